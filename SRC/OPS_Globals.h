@@ -44,6 +44,21 @@ extern OPS_Stream *opserrPtr;
 #include <string.h>
 #include <stdlib.h>
 
+// storage class for scratch space that must not be shared between threads,
+// e.g. the work areas of the Matrix class and the static matrices and vectors
+// used by the elements during state determination. without compiler support
+// it falls back to ordinary static storage; OPS_HAVE_THREAD_LOCAL is then not
+// defined and the element state determination must run in a single thread.
+#if defined(_MSC_VER) && (_MSC_VER >= 1900)
+#define OPS_THREAD_LOCAL thread_local
+#define OPS_HAVE_THREAD_LOCAL
+#elif defined(__cplusplus) && (__cplusplus >= 201103L)
+#define OPS_THREAD_LOCAL thread_local
+#define OPS_HAVE_THREAD_LOCAL
+#else
+#define OPS_THREAD_LOCAL
+#endif
+
 // #define _USING_STL_STREAMS
 // #include <iostream>
 // using std::cerr;
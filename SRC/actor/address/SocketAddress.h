@@ -55,6 +55,7 @@ class SocketAddress: public ChannelAddress
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class TCP_SocketBuffered;
 };
 
 
@@ -67,3 +67,9 @@ Channel::getTag(void)
 {
 		return tag;
 }
+
+int
+Channel::flush(void)
+{
+  return 0;
+}
@@ -63,6 +63,9 @@ class Channel
     virtual int isDatastore(void);
     virtual int getDbTag(void);
     int getTag(void);
+
+    // method to write out anything a channel has buffered
+    virtual int flush(void);
     
     // methods to send/receive messages and objects on channels.
     virtual int sendObj(int commitTag,
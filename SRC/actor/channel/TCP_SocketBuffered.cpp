@@ -0,0 +1,758 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/TCP_SocketBuffered.cpp,v $
+                                                                        
+                                                                        
+// File: ~/actor/channel/TCP_SocketBuffered.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Purpose: This file contains the implementation of the methods needed
+// to define the TCP_SocketBuffered class interface.
+//
+// What: "@(#) TCP_SocketBuffered.cpp, revA"
+
+#include "TCP_SocketBuffered.h"
+#include <string.h>
+#include <errno.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <ChannelAddress.h>
+#include <MovableObject.h>
+#include <SocketAddress.h>
+
+// types of the entries in the stream
+#define TCP_BUFFERED_MSG     1
+#define TCP_BUFFERED_MATRIX  2
+#define TCP_BUFFERED_VECTOR  3
+#define TCP_BUFFERED_ID      4
+
+// each entry is preceded by its type and number of components
+static const int entryHeaderSize = 2*sizeof(int);
+
+static int GetHostAddr(char *host, char *IntAddr);
+static void inttoa(unsigned int no, char *string, int *cnt);
+
+
+// TCP_SocketBuffered(): 
+// 	constructor to open a socket with my inet_addr and with a port number 
+//	given by the OS. 
+TCP_SocketBuffered::TCP_SocketBuffered()
+    : myPort(0), connectType(0), flushSize(65536),
+    sendBuffer(0), sendSize(0), sendCapacity(0),
+    pendBuffer(0), pendSize(0), pendSent(0), pendCapacity(0)
+{
+    // initialize sockets
+    startup_sockets();
+
+    // set up my_Addr 
+    bzero((char *) &my_Addr, sizeof(my_Addr));    
+    my_Addr.addr_in.sin_family = AF_INET;
+    my_Addr.addr_in.sin_port = htons(0);
+
+#ifdef _WIN32
+    my_Addr.addr_in.sin_addr.S_un.S_addr = htonl(INADDR_ANY);
+#else
+    my_Addr.addr_in.sin_addr.s_addr = htonl(INADDR_ANY);
+#endif
+
+    // open a socket
+    if ((sockfd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        opserr << "TCP_SocketBuffered::TCP_SocketBuffered() - could not open socket\n";
+    }
+
+    // bind local address to it
+    if (bind(sockfd, &my_Addr.addr, sizeof(my_Addr.addr)) < 0) {
+        opserr << "TCP_SocketBuffered::TCP_SocketBuffered() - could not bind local address\n";
+    }
+
+    // get my_address info
+    addrLength = sizeof(my_Addr.addr);
+    myPort = ntohs(my_Addr.addr_in.sin_port);
+}    
+
+
+// TCP_SocketBuffered(unsigned int port): 
+//	constructor to open a socket with my inet_addr and with a port number port.
+TCP_SocketBuffered::TCP_SocketBuffered(unsigned int port, int flushsize) 
+    : myPort(0), connectType(0), flushSize(flushsize),
+    sendBuffer(0), sendSize(0), sendCapacity(0),
+    pendBuffer(0), pendSize(0), pendSent(0), pendCapacity(0)
+{
+    // initialize sockets
+    startup_sockets();
+
+    // set up my_Addr 
+    bzero((char *) &my_Addr, sizeof(my_Addr));
+    my_Addr.addr_in.sin_family = AF_INET;
+    my_Addr.addr_in.sin_port = htons(port);
+
+#ifdef _WIN32
+    my_Addr.addr_in.sin_addr.S_un.S_addr = htonl(INADDR_ANY);
+#else
+    my_Addr.addr_in.sin_addr.s_addr = htonl(INADDR_ANY);
+#endif
+
+    // open a socket
+    if ((sockfd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        opserr << "TCP_SocketBuffered::TCP_SocketBuffered() - could not open socket\n";
+    }
+
+    // bind local address to it
+    if (bind(sockfd, &my_Addr.addr, sizeof(my_Addr.addr)) < 0) {
+        opserr << "TCP_SocketBuffered::TCP_SocketBuffered() - could not bind local address\n";
+    }    
+
+    // get my_address info
+    addrLength = sizeof(my_Addr.addr);
+    myPort = ntohs(my_Addr.addr_in.sin_port);
+}
+
+
+// TCP_SocketBuffered(unsigned int other_Port, char *other_InetAddr): 
+// 	constructor to open a socket with my inet_addr and with a port number 
+//	given by the OS. Then to connect with a TCP_SocketBuffered whose address
+//	is given by other_Port and other_InetAddr. 
+TCP_SocketBuffered::TCP_SocketBuffered(unsigned int other_Port,
+    const char *other_InetAddr, int flushsize)
+    : myPort(0), connectType(1), flushSize(flushsize),
+    sendBuffer(0), sendSize(0), sendCapacity(0),
+    pendBuffer(0), pendSize(0), pendSent(0), pendCapacity(0)
+{
+    // initialize sockets
+    startup_sockets();
+
+    // set up remote address
+    bzero((char *) &other_Addr, sizeof(other_Addr));
+    other_Addr.addr_in.sin_family = AF_INET;
+    other_Addr.addr_in.sin_port = htons(other_Port);
+
+#ifdef _WIN32
+    other_Addr.addr_in.sin_addr.S_un.S_addr = inet_addr(other_InetAddr);
+#else
+    other_Addr.addr_in.sin_addr.s_addr = inet_addr(other_InetAddr);
+#endif
+
+    // set up my_Addr.addr_in 
+    bzero((char *) &my_Addr, sizeof(my_Addr));    
+    my_Addr.addr_in.sin_family = AF_INET;
+    my_Addr.addr_in.sin_port = htons(0);
+
+#ifdef _WIN32
+    my_Addr.addr_in.sin_addr.S_un.S_addr = htonl(INADDR_ANY);
+#else
+    my_Addr.addr_in.sin_addr.s_addr = htonl(INADDR_ANY);
+#endif
+
+    // open a socket
+    if ((sockfd = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+        opserr << "TCP_SocketBuffered::TCP_SocketBuffered() - could not open socket\n";
+    }
+
+    // bind local address to it
+    if (bind(sockfd, &my_Addr.addr, sizeof(my_Addr.addr)) < 0) {
+        opserr << "TCP_SocketBuffered::TCP_SocketBuffered() - could not bind local address\n";
+    }
+
+    addrLength = sizeof(my_Addr.addr);
+    getsockname(sockfd, &my_Addr.addr, &addrLength);
+    myPort = ntohs(my_Addr.addr_in.sin_port);    
+}
+
+
+// ~TCP_SocketBuffered():
+//	destructor, writes out anything still buffered before closing
+TCP_SocketBuffered::~TCP_SocketBuffered()
+{
+    this->flush();
+    this->progressSend(true);
+
+#ifdef _WIN32
+    closesocket(sockfd);
+#else
+    close(sockfd);
+#endif
+
+    // cleanup sockets
+    cleanup_sockets();
+
+    if (sendBuffer != 0)
+        delete [] sendBuffer;
+    if (pendBuffer != 0)
+        delete [] pendBuffer;
+}
+
+
+int 
+TCP_SocketBuffered::setUpConnection()
+{
+    // the channel does its own aggregation, so there is no point in 
+    // also having the socket hold back small segments
+    int noDelay = 1;
+
+    if (connectType == 1) {
+        
+        // now try to connect to socket with remote address.
+        if (connect(sockfd, &other_Addr.addr, sizeof(other_Addr.addr))< 0) {
+            opserr << "TCP_SocketBuffered::setUpConnection() - could not connect\n";
+            return -1;
+        }
+        
+    } else {
+
+        // wait for other process to contact me & set up connection
+        socket_type newsockfd;
+        listen(sockfd, 1);    
+        newsockfd = accept(sockfd, &other_Addr.addr, &addrLength);
+        if (newsockfd < 0) {
+            opserr << "TCP_SocketBuffered::setUpConnection() - could not accept connection\n";
+            return -1;
+        }
+
+        // close old socket & reset sockfd
+#ifdef _WIN32
+        closesocket(sockfd);
+#else
+        close(sockfd);
+#endif
+        sockfd = newsockfd;
+    }    
+
+    // get my_address info
+    getsockname(sockfd, &my_Addr.addr, &addrLength);
+
+    // set TCP_NODELAY option
+    if ((setsockopt(sockfd, IPPROTO_TCP, TCP_NODELAY, 
+        (char *) &noDelay, sizeof(int))) < 0) { 
+            opserr << "TCP_SocketBuffered::setUpConnection() - "
+                << "could not set TCP_NODELAY option\n";
+    }
+    
+    return 0;
+}    
+
+
+int
+TCP_SocketBuffered::setNextAddress(const ChannelAddress &theAddress)
+{	
+    return this->checkAddress("setNextAddress", (ChannelAddress *)&theAddress);
+}
+
+
+int 
+TCP_SocketBuffered::sendObj(int commitTag,
+    MovableObject &theObject, ChannelAddress *theAddress) 
+{
+    if (this->checkAddress("sendObj", theAddress) != 0)
+        return -1;
+
+    return theObject.sendSelf(commitTag, *this);
+}
+
+
+int 
+TCP_SocketBuffered::recvObj(int commitTag,
+    MovableObject &theObject, FEM_ObjectBroker &theBroker, 
+    ChannelAddress *theAddress)
+{
+    if (this->checkAddress("recvObj", theAddress) != 0)
+        return -1;
+
+    return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int 
+TCP_SocketBuffered::recvMsg(int dbTag, int commitTag,
+    Message &msg, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("recvMsg", theAddress) != 0)
+        return -1;
+
+    return this->recvEntry(TCP_BUFFERED_MSG, msg.data, msg.length, msg.length);
+}
+
+
+int 
+TCP_SocketBuffered::recvMsgUnknownSize(int dbTag, int commitTag,
+    Message &msg, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("recvMsgUnknownSize", theAddress) != 0)
+        return -1;
+
+    // the header gives the size; the message must be large enough for it
+    int length;
+    if (this->recvHeader(TCP_BUFFERED_MSG, length) != 0)
+        return -1;
+
+    if (length > msg.length) {
+        opserr << "TCP_SocketBuffered::recvMsgUnknownSize() - message of "
+            << length << " bytes does not fit in " << msg.length << " bytes\n";
+        return -1;
+    }
+
+    if (this->readAll(msg.data, length) != 0)
+        return -1;
+
+    if (length < msg.length)
+        msg.data[length] = '\0';
+
+    return 0;
+}
+
+
+int 
+TCP_SocketBuffered::sendMsg(int dbTag, int commitTag,
+    const Message &msg, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("sendMsg", theAddress) != 0)
+        return -1;
+
+    return this->addEntry(TCP_BUFFERED_MSG, msg.data, msg.length, msg.length);
+}
+
+
+int 
+TCP_SocketBuffered::recvMatrix(int dbTag, int commitTag,
+    Matrix &theMatrix, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("recvMatrix", theAddress) != 0)
+        return -1;
+
+    return this->recvEntry(TCP_BUFFERED_MATRIX, (char *)theMatrix.data,
+        theMatrix.dataSize, theMatrix.dataSize*sizeof(double));
+}
+
+
+int 
+TCP_SocketBuffered::sendMatrix(int dbTag, int commitTag,
+    const Matrix &theMatrix, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("sendMatrix", theAddress) != 0)
+        return -1;
+
+    return this->addEntry(TCP_BUFFERED_MATRIX, (char *)theMatrix.data,
+        theMatrix.dataSize, theMatrix.dataSize*sizeof(double));
+}
+
+
+int 
+TCP_SocketBuffered::recvVector(int dbTag, int commitTag,
+    Vector &theVector, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("recvVector", theAddress) != 0)
+        return -1;
+
+    return this->recvEntry(TCP_BUFFERED_VECTOR, (char *)theVector.theData,
+        theVector.sz, theVector.sz*sizeof(double));
+}
+
+
+int 
+TCP_SocketBuffered::sendVector(int dbTag, int commitTag,
+    const Vector &theVector, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("sendVector", theAddress) != 0)
+        return -1;
+
+    return this->addEntry(TCP_BUFFERED_VECTOR, (char *)theVector.theData,
+        theVector.sz, theVector.sz*sizeof(double));
+}
+
+
+int 
+TCP_SocketBuffered::recvID(int dbTag, int commitTag,
+    ID &theID, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("recvID", theAddress) != 0)
+        return -1;
+
+    return this->recvEntry(TCP_BUFFERED_ID, (char *)theID.data,
+        theID.sz, theID.sz*sizeof(int));
+}
+
+
+int 
+TCP_SocketBuffered::sendID(int dbTag, int commitTag,
+    const ID &theID, ChannelAddress *theAddress)
+{	
+    if (this->checkAddress("sendID", theAddress) != 0)
+        return -1;
+
+    return this->addEntry(TCP_BUFFERED_ID, (char *)theID.data,
+        theID.sz, theID.sz*sizeof(int));
+}
+
+
+// int flush():
+//	Method to hand the buffered entries to the socket. Returns without
+//	waiting for the socket to accept all of them.
+int
+TCP_SocketBuffered::flush(void)
+{
+    if (sendSize == 0)
+        return 0;
+
+    // the previous buffer must be written before it can be reused
+    if (this->progressSend(true) != 0)
+        return -1;
+
+    char *tmpBuffer = pendBuffer;
+    int tmpCapacity = pendCapacity;
+    pendBuffer = sendBuffer;
+    pendCapacity = sendCapacity;
+    pendSize = sendSize;
+    pendSent = 0;
+    sendBuffer = tmpBuffer;
+    sendCapacity = tmpCapacity;
+    sendSize = 0;
+
+    return this->progressSend(false);
+}
+
+
+int
+TCP_SocketBuffered::setFlushSize(int numBytes)
+{
+    if (numBytes < 0) {
+        opserr << "TCP_SocketBuffered::setFlushSize() - size must be positive\n";
+        return -1;
+    }
+
+    flushSize = numBytes;
+    if (sendSize >= flushSize)
+        return this->flush();
+
+    return 0;
+}
+
+
+unsigned int 
+TCP_SocketBuffered::getPortNumber() const
+{
+    return myPort;
+}
+
+
+unsigned int 
+TCP_SocketBuffered::getBytesAvailable()
+{
+    unsigned long bytesAvailable;
+
+#ifdef _WIN32
+    ioctlsocket(sockfd,FIONREAD,&bytesAvailable);
+#else
+    ioctl(sockfd,FIONREAD,&bytesAvailable);
+#endif
+
+    return bytesAvailable;
+}
+
+
+char *
+TCP_SocketBuffered::addToProgram()
+{
+    // channel type 4 makes the actor program create a TCP_SocketBuffered
+    const char *tcp = " 4 ";
+
+    char  my_InetAddr[MAX_INET_ADDR];
+    char  myPortNum[8];
+    char  me[30];
+    unsigned int thePort = this->getPortNumber();
+
+    int start = 0;
+    inttoa(thePort,myPortNum,&start);
+    gethostname(me,MAX_INET_ADDR);
+    GetHostAddr(me,my_InetAddr);
+
+    char *newStuff =(char *)malloc(100*sizeof(char));
+    for (int i=0; i<100; i++) 
+        newStuff[i] = ' ';
+
+    strcpy(newStuff,tcp);
+    strcat(newStuff," ");          
+    strcat(newStuff,my_InetAddr);
+    strcat(newStuff," ");
+    strcat(newStuff,myPortNum);
+    strcat(newStuff," ");    
+
+    return newStuff;
+}
+
+
+// int checkAddress():
+//	Method to check the address is the only one a TCP_SocketBuffered can
+//	send to; a null address is always o.k.
+int
+TCP_SocketBuffered::checkAddress(const char *method, ChannelAddress *theAddress)
+{
+    if (theAddress == 0)
+        return 0;
+
+    if (theAddress->getType() != SOCKET_TYPE) {
+        opserr << "TCP_SocketBuffered::" << method << "() - a TCP_SocketBuffered ";
+        opserr << "can only communicate with a TCP_SocketBuffered";
+        opserr << " address given is not of type SocketAddress\n"; 
+        return -1;	    
+    }
+
+    SocketAddress *theSocketAddress = (SocketAddress *)theAddress;
+    if (bcmp((char *) &other_Addr.addr_in, (char *) &theSocketAddress->address.addr_in, 
+        theSocketAddress->addrLength) != 0) {
+
+            opserr << "TCP_SocketBuffered::" << method << "() - a TCP_SocketBuffered ";
+            opserr << "can only communicate with one other TCP_SocketBuffered\n"; 
+            return -1;
+    }
+
+    return 0;
+}
+
+
+// int addEntry():
+//	Method to append an entry to the send buffer. Entries larger than
+//	flushSize are written straight from the storage of the object, after
+//	anything buffered before them.
+int
+TCP_SocketBuffered::addEntry(int type, const char *data, int count, int numBytes)
+{
+    int header[2];
+    header[0] = type;
+    header[1] = count;
+
+    if (numBytes > flushSize) {
+        if (this->flush() != 0 || this->progressSend(true) != 0)
+            return -1;
+        if (this->writeAll((char *)header, entryHeaderSize) != 0)
+            return -1;
+        return this->writeAll(data, numBytes);
+    }
+
+    // keep the socket busy with any earlier buffer while this one fills
+    if (pendSent < pendSize && this->progressSend(false) != 0)
+        return -1;
+
+    int newSize = sendSize + entryHeaderSize + numBytes;
+    if (newSize > sendCapacity) {
+        int newCapacity = 2*sendCapacity;
+        if (newCapacity < newSize)
+            newCapacity = newSize;
+
+        char *newBuffer = new char[newCapacity];
+        if (newBuffer == 0) {
+            opserr << "TCP_SocketBuffered::addEntry() - out of memory\n";
+            return -1;
+        }
+        if (sendSize != 0)
+            memcpy(newBuffer, sendBuffer, sendSize);
+        if (sendBuffer != 0)
+            delete [] sendBuffer;
+
+        sendBuffer = newBuffer;
+        sendCapacity = newCapacity;
+    }
+
+    memcpy(&sendBuffer[sendSize], header, entryHeaderSize);
+    if (numBytes != 0)
+        memcpy(&sendBuffer[sendSize+entryHeaderSize], data, numBytes);
+    sendSize = newSize;
+
+    if (sendSize >= flushSize)
+        return this->flush();
+
+    return 0;
+}
+
+
+// int recvHeader():
+//	Method to read the header of the next entry, checking it is of the 
+//	type expected. Everything buffered is written first, as the entry
+//	may be the reply to it.
+int
+TCP_SocketBuffered::recvHeader(int type, int &count)
+{
+    if (this->flush() != 0 || this->progressSend(true) != 0)
+        return -1;
+
+    int header[2];
+    if (this->readAll((char *)header, entryHeaderSize) != 0)
+        return -1;
+
+    if (header[0] != type) {
+        opserr << "TCP_SocketBuffered::recvHeader() - expected entry of type "
+            << type << " but received type " << header[0] << endln;
+        return -1;
+    }
+
+    count = header[1];
+    return 0;
+}
+
+
+// int recvEntry():
+//	Method to receive the next entry directly into the storage given.
+int
+TCP_SocketBuffered::recvEntry(int type, char *data, int count, int numBytes)
+{
+    int sentCount;
+    if (this->recvHeader(type, sentCount) != 0)
+        return -1;
+
+    if (sentCount != count) {
+        opserr << "TCP_SocketBuffered::recvEntry() - size " << sentCount
+            << " of entry received does not match size " << count 
+            << " of object\n";
+        return -1;
+    }
+
+    return this->readAll(data, numBytes);
+}
+
+
+// int progressSend():
+//	Method to write the flushed buffer to the socket. If block is false
+//	it returns as soon as the socket will not accept any more. Winsock
+//	has no MSG_DONTWAIT, so there the socket is put in non-blocking mode
+//	for the duration of the call; on other platforms without it the
+//	write blocks.
+int
+TCP_SocketBuffered::progressSend(bool block)
+{
+    int flags = 0;
+#ifdef _WIN32
+    u_long nonBlocking = (block == false) ? 1 : 0;
+    if (nonBlocking == 1)
+        ioctlsocket(sockfd, FIONBIO, &nonBlocking);
+#elif defined(MSG_DONTWAIT)
+    if (block == false)
+        flags = MSG_DONTWAIT;
+#endif
+
+    int res = 0;
+    while (pendSent < pendSize) {
+        int nwrite = send(sockfd, &pendBuffer[pendSent], pendSize-pendSent, flags);
+        if (nwrite < 0) {
+#ifdef _WIN32
+            if (block == false && WSAGetLastError() == WSAEWOULDBLOCK)
+                break;
+#else
+            if (block == false && (errno == EAGAIN || errno == EWOULDBLOCK))
+                break;
+            if (errno == EINTR)
+                continue;
+#endif
+            opserr << "TCP_SocketBuffered::progressSend() - could not write to socket\n";
+            res = -1;
+            break;
+        }
+        pendSent += nwrite;
+    }
+
+#ifdef _WIN32
+    if (nonBlocking == 1) {
+        nonBlocking = 0;
+        ioctlsocket(sockfd, FIONBIO, &nonBlocking);
+    }
+#endif
+
+    if (res == 0 && pendSent == pendSize) {
+        pendSize = 0;
+        pendSent = 0;
+    }
+
+    return res;
+}
+
+
+int
+TCP_SocketBuffered::writeAll(const char *data, int numBytes)
+{
+    while (numBytes > 0) {
+        int nwrite = send(sockfd, data, numBytes, 0);
+        if (nwrite < 0) {
+#ifndef _WIN32
+            if (errno == EINTR)
+                continue;
+#endif
+            opserr << "TCP_SocketBuffered::writeAll() - could not write to socket\n";
+            return -1;
+        }
+        numBytes -= nwrite;
+        data += nwrite;
+    }
+
+    return 0;
+}
+
+
+int
+TCP_SocketBuffered::readAll(char *data, int numBytes)
+{
+    while (numBytes > 0) {
+        int nread = recv(sockfd, data, numBytes, 0);
+        if (nread <= 0) {
+#ifndef _WIN32
+            if (nread < 0 && errno == EINTR)
+                continue;
+#endif
+            opserr << "TCP_SocketBuffered::readAll() - could not read from socket\n";
+            return -1;
+        }
+        numBytes -= nread;
+        data += nread;
+    }
+
+    return 0;
+}
+
+
+static int
+GetHostAddr(char *host, char *IntAddr)
+{
+    struct hostent *hostptr;
+
+    if ( (hostptr = gethostbyname(host)) == NULL) 
+        return (-1);
+
+    switch(hostptr->h_addrtype) {
+      case AF_INET:
+          strcpy(IntAddr,inet_ntoa(*(struct in_addr *)*hostptr->h_addr_list));
+          return (0);
+
+      default:
+          return (-2);
+    }
+}
+
+
+static void
+inttoa(unsigned int no, char *string, int *cnt) {
+    if (no /10) {
+        inttoa(no/10, string, cnt);
+        *cnt = *cnt+1;
+    }
+    string[*cnt] = no % 10 + '0';
+}
@@ -0,0 +1,161 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/TCP_SocketBuffered.h,v $
+                                                                        
+                                                                        
+// File: ~/actor/channel/TCP_SocketBuffered.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Purpose: This file contains the class definition for TCP_SocketBuffered.
+// TCP_SocketBuffered is a sub-class of channel that, like TCP_Socket, uses
+// a TCP stream socket but does not write each Vector, ID, Matrix or 
+// Message to the socket as it is sent. Instead each is appended, preceded
+// by a small header giving its type and size, to a send buffer which is
+// written in one piece when flush() is invoked, when a receive is
+// requested or when the buffer grows beyond flushSize. The write of the
+// buffer is non-blocking (on Windows by switching the socket to FIONBIO);
+// any part the socket cannot accept immediately is written the next time
+// the channel is used, so the sender can go on computing while the data
+// is in transit. On the receiving side the header of each entry is read
+// and checked against the object being received and the data then read
+// from the socket directly into the storage of that object. Both ends of the connection must be TCP_SocketBuffered objects.
+//
+// What: "@(#) TCP_SocketBuffered.h, revA"
+
+#ifndef TCP_SocketBuffered_h
+#define TCP_SocketBuffered_h
+
+#include <bool.h>
+#include <Socket.h>
+#include <Channel.h>
+
+class TCP_SocketBuffered : public Channel
+{
+  public:
+    TCP_SocketBuffered();        
+    TCP_SocketBuffered(unsigned int port, int flushSize = 65536);    
+    TCP_SocketBuffered(unsigned int other_Port, const char *other_InetAddr,
+        int flushSize = 65536);
+    ~TCP_SocketBuffered();
+
+    char *addToProgram();
+    
+    virtual int setUpConnection();
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    virtual ChannelAddress *getLastSendersAddress(){ return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+		
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+    
+    int sendnDarray(int dbTag, int commitTag,
+           const nDarray &theNDarray,
+           ChannelAddress *theAddress =0) {return 0;};
+    int recvnDarray(int dbTag, int commitTag,
+           nDarray &theNDarray,			
+           ChannelAddress *theAddress =0) {return 0;};
+
+    // methods to control the send buffer
+    int flush(void);
+    int setFlushSize(int numBytes);
+
+  protected:
+    unsigned int getPortNumber() const;
+    unsigned int getBytesAvailable();
+    
+  private:
+    int checkAddress(const char *method, ChannelAddress *theAddress);
+    int addEntry(int type, const char *data, int count, int numBytes);
+    int recvEntry(int type, char *data, int count, int numBytes);
+    int recvHeader(int type, int &count);
+    int progressSend(bool block);
+    int writeAll(const char *data, int numBytes);
+    int readAll(char *data, int numBytes);
+
+    socket_type sockfd;
+
+    union {
+      struct sockaddr    addr;
+      struct sockaddr_in addr_in;
+    } my_Addr;
+    union {
+      struct sockaddr    addr;
+      struct sockaddr_in addr_in;
+    } other_Addr;
+
+    socklen_type addrLength;
+
+    unsigned int myPort;
+    int connectType;
+
+    int flushSize;          // size at which the send buffer is flushed
+
+    char *sendBuffer;       // entries not yet flushed
+    int sendSize;
+    int sendCapacity;
+
+    char *pendBuffer;       // flushed entries not yet accepted by the socket
+    int pendSize;
+    int pendSent;
+    int pendCapacity;
+};
+
+#endif
@@ -51,6 +51,7 @@ class Message
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class TCP_SocketBuffered;
     friend class MPI_Channel;
     
   private:
@@ -351,6 +351,7 @@
 #include <PenaltyConstraintHandler.h>
 #include <LagrangeConstraintHandler.h>
 #include <TransformationConstraintHandler.h>
+#include <SparseTransformationConstraintHandler.h>
 
 // dof numberer header files
 #include <DOF_Numberer.h>   
@@ -367,6 +368,7 @@
 #include <NewtonLineSearch.h>
 #include <KrylovNewton.h>
 #include <AcceleratedNewton.h>
+#include <AdaptiveNewton.h>
 #include <ModifiedNewton.h>
 
 #include <KrylovAccelerator.h>
@@ -1727,6 +1729,9 @@ FEM_ObjectBrokerAllClasses::getNewConstraintHandler(int classTag)
 
 	case HANDLER_TAG_TransformationConstraintHandler:  
 	     return new TransformationConstraintHandler();
+
+	case HANDLER_TAG_SparseTransformationConstraintHandler:  
+	     return new SparseTransformationConstraintHandler();
 	     
 	default:
 	     opserr << "FEM_ObjectBrokerAllClasses::getNewConstraintHandler - ";
@@ -1801,6 +1806,9 @@ FEM_ObjectBrokerAllClasses::getNewEquiSolnAlgo(int classTag)
 
 	case EquiALGORITHM_TAGS_AcceleratedNewton:  
 	     return new AcceleratedNewton();
+
+	case EquiALGORITHM_TAGS_AdaptiveNewton:  
+	     return new AdaptiveNewton();
 	     
 	case EquiALGORITHM_TAGS_ModifiedNewton:  
 	     return new ModifiedNewton();
@@ -160,6 +160,13 @@ Shadow::recvID(ID &theID)
 }
 
 
+int
+Shadow::flush(void)
+{
+    return theChannel->flush();
+}
+
+
 void
 Shadow::setCommitTag(int tag)
 {
@@ -75,6 +75,7 @@ class Shadow
     virtual int recvVector(Vector &theVector);      
     virtual int sendID(const ID &theID);  
     virtual int recvID(ID &theID);      
+    virtual int flush(void);
     void setCommitTag(int commitTag);
 
     Channel 		  *getChannelPtr(void) const;
@@ -208,7 +208,7 @@ AcceleratedNewton::solveCurrentStep(void)
     numIterations++;
 
     // Check convergence criteria
-    result = theTest->test();
+    result = theTest->runTest();
 
     if (result == -1) {
       // Let the accelerator update the tangent if needed
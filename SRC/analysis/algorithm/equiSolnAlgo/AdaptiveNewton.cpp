@@ -0,0 +1,392 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.cpp,v $
+                                                                        
+                                                                        
+// File: ~/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of AdaptiveNewton.
+//
+// What: "@(#) AdaptiveNewton.cpp, revA"
+
+#include <AdaptiveNewton.h>
+#include <KrylovAccelerator.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <ID.h>
+#include <Timer.h>
+#include <math.h>
+
+// the cost of a new tangent relative to an iteration before any is measured
+#define ADAPTIVE_NEWTON_COST_RATIO 10.0
+
+// the weight of a new measurement in the running averages
+#define ADAPTIVE_NEWTON_WEIGHT 0.3
+
+// Constructor
+AdaptiveNewton::AdaptiveNewton(int theTangentToUse)
+  :EquiSolnAlgo(EquiALGORITHM_TAGS_AdaptiveNewton),
+   tangent(theTangentToUse), maxDim(3), maxRatio(0.9), krylovRatio(0.1),
+   theAccelerator(0), vAccel(0),
+   haveTangent(false), krylovMode(false), krylovDim(0), 
+   rhoKeep(0.5), rhoKrylov(0.5), rhoNewton(0.1),
+   costKeep(0.0), costRefactor(0.0),
+   numSteps(0), numFactorizations(0), numIterations(0), numKrylov(0),
+   data(7)
+{
+
+}
+
+AdaptiveNewton::AdaptiveNewton(ConvergenceTest &theT, int dim,
+			       double maxR, double krylovR,
+			       int theTangentToUse)
+  :EquiSolnAlgo(EquiALGORITHM_TAGS_AdaptiveNewton),
+   tangent(theTangentToUse), maxDim(dim), maxRatio(maxR), krylovRatio(krylovR),
+   theAccelerator(0), vAccel(0),
+   haveTangent(false), krylovMode(false), krylovDim(0), 
+   rhoKeep(0.5), rhoKrylov(0.5), rhoNewton(0.1),
+   costKeep(0.0), costRefactor(0.0),
+   numSteps(0), numFactorizations(0), numIterations(0), numKrylov(0),
+   data(7)
+{
+  theTest = &theT;
+}
+
+// Destructor
+AdaptiveNewton::~AdaptiveNewton()
+{
+  if (theAccelerator != 0)
+    delete theAccelerator;
+
+  if (vAccel != 0)
+    delete vAccel;
+}
+
+void 
+AdaptiveNewton::setLinks(AnalysisModel &theModel, 
+			 IncrementalIntegrator &theIntegrator,
+			 LinearSOE &theSOE,
+			 ConvergenceTest *theConvergenceTest)
+{
+  this->EquiSolnAlgo::setLinks(theModel, theIntegrator, theSOE, theConvergenceTest);
+  haveTangent = false;
+  krylovMode = false;
+}
+
+int
+AdaptiveNewton::domainChanged(void)
+{
+  // the system has been resized, there is no factorization to keep
+  haveTangent = false;
+  krylovMode = false;
+  return 0;
+}
+
+int 
+AdaptiveNewton::solveCurrentStep(void)
+{
+  // set up some pointers and check they are valid
+  AnalysisModel *theAnaModel = this->getAnalysisModelPtr();
+  IncrementalIntegrator *theIntegrator = this->getIncrementalIntegratorPtr();
+  LinearSOE *theSOE = this->getLinearSOEptr();
+  
+  if ((theAnaModel == 0) || (theIntegrator == 0) || (theSOE == 0)
+      || (theTest == 0)){
+    opserr << "WARNING AdaptiveNewton::solveCurrentStep() - setLinks() has";
+    opserr << " not been called - or no ConvergenceTest has been set\n";
+    return -5;
+  }	
+
+  if (theAccelerator == 0)
+    theAccelerator = new KrylovAccelerator(maxDim, NO_TANGENT);
+
+  int numEqns = theSOE->getNumEqn();
+  if (vAccel == 0 || vAccel->Size() != numEqns) {
+    if (vAccel != 0)
+      delete vAccel;
+    vAccel = new Vector(numEqns);
+    haveTangent = false;
+    krylovMode = false;
+  }
+
+  if (theAccelerator == 0 || vAccel == 0) {
+    opserr << "WARNING AdaptiveNewton::solveCurrentStep() - ";
+    opserr << " could not allocate the accelerator\n";
+    return -6;
+  }
+
+  numSteps++;
+
+  if (theIntegrator->formUnbalance() < 0) {
+    opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+    opserr << "the Integrator failed in formUnbalance()\n";	
+    return -2;
+  }
+
+  // set itself as the ConvergenceTest objects EquiSolnAlgo
+  theTest->setEquiSolnAlgo(*this);
+  if (theTest->start() < 0) {
+    opserr << "AdaptiveNewton::solveCurrentStep() -";
+    opserr << "the ConvergenceTest object failed in start()\n";
+    return -3;
+  }
+
+  // the subspace of the last step is not valid for the new increment
+  if (krylovMode == true) {
+    theAccelerator->newStep(*theSOE);
+    krylovDim = 0;
+  }
+
+  // the first iteration may use the factorization of the last step
+  int decision = this->decide();
+
+  int result = -1;
+  int count = 0;
+  do {
+
+    double tStart = Timer::getWallTime();
+
+    if (decision == ADAPTIVE_NEWTON_REFACTOR) {
+      if (theIntegrator->formTangent(tangent) < 0) {
+	opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formTangent()\n";
+	haveTangent = false;
+	return -1;
+      }
+      numFactorizations++;
+      haveTangent = true;
+      krylovMode = false;
+    }
+
+    // the subspace is started when the accelerator is first used on the
+    // factorization and is then kept until a new tangent is formed
+    if (decision == ADAPTIVE_NEWTON_KRYLOV && krylovMode == false) {
+      theAccelerator->newStep(*theSOE);
+      krylovMode = true;
+      krylovDim = 0;
+      rhoKrylov = rhoKeep;
+    }
+
+    if (theSOE->solve() < 0) {
+      opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+      opserr << "the LinearSysOfEqn failed in solve()\n";	
+      haveTangent = false;
+      return -3;
+    }
+
+    *vAccel = theSOE->getX();
+
+    // an empty subspace leaves the increment unchanged
+    bool accelerated = false;
+    if (decision == ADAPTIVE_NEWTON_KRYLOV) {
+      accelerated = (krylovDim > 0);
+      if (theAccelerator->accelerate(*vAccel, *theSOE, *theIntegrator) < 0) {
+	opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+	opserr << "the Accelerator failed in accelerate()\n";
+	return -1;
+      }
+      if (accelerated == true)
+	numKrylov++;
+      krylovDim++;
+
+      // a full subspace is restarted
+      if (theAccelerator->updateTangent() == true)
+	krylovDim = 0;
+    }
+
+    if (theIntegrator->update(*vAccel) < 0) {
+      opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+      opserr << "the Integrator failed in update()\n";	
+      return -4;
+    }	
+
+    if (theIntegrator->formUnbalance() < 0) {
+      opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+      opserr << "the Integrator failed in formUnbalance()\n";	
+      return -2;
+    }
+
+    result = theTest->runTest();
+    numIterations++;
+
+    double cost = Timer::getWallTime() - tStart;
+
+    // the contraction ratio of the last two norms of the test
+    const Vector &norms = theTest->getNorms();
+    double norm = 0.0;
+    double rho = -1.0;
+    if (count < norms.Size())
+      norm = norms(count);
+    if (count > 0 && count < norms.Size() && norms(count-1) > 0.0)
+      rho = norm/norms(count-1);
+
+    if (decision == ADAPTIVE_NEWTON_REFACTOR) {
+      if (costRefactor == 0.0)
+	costRefactor = cost;
+      else
+	costRefactor += ADAPTIVE_NEWTON_WEIGHT*(cost - costRefactor);
+      if (rho >= 0.0) {
+	rhoNewton += ADAPTIVE_NEWTON_WEIGHT*(rho - rhoNewton);
+	rhoKeep = rho;
+      }
+    } else {
+      if (costKeep == 0.0)
+	costKeep = cost;
+      else
+	costKeep += ADAPTIVE_NEWTON_WEIGHT*(cost - costKeep);
+      if (rho >= 0.0) {
+	if (accelerated == true)
+	  rhoKrylov = rho;
+	else
+	  rhoKeep = rho;
+      }
+    }
+
+    data(0) = numSteps;
+    data(1) = count+1;
+    data(2) = decision;
+    data(3) = norm;
+    data(4) = rho;
+    data(5) = costKeep;
+    data(6) = costRefactor;
+
+    this->record(count++);
+
+    if (result == -1)
+      decision = this->decide();
+
+  } while (result == -1);
+
+  if (result == -2) {
+    // do not start the next attempt on this factorization
+    rhoKeep = 1.0;
+    rhoKrylov = 1.0;
+    opserr << "AdaptiveNewton::solveCurrentStep() -";
+    opserr << "the ConvergenceTest object failed in test()\n";
+    return -3;
+  }
+
+  // note - if postive result we are returning what the convergence
+  // test returned which should be the number of iterations
+  return result;
+}
+
+// int decide():
+//	an iteration with a new tangent is expected to reduce the norm by 
+//	rhoNewton at a cost of costRefactor, one on the kept factorization by 
+//	rhoKeep at a cost of costKeep; the new tangent is formed if it gives 
+//	the larger reduction per unit time. On the kept factorization the
+//	accelerator is used unless the contraction is already fast; once used
+//	it is kept, with rhoKrylov in place of rhoKeep, until a new tangent.
+int
+AdaptiveNewton::decide(void)
+{
+  if (haveTangent == false)
+    return ADAPTIVE_NEWTON_REFACTOR;
+
+  double rho = (krylovMode == true) ? rhoKrylov : rhoKeep;
+  if (rho >= maxRatio)
+    return ADAPTIVE_NEWTON_REFACTOR;
+
+  double ratio = ADAPTIVE_NEWTON_COST_RATIO;
+  if (costKeep > 0.0 && costRefactor > 0.0)
+    ratio = costRefactor/costKeep;
+  if (ratio < 1.0)
+    ratio = 1.0;
+
+  double gainKeep = -log((rho > 1.0e-12) ? rho : 1.0e-12);
+  double gainNewton = -log((rhoNewton > 1.0e-12) ? rhoNewton : 1.0e-12);
+
+  if (gainNewton > ratio*gainKeep)
+    return ADAPTIVE_NEWTON_REFACTOR;
+
+  if (krylovMode == true || rhoKeep > krylovRatio)
+    return ADAPTIVE_NEWTON_KRYLOV;
+
+  return ADAPTIVE_NEWTON_KEEP;
+}
+
+const Vector *
+AdaptiveNewton::getIterationData(void)
+{
+  return &data;
+}
+
+int
+AdaptiveNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector params(4);
+  params(0) = tangent;
+  params(1) = maxDim;
+  params(2) = maxRatio;
+  params(3) = krylovRatio;
+
+  if (theChannel.sendVector(this->getDbTag(), cTag, params) < 0) {
+    opserr << "AdaptiveNewton::sendSelf() - failed to send data\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+AdaptiveNewton::recvSelf(int cTag, Channel &theChannel, 
+			 FEM_ObjectBroker &theBroker)
+{
+  static Vector params(4);
+  if (theChannel.recvVector(this->getDbTag(), cTag, params) < 0) {
+    opserr << "AdaptiveNewton::recvSelf() - failed to recv data\n";
+    return -1;
+  }
+
+  tangent = (int)params(0);
+  maxDim = (int)params(1);
+  maxRatio = params(2);
+  krylovRatio = params(3);
+
+  if (theAccelerator != 0) {
+    delete theAccelerator;
+    theAccelerator = 0;
+  }
+  haveTangent = false;
+  krylovMode = false;
+
+  return 0;
+}
+
+void
+AdaptiveNewton::Print(OPS_Stream &s, int flag)
+{
+  s << "AdaptiveNewton" << endln;
+  s << "\tMax subspace dimension: " << maxDim << endln;
+  s << "\tMax contraction ratio: " << maxRatio << ", Krylov above: " << krylovRatio << endln;
+  s << "\tNumber of iterations: " << numIterations << ", factorizations: ";
+  s << numFactorizations << ", accelerated: " << numKrylov << endln;
+}
@@ -0,0 +1,116 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h,v $
+                                                                        
+                                                                        
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+// File: ~/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// AdaptiveNewton. AdaptiveNewton is a Newton method which decides at
+// each iteration whether to keep the current factorization, to keep it
+// and apply a KrylovAccelerator to the modified Newton increment, or to
+// form and factor a new tangent. The decision is based on the contraction
+// ratio of the norms in the ConvergenceTest and on the measured wall time
+// of an iteration with and without a new tangent: a new tangent is formed
+// if the reduction of the norm it is expected to give per unit time is 
+// larger than that of the last iteration on the kept factorization. Once
+// the accelerator is used on a factorization it is used until a new 
+// tangent is formed, so that its subspace grows. The factorization is 
+// kept from one step to the next.
+//
+// What: "@(#) AdaptiveNewton.h, revA"
+
+#include <EquiSolnAlgo.h>
+#include <Vector.h>
+
+class KrylovAccelerator;
+
+#define ADAPTIVE_NEWTON_KEEP      0
+#define ADAPTIVE_NEWTON_KRYLOV    1
+#define ADAPTIVE_NEWTON_REFACTOR  2
+
+class AdaptiveNewton: public EquiSolnAlgo
+{
+  public:
+    AdaptiveNewton(int tangent = CURRENT_TANGENT);
+    AdaptiveNewton(ConvergenceTest &theTest, int maxDim = 3,
+		   double maxRatio = 0.9, double krylovRatio = 0.1,
+		   int tangent = CURRENT_TANGENT);
+    ~AdaptiveNewton();
+
+    void setLinks(AnalysisModel &theModel, 
+		  IncrementalIntegrator &theIntegrator,
+		  LinearSOE &theSOE,
+		  ConvergenceTest *theTest);
+    int domainChanged(void);
+
+    int solveCurrentStep(void);    
+
+    int getNumFactorizations(void) {return numFactorizations;}
+    int getNumIterations(void) {return numIterations;}
+    int getNumKrylov(void) {return numKrylov;}
+    const Vector *getIterationData(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, 
+			 FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag =0);    
+    
+  protected:
+    
+  private:
+    int decide(void);
+
+    int tangent;
+    int maxDim;
+    double maxRatio;        // a new tangent is formed above this contraction
+    double krylovRatio;     // the accelerator is used above this contraction
+
+    KrylovAccelerator *theAccelerator;
+    Vector *vAccel;
+    
+    bool haveTangent;       // a factorization that may be kept exists
+    bool krylovMode;        // the accelerator is used on this factorization
+    int krylovDim;          // accelerated iterations since the subspace was reset
+    double rhoKeep;         // last contraction of an unaccelerated iteration
+    double rhoKrylov;       // last contraction of an accelerated iteration
+    double rhoNewton;       // average contraction after a new tangent
+    double costKeep;        // average wall time of an iteration
+    double costRefactor;    // average wall time of an iteration with a new tangent
+
+    int numSteps;
+    int numFactorizations;
+    int numIterations;
+    int numKrylov;
+
+    // step, iteration, decision, norm, contraction, costKeep, costRefactor
+    Vector data;
+};
+
+#endif
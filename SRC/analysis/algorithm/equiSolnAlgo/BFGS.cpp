@@ -340,13 +340,13 @@ BFGS::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";	
         }	    
 
-        result = localTest->test();
+        result = localTest->runTest();
  
         
       } while ( result == -1 && nBFGS <= numberLoops );
 
 
-      result = theTest->test();
+      result = theTest->runTest();
       this->record(count++);
 
     }  while (result == -1);
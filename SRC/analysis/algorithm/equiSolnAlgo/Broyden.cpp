@@ -323,12 +323,12 @@ Broyden::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";	
         }	    
 	
-	result = localTest->test() ;
+	result = localTest->runTest() ;
         
       } while ( result == -1 && nBroyden <= numberLoops );
 
 
-      result = theTest->test();
+      result = theTest->runTest();
       this->record(count++);
 
     }  while (result == -1);
@@ -528,7 +528,7 @@ Broyden::Print(OPS_Stream &s, int flag)
 	    return -2;
 	}	
 	
-	result = theTest->test();
+	result = theTest->runTest();
 	this->record(nBroyden++);
 
       const Vector &du = BroydengetX( theIntegrator, theSOE, nBroyden )  ;
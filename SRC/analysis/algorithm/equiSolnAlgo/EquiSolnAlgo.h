@@ -75,6 +75,9 @@ class EquiSolnAlgo: public SolutionAlgorithm
     virtual double getSolveTimeReal(void)  {return 0.0;}
     virtual double getAccelTimeCPU(void)   {return 0.0;}
     virtual double getAccelTimeReal(void)  {return 0.0;}
+
+    // data on the last iteration for the algorithm recorders, if any
+    virtual const Vector *getIterationData(void) {return 0;}
  
     // the following are not protected as convergence test
     // may need access to them
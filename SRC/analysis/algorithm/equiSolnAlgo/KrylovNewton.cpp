@@ -216,7 +216,7 @@ KrylovNewton::solveCurrentStep(void)
     // Increase current dimension of Krylov subspace
     dim++;
 
-    result = theTest->test();
+    result = theTest->runTest();
     this->record(k++);
 
   } while (result == -1);
@@ -138,7 +138,7 @@ ModifiedNewton::solveCurrentStep(void)
 	}	
 
 	this->record(count++);
-	result = theTest->test();
+	result = theTest->runTest();
 
     } while (result == -1);
 
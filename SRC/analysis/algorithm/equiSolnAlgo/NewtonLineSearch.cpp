@@ -152,7 +152,7 @@ NewtonLineSearch::solveCurrentStep(void)
 
 	// do a line search only if convergence criteria not met
 	theOtherTest->start();
-	result = theOtherTest->test();
+	result = theOtherTest->runTest();
 
 	if (result < 1) {
 	  //new residual 
@@ -167,7 +167,7 @@ NewtonLineSearch::solveCurrentStep(void)
 
 	this->record(0);
 	  
-	result = theTest->test();
+	result = theTest->runTest();
 
     } while (result == -1);
 
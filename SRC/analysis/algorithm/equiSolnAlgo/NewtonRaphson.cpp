@@ -145,7 +145,7 @@ NewtonRaphson::solveCurrentStep(void)
 	return -2;
       }	
 
-      result = theTest->test();
+      result = theTest->runTest();
       this->record(count++);
 
     } while (result == -1);
@@ -125,7 +125,7 @@ PeriodicNewton::solveCurrentStep(void)
 	}	
 
 	this->record(count++);
-	result = theTest->test();
+	result = theTest->runTest();
 	
 	iter++;
 	if (iter > maxCount) {
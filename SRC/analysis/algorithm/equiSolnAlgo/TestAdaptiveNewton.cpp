@@ -0,0 +1,217 @@
+// Description: compares AdaptiveNewton with NewtonRaphson, ModifiedNewton
+// and KrylovNewton. A column of J2 plasticity bricks, fixed at the base, is
+// pushed laterally at the top under load control to a total shear of 40,
+// well past first yield, the capacity being about 46. Forming and factoring
+// the tangent of the profile system is the dominant cost of an iteration
+// with a new tangent. For each algorithm the wall time, the number of
+// iterations and the number of tangents formed are printed. All must 
+// converge to the tip displacement of NewtonRaphson, and AdaptiveNewton 
+// must accelerate some iterations and, keeping its factorization from one
+// step to the next, form fewer tangents than ModifiedNewton.
+//
+// usage: testAdaptiveNewton ?numEleXY numEleZ numSteps?, exits with the
+// number of failed checks
+
+#include <StandardStream.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <NodalLoad.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <J2Plasticity.h>
+#include <Brick.h>
+#include <StaticAnalysis.h>
+#include <AnalysisModel.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <LoadControl.h>
+#include <CTestNormDispIncr.h>
+#include <NewtonRaphson.h>
+#include <ModifiedNewton.h>
+#include <KrylovNewton.h>
+#include <AdaptiveNewton.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <Timer.h>
+#include <Vector.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int nxy = 6;
+static int nz = 12;
+static int numSteps = 10;
+static const double totalShear = 40.0;
+
+// counts the tangents formed, each of which is factored
+class CountingLoadControl: public LoadControl
+{
+  public:
+    CountingLoadControl(double increment)
+      :LoadControl(increment, 1, increment, increment),
+       numTangents(0) {}
+    int formTangent(int statusFlag) {
+      numTangents++;
+      return this->LoadControl::formTangent(statusFlag);
+    }
+    int numTangents;
+};
+
+static int
+nodeTag(int i, int j, int k)
+{
+  return 1 + i + j*(nxy+1) + k*(nxy+1)*(nxy+1);
+}
+
+// a 1 x 1 x 2 column with the top corner node returned
+static int
+buildModel(Domain &theDomain)
+{
+  double h = 1.0/nxy;
+  double hz = 2.0/nz;
+  for (int k=0; k<=nz; k++)
+    for (int j=0; j<=nxy; j++)
+      for (int i=0; i<=nxy; i++) {
+	int tag = nodeTag(i,j,k);
+	theDomain.addNode(new Node(tag, 3, i*h, j*h, k*hz));
+	if (k == 0)
+	  for (int dof=0; dof<3; dof++)
+	    theDomain.addSP_Constraint(new SP_Constraint(tag, dof, 0.0, true));
+      }
+
+  double E = 200000.0;
+  double nu = 0.3;
+  J2Plasticity theMaterial(1, 0, E/(3.0*(1.0-2.0*nu)), E/(2.0*(1.0+nu)),
+			   250.0, 300.0, 20.0, 2000.0);
+
+  int eleTag = 1;
+  for (int k=0; k<nz; k++)
+    for (int j=0; j<nxy; j++)
+      for (int i=0; i<nxy; i++)
+	theDomain.addElement(new Brick(eleTag++,
+				       nodeTag(i,j,k), nodeTag(i+1,j,k),
+				       nodeTag(i+1,j+1,k), nodeTag(i,j+1,k),
+				       nodeTag(i,j,k+1), nodeTag(i+1,j,k+1),
+				       nodeTag(i+1,j+1,k+1), nodeTag(i,j+1,k+1),
+				       theMaterial));
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries(1));
+  theDomain.addLoadPattern(thePattern);
+  // a unit total shear over the top nodes
+  Vector load(3);
+  load(0) = 1.0/((nxy+1)*(nxy+1));
+  int loadTag = 1;
+  for (int j=0; j<=nxy; j++)
+    for (int i=0; i<=nxy; i++)
+      theDomain.addNodalLoad(new NodalLoad(loadTag++, nodeTag(i,j,nz), load), 1);
+
+  return nodeTag(nxy,nxy,nz);
+}
+
+// runs the pushover with one of the algorithms, returning the wall time,
+// the numbers of iterations, tangents and accelerated iterations and the
+// final tip displacement
+static int
+runAlgorithm(int type, double &time, int &numIter, int &numFact, int &numKrylov,
+	     double &uTip)
+{
+  Domain theDomain;
+  int tipNode = buildModel(theDomain);
+
+  AnalysisModel *theModel = new AnalysisModel();
+  CTestNormDispIncr *theTest = new CTestNormDispIncr(1.0e-10, 200, 0);
+  EquiSolnAlgo *theAlgorithm = 0;
+  AdaptiveNewton *theAdaptive = 0;
+  if (type == 0)
+    theAlgorithm = new NewtonRaphson(*theTest);
+  else if (type == 1)
+    theAlgorithm = new ModifiedNewton(*theTest);
+  else if (type == 2)
+    theAlgorithm = new KrylovNewton(*theTest);
+  else
+    theAlgorithm = theAdaptive = new AdaptiveNewton(*theTest);
+  PlainHandler *theHandler = new PlainHandler();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*(new RCM(false)));
+  CountingLoadControl *theIntegrator = new CountingLoadControl(totalShear/numSteps);
+  ProfileSPDLinSOE *theSOE = new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+
+  StaticAnalysis theAnalysis(theDomain, *theHandler, *theNumberer, *theModel,
+			     *theAlgorithm, *theSOE, *theIntegrator, theTest);
+
+  numIter = 0;
+  double tStart = Timer::getWallTime();
+  for (int step=0; step<numSteps; step++) {
+    if (theAnalysis.analyze(1) < 0) {
+      opserr << "FAILED - algorithm " << type << " step " << step+1 << endln;
+      return -1;
+    }
+    numIter += theTest->getNumTests();
+  }
+  time = Timer::getWallTime() - tStart;
+
+  numFact = theIntegrator->numTangents;
+  if (theAdaptive != 0)
+    numKrylov = theAdaptive->getNumKrylov();
+
+  uTip = theDomain.getNode(tipNode)->getDisp()(0);
+
+  return 0;
+}
+
+// main routine
+int main(int argc, char **argv)
+{
+  if (argc == 4) {
+    nxy = atoi(argv[1]);
+    nz = atoi(argv[2]);
+    numSteps = atoi(argv[3]);
+  }
+
+  int numFailed = 0;
+  const char *names[4] = {"NewtonRaphson", "ModifiedNewton", "KrylovNewton", "AdaptiveNewton"};
+  double time[4], uTip[4];
+  int numIter[4], numFact[4], numKrylov[4];
+
+  for (int type=0; type<4; type++) {
+    numKrylov[type] = 0;
+    if (runAlgorithm(type, time[type], numIter[type], numFact[type],
+		     numKrylov[type], uTip[type]) < 0)
+      exit(numFailed+1);
+  }
+
+  opserr << "bricks " << nxy*nxy*nz << ", steps " << numSteps << endln;
+  opserr << "algorithm        time (s)  iterations        tangents  accelerated  tip displacement\n";
+  for (int type=0; type<4; type++) {
+    char buffer[120];
+    sprintf(buffer, "%-15s %9.3f %11d %15d %12d %17.9e\n", names[type], time[type],
+	    numIter[type], numFact[type], numKrylov[type], uTip[type]);
+    opserr << buffer;
+  }
+
+  for (int type=1; type<4; type++)
+    if (fabs(uTip[type]-uTip[0]) > 1.0e-6*fabs(uTip[0])) {
+      opserr << "FAILED - " << names[type] << " tip displacement " << uTip[type];
+      opserr << " NewtonRaphson " << uTip[0] << endln;
+      numFailed++;
+    }
+
+  if (numKrylov[3] == 0) {
+    opserr << "FAILED - AdaptiveNewton made no accelerated iterations\n";
+    numFailed++;
+  }
+  if (numFact[3] >= numFact[1]) {
+    opserr << "FAILED - AdaptiveNewton formed as many tangents as ModifiedNewton\n";
+    numFailed++;
+  }
+
+  if (numFailed == 0)
+    opserr << "AdaptiveNewton - all checks passed\n";
+
+  exit(numFailed);
+}
@@ -55,6 +55,8 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
+#include <PerformanceMonitor.h>
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
 #include <SensitivityAlgorithm.h>
@@ -184,6 +186,8 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
 
   for (int i=0; i<numSteps; i++) {
 
+    PerformanceTimer theTimer(PERF_STEP);
+
     if (theAnalysisModel->analysisStep(dT) < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the AnalysisModel failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -378,9 +382,9 @@ DirectIntegrationAnalysis::domainChanged(void)
 
     // we invoke setGraph() on the LinearSOE which
     // causes that object to determine its size
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    CSR_Graph &theCSR_Graph = theAnalysisModel->getDOF_CSR_Graph();
 
-    int result = theSOE->setSize(theGraph);
+    int result = theSOE->setSize(theCSR_Graph);
     if (result < 0) {
 	opserr << "DirectIntegrationAnalysis::handle() - ";
 	opserr << "LinearSOE::setSize() failed";
@@ -388,6 +392,7 @@ DirectIntegrationAnalysis::domainChanged(void)
     }	    
 
     if (theEigenSOE != 0) {
+      Graph &theGraph = theAnalysisModel->getDOFGraph();
       result = theEigenSOE->setSize(theGraph);
       if (result < 0) {
 	opserr << "DirectIntegrationAnalysis::handle() - ";
@@ -118,7 +118,9 @@ DomainDecompositionAnalysis::DomainDecompositionAnalysis(Subdomain &the_Domain,
  theIntegrator( &integrator),
  theSOE( &theLinSOE),
  theSolver( &theDDSolver),
- theResidual(0),numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0)
+ theResidual(0),numEqn(0),numExtEqn(0),tangFormed(false),tangFormedCount(0),
+ domainStamp(0),
+ myChannel(0)
 {
     theModel->setLinks(the_Domain, handler);
     theHandler->setLinks(*theSubdomain,*theModel,*theIntegrator);
@@ -271,6 +273,15 @@ DomainDecompositionAnalysis::domainChanged(void)
 int
 DomainDecompositionAnalysis::getNumExternalEqn(void)
 {
+    // the number is asked for by the FE_Element of the subdomain, which 
+    // may be created before the tangent of a changed subdomain is formed
+    Domain *the_Domain = this->getDomainPtr();
+    int stamp = the_Domain->hasDomainChanged();
+    if (stamp != domainStamp) {
+	domainStamp = stamp;
+	this->domainChanged();
+    }
+
     return numExtEqn;
 }
 
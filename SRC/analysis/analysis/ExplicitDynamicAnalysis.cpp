@@ -0,0 +1,955 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ExplicitDynamicAnalysis.cpp,v $
+                                                                        
+                                                                        
+// File: ~/analysis/analysis/ExplicitDynamicAnalysis.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// ExplicitDynamicAnalysis.
+//
+// What: "@(#) ExplicitDynamicAnalysis.cpp, revA"
+
+#include <ExplicitDynamicAnalysis.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ThreadPool.h>
+#include <PerformanceMonitor.h>
+#include <math.h>
+#include <map>
+
+// used for the stable time step of an element or node with no estimate
+#define EXPLICIT_NO_LIMIT 1.0e300
+
+// the number of element partitions, each summing into its own force array;
+// fixed so that the summation order does not depend on the number of threads
+#define EXPLICIT_NUM_PARTS 16
+
+// ThreadTasks for the three phases of a substep: setting the trial 
+// response at the nodes, forming the element forces of each partition 
+// and updating the response of the nodes at the end of their interval
+class ExplicitTrialTask: public ThreadTask
+{
+  public:
+    ExplicitTrialTask(ExplicitDynamicAnalysis &theAnalysis, double time)
+      :theAnalysis(theAnalysis), time(time) {};
+    int run(int first, int last, int threadID) {
+      theAnalysis.setTrialResponse(first, last, time);
+      return 0;
+    }
+  private:
+    ExplicitDynamicAnalysis &theAnalysis;
+    double time;
+};
+
+class ExplicitForceTask: public ThreadTask
+{
+  public:
+    ExplicitForceTask(ExplicitDynamicAnalysis &theAnalysis, int numActive)
+      :theAnalysis(theAnalysis), numActive(numActive) {};
+    int run(int first, int last, int threadID) {
+      int result = 0;
+      for (int i=first; i<last; i++)
+	if (theAnalysis.formPartForce(i, numActive) < 0)
+	  result = -1;
+      return result;
+    }
+  private:
+    ExplicitDynamicAnalysis &theAnalysis;
+    int numActive;
+};
+
+class ExplicitUpdateTask: public ThreadTask
+{
+  public:
+    ExplicitUpdateTask(ExplicitDynamicAnalysis &theAnalysis, double time)
+      :theAnalysis(theAnalysis), time(time) {};
+    int run(int first, int last, int threadID) {
+      theAnalysis.updateResponse(first, last, time);
+      return 0;
+    }
+  private:
+    ExplicitDynamicAnalysis &theAnalysis;
+    double time;
+};
+
+
+ExplicitDynamicAnalysis::ExplicitDynamicAnalysis(Domain &the_Domain,
+						 double alpham,
+						 double factor,
+						 double c,
+						 int maxSubcycleLevel,
+						 int numThreads)
+  :TransientAnalysis(the_Domain),
+   alphaM(alpham), safetyFactor(factor), waveSpeed(c), 
+   maxLevel(maxSubcycleLevel), thePool(0), domainStamp(-1),
+   numNodes(0), numDOF(0), theNodes(0), nodeStart(0),
+   U(0), V(0), A(0), Ustart(0), Vhalf(0), mass(0), dofFlag(0), dofSP(0),
+   tStart(0), dtNode(0), zeroDOF(0),
+   numEles(0), theEles(0), threadSafe(0), eleDOFStart(0), eleDOFs(0),
+   eleNodeStart(0), eleNodes(0), dtEle(0),
+   deltaT(0.0), numSub(1), h0(0.0), numLevels(1), nodeLevel(0), 
+   eleOrder(0), eleLevelEnd(0), nodeOrder(0), nodeLevelEnd(0), 
+   trialOrder(0), trialLevelEnd(0),
+   numParts(1), partForce(0), partStart(0)
+{
+  if (maxLevel < 0)
+    maxLevel = 0;
+  if (safetyFactor <= 0.0)
+    safetyFactor = 0.9;
+
+  if (numThreads <= 0)
+    numThreads = ThreadPool::getNumProcessors();
+
+  if (numThreads > 1) {
+    thePool = new ThreadPool(numThreads);
+    if (thePool != 0 && thePool->getNumThreads() == 1) {
+      delete thePool;
+      thePool = 0;
+    }
+  }
+}
+
+
+ExplicitDynamicAnalysis::~ExplicitDynamicAnalysis()
+{
+  this->clearAll();
+
+  if (thePool != 0)
+    delete thePool;
+}
+
+
+void
+ExplicitDynamicAnalysis::clearAll(void)
+{
+  if (theNodes != 0) delete [] theNodes;
+  if (nodeStart != 0) delete [] nodeStart;
+  if (U != 0) delete [] U;
+  if (V != 0) delete [] V;
+  if (A != 0) delete [] A;
+  if (Ustart != 0) delete [] Ustart;
+  if (Vhalf != 0) delete [] Vhalf;
+  if (mass != 0) delete [] mass;
+  if (dofFlag != 0) delete [] dofFlag;
+  if (dofSP != 0) delete [] dofSP;
+  if (tStart != 0) delete [] tStart;
+  if (dtNode != 0) delete [] dtNode;
+  if (zeroDOF != 0) delete [] zeroDOF;
+  if (theEles != 0) delete [] theEles;
+  if (threadSafe != 0) delete [] threadSafe;
+  if (eleDOFStart != 0) delete [] eleDOFStart;
+  if (eleDOFs != 0) delete [] eleDOFs;
+  if (eleNodeStart != 0) delete [] eleNodeStart;
+  if (eleNodes != 0) delete [] eleNodes;
+  if (dtEle != 0) delete [] dtEle;
+  if (nodeLevel != 0) delete [] nodeLevel;
+  if (eleOrder != 0) delete [] eleOrder;
+  if (eleLevelEnd != 0) delete [] eleLevelEnd;
+  if (nodeOrder != 0) delete [] nodeOrder;
+  if (nodeLevelEnd != 0) delete [] nodeLevelEnd;
+  if (trialOrder != 0) delete [] trialOrder;
+  if (trialLevelEnd != 0) delete [] trialLevelEnd;
+  if (partForce != 0) {
+    for (int p=0; p<numParts; p++)
+      if (partForce[p] != 0)
+	delete [] partForce[p];
+    delete [] partForce;
+  }
+  if (partStart != 0) delete [] partStart;
+
+  theNodes = 0; nodeStart = 0; U = 0; V = 0; A = 0; Ustart = 0; Vhalf = 0;
+  mass = 0; dofFlag = 0; dofSP = 0; tStart = 0; dtNode = 0; zeroDOF = 0;
+  theEles = 0; threadSafe = 0; eleDOFStart = 0; eleDOFs = 0; 
+  eleNodeStart = 0; eleNodes = 0; dtEle = 0;
+  nodeLevel = 0; eleOrder = 0; eleLevelEnd = 0; nodeOrder = 0; 
+  nodeLevelEnd = 0; trialOrder = 0; trialLevelEnd = 0;
+  partForce = 0; partStart = 0;
+
+  numNodes = 0; numDOF = 0; numEles = 0; numParts = 1;
+  deltaT = 0.0; numSub = 1; h0 = 0.0; numLevels = 1;
+  domainStamp = -1;
+}
+
+
+int
+ExplicitDynamicAnalysis::initialize(void)
+{
+  Domain *the_Domain = this->getDomainPtr();
+
+  // check if domain has undergone change
+  int stamp = the_Domain->hasDomainChanged();
+  if (stamp != domainStamp) {
+    domainStamp = stamp;	
+    if (this->domainChanged() < 0) {
+      opserr << "ExplicitDynamicAnalysis::initialize() - domainChanged() failed\n";
+      return -1;
+    }	
+  }
+
+  return 0;
+}
+
+
+int
+ExplicitDynamicAnalysis::domainChanged(void)
+{
+  Domain *the_Domain = this->getDomainPtr();
+  int stamp = the_Domain->hasDomainChanged();
+
+  this->clearAll();
+  domainStamp = stamp;
+
+  if (the_Domain->getNumMPs() != 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - ";
+    opserr << "MP_Constraints are not supported\n";
+    return -1;
+  }
+
+  //
+  // the nodes and their dof in the flat arrays
+  //
+
+  numNodes = the_Domain->getNumNodes();
+  theNodes = new Node *[numNodes];
+  nodeStart = new int[numNodes+1];
+  if (theNodes == 0 || nodeStart == 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - out of memory\n";
+    this->clearAll();
+    return -2;
+  }
+
+  std::map<int, int> nodeIndex;
+  int maxNodalDOF = 0;
+  Node *nodePtr;
+  NodeIter &theNodeIter = the_Domain->getNodes();
+  int i = 0;
+  nodeStart[0] = 0;
+  while ((nodePtr = theNodeIter()) != 0 && i < numNodes) {
+    int numNodalDOF = nodePtr->getNumberDOF();
+    if (numNodalDOF > maxNodalDOF)
+      maxNodalDOF = numNodalDOF;
+    nodeIndex[nodePtr->getTag()] = i;
+    theNodes[i] = nodePtr;
+    nodeStart[i+1] = nodeStart[i] + numNodalDOF;
+    i++;
+  }
+  numDOF = nodeStart[numNodes];
+
+  U = new double[numDOF];
+  V = new double[numDOF];
+  A = new double[numDOF];
+  Ustart = new double[numDOF];
+  Vhalf = new double[numDOF];
+  mass = new double[numDOF];
+  dofFlag = new int[numDOF];
+  dofSP = new SP_Constraint *[numDOF];
+  tStart = new double[numNodes];
+  dtNode = new double[numNodes];
+  zeroDOF = new double[maxNodalDOF+1];
+  nodeLevel = new int[numNodes];
+  nodeOrder = new int[numNodes];
+  trialOrder = new int[numNodes];
+  nodeLevelEnd = new int[maxLevel+1];
+  trialLevelEnd = new int[maxLevel+1];
+  eleLevelEnd = new int[maxLevel+1];
+
+  if (U == 0 || V == 0 || A == 0 || Ustart == 0 || Vhalf == 0 || mass == 0 ||
+      dofFlag == 0 || dofSP == 0 || tStart == 0 || dtNode == 0 || zeroDOF == 0 ||
+      nodeLevel == 0 || nodeOrder == 0 || trialOrder == 0 || 
+      nodeLevelEnd == 0 || trialLevelEnd == 0 || eleLevelEnd == 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - out of memory for ";
+    opserr << numDOF << " dof\n";
+    this->clearAll();
+    return -2;
+  }
+
+  for (i=0; i<=maxNodalDOF; i++)
+    zeroDOF[i] = 0.0;
+
+  // the current response and the nodal mass
+  for (i=0; i<numNodes; i++) {
+    nodePtr = theNodes[i];
+    const Vector &disp = nodePtr->getTrialDisp();
+    const Vector &vel = nodePtr->getTrialVel();
+    const Matrix &nodalMass = nodePtr->getMass();
+    int numNodalDOF = nodeStart[i+1] - nodeStart[i];
+    for (int j=0; j<numNodalDOF; j++) {
+      int loc = nodeStart[i] + j;
+      U[loc] = disp(j);
+      V[loc] = vel(j);
+      A[loc] = 0.0;
+      double sum = 0.0;
+      if (nodalMass.noRows() == numNodalDOF)
+	for (int k=0; k<numNodalDOF; k++)
+	  sum += nodalMass(j,k);
+      mass[loc] = sum;
+      dofFlag[loc] = 0;
+      dofSP[loc] = 0;
+    }
+    dtNode[i] = EXPLICIT_NO_LIMIT;
+  }
+
+  //
+  // the elements and the location of their dof in the flat arrays
+  //
+
+  numEles = the_Domain->getNumElements();
+  theEles = new Element *[numEles];
+  threadSafe = new bool[numEles];
+  eleDOFStart = new int[numEles+1];
+  eleNodeStart = new int[numEles+1];
+  dtEle = new double[numEles];
+  eleOrder = new int[numEles];
+  if (theEles == 0 || threadSafe == 0 || eleDOFStart == 0 || 
+      eleNodeStart == 0 || dtEle == 0 || eleOrder == 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - out of memory for ";
+    opserr << numEles << " elements\n";
+    this->clearAll();
+    return -2;
+  }
+
+  Element *elePtr;
+  ElementIter &theEleIter = the_Domain->getElements();
+  int e = 0;
+  eleDOFStart[0] = 0;
+  eleNodeStart[0] = 0;
+  while ((elePtr = theEleIter()) != 0 && e < numEles) {
+    if (elePtr->isSubdomain() == true) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - ";
+      opserr << "Subdomains are not supported\n";
+      this->clearAll();
+      return -3;
+    }
+    theEles[e] = elePtr;
+    threadSafe[e] = elePtr->isThreadSafe();
+    eleDOFStart[e+1] = eleDOFStart[e] + elePtr->getNumDOF();
+    eleNodeStart[e+1] = eleNodeStart[e] + elePtr->getNumExternalNodes();
+    e++;
+  }
+
+  eleDOFs = new int[eleDOFStart[numEles]+1];
+  eleNodes = new int[eleNodeStart[numEles]+1];
+  int *numEleAtNode = new int[numNodes];
+  double *stiffRow = new double[numDOF];
+  if (eleDOFs == 0 || eleNodes == 0 || numEleAtNode == 0 || stiffRow == 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - out of memory\n";
+    if (numEleAtNode != 0) delete [] numEleAtNode;
+    if (stiffRow != 0) delete [] stiffRow;
+    this->clearAll();
+    return -2;
+  }
+
+  for (i=0; i<numNodes; i++)
+    numEleAtNode[i] = 0;
+  for (i=0; i<numDOF; i++)
+    stiffRow[i] = 0.0;
+
+  int result = 0;
+  for (e=0; e<numEles && result == 0; e++) {
+    elePtr = theEles[e];
+    Node **nodes = elePtr->getNodePtrs();
+    int numEleNodes = eleNodeStart[e+1] - eleNodeStart[e];
+    int loc = eleDOFStart[e];
+    for (int a=0; a<numEleNodes; a++) {
+      int index = nodeIndex[nodes[a]->getTag()];
+      eleNodes[eleNodeStart[e]+a] = index;
+      numEleAtNode[index]++;
+      for (int j=nodeStart[index]; j<nodeStart[index+1]; j++) {
+	if (loc < eleDOFStart[e+1])
+	  eleDOFs[loc] = j;
+	loc++;
+      }
+    }
+    if (loc != eleDOFStart[e+1]) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - element ";
+      opserr << elePtr->getTag() << " number of dof not that of its nodes\n";
+      result = -3;
+    }
+  }
+
+  // add the lumped element mass and the initial stiffness row sums
+  for (e=0; e<numEles && result == 0; e++) {
+    elePtr = theEles[e];
+    int numEleDOF = eleDOFStart[e+1] - eleDOFStart[e];
+    const int *dofs = &eleDOFs[eleDOFStart[e]];
+
+    const Matrix &eleMass = elePtr->getMass();
+    for (int j=0; j<numEleDOF; j++) {
+      double sum = 0.0;
+      for (int k=0; k<numEleDOF; k++)
+	sum += eleMass(j,k);
+      mass[dofs[j]] += sum;
+    }
+
+    const Matrix &eleK = elePtr->getInitialStiff();
+    for (int j=0; j<numEleDOF; j++) {
+      double sum = 0.0;
+      for (int k=0; k<numEleDOF; k++)
+	sum += fabs(eleK(j,k));
+      stiffRow[dofs[j]] += sum;
+    }
+  }
+
+  // the constrained dof
+  SP_ConstraintIter &theSPs = the_Domain->getDomainAndLoadPatternSPs();
+  SP_Constraint *theSP;
+  while ((theSP = theSPs()) != 0 && result == 0) {
+    std::map<int, int>::iterator it = nodeIndex.find(theSP->getNodeTag());
+    int dof = theSP->getDOF_Number();
+    if (it == nodeIndex.end() || dof < 0 || 
+	dof >= nodeStart[it->second+1] - nodeStart[it->second]) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - no node or dof ";
+      opserr << "for SP_Constraint " << theSP->getTag() << endln;
+      result = -3;
+    } else {
+      int loc = nodeStart[it->second] + dof;
+      dofFlag[loc] = 1;
+      dofSP[loc] = theSP;
+    }
+  }
+
+  // a free dof without mass is only allowed if it has no stiffness
+  for (i=0; i<numNodes && result == 0; i++) {
+    for (int j=nodeStart[i]; j<nodeStart[i+1]; j++) {
+      if (dofFlag[j] == 0 && mass[j] <= 0.0) {
+	if (stiffRow[j] == 0.0)
+	  dofFlag[j] = 2;
+	else {
+	  opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - no mass at node ";
+	  opserr << theNodes[i]->getTag() << " dof " << j - nodeStart[i] + 1 << endln;
+	  result = -4;
+	}
+      }
+    }
+  }
+
+  // the stable time step of the elements: from the characteristic length
+  // if a wave speed is given, otherwise 2/w where w^2 bounds the highest
+  // eigenvalue of the element with its nodal mass shared equally amongst
+  // the elements at the node; the largest element value bounds that of
+  // the whole model by Gershgorin
+  for (e=0; e<numEles && result == 0; e++) {
+    elePtr = theEles[e];
+    dtEle[e] = EXPLICIT_NO_LIMIT;
+
+    if (waveSpeed > 0.0) {
+      double length = elePtr->getCharacteristicLength();
+      if (length > 0.0)
+	dtEle[e] = length/waveSpeed;
+    } else {
+      const Matrix &eleK = elePtr->getInitialStiff();
+      int numEleDOF = eleDOFStart[e+1] - eleDOFStart[e];
+      const int *dofs = &eleDOFs[eleDOFStart[e]];
+      double maxW2 = 0.0;
+      int a = 0;
+      int endNodeDOF = 0;
+      for (int j=0; j<numEleDOF; j++) {
+	int loc = dofs[j];
+	while (j >= endNodeDOF && a < eleNodeStart[e+1] - eleNodeStart[e]) {
+	  int index = eleNodes[eleNodeStart[e]+a];
+	  endNodeDOF += nodeStart[index+1] - nodeStart[index];
+	  a++;
+	}
+	if (dofFlag[loc] != 0 || mass[loc] <= 0.0)
+	  continue;
+	double sum = 0.0;
+	for (int k=0; k<numEleDOF; k++)
+	  sum += fabs(eleK(j,k));
+	int index = eleNodes[eleNodeStart[e]+a-1];
+	double w2 = sum * numEleAtNode[index] / mass[loc];
+	if (w2 > maxW2)
+	  maxW2 = w2;
+      }
+      if (maxW2 > 0.0)
+	dtEle[e] = 2.0/sqrt(maxW2);
+    }
+
+    for (int a=eleNodeStart[e]; a<eleNodeStart[e+1]; a++) 
+      if (dtEle[e] < dtNode[eleNodes[a]])
+	dtNode[eleNodes[a]] = dtEle[e];
+  }
+
+  delete [] numEleAtNode;
+  delete [] stiffRow;
+
+  if (result < 0) {
+    this->clearAll();
+    return result;
+  }
+
+  //
+  // the partition force arrays
+  //
+
+  numParts = EXPLICIT_NUM_PARTS;
+  partForce = new double *[numParts];
+  partStart = new int[numParts+1];
+  if (partForce == 0 || partStart == 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - out of memory\n";
+    this->clearAll();
+    return -2;
+  }
+  for (int p=0; p<numParts; p++) {
+    partForce[p] = new double[numDOF];
+    if (partForce[p] == 0) {
+      opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - out of memory\n";
+      this->clearAll();
+      return -2;
+    }
+  }
+
+  //
+  // form the acceleration at the current time; with all nodes at level 0
+  // and a zero substep the velocity is unchanged
+  //
+
+  for (i=0; i<numNodes; i++) {
+    nodeLevel[i] = 0;
+    tStart[i] = the_Domain->getCurrentTime();
+  }
+  for (i=0; i<numDOF; i++) {
+    Ustart[i] = U[i];
+    Vhalf[i] = V[i];
+  }
+
+  this->setLevels(0);
+  h0 = 0.0;
+  deltaT = 0.0;
+
+  the_Domain->applyLoad(the_Domain->getCurrentTime());
+  if (this->formForces(0) < 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::domainChanged() - failed to form ";
+    opserr << "the initial acceleration\n";
+    this->clearAll();
+    return -5;
+  }
+
+  domainStamp = stamp;
+  return 0;
+}
+
+
+double
+ExplicitDynamicAnalysis::getStableTimeStep(void)
+{
+  Domain *the_Domain = this->getDomainPtr();
+  int stamp = the_Domain->hasDomainChanged();
+  if (stamp != domainStamp) 
+    if (this->domainChanged() < 0)
+      return 0.0;
+
+  double dtMin = EXPLICIT_NO_LIMIT;
+  for (int i=0; i<numNodes; i++)
+    if (dtNode[i] < dtMin)
+      dtMin = dtNode[i];
+
+  return safetyFactor * dtMin;
+}
+
+
+int
+ExplicitDynamicAnalysis::analyze(int numSteps, double dT)
+{
+  Domain *the_Domain = this->getDomainPtr();
+
+  for (int step=0; step<numSteps; step++) {
+
+    PerformanceTimer theTimer(PERF_STEP);
+
+    the_Domain->analysisStep(dT);
+
+    // check if domain has undergone change
+    int stamp = the_Domain->hasDomainChanged();
+    if (stamp != domainStamp) {
+      if (this->domainChanged() < 0) {
+	opserr << "ExplicitDynamicAnalysis::analyze() - domainChanged() failed\n";
+	return -1;
+      }	
+    }
+
+    if (dT != deltaT) {
+      if (this->setTimeStep(dT) < 0) {
+	opserr << "ExplicitDynamicAnalysis::analyze() - setTimeStep() failed\n";
+	return -1;
+      }
+    }
+
+    // each node starts an interval of its own step
+    double t0 = the_Domain->getCurrentTime();
+    for (int i=0; i<numNodes; i++) {
+      double h = ldexp(h0, nodeLevel[i]);
+      for (int j=nodeStart[i]; j<nodeStart[i+1]; j++) {
+	Ustart[j] = U[j];
+	if (dofFlag[j] == 0)
+	  Vhalf[j] = V[j] + 0.5*h*A[j];
+	else
+	  Vhalf[j] = 0.0;
+      }
+      tStart[i] = t0;
+    }
+
+    // the substeps; at substep s the nodes and elements of the levels 
+    // whose step divides s are advanced
+    for (int s=1; s<=numSub; s++) {
+      double time = t0 + s*h0;
+      if (s == numSub)
+	time = t0 + dT;
+
+      int level = 0;
+      while (level < numLevels-1 && (s % (2 << level)) == 0)
+	level++;
+
+      the_Domain->applyLoad(time);
+
+      if (this->formForces(level) < 0) {
+	opserr << "ExplicitDynamicAnalysis::analyze() - failed to form the forces";
+	opserr << " at time " << time << endln;
+	the_Domain->revertToLastCommit();
+	domainStamp = -1;
+	return -3;
+      }
+    }
+
+    if (the_Domain->commit() < 0) {
+      opserr << "ExplicitDynamicAnalysis::analyze() - the Domain failed to commit";
+      opserr << " at time " << the_Domain->getCurrentTime() << endln;
+      the_Domain->revertToLastCommit();
+      domainStamp = -1;
+      return -4;
+    }
+  }
+
+  return 0;
+}
+
+
+// int setTimeStep():
+//	determines the number of substeps in dT and, with subcycling, the
+//	level of each node, a node of level k advancing 2^k substeps at once.
+int
+ExplicitDynamicAnalysis::setTimeStep(double dT)
+{
+  if (dT <= 0.0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::setTimeStep() - dT " << dT;
+    opserr << " must be positive\n";
+    return -1;
+  }
+
+  double dtMin = EXPLICIT_NO_LIMIT;
+  for (int i=0; i<numNodes; i++)
+    if (dtNode[i] < dtMin)
+      dtMin = dtNode[i];
+
+  int K = 0;
+  numSub = 1;
+  if (dtMin < EXPLICIT_NO_LIMIT) {
+    dtMin *= safetyFactor;
+    double ratio = dT/dtMin;
+    if (maxLevel > 0 && ratio > 1.0) {
+      K = (int)ceil(log(ratio)/log(2.0) - 1.0e-12);
+      if (K > maxLevel)
+	K = maxLevel;
+    }
+    int numCycle = (int)ceil(ratio/ldexp(1.0, K) - 1.0e-12);
+    if (numCycle < 1)
+      numCycle = 1;
+    numSub = numCycle << K;
+  }
+  h0 = dT/numSub;
+
+  for (int i=0; i<numNodes; i++) {
+    int k = K;
+    if (K > 0 && dtNode[i] < EXPLICIT_NO_LIMIT) {
+      k = (int)floor(log(safetyFactor*dtNode[i]/h0)/log(2.0) + 1.0e-12);
+      if (k < 0)
+	k = 0;
+      else if (k > K)
+	k = K;
+    }
+    nodeLevel[i] = k;
+  }
+
+  deltaT = dT;
+  return this->setLevels(K);
+}
+
+
+// int setLevels():
+//	an element is formed at the level of its fastest node and a node needs
+//	a trial displacement at the level of its fastest element; the element,
+//	node and trial node orders are sorted by these levels.
+int
+ExplicitDynamicAnalysis::setLevels(int K)
+{
+  numLevels = K+1;
+
+  int *eleLevel = new int[numEles+1];
+  int *trialLevel = new int[numNodes+1];
+  if (eleLevel == 0 || trialLevel == 0) {
+    opserr << "WARNING ExplicitDynamicAnalysis::setLevels() - out of memory\n";
+    if (eleLevel != 0) delete [] eleLevel;
+    if (trialLevel != 0) delete [] trialLevel;
+    return -1;
+  }
+
+  int i, e, k;
+  for (i=0; i<numNodes; i++)
+    trialLevel[i] = nodeLevel[i];
+
+  for (e=0; e<numEles; e++) {
+    int level = K;
+    for (int a=eleNodeStart[e]; a<eleNodeStart[e+1]; a++)
+      if (nodeLevel[eleNodes[a]] < level)
+	level = nodeLevel[eleNodes[a]];
+    eleLevel[e] = level;
+    for (int b=eleNodeStart[e]; b<eleNodeStart[e+1]; b++)
+      if (level < trialLevel[eleNodes[b]])
+	trialLevel[eleNodes[b]] = level;
+  }
+
+  // counting sorts, levelEnd[k] being the number of level <= k
+  for (k=0; k<numLevels; k++) {
+    eleLevelEnd[k] = 0;
+    nodeLevelEnd[k] = 0;
+    trialLevelEnd[k] = 0;
+  }
+  for (e=0; e<numEles; e++)
+    eleLevelEnd[eleLevel[e]]++;
+  for (i=0; i<numNodes; i++) {
+    nodeLevelEnd[nodeLevel[i]]++;
+    trialLevelEnd[trialLevel[i]]++;
+  }
+  for (k=1; k<numLevels; k++) {
+    eleLevelEnd[k] += eleLevelEnd[k-1];
+    nodeLevelEnd[k] += nodeLevelEnd[k-1];
+    trialLevelEnd[k] += trialLevelEnd[k-1];
+  }
+
+  // fill from the back so the original order is kept within a level
+  for (e=numEles-1; e>=0; e--)
+    eleOrder[--eleLevelEnd[eleLevel[e]]] = e;
+  for (i=numNodes-1; i>=0; i--) {
+    nodeOrder[--nodeLevelEnd[nodeLevel[i]]] = i;
+    trialOrder[--trialLevelEnd[trialLevel[i]]] = i;
+  }
+
+  // the decrements leave the start of each level, shift to the ends
+  for (k=0; k<numLevels-1; k++) {
+    eleLevelEnd[k] = eleLevelEnd[k+1];
+    nodeLevelEnd[k] = nodeLevelEnd[k+1];
+    trialLevelEnd[k] = trialLevelEnd[k+1];
+  }
+  eleLevelEnd[numLevels-1] = numEles;
+  nodeLevelEnd[numLevels-1] = numNodes;
+  trialLevelEnd[numLevels-1] = numNodes;
+
+  delete [] eleLevel;
+  delete [] trialLevel;
+
+  return 0;
+}
+
+
+// int formForces():
+//	sets the trial response of the nodes needed at the level, forms the
+//	element forces of the level and updates the nodes whose interval ends.
+int
+ExplicitDynamicAnalysis::formForces(int level)
+{
+  Domain *the_Domain = this->getDomainPtr();
+  double time = the_Domain->getCurrentTime();
+
+  int numTrial = trialLevelEnd[level];
+  int numActive = eleLevelEnd[level];
+  int numEnding = nodeLevelEnd[level];
+
+  // the partitions of the active elements
+  for (int p=0; p<=numParts; p++)
+    partStart[p] = (int)(((long long)numActive * p)/numParts);
+
+  int result = 0;
+
+  ExplicitTrialTask theTrialTask(*this, time);
+  ExplicitForceTask theForceTask(*this, numActive);
+  ExplicitUpdateTask theUpdateTask(*this, time);
+
+  if (thePool != 0)
+    thePool->execute(theTrialTask, numTrial);
+  else
+    theTrialTask.run(0, numTrial, 0);
+
+  {
+    PerformanceTimer theTimer(PERF_DOMAIN_UPDATE);
+    if (thePool != 0) {
+      if (thePool->execute(theForceTask, numParts, 1) < 0)
+	result = -1;
+    } else if (theForceTask.run(0, numParts, 0) < 0)
+      result = -1;
+
+    // the elements that are not thread safe, by the calling thread into 
+    // their own partition after the others, with or without a ThreadPool
+    for (int p=0; p<numParts; p++) {
+      double *force = partForce[p];
+      for (int k=partStart[p]; k<partStart[p+1]; k++) {
+	int e = eleOrder[k];
+	if (threadSafe[e] == true)
+	  continue;
+	Element *theEle = theEles[e];
+	if (theEle->update() != 0)
+	  result = -1;
+	const Vector &R = theEle->getResistingForceIncInertia();
+	const int *dofs = &eleDOFs[eleDOFStart[e]];
+	int numEleDOF = eleDOFStart[e+1] - eleDOFStart[e];
+	for (int j=0; j<numEleDOF; j++)
+	  force[dofs[j]] += R(j);
+      }
+    }
+  }
+
+  if (thePool != 0)
+    thePool->execute(theUpdateTask, numEnding);
+  else
+    theUpdateTask.run(0, numEnding, 0);
+
+  return result;
+}
+
+
+// int formPartForce():
+//	updates the elements of the partition and adds their resisting forces,
+//	including any damping and element loads, to the partition force array;
+//	the elements that are not thread safe are left for the calling thread.
+int
+ExplicitDynamicAnalysis::formPartForce(int part, int numActive)
+{
+  int result = 0;
+  double *force = partForce[part];
+
+  for (int k=partStart[part]; k<partStart[part+1]; k++) {
+    int e = eleOrder[k];
+    if (threadSafe[e] == false)
+      continue;
+
+    Element *theEle = theEles[e];
+    if (theEle->update() != 0)
+      result = -1;
+
+    const Vector &R = theEle->getResistingForceIncInertia();
+    const int *dofs = &eleDOFs[eleDOFStart[e]];
+    int numEleDOF = eleDOFStart[e+1] - eleDOFStart[e];
+    for (int j=0; j<numEleDOF; j++)
+      force[dofs[j]] += R(j);
+  }
+
+  return result;
+}
+
+
+// void setTrialResponse():
+//	sets the trial displacement of nodes first to last in the trial order
+//	to that at time along their interval, the trial velocity to that over
+//	the interval and the trial acceleration to zero so that the elements 
+//	add no inertia force; the partition forces at the nodes are zeroed.
+void
+ExplicitDynamicAnalysis::setTrialResponse(int first, int last, double time)
+{
+  for (int k=first; k<last; k++) {
+    int i = trialOrder[k];
+    int start = nodeStart[i];
+    int numNodalDOF = nodeStart[i+1] - start;
+    double tau = time - tStart[i];
+
+    for (int j=start; j<start+numNodalDOF; j++) {
+      if (dofFlag[j] == 0)
+	U[j] = Ustart[j] + tau*Vhalf[j];
+      else if (dofFlag[j] == 1)
+	U[j] = dofSP[j]->getValue();
+      for (int p=0; p<numParts; p++)
+	partForce[p][j] = 0.0;
+    }
+
+    Node *theNode = theNodes[i];
+    Vector disp(&U[start], numNodalDOF);
+    Vector vel(&Vhalf[start], numNodalDOF);
+    Vector accel(zeroDOF, numNodalDOF);
+    theNode->setTrialDisp(disp);
+    theNode->setTrialVel(vel);
+    theNode->setTrialAccel(accel);
+  }
+}
+
+
+// void updateResponse():
+//	for nodes first to last in the node order, whose interval ends at time,
+//	determines the acceleration from the unbalance and the velocity at 
+//	time and starts the next interval.
+void
+ExplicitDynamicAnalysis::updateResponse(int first, int last, double time)
+{
+  for (int k=first; k<last; k++) {
+    int i = nodeOrder[k];
+    int start = nodeStart[i];
+    int numNodalDOF = nodeStart[i+1] - start;
+    double h = ldexp(h0, nodeLevel[i]);
+    double tau = time - tStart[i];
+
+    Node *theNode = theNodes[i];
+    const Vector &load = theNode->getUnbalancedLoad();
+
+    for (int j=start; j<start+numNodalDOF; j++) {
+      if (dofFlag[j] == 0) {
+	double force = load(j-start);
+	for (int p=0; p<numParts; p++)
+	  force -= partForce[p][j];
+	A[j] = force/mass[j] - alphaM*Vhalf[j];
+	V[j] = Vhalf[j] + 0.5*h*A[j];
+	Vhalf[j] = V[j] + 0.5*h*A[j];
+      } else {
+	A[j] = 0.0;
+	if (dofFlag[j] == 1 && tau > 0.0)
+	  V[j] = (U[j] - Ustart[j])/tau;
+	else
+	  V[j] = 0.0;
+	Vhalf[j] = 0.0;
+      }
+      Ustart[j] = U[j];
+    }
+    tStart[i] = time;
+
+    Vector vel(&V[start], numNodalDOF);
+    Vector accel(&A[start], numNodalDOF);
+    theNode->setTrialVel(vel);
+    theNode->setTrialAccel(accel);
+  }
+}
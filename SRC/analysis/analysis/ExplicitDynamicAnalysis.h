@@ -0,0 +1,142 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/ExplicitDynamicAnalysis.h,v $
+                                                                        
+                                                                        
+#ifndef ExplicitDynamicAnalysis_h
+#define ExplicitDynamicAnalysis_h
+
+// File: ~/analysis/analysis/ExplicitDynamicAnalysis.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// ExplicitDynamicAnalysis. ExplicitDynamicAnalysis is a TransientAnalysis 
+// performing a central difference analysis directly on the Domain; no 
+// AnalysisModel, ConstraintHandler, Integrator or LinearSOE is used. The 
+// lumped (row sum) mass of the nodes and elements is formed once when the
+// domain changes, the nodal response is kept in flat arrays, and the 
+// resisting forces of the elements are formed in parallel by a ThreadPool, 
+// each of a fixed number of element partitions summing into its own force
+// array so the result does not depend on the number of threads.
+//
+// The stable time step of each element is estimated either from its 
+// characteristic length and a given wave speed, or from a Gershgorin bound
+// on its initial stiffness and the lumped mass; analyze() divides each 
+// step dT into as many substeps as needed. With subcycling, each node is 
+// given the largest step dT/2^K*2^k its elements allow and the elements 
+// are only formed when one of their nodes needs a force.
+//
+// Only single point constraints are supported; the free dof must have mass.
+//
+// What: "@(#) ExplicitDynamicAnalysis.h, revA"
+
+#include <TransientAnalysis.h>
+
+class Element;
+class Node;
+class SP_Constraint;
+class ThreadPool;
+
+class ExplicitDynamicAnalysis: public TransientAnalysis
+{
+  public:
+    ExplicitDynamicAnalysis(Domain &theDomain, double alphaM = 0.0, 
+			    double safetyFactor = 0.9, double waveSpeed = 0.0,
+			    int maxSubcycleLevel = 0, int numThreads = 1);
+    ~ExplicitDynamicAnalysis();
+
+    void clearAll(void);	    
+    int initialize(void);
+    int domainChanged(void);
+    int analyze(int numSteps, double dT);
+
+    double getStableTimeStep(void);
+
+    friend class ExplicitTrialTask;
+    friend class ExplicitForceTask;
+    friend class ExplicitUpdateTask;
+    
+  protected:
+    
+  private:
+    int setTimeStep(double dT);
+    int setLevels(int K);
+    int formForces(int level);
+    int formPartForce(int part, int numActive);
+    void setTrialResponse(int first, int last, double time);
+    void updateResponse(int first, int last, double time);
+
+    // analysis parameters
+    double alphaM;          // mass proportional damping
+    double safetyFactor;    // applied to the stable time step
+    double waveSpeed;       // if > 0 used with the characteristic length
+    int maxLevel;           // maximum subcycling level, 0 for none
+    ThreadPool *thePool;
+    int domainStamp;
+
+    // the nodes and the flat response arrays, node i has its dof
+    // at nodeStart[i] to nodeStart[i+1]-1
+    int numNodes;
+    int numDOF;
+    Node **theNodes;
+    int *nodeStart;
+    double *U, *V, *A;      // current trial response
+    double *Ustart, *Vhalf; // displacement at, and velocity over, the interval
+    double *mass;           // lumped mass
+    int *dofFlag;           // 0 free, 1 constrained, 2 no mass or stiffness
+    SP_Constraint **dofSP;  // the constraint at a constrained dof
+    double *tStart;         // the start time of the interval of each node
+    double *dtNode;         // the stable time step of each node
+    double *zeroDOF;        // zero trial accel for the largest node
+
+    // the elements and the locations of their dof in the flat arrays
+    int numEles;
+    Element **theEles;
+    bool *threadSafe;
+    int *eleDOFStart;
+    int *eleDOFs;
+    int *eleNodeStart;
+    int *eleNodes;
+    double *dtEle;          // the stable time step of each element
+
+    // subcycling levels; the element, ending node and trial node orders 
+    // are sorted by level so that those active at level L are those in 
+    // the first levelEnd[L] locations
+    double deltaT;          // the dT for which the levels were set
+    int numSub;             // number of substeps in dT
+    double h0;              // the substep, dT/numSub
+    int numLevels;
+    int *nodeLevel;
+    int *eleOrder, *eleLevelEnd;
+    int *nodeOrder, *nodeLevelEnd;
+    int *trialOrder, *trialLevelEnd;
+
+    // per partition force arrays
+    int numParts;
+    double **partForce;
+    int *partStart;
+};
+
+#endif
@@ -46,7 +46,9 @@
 #include <Matrix.h>
 #include <ID.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Timer.h>
+#include <PerformanceMonitor.h>
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -80,6 +82,7 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
 
     theIntegrator->setLinks(theModel, theLinSOE, theTest);
     theAlgorithm->setLinks(theModel, theStaticIntegrator, theLinSOE, theTest);
+    theSOE->setLinks(theModel);
 
     if (theTest != 0)
       theAlgorithm->setConvergenceTest(theTest);
@@ -147,6 +150,8 @@ StaticAnalysis::analyze(int numSteps)
 
     for (int i=0; i<numSteps; i++) {
 
+	PerformanceTimer theTimer(PERF_STEP);
+
 	result = theAnalysisModel->analysisStep();
 	if (result < 0) {
 	    opserr << "StaticAnalysis::analyze() - the AnalysisModel failed";
@@ -411,9 +416,9 @@ StaticAnalysis::domainChanged(void)
     // we invoke setSize() on the LinearSOE which
     // causes that object to determine its size
 
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    CSR_Graph &theCSR_Graph = theAnalysisModel->getDOF_CSR_Graph();
 
-    result = theSOE->setSize(theGraph);
+    result = theSOE->setSize(theCSR_Graph);
     if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
 	opserr << "LinearSOE::setSize() failed";
@@ -421,6 +426,7 @@ StaticAnalysis::domainChanged(void)
     }	    
 
     if (theEigenSOE != 0) {
+      Graph &theGraph = theAnalysisModel->getDOFGraph();
       result = theEigenSOE->setSize(theGraph);
       if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
@@ -0,0 +1,194 @@
+// Description: checks ExplicitDynamicAnalysis against a central difference
+// DirectIntegrationAnalysis. A bar of truss elements, three short ones at
+// the fixed end, is loaded at the free end by a ramp. Without subcycling the
+// tip displacement must agree with CentralDifference to round-off, and must
+// not change with the number of threads; with subcycling, the long elements
+// taking four times the step of the short ones, it must agree with the
+// central difference solution at the short step to within the truncation
+// error. The nodes have 3 dof so the stable step from the wave speed checks
+// that the characteristic length only uses the 2 coordinates.
+//
+// usage: testExplicitDynamicAnalysis, exits with the number of failed checks
+
+#include <StandardStream.h>
+#include <Domain.h>
+#include <Node.h>
+#include <SP_Constraint.h>
+#include <NodalLoad.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <ElasticMaterial.h>
+#include <Truss.h>
+#include <ExplicitDynamicAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
+#include <AnalysisModel.h>
+#include <Linear.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <CentralDifference.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <Vector.h>
+#include <math.h>
+#include <stdlib.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static const int numShort = 3;
+static const int numEle = 10;
+static const double Lshort = 0.2;
+static const double Llong = 1.0;
+static const double E = 1000.0;
+static const double rho = 1.0;
+
+static void
+buildModel(Domain &theDomain)
+{
+  double x = 0.0;
+  for (int i=0; i<=numEle; i++) {
+    theDomain.addNode(new Node(i+1, 3, x, 0.0));
+    x += (i < numShort) ? Lshort : Llong;
+  }
+
+  theDomain.addSP_Constraint(new SP_Constraint(1, 0, 0.0, true));
+  for (int i=0; i<=numEle; i++) {
+    theDomain.addSP_Constraint(new SP_Constraint(i+1, 1, 0.0, true));
+    theDomain.addSP_Constraint(new SP_Constraint(i+1, 2, 0.0, true));
+  }
+
+  ElasticMaterial theMaterial(1, E);
+  for (int i=1; i<=numEle; i++)
+    theDomain.addElement(new Truss(i, 2, i, i+1, theMaterial, 1.0, rho));
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries(1));
+  theDomain.addLoadPattern(thePattern);
+  Vector load(3);
+  load(0) = 1.0;
+  theDomain.addNodalLoad(new NodalLoad(1, numEle+1, load), 1);
+}
+
+// the tip displacement at the end of each step of dT
+static void
+runCentralDifference(double dT, int numSteps, Vector &u)
+{
+  Domain theDomain;
+  buildModel(theDomain);
+
+  AnalysisModel *theModel = new AnalysisModel();
+  Linear *theAlgorithm = new Linear();
+  PlainHandler *theHandler = new PlainHandler();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*(new RCM(false)));
+  CentralDifference *theIntegrator = new CentralDifference();
+  BandGenLinSOE *theSOE = new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+  DirectIntegrationAnalysis theAnalysis(theDomain, *theHandler, *theNumberer,
+					*theModel, *theAlgorithm, *theSOE,
+					*theIntegrator);
+
+  u.resize(numSteps);
+  for (int step=0; step<numSteps; step++) {
+    theAnalysis.analyze(1, dT);
+    u(step) = theDomain.getNode(numEle+1)->getDisp()(0);
+  }
+}
+
+static int
+runExplicit(double dT, int numSteps, int maxLevel, int numThreads, Vector &u)
+{
+  Domain theDomain;
+  buildModel(theDomain);
+
+  ExplicitDynamicAnalysis theAnalysis(theDomain, 0.0, 0.9, 0.0, maxLevel, numThreads);
+
+  u.resize(numSteps);
+  for (int step=0; step<numSteps; step++) {
+    if (theAnalysis.analyze(1, dT) < 0)
+      return -1;
+    u(step) = theDomain.getNode(numEle+1)->getDisp()(0);
+  }
+
+  return 0;
+}
+
+static double
+getStableTimeStep(double waveSpeed)
+{
+  Domain theDomain;
+  buildModel(theDomain);
+
+  ExplicitDynamicAnalysis theAnalysis(theDomain, 0.0, 0.9, waveSpeed, 0, 1);
+  return theAnalysis.getStableTimeStep();
+}
+
+// main routine
+int main(int argc, char **argv)
+{
+  int numFailed = 0;
+
+  // the stable step from the wave speed is 0.9 Lshort/c
+  double c = sqrt(E/rho);
+  double dtWave = getStableTimeStep(c);
+  if (fabs(dtWave - 0.9*Lshort/c) > 1.0e-12*dtWave) {
+    opserr << "FAILED - stable time step " << dtWave << " from the wave speed, ";
+    opserr << "expected " << 0.9*Lshort/c << endln;
+    numFailed++;
+  }
+
+  // the Gershgorin bound, 4 steps of which one of the long elements allows
+  double dt = getStableTimeStep(0.0);
+  if (dt <= 0.0 || dt > dtWave) {
+    opserr << "FAILED - stable time step " << dt << endln;
+    exit(numFailed+1);
+  }
+
+  const int numSteps = 4*(int)(2.0/dt/4);
+
+  Vector uCD, u1, u3, uSub;
+  runCentralDifference(dt, numSteps, uCD);
+  double uMax = 0.0;
+  for (int i=0; i<numSteps; i++)
+    if (fabs(uCD(i)) > uMax)
+      uMax = fabs(uCD(i));
+
+  if (runExplicit(dt, numSteps, 0, 1, u1) < 0 ||
+      runExplicit(dt, numSteps, 0, 3, u3) < 0 ||
+      runExplicit(4.0*dt, numSteps/4, 2, 1, uSub) < 0) {
+    opserr << "FAILED - explicit analysis\n";
+    exit(numFailed+1);
+  }
+
+  double maxDiff = 0.0;
+  for (int i=0; i<numSteps; i++) {
+    if (fabs(u1(i)-uCD(i)) > maxDiff)
+      maxDiff = fabs(u1(i)-uCD(i));
+    if (u3(i) != u1(i)) {
+      opserr << "FAILED - step " << i+1 << " 3 threads " << u3(i) << " 1 thread " << u1(i) << endln;
+      numFailed++;
+      break;
+    }
+  }
+  opserr << "no subcycling, max difference from CentralDifference " << maxDiff/uMax;
+  opserr << " of the peak " << uMax << endln;
+  if (maxDiff > 1.0e-10*uMax) {
+    opserr << "FAILED - no subcycling differs from CentralDifference\n";
+    numFailed++;
+  }
+
+  maxDiff = 0.0;
+  for (int i=0; i<numSteps/4; i++)
+    if (fabs(uSub(i)-uCD(4*i+3)) > maxDiff)
+      maxDiff = fabs(uSub(i)-uCD(4*i+3));
+  opserr << "subcycling, max difference from CentralDifference " << maxDiff/uMax;
+  opserr << " of the peak\n";
+  if (maxDiff > 0.02*uMax) {
+    opserr << "FAILED - subcycling differs from CentralDifference\n";
+    numFailed++;
+  }
+
+  if (numFailed == 0)
+    opserr << "ExplicitDynamicAnalysis - all checks passed\n";
+
+  exit(numFailed);
+}
@@ -41,6 +41,7 @@
 #include <ConvergenceTest.h>
 #include <float.h>
 #include <AnalysisModel.h>
+#include <PerformanceMonitor.h>
 
 // Constructor
 VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(
@@ -84,6 +85,8 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
   // loop until analysis has performed the total time incr requested
   while (currentTimeIncr < totalTimeIncr) {
 
+    PerformanceTimer theTimer(PERF_STEP);
+
     if (theModel->analysisStep(currentDt) < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the AnalysisModel failed in newStepDomain";
       opserr << " at time " << theDom->getCurrentTime() << endln;
@@ -711,6 +711,16 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
 }
 
 
+bool
+TransformationDOF_Group::isConstantT(void) const
+{
+    if (theMP == 0)
+	return true;
+
+    return !theMP->isTimeVarying();
+}
+
+
 Matrix *
 TransformationDOF_Group::getT(void)
 {
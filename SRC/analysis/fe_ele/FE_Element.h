@@ -91,6 +91,10 @@ class FE_Element: public TaggedObject
 
     virtual int updateElement(void);
 
+    // true if getTangent()/getResidual() may be invoked on different
+    // objects concurrently, i.e. no class wide storage is used
+    virtual bool isThreadSafe(void) const;
+
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
@@ -128,9 +132,6 @@ class FE_Element: public TaggedObject
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
     
 
 };
@@ -0,0 +1,302 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/fe_ele/transformation/SparseTransformationFE.cpp,v $
+                                                                        
+                                                                        
+// File: ~/analysis/fe_ele/transformation/SparseTransformationFE.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// SparseTransformationFE.
+//
+// What: "@(#) SparseTransformationFE.cpp, revA"
+
+#include <SparseTransformationFE.h>
+#include <stdlib.h>
+
+#include <Element.h>
+#include <DOF_Group.h>
+#include <TransformationDOF_Group.h>
+#include <Matrix.h>
+#include <Vector.h>
+
+SparseTransformationFE::SparseTransformationFE(int tag, Element *ele)
+  :TransformationFE(tag, ele), 
+   mapStart(0), mapIndex(0), mapValue(0), sizeMap(0), constantT(true)
+{
+    mapStart = new int[numOriginalDOF+1];
+    if (mapStart == 0) {
+	opserr << "FATAL SparseTransformationFE::SparseTransformationFE() - out of memory\n";
+	exit(-1);
+    }
+}
+
+
+SparseTransformationFE::~SparseTransformationFE()
+{
+    if (mapStart != 0)
+	delete [] mapStart;
+    if (mapIndex != 0)
+	delete [] mapIndex;
+    if (mapValue != 0)
+	delete [] mapValue;
+}
+
+
+int
+SparseTransformationFE::setID(void)
+{
+    int result = this->TransformationFE::setID();
+    if (result < 0)
+	return result;
+
+    // only an MP_Constraint that varies with time changes T, those nodes
+    // with a T are at a TransformationDOF_Group
+    constantT = true;
+    for (int a=0; a<numGroups; a++) 
+	if (theDOFs[a]->getT() != 0 &&
+	    ((TransformationDOF_Group *)theDOFs[a])->isConstantT() == false)
+	    constantT = false;
+
+    return this->formMap();
+}
+
+
+const Matrix &
+SparseTransformationFE::getTangent(Integrator *theNewIntegrator)
+{
+    const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
+
+    if (constantT == false)
+	this->formMap();
+
+    // modTangent(p,q) = sum T(i,p) K(i,j) T(j,q) over the nonzero T
+    Matrix &modK = *modTangent;
+    modK.Zero();
+
+    for (int j=0; j<numOriginalDOF; j++) {
+	int startJ = mapStart[j];
+	int endJ = mapStart[j+1];
+	for (int i=0; i<numOriginalDOF; i++) {
+	    double Kij = theTangent(i,j);
+	    if (Kij == 0.0)
+		continue;
+
+	    int startI = mapStart[i];
+	    int endI = mapStart[i+1];
+	    for (int q=startJ; q<endJ; q++) {
+		double KijTjq = Kij * mapValue[q];
+		int col = mapIndex[q];
+		for (int p=startI; p<endI; p++)
+		    modK(mapIndex[p], col) += mapValue[p] * KijTjq;
+	    }
+	}
+    }
+
+    return modK;
+}
+
+
+const Vector &
+SparseTransformationFE::getResidual(Integrator *theNewIntegrator)
+{
+    const Vector &theResidual = this->FE_Element::getResidual(theNewIntegrator);
+
+    if (constantT == false)
+	this->formMap();
+
+    // modResidual(p) = sum T(i,p) R(i) over the nonzero T
+    Vector &modR = *modResidual;
+    modR.Zero();
+
+    for (int i=0; i<numOriginalDOF; i++) {
+	double Ri = theResidual(i);
+	if (Ri == 0.0)
+	    continue;
+	for (int p=mapStart[i]; p<mapStart[i+1]; p++)
+	    modR(mapIndex[p]) += mapValue[p] * Ri;
+    }
+
+    return modR;
+}
+
+
+const Vector &
+SparseTransformationFE::getK_Force(const Vector &x, double fact)
+{
+    this->FE_Element::zeroTangent();
+    this->FE_Element::addKtToTang();
+    return this->formForce(this->FE_Element::getTangent(0), x);
+}
+
+
+const Vector &
+SparseTransformationFE::getKi_Force(const Vector &x, double fact)
+{
+    this->FE_Element::zeroTangent();
+    this->FE_Element::addKiToTang();
+    return this->formForce(this->FE_Element::getTangent(0), x);
+}
+
+
+const Vector &
+SparseTransformationFE::getM_Force(const Vector &x, double fact)
+{
+    this->FE_Element::zeroTangent();
+    this->FE_Element::addMtoTang();
+    return this->formForce(this->FE_Element::getTangent(0), x);
+}
+
+
+const Vector &
+SparseTransformationFE::getC_Force(const Vector &x, double fact)
+{
+    this->FE_Element::zeroTangent();
+    this->FE_Element::addCtoTang();
+    return this->formForce(this->FE_Element::getTangent(0), x);
+}
+
+
+// const Vector &formForce():
+//	forms T^t A T x, A being the element matrix, as T^t (A (T x)) through
+//	the map; as in TransformationFE the factor is not applied.
+const Vector &
+SparseTransformationFE::formForce(const Matrix &theMatrix, const Vector &x)
+{
+    if (constantT == false)
+	this->formMap();
+
+    // the components of x at the element dof, T x
+    Vector u(numOriginalDOF);
+    for (int j=0; j<numOriginalDOF; j++) {
+	double sum = 0.0;
+	for (int q=mapStart[j]; q<mapStart[j+1]; q++) {
+	    int dof = (*modID)(mapIndex[q]);
+	    if (dof >= 0)
+		sum += mapValue[q] * x(dof);
+	}
+	u(j) = sum;
+    }
+
+    // modResidual(p) = sum T(i,p) (A u)(i) over the nonzero T
+    Vector &modR = *modResidual;
+    modR.Zero();
+
+    for (int i=0; i<numOriginalDOF; i++) {
+	double Au = 0.0;
+	for (int j=0; j<numOriginalDOF; j++)
+	    Au += theMatrix(i,j) * u(j);
+	if (Au == 0.0)
+	    continue;
+	for (int p=mapStart[i]; p<mapStart[i+1]; p++)
+	    modR(mapIndex[p]) += mapValue[p] * Au;
+    }
+
+    return modR;
+}
+
+
+// int formMap():
+//	stores T for the element by rows, i.e. for each original dof the
+//	transformed dofs and T values; a node without a T maps each dof
+//	to itself with a value of 1.0.
+int
+SparseTransformationFE::formMap(void)
+{
+    // determine the number of entries and check the original dof
+    int numEntries = 0;
+    int numDOF = 0;
+    for (int a=0; a<numGroups; a++) {
+	Matrix *T = theDOFs[a]->getT();
+	if (T != 0) {
+	    numEntries += T->noRows() * T->noCols();
+	    numDOF += T->noRows();
+	} else {
+	    numEntries += theDOFs[a]->getNumDOF();
+	    numDOF += theDOFs[a]->getNumDOF();
+	}
+    }
+
+    if (numDOF != numOriginalDOF) {
+	opserr << "WARNING SparseTransformationFE::formMap() - number of dof at the nodes ";
+	opserr << numDOF << " not equal to number at the element " << numOriginalDOF << endln;
+	return -1;
+    }
+
+    if (numEntries > sizeMap) {
+	if (mapIndex != 0)
+	    delete [] mapIndex;
+	if (mapValue != 0)
+	    delete [] mapValue;
+	mapIndex = new int[numEntries];
+	mapValue = new double[numEntries];
+	if (mapIndex == 0 || mapValue == 0) {
+	    opserr << "FATAL SparseTransformationFE::formMap() - out of memory for ";
+	    opserr << numEntries << " entries\n";
+	    exit(-1);
+	}
+	sizeMap = numEntries;
+    }
+
+    // now fill in the map, keeping only the nonzero entries of T
+    int k = 0;
+    int loc = 0;
+    int startTransformed = 0;
+    mapStart[0] = 0;
+    for (int b=0; b<numGroups; b++) {
+	Matrix *T = theDOFs[b]->getT();
+	if (T != 0) {
+	    int numRows = T->noRows();
+	    int numCols = T->noCols();
+	    for (int r=0; r<numRows; r++) {
+		for (int c=0; c<numCols; c++) {
+		    double value = (*T)(r,c);
+		    if (value != 0.0) {
+			mapIndex[loc] = startTransformed + c;
+			mapValue[loc++] = value;
+		    }
+		}
+		mapStart[++k] = loc;
+	    }
+	    startTransformed += numCols;
+	} else {
+	    int numNodalDOF = theDOFs[b]->getNumDOF();
+	    for (int r=0; r<numNodalDOF; r++) {
+		mapIndex[loc] = startTransformed + r;
+		mapValue[loc++] = 1.0;
+		mapStart[++k] = loc;
+	    }
+	    startTransformed += numNodalDOF;
+	}
+    }
+
+    if (startTransformed != numTransformedDOF) {
+	opserr << "WARNING SparseTransformationFE::formMap() - number of transformed dof ";
+	opserr << startTransformed << " not equal to that in the ID " << numTransformedDOF << endln;
+	return -2;
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/fe_ele/transformation/SparseTransformationFE.h,v $
+                                                                        
+                                                                        
+#ifndef SparseTransformationFE_h
+#define SparseTransformationFE_h
+
+// File: ~/analysis/fe_ele/transformation/SparseTransformationFE.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseTransformationFE. A SparseTransformationFE is a TransformationFE 
+// that stores the nonzero entries of the block diagonal transformation T 
+// of its element as a map from each element dof to the transformed dofs 
+// it contributes to. The map is formed when the ID is set (and again each
+// time for a time varying MP_Constraint), so that T^t K T and T^t R are 
+// formed by scattering the element tangent and residual through the map
+// instead of with dense matrix triple products. The forces T^t K T x, 
+// T^t Ki T x, T^t M T x and T^t C T x are formed as T^t (K (T x)) through 
+// the map, without the class wide buffers of TransformationFE.
+//
+// What: "@(#) SparseTransformationFE.h, revA"
+
+#include <TransformationFE.h>
+
+class SparseTransformationFE: public TransformationFE
+{
+  public:
+    SparseTransformationFE(int tag, Element *theElement);
+    ~SparseTransformationFE();    
+
+    virtual int setID(void);
+    
+    // methods to form and obtain the tangent and residual
+    virtual const Matrix &getTangent(Integrator *theIntegrator);
+    virtual const Vector &getResidual(Integrator *theIntegrator);
+
+    virtual const Vector &getK_Force(const Vector &x, double fact = 1.0);
+    virtual const Vector &getKi_Force(const Vector &x, double fact = 1.0);
+    virtual const Vector &getM_Force(const Vector &x, double fact = 1.0);
+    virtual const Vector &getC_Force(const Vector &x, double fact = 1.0);
+
+  protected:
+    
+  private:
+    int formMap(void);
+    const Vector &formForce(const Matrix &theMatrix, const Vector &x);
+
+    int *mapStart;    // entries for element dof k at mapStart[k] to mapStart[k+1]-1
+    int *mapIndex;    // the transformed dof of each entry
+    double *mapValue; // the T value of each entry
+    int sizeMap;      // the allocated size of mapIndex and mapValue
+    bool constantT;   // true if the map need only be formed in setID()
+};
+
+#endif
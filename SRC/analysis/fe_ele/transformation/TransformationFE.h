@@ -69,6 +69,9 @@ class TransformationFE: public FE_Element
     const Vector &getLastResponse(void);
     int addSP(SP_Constraint &theSP);
 
+    // the class wide transformation matrices are shared
+    bool isThreadSafe(void) const {return false;};
+
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
     virtual void addM_ForceSensitivity       (int gradNumber, const Vector &vect, double fact = 1.0);
@@ -78,9 +81,7 @@ class TransformationFE: public FE_Element
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
     
-  private:
-    
-    // private variables - a copy for each object of the class        
+    // variables - a copy for each object of the class        
     DOF_Group **theDOFs;
     int numSPs;
     SP_Constraint **theSPs;
@@ -91,6 +92,7 @@ class TransformationFE: public FE_Element
     int numTransformedDOF;
     int numOriginalDOF;
     
+  private:
     // static variables - single copy for all objects of the class	
     static Matrix **modMatrices; // array of pointers to class wide matrices
     static Vector **modVectors;  // array of pointers to class widde vectors
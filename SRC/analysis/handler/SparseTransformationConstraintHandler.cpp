@@ -0,0 +1,55 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/handler/SparseTransformationConstraintHandler.cpp,v $
+                                                                        
+                                                                        
+// File: ~/analysis/handler/SparseTransformationConstraintHandler.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// SparseTransformationConstraintHandler.
+//
+// What: "@(#) SparseTransformationConstraintHandler.cpp, revA"
+
+#include <SparseTransformationConstraintHandler.h>
+#include <SparseTransformationFE.h>
+#include <classTags.h>
+
+SparseTransformationConstraintHandler::SparseTransformationConstraintHandler()
+:TransformationConstraintHandler(HANDLER_TAG_SparseTransformationConstraintHandler)
+{
+
+}
+
+SparseTransformationConstraintHandler::~SparseTransformationConstraintHandler()
+{
+
+}
+
+FE_Element *
+SparseTransformationConstraintHandler::createTransformationFE(int tag, Element *theEle)
+{
+    return new SparseTransformationFE(tag, theEle);
+}
@@ -0,0 +1,58 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/handler/SparseTransformationConstraintHandler.h,v $
+                                                                        
+                                                                        
+// File: ~/analysis/handler/SparseTransformationConstraintHandler.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseTransformationConstraintHandler. SparseTransformationConstraintHandler
+// is a TransformationConstraintHandler that creates a SparseTransformationFE 
+// for each element with a constrained node; the element matrices are 
+// transformed with a map of the nonzero T entries formed once per domain 
+// change instead of dense T^t K T products. The DOF_Groups and the treatment 
+// of the SP_Constraints are those of the TransformationConstraintHandler.
+//
+// What: "@(#) SparseTransformationConstraintHandler.h, revA"
+
+#ifndef SparseTransformationConstraintHandler_h
+#define SparseTransformationConstraintHandler_h
+
+#include <TransformationConstraintHandler.h>
+
+class SparseTransformationConstraintHandler : public TransformationConstraintHandler
+{
+  public:
+    SparseTransformationConstraintHandler();
+    ~SparseTransformationConstraintHandler();
+
+  protected:
+    FE_Element *createTransformationFE(int tag, Element *theEle);
+    
+  private:
+};
+
+#endif
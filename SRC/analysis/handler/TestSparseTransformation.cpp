@@ -0,0 +1,268 @@
+// Description: checks the SparseTransformation handler against the
+// Transformation handler. A two storey, two by two bay frame of elastic
+// beams has a rigid diaphragm at each floor, the retained node of which
+// carries the floor mass and a lateral load. The same static and Newmark
+// analyses, with Rayleigh damping, are run with each handler; the nodal
+// displacements, and the forces T^t K T x, T^t Ki T x, T^t M T x and
+// T^t C T x of every element, must agree to round-off.
+//
+// usage: testSparseTransformation, exits with the number of failed checks
+
+#include <StandardStream.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <SP_Constraint.h>
+#include <RigidDiaphragm.h>
+#include <NodalLoad.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <LinearCrdTransf3d.h>
+#include <ElasticBeam3d.h>
+#include <StaticAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <Linear.h>
+#include <TransformationConstraintHandler.h>
+#include <SparseTransformationConstraintHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <LoadControl.h>
+#include <Newmark.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <math.h>
+#include <stdlib.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static const int numBay = 2;
+static const int numStorey = 2;
+static const int numSteps = 20;
+
+static int
+nodeTag(int i, int j, int k)
+{
+  return 1 + i + j*(numBay+1) + k*(numBay+1)*(numBay+1);
+}
+
+static void
+buildModel(Domain &theDomain)
+{
+  const double L = 5.0;
+  const double H = 3.0;
+
+  for (int k=0; k<=numStorey; k++)
+    for (int j=0; j<=numBay; j++)
+      for (int i=0; i<=numBay; i++) {
+	int tag = nodeTag(i,j,k);
+	theDomain.addNode(new Node(tag, 6, i*L, j*L, k*H));
+	if (k == 0)
+	  for (int dof=0; dof<6; dof++)
+	    theDomain.addSP_Constraint(new SP_Constraint(tag, dof, 0.0, true));
+      }
+
+  // the retained node of each floor, at its centre and carrying its mass
+  int numNodes = (numBay+1)*(numBay+1)*(numStorey+1);
+  Matrix mass(6,6);
+  mass(0,0) = mass(1,1) = 50.0;
+  mass(5,5) = 50.0*numBay*numBay*L*L/6.0;
+  ID constrained((numBay+1)*(numBay+1));
+  for (int k=1; k<=numStorey; k++) {
+    int tagR = numNodes + k;
+    Node *theNode = new Node(tagR, 6, 0.5*numBay*L + 0.3, 0.5*numBay*L - 0.2, k*H);
+    theNode->setMass(mass);
+    theDomain.addNode(theNode);
+    for (int dof=2; dof<5; dof++)
+      theDomain.addSP_Constraint(new SP_Constraint(tagR, dof, 0.0, true));
+    for (int j=0; j<=numBay; j++)
+      for (int i=0; i<=numBay; i++)
+	constrained(i + j*(numBay+1)) = nodeTag(i,j,k);
+    RigidDiaphragm theDiaphragm(theDomain, tagR, constrained, 2);
+  }
+
+  Vector vecxzCol(3), vecxzBeam(3);
+  vecxzCol(0) = 1.0;
+  vecxzBeam(2) = 1.0;
+  LinearCrdTransf3d theColTransf(1, vecxzCol);
+  LinearCrdTransf3d theBeamTransf(2, vecxzBeam);
+
+  const double A = 0.16, E = 3.0e7, G = 1.25e7, J = 0.0036, I = 0.0021;
+  const double rho = 0.4;
+  int eleTag = 1;
+  for (int k=0; k<numStorey; k++)
+    for (int j=0; j<=numBay; j++)
+      for (int i=0; i<=numBay; i++)
+	theDomain.addElement(new ElasticBeam3d(eleTag++, A, E, G, J, I, 1.2*I,
+					       nodeTag(i,j,k), nodeTag(i,j,k+1),
+					       theColTransf, rho));
+  for (int k=1; k<=numStorey; k++)
+    for (int j=0; j<=numBay; j++)
+      for (int i=0; i<numBay; i++) {
+	theDomain.addElement(new ElasticBeam3d(eleTag++, A, E, G, J, I, 1.5*I,
+					       nodeTag(i,j,k), nodeTag(i+1,j,k),
+					       theBeamTransf, rho));
+	theDomain.addElement(new ElasticBeam3d(eleTag++, A, E, G, J, I, 1.5*I,
+					       nodeTag(j,i,k), nodeTag(j,i+1,k),
+					       theBeamTransf, rho));
+      }
+
+  // lateral loads at the retained nodes and a vertical load at the corners
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries(1));
+  theDomain.addLoadPattern(thePattern);
+  Vector load(6);
+  int loadTag = 1;
+  for (int k=1; k<=numStorey; k++) {
+    load.Zero();
+    load(0) = 10.0*k;
+    load(1) = -4.0*k;
+    load(5) = 3.0;
+    theDomain.addNodalLoad(new NodalLoad(loadTag++, numNodes + k, load), 1);
+    load.Zero();
+    load(2) = -20.0;
+    theDomain.addNodalLoad(new NodalLoad(loadTag++, nodeTag(numBay,numBay,k), load), 1);
+  }
+
+  theDomain.setRayleighDampingFactors(0.2, 0.002, 0.0, 0.0);
+}
+
+// the displacements of all nodes in tag order after the static analysis
+// and after each step of the transient analysis, and the element forces
+static void
+runAnalysis(bool sparse, Matrix &u, Matrix &forces)
+{
+  Domain theDomain;
+  buildModel(theDomain);
+
+  ConstraintHandler *theHandler = 0;
+  if (sparse == true)
+    theHandler = new SparseTransformationConstraintHandler();
+  else
+    theHandler = new TransformationConstraintHandler();
+
+  AnalysisModel *theModel = new AnalysisModel();
+  Linear *theAlgorithm = new Linear();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*(new RCM(false)));
+  LoadControl *theStatic = new LoadControl(1.0, 1, 1.0, 1.0);
+  BandGenLinSOE *theSOE = new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+
+  StaticAnalysis *theStaticAnalysis =
+    new StaticAnalysis(theDomain, *theHandler, *theNumberer, *theModel,
+		       *theAlgorithm, *theSOE, *theStatic);
+
+  int numNodes = theDomain.getNumNodes();
+  u.resize(numNodes*6, numSteps+1);
+  u.Zero();
+
+  theStaticAnalysis->analyze(1);
+
+  int step = 0;
+  Node *theNode;
+  NodeIter &theNodes = theDomain.getNodes();
+  for (int n=0; (theNode = theNodes()) != 0; n++) {
+    const Vector &disp = theNode->getDisp();
+    for (int dof=0; dof<6; dof++)
+      u(6*n+dof, step) = disp(dof);
+  }
+
+  // the element forces for the vector of equation numbers
+  int numEqn = theSOE->getNumEqn();
+  Vector x(numEqn);
+  for (int i=0; i<numEqn; i++)
+    x(i) = 1.0 + 0.1*i;
+  int numEles = theDomain.getNumElements();
+  forces.resize(12*4, numEles);
+  forces.Zero();
+  FE_Element *theFE;
+  FE_EleIter &theFEs = theModel->getFEs();
+  while ((theFE = theFEs()) != 0) {
+    int col = theFE->getElement()->getTag() - 1;
+    for (int type=0; type<4; type++) {
+      const Vector &force = (type == 0) ? theFE->getK_Force(x) :
+	(type == 1) ? theFE->getKi_Force(x) :
+	(type == 2) ? theFE->getM_Force(x) : theFE->getC_Force(x);
+      for (int i=0; i<force.Size() && i<12; i++)
+	forces(12*type+i, col) = force(i);
+    }
+  }
+
+  theStaticAnalysis->clearAll();
+  delete theStaticAnalysis;
+
+  // the transient analysis from the static state
+  theModel = new AnalysisModel();
+  theAlgorithm = new Linear();
+  theNumberer = new DOF_Numberer(*(new RCM(false)));
+  theSOE = new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+  if (sparse == true)
+    theHandler = new SparseTransformationConstraintHandler();
+  else
+    theHandler = new TransformationConstraintHandler();
+  Newmark *theIntegrator = new Newmark(0.5, 0.25);
+
+  DirectIntegrationAnalysis theAnalysis(theDomain, *theHandler, *theNumberer,
+					*theModel, *theAlgorithm, *theSOE,
+					*theIntegrator);
+
+  for (step=1; step<=numSteps; step++) {
+    theAnalysis.analyze(1, 0.01);
+    NodeIter &theNodes = theDomain.getNodes();
+    for (int n=0; (theNode = theNodes()) != 0; n++) {
+      const Vector &disp = theNode->getDisp();
+      for (int dof=0; dof<6; dof++)
+	u(6*n+dof, step) = disp(dof);
+    }
+  }
+}
+
+static double
+maxAbs(const Matrix &A)
+{
+  double result = 0.0;
+  for (int i=0; i<A.noRows(); i++)
+    for (int j=0; j<A.noCols(); j++)
+      if (fabs(A(i,j)) > result)
+	result = fabs(A(i,j));
+  return result;
+}
+
+// main routine
+int main(int argc, char **argv)
+{
+  int numFailed = 0;
+
+  Matrix u, uSparse, forces, forcesSparse;
+  runAnalysis(false, u, forces);
+  runAnalysis(true, uSparse, forcesSparse);
+
+  double uMax = maxAbs(u);
+  double fMax = maxAbs(forces);
+  Matrix du = uSparse - u;
+  Matrix df = forcesSparse - forces;
+  double duMax = maxAbs(du);
+  double dfMax = maxAbs(df);
+
+  opserr << "max displacement " << uMax << ", max difference " << duMax << endln;
+  opserr << "max element force " << fMax << ", max difference " << dfMax << endln;
+
+  if (uMax == 0.0 || duMax > 1.0e-10*uMax) {
+    opserr << "FAILED - displacements differ\n";
+    numFailed++;
+  }
+  if (fMax == 0.0 || dfMax > 1.0e-10*fMax) {
+    opserr << "FAILED - element forces differ\n";
+    numFailed++;
+  }
+
+  if (numFailed == 0)
+    opserr << "SparseTransformationConstraintHandler - all checks passed\n";
+
+  exit(numFailed);
+}
@@ -62,6 +62,13 @@ TransformationConstraintHandler::TransformationConstraintHandler()
 
 }
 
+TransformationConstraintHandler::TransformationConstraintHandler(int classTag)
+:ConstraintHandler(classTag),
+ theFEs(0), theDOFs(0),numFE(0),numDOF(0),numConstrainedNodes(0)
+{
+
+}
+
 TransformationConstraintHandler::~TransformationConstraintHandler()
 {
   if (theDOFs != 0) 
@@ -328,7 +335,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	      return -5;
 	    }	
 	  } else {
-	    if ((fePtr = new TransformationFE(numFeEle, elePtr)) == 0) {		
+	    if ((fePtr = this->createTransformationFE(numFeEle, elePtr)) == 0) {		
 	      opserr << "WARNING TransformationConstraintHandler::handle()";
 	      opserr << " - ran out of memory";
 	      opserr << " creating TransformationFE " << elePtr->getTag() << endln; 
@@ -354,7 +361,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	    return -5;
 	  }	
 	} else {
-	  if ((fePtr = new TransformationFE(numFeEle, elePtr)) == 0) {		
+	  if ((fePtr = this->createTransformationFE(numFeEle, elePtr)) == 0) {		
 	    opserr << "WARNING TransformationConstraintHandler::handle()";
 	    opserr << " - ran out of memory";
 	    opserr << " creating TransformationFE " << elePtr->getTag() << endln; 
@@ -407,6 +414,13 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 
 
 
+FE_Element *
+TransformationConstraintHandler::createTransformationFE(int tag, Element *theEle)
+{
+    return new TransformationFE(tag, theEle);
+}
+
+
 void 
 TransformationConstraintHandler::clearAll(void)
 {
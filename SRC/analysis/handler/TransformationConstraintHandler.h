@@ -44,6 +44,7 @@
 
 class FE_Element;
 class DOF_Group;
+class Element;
 
 class TransformationConstraintHandler : public ConstraintHandler
 {
@@ -62,6 +63,10 @@ class TransformationConstraintHandler : public ConstraintHandler
 			 FEM_ObjectBroker &theBroker);
 
   protected:
+    TransformationConstraintHandler(int classTag);
+
+    // creates the FE_Element for an element with a constrained node
+    virtual FE_Element *createTransformationFE(int tag, Element *theEle);
     
   private:
     FE_Element 	**theFEs;
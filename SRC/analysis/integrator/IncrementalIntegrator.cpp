@@ -39,12 +39,64 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <ThreadPool.h>
+#include <PerformanceMonitor.h>
 #include <cmath>
 
+// ThreadTasks used to form the FE_Element tangents and residuals in
+// parallel; FE_Elements that are not thread safe are left for the
+// calling thread to form when their contribution is added to the SOE
+class FormTangentTask: public ThreadTask
+{
+  public:
+    FormTangentTask(IncrementalIntegrator &theIntegrator,
+		    FE_Element **theFEs, const Matrix **theTangents)
+      :theIntegrator(theIntegrator), theFEs(theFEs), theTangents(theTangents) {};
+    int run(int first, int last, int threadID) {
+      for (int i=first; i<last; i++) {
+	FE_Element *elePtr = theFEs[i];
+	if (elePtr->isThreadSafe() == true) {
+	  PerformanceTimer theTimer(PERF_FORM_TANGENT, elePtr->getElement());
+	  theTangents[i] = &(elePtr->getTangent(&theIntegrator));
+	} else
+	  theTangents[i] = 0;
+      }
+      return 0;
+    }
+  private:
+    IncrementalIntegrator &theIntegrator;
+    FE_Element **theFEs;
+    const Matrix **theTangents;
+};
+
+class FormResidualTask: public ThreadTask
+{
+  public:
+    FormResidualTask(IncrementalIntegrator &theIntegrator,
+		     FE_Element **theFEs, const Vector **theResiduals)
+      :theIntegrator(theIntegrator), theFEs(theFEs), theResiduals(theResiduals) {};
+    int run(int first, int last, int threadID) {
+      for (int i=first; i<last; i++) {
+	FE_Element *elePtr = theFEs[i];
+	if (elePtr->isThreadSafe() == true) {
+	  PerformanceTimer theTimer(PERF_FORM_UNBALANCE, elePtr->getElement());
+	  theResiduals[i] = &(elePtr->getResidual(&theIntegrator));
+	} else
+	  theResiduals[i] = 0;
+      }
+      return 0;
+    }
+  private:
+    IncrementalIntegrator &theIntegrator;
+    FE_Element **theFEs;
+    const Vector **theResiduals;
+};
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), modalDampingValues(0), theEigenSOE(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ thePool(0), theFEs(0), theTangents(0), theResiduals(0), numFEs(0), sizeFEs(0)
 {
 
 }
@@ -53,6 +105,15 @@ IncrementalIntegrator::~IncrementalIntegrator()
 {
   if (modalDampingValues != 0)
     delete modalDampingValues;
+
+  if (thePool != 0)
+    delete thePool;
+
+  if (theFEs != 0) {
+    delete [] theFEs;
+    delete [] theTangents;
+    delete [] theResiduals;
+  }
 }
 
 void
@@ -61,6 +122,8 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
     theAnalysisModel = &theModel;
     theSOE = &theLinSOE;
     theTest = theConvergenceTest;
+
+    theAnalysisModel->setNumThreads(this->getNumThreads());
 }
 
 
@@ -72,6 +135,8 @@ IncrementalIntegrator::setEigenSOE(EigenSOE *theEigSOE) {
 int 
 IncrementalIntegrator::formTangent(int statFlag)
 {
+    PerformanceTimer theTimer(PERF_FORM_TANGENT);
+
     int result = 0;
     statusFlag = statFlag;
 
@@ -88,14 +153,8 @@ IncrementalIntegrator::formTangent(int statFlag)
     // efficiency when performing parallel computations - CHANGE
 
     // loop through the FE_Elements adding their contributions to the tangent
-    FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "WARNING IncrementalIntegrator::formTangent -";
-	    opserr << " failed in addA for ID " << elePtr->getID();	    
-	    result = -3;
-	}
+    if (this->formElementTangent() < 0)
+	result = -3;
 
     return result;
 }
@@ -104,6 +163,8 @@ IncrementalIntegrator::formTangent(int statFlag)
 int 
 IncrementalIntegrator::formUnbalance(void)
 {
+    PerformanceTimer theTimer(PERF_FORM_UNBALANCE);
+
     if (theAnalysisModel == 0 || theSOE == 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance -";
 	opserr << " no AnalysisModel or LinearSOE has been set\n";
@@ -251,10 +312,43 @@ IncrementalIntegrator::formElementResidual(void)
 
     int res = 0;    
 
+    if (thePool != 0) {
+
+	// form the residuals in parallel & then add them in order
+	if (this->getFEs() < 0)
+	    return -1;
+
+	FormResidualTask theTask(*this, theFEs, theResiduals);
+	thePool->execute(theTask, numFEs);
+
+	for (int i=0; i<numFEs; i++) {
+	    elePtr = theFEs[i];
+	    const Vector *theResidual = theResiduals[i];
+	    if (theResidual == 0) {
+		PerformanceTimer theTimer(PERF_FORM_UNBALANCE, elePtr->getElement());
+		theResidual = &(elePtr->getResidual(this));
+	    }
+
+	    if (theSOE->addB(*theResidual,elePtr->getID()) <0) {
+		opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+		opserr << " failed in addB for ID " << elePtr->getID();
+		res = -2;
+	    }
+	}
+
+	return res;
+    }
+
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0) {
 
-	if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0) {
+	const Vector *theResidual;
+	{
+	  PerformanceTimer theTimer(PERF_FORM_UNBALANCE, elePtr->getElement());
+	  theResidual = &(elePtr->getResidual(this));
+	}
+
+	if (theSOE->addB(*theResidual,elePtr->getID()) <0) {
 	    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
 	    opserr << " failed in addB for ID " << elePtr->getID();
 	    res = -2;
@@ -264,6 +358,153 @@ IncrementalIntegrator::formElementResidual(void)
     return res;	    
 }
 
+int 
+IncrementalIntegrator::formElementTangent(void)
+{
+    // loop through the FE_Elements and add the tangent
+    FE_Element *elePtr;
+
+    int res = 0;    
+
+    if (thePool != 0) {
+
+	// form the tangents in parallel & then add them in order
+	if (this->getFEs() < 0)
+	    return -1;
+
+	FormTangentTask theTask(*this, theFEs, theTangents);
+	thePool->execute(theTask, numFEs);
+
+	for (int i=0; i<numFEs; i++) {
+	    elePtr = theFEs[i];
+	    const Matrix *theTangent = theTangents[i];
+	    if (theTangent == 0) {
+		PerformanceTimer theTimer(PERF_FORM_TANGENT, elePtr->getElement());
+		theTangent = &(elePtr->getTangent(this));
+	    }
+
+	    if (theSOE->addA(*theTangent,elePtr->getID()) < 0) {
+		opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+		opserr << " failed in addA for ID " << elePtr->getID();	    
+		res = -3;
+	    }
+	}
+
+	return res;
+    }
+
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+    while((elePtr = theEles2()) != 0) {
+
+	const Matrix *theTangent;
+	{
+	  PerformanceTimer theTimer(PERF_FORM_TANGENT, elePtr->getElement());
+	  theTangent = &(elePtr->getTangent(this));
+	}
+
+	if (theSOE->addA(*theTangent,elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementTangent -";
+	    opserr << " failed in addA for ID " << elePtr->getID();	    
+	    res = -3;
+	}
+    }
+
+    return res;
+}
+
+int
+IncrementalIntegrator::setNumThreads(int numThreads)
+{
+  if (numThreads <= 0)
+    numThreads = ThreadPool::getNumProcessors();
+
+#ifndef OPS_HAVE_THREAD_LOCAL
+  // the element scratch storage is shared between threads
+  if (numThreads != 1) {
+    opserr << "WARNING IncrementalIntegrator::setNumThreads() - compiled without thread local storage, using 1 thread\n";
+    numThreads = 1;
+  }
+#endif
+
+  if (thePool != 0) {
+    if (thePool->getNumThreads() == numThreads)
+      return 0;
+    delete thePool;
+    thePool = 0;
+  }
+
+  if (theAnalysisModel != 0)
+    theAnalysisModel->setNumThreads(1);
+
+  if (numThreads == 1)
+    return 0;
+
+  thePool = new ThreadPool(numThreads);
+  if (thePool == 0) {
+    opserr << "WARNING IncrementalIntegrator::setNumThreads() - out of memory\n";
+    return -1;
+  }
+
+  // the pool may have been able to start fewer threads than asked for
+  if (thePool->getNumThreads() == 1) {
+    delete thePool;
+    thePool = 0;
+  }
+
+  // the DOF graph is built with as many threads
+  if (theAnalysisModel != 0)
+    theAnalysisModel->setNumThreads(this->getNumThreads());
+
+  return 0;
+}
+
+int
+IncrementalIntegrator::getNumThreads(void) const
+{
+  if (thePool == 0)
+    return 1;
+
+  return thePool->getNumThreads();
+}
+
+int
+IncrementalIntegrator::getFEs(void)
+{
+    // gather the FE_Elements into an array so they can be handed
+    // out to the threads; the array is grown as needed
+    numFEs = 0;
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();    
+    while((elePtr = theEles()) != 0) {
+	if (numFEs == sizeFEs) {
+	    int newSize = 2*sizeFEs;
+	    if (newSize < 1024)
+		newSize = 1024;
+	    FE_Element **newFEs = new FE_Element *[newSize];
+	    const Matrix **newTangents = new const Matrix *[newSize];
+	    const Vector **newResiduals = new const Vector *[newSize];
+	    if (newFEs == 0 || newTangents == 0 || newResiduals == 0) {
+		opserr << "WARNING IncrementalIntegrator::getFEs() - out of memory\n";
+		return -1;
+	    }
+	    for (int i=0; i<numFEs; i++)
+		newFEs[i] = theFEs[i];
+	    if (theFEs != 0) {
+		delete [] theFEs;
+		delete [] theTangents;
+		delete [] theResiduals;
+	    }
+	    theFEs = newFEs;
+	    theTangents = newTangents;
+	    theResiduals = newResiduals;
+	    sizeFEs = newSize;
+	}
+	theFEs[numFEs++] = elePtr;
+    }
+
+    return 0;
+}
+
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
 {
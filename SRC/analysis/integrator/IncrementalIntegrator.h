@@ -45,6 +45,8 @@ class ConvergenceTest;
 class FE_Element;
 class DOF_Group;
 class Vector;
+class Matrix;
+class ThreadPool;
 
 #define CURRENT_TANGENT 0
 #define INITIAL_TANGENT 1
@@ -86,6 +88,11 @@ class IncrementalIntegrator : public Integrator
     int setModalDampingFactors(const Vector &);
     int addModalDampingForce(void);
 
+    // method to have the element tangents and residuals formed by
+    // numThreads threads, 1 for serial assembly, 0 for one per processor
+    int setNumThreads(int numThreads);
+    int getNumThreads(void) const;
+
 // AddingSensitivity:BEGIN //////////////////////////////////
     virtual int revertToStart();
 // AddingSensitivity:END ////////////////////////////////////
@@ -100,6 +107,7 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    virtual int  formElementTangent(void);
     int statusFlag;
 
     Vector *modalDampingValues;
@@ -109,6 +117,16 @@ class IncrementalIntegrator : public Integrator
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
+
+    // for parallel assembly; the FE_Element tangents & residuals are 
+    // formed by the threads and then added to the SOE in FE_Element order
+    int  getFEs(void);
+    ThreadPool *thePool;
+    FE_Element **theFEs;
+    const Matrix **theTangents;
+    const Vector **theResiduals;
+    int numFEs;
+    int sizeFEs;
 };
 
 #endif
@@ -31,6 +31,7 @@
 #include <AnalysisModel.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <PerformanceMonitor.h>
 
 KRAlphaExplicit::KRAlphaExplicit()
     : TransientIntegrator(INTEGRATOR_TAGS_KRAlphaExplicit),
@@ -250,6 +251,8 @@ int KRAlphaExplicit::revertToLastStep()
 
 int KRAlphaExplicit::formTangent(int statFlag)
 {
+    PerformanceTimer theTimer(PERF_FORM_TANGENT);
+
     statusFlag = statFlag;
     
     LinearSOE *theLinSOE = this->getLinearSOE();
@@ -44,10 +44,13 @@
 #include <FEM_ObjectBroker.h>
 #include <string.h>
 #include <NodeIter.h>
+#include <ElementIter.h>
+#include <Element.h>
 #include <Domain.h>
 #include <Node.h>
 #include <LoadPattern.h>
 #include <LoadPatternIter.h>
+#include <SparseRayleighDamping.h>
 
 #include <elementAPI.h>
 
@@ -62,8 +65,8 @@ OPS_NewNewmark(void)
   TransientIntegrator *theIntegrator = 0;
 
   int argc = OPS_GetNumRemainingInputArgs();
-  if (argc != 2 && argc != 4) {
-    opserr << "WARNING - incorrect number of args want Newmark $gamma $beta <-form $typeUnknown>\n";
+  if (argc < 2) {
+    opserr << "WARNING - incorrect number of args want Newmark $gamma $beta <-form $typeUnknown> <-rayleigh $alphaM $betaK0 $betaKc>\n";
     return 0;
   }
 
@@ -71,27 +74,41 @@ OPS_NewNewmark(void)
   double dData[2];
   int numData = 2;
   if (OPS_GetDouble(&numData, dData) != 0) {
-    opserr << "WARNING - invalid args want Newmark $gamma $beta <-form $typeUnknown>\n";
+    opserr << "WARNING - invalid args want Newmark $gamma $beta <-form $typeUnknown> <-rayleigh $alphaM $betaK0 $betaKc>\n";
     return 0;
   }
+
+  bool rayleighFlag = false;
+  double rayleighData[3] = {0.0, 0.0, 0.0};
   
-  if (argc == 2)
-    theIntegrator = new Newmark(dData[0], dData[1]);
-  else {
+  while (OPS_GetNumRemainingInputArgs() > 0) {
     char nextString[10];
     OPS_GetString(nextString, 10);
-    if (strcmp(nextString,"-form") == 0) {
+    if (strcmp(nextString,"-form") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
       OPS_GetString(nextString, 10);
       if ((nextString[0] == 'D') || (nextString[0] == 'd')) 
 	dispFlag = true;
       else if ((nextString[0] == 'A') || (nextString[0] == 'a')) 
 	dispFlag = false;      
-    }    
-    theIntegrator = new Newmark(dData[0], dData[1], dispFlag);
+    } else if (strcmp(nextString,"-rayleigh") == 0) {
+      numData = 3;
+      if (OPS_GetNumRemainingInputArgs() < 3 || 
+	  OPS_GetDouble(&numData, rayleighData) != 0) {
+	opserr << "WARNING - invalid args want Newmark $gamma $beta -rayleigh $alphaM $betaK0 $betaKc\n";
+	return 0;
+      }
+      rayleighFlag = true;
+    }
   }
 
+  theIntegrator = new Newmark(dData[0], dData[1], dispFlag);
+
   if (theIntegrator == 0)
     opserr << "WARNING - out of memory creating Newmark integrator\n";
+  else if (rayleighFlag == true)
+    ((Newmark *)theIntegrator)->setRayleighDampingFactors(rayleighData[0], 
+							  rayleighData[1], 
+							  rayleighData[2]);
 
   return theIntegrator;
 }
@@ -102,7 +119,7 @@ Newmark::Newmark()
       displ(true), gamma(0), beta(0), 
       c1(0.0), c2(0.0), c3(0.0), 
       Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-      determiningMass(false),
+      determiningMass(false), theRayleighDamping(0),
       sensitivityFlag(0), gradNumber(0), massMatrixMultiplicator(0),
       dampingMatrixMultiplicator(0), assemblyFlag(0), independentRHS()
 {
@@ -115,7 +132,7 @@ Newmark::Newmark(double _gamma, double _beta, bool dispFlag, bool aflag)
       displ(dispFlag), gamma(_gamma), beta(_beta), 
       c1(0.0), c2(0.0), c3(0.0), 
       Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-      determiningMass(false),
+      determiningMass(false), theRayleighDamping(0),
       sensitivityFlag(0), gradNumber(0), massMatrixMultiplicator(0),
       dampingMatrixMultiplicator(0), assemblyFlag(aflag), independentRHS()
 {
@@ -144,6 +161,9 @@ Newmark::~Newmark()
     
     if (dampingMatrixMultiplicator!=0)
 	delete dampingMatrixMultiplicator;
+
+    if (theRayleighDamping != 0)
+	delete theRayleighDamping;
 }
 
 
@@ -287,6 +307,63 @@ int Newmark::formNodTangent(DOF_Group *theDof)
 }    
 
 
+int Newmark::formTangent(int statFlag)
+{
+    int result = this->TransientIntegrator::formTangent(statFlag);
+
+    // add c2 times the damping matrix assembled in domainChanged()
+    if (theRayleighDamping != 0 && determiningMass == false)  {
+        LinearSOE *theLinSOE = this->getLinearSOE();
+        if (theRayleighDamping->addToTang(*theLinSOE, c2) < 0)  {
+            opserr << "Newmark::formTangent() - failed to add Rayleigh damping\n";
+            result = -3;
+        }
+    }
+
+    return result;
+}
+
+
+int Newmark::formUnbalance(void)
+{
+    int result = this->IncrementalIntegrator::formUnbalance();
+    if (result < 0 || theRayleighDamping == 0)
+        return result;
+
+    // the damping forces D*Udot are part of the resisting force
+    LinearSOE *theLinSOE = this->getLinearSOE();
+    if (theRayleighDamping->addToResidual(*theLinSOE, *Udot, -1.0) < 0)  {
+        opserr << "Newmark::formUnbalance() - failed to add Rayleigh damping forces\n";
+        return -3;
+    }
+
+    return 0;
+}
+
+
+int Newmark::setRayleighDampingFactors(double alphaM, double betaK0, double betaKc)
+{
+    if (theRayleighDamping != 0)
+        delete theRayleighDamping;
+    theRayleighDamping = 0;
+
+    if (alphaM == 0.0 && betaK0 == 0.0 && betaKc == 0.0)
+        return 0;
+
+    theRayleighDamping = new SparseRayleighDamping(alphaM, betaK0, betaKc);
+    if (theRayleighDamping == 0)  {
+        opserr << "Newmark::setRayleighDampingFactors() - out of memory\n";
+        return -1;
+    }
+
+    // if already in an analysis the matrices are needed now
+    if (this->getAnalysisModel() != 0 && U != 0)
+        return theRayleighDamping->setSize(*(this->getAnalysisModel()));
+
+    return 0;
+}
+
+
 int Newmark::domainChanged()
 {
     AnalysisModel *myModel = this->getAnalysisModel();
@@ -384,6 +461,38 @@ int Newmark::domainChanged()
             }
         }
     }    
+
+    // form the damping matrix for the new set of equations
+    if (theRayleighDamping != 0)  {
+        if (theRayleighDamping->setSize(*myModel) < 0)  {
+            opserr << "Newmark::domainChanged - failed to form the Rayleigh damping matrix\n";
+            return -2;
+        }
+
+        // only the current tangent betaK term is meant to be left with the
+        // elements, any other factor set on them is added a second time
+        Domain *theDomain = myModel->getDomainPtr();
+        int numEle = 0, numNode = 0;
+        double alphaM, betaK, betaK0, betaKc;
+        ElementIter &theEles = theDomain->getElements();
+        Element *elePtr;
+        while ((elePtr = theEles()) != 0)  {
+            elePtr->getRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+            if (alphaM != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
+                numEle++;
+        }
+        NodeIter &theNodes = theDomain->getNodes();
+        Node *nodePtr;
+        while ((nodePtr = theNodes()) != 0)  {
+            if (nodePtr->getRayleighDampingFactor() != 0.0)
+                numNode++;
+        }
+        if (numEle != 0 || numNode != 0)  {
+            opserr << "WARNING Newmark::domainChanged - " << numEle << " elements and ";
+            opserr << numNode << " nodes have Rayleigh factors as well as -rayleigh, ";
+            opserr << "their damping is counted twice\n";
+        }
+    }
     
     return 0;
 }
@@ -434,15 +543,37 @@ int Newmark::update(const Vector &deltaU)
 }    
 
 
+int Newmark::commit(void)
+{
+    int result = this->IncrementalIntegrator::commit();
+
+    // the betaKc part of the damping matrix follows the committed tangent
+    if (result == 0 && theRayleighDamping != 0)  {
+        AnalysisModel *theModel = this->getAnalysisModel();
+        if (theRayleighDamping->commitState(*theModel) < 0)  {
+            opserr << "Newmark::commit() - failed to update the Rayleigh damping matrix\n";
+            return -2;
+        }
+    }
+
+    return result;
+}
+
+
 int Newmark::sendSelf(int cTag, Channel &theChannel)
 {
-    Vector data(3);
+    Vector data(6);
     data(0) = gamma;
     data(1) = beta;
     if (displ == true) 
         data(2) = 1.0;
     else
         data(2) = 0.0;
+    if (theRayleighDamping != 0)  {
+        data(3) = theRayleighDamping->getAlphaM();
+        data(4) = theRayleighDamping->getBetaK0();
+        data(5) = theRayleighDamping->getBetaKc();
+    }
 
     
     if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0)  {
@@ -456,7 +587,7 @@ int Newmark::sendSelf(int cTag, Channel &theChannel)
 
 int Newmark::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
-    Vector data(3);
+    Vector data(6);
     if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0)  {
         opserr << "WARNING Newmark::recvSelf() - could not receive data\n";
         gamma = 0.5; beta = 0.25; 
@@ -470,7 +601,7 @@ int Newmark::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker
     else
         displ = false;
 
-    return 0;
+    return this->setRayleighDampingFactors(data(3), data(4), data(5));
 }
 
 
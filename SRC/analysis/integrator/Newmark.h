@@ -42,6 +42,7 @@
 
 class DOF_Group;
 class FE_Element;
+class SparseRayleighDamping;
 
 class Newmark : public TransientIntegrator
 {
@@ -59,11 +60,18 @@ public:
     int formNodTangent(DOF_Group *theDof);
     int formEleResidual(FE_Element* theEle);
     int formNodUnbalance(DOF_Group* theDof);
+
+    // methods overridden to add the Rayleigh damping of the whole model
+    // when set through setRayleighDampingFactors()
+    int formTangent(int statFlag);
+    int formUnbalance(void);
+    int setRayleighDampingFactors(double alphaM, double betaK0, double betaKc);
     
     int domainChanged(void);    
     int newStep(double deltaT);    
     int revertToLastStep(void);        
     int update(const Vector &deltaU);
+    int commit(void);
     
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -87,6 +95,7 @@ protected:
     Vector *Ut, *Utdot, *Utdotdot;  // response quantities at time t
     Vector *U, *Udot, *Udotdot;     // response quantities at time t+deltaT
     bool determiningMass;           // flag to check if just want the mass contribution
+    SparseRayleighDamping *theRayleighDamping; // assembled Rayleigh damping, 0 if none
 
     // Adding Sensitivity
     int sensitivityFlag;
@@ -0,0 +1,353 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/SparseRayleighDamping.cpp,v $
+                                                                        
+                                                                        
+// File: ~/analysis/integrator/SparseRayleighDamping.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// SparseRayleighDamping.
+//
+// What: "@(#) SparseRayleighDamping.cpp, revA"
+
+#include <SparseRayleighDamping.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Element.h>
+#include <LinearSOE.h>
+#include <CSR_Graph.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <PerformanceMonitor.h>
+
+// the matrices assemble() can form
+#define RAYLEIGH_MASS       0
+#define RAYLEIGH_INITIAL    1
+#define RAYLEIGH_COMMITTED  2
+
+SparseRayleighDamping::SparseRayleighDamping(double alpham, double betak0, 
+					     double betakc)
+  :alphaM(alpham), betaK0(betak0), betaKc(betakc),
+   size(0), nnz(0), rowStart(0), colIndex(0), D0(0), Kc(0), D(0), force(0),
+   allEqn(0)
+{
+
+}
+
+
+SparseRayleighDamping::~SparseRayleighDamping()
+{
+  this->clear();
+}
+
+
+void
+SparseRayleighDamping::clear(void)
+{
+  if (rowStart != 0)
+    delete [] rowStart;
+  if (colIndex != 0)
+    delete [] colIndex;
+  if (D0 != 0)
+    delete [] D0;
+  if (Kc != 0)
+    delete [] Kc;
+  if (D != 0)
+    delete [] D;
+  if (force != 0)
+    delete [] force;
+
+  rowStart = 0; colIndex = 0; D0 = 0; Kc = 0; D = 0; force = 0;
+  size = 0; nnz = 0;
+  theScatterMap.clear();
+}
+
+
+int
+SparseRayleighDamping::setSize(AnalysisModel &theModel)
+{
+  this->clear();
+
+  // the matrices of a Subdomain are not available to be assembled here
+  FE_EleIter &theEles = theModel.getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    Element *theEle = elePtr->getElement();
+    if (theEle != 0 && theEle->isSubdomain() == true) {
+      opserr << "WARNING SparseRayleighDamping::setSize() - the model contains Subdomain ";
+      opserr << theEle->getTag() << ", use element Rayleigh damping instead\n";
+      return -1;
+    }
+  }
+
+  // the pattern is that of the DOF graph with the diagonal merged in, 
+  // the same as a SparseGenRowLinSOE sized from that graph
+  CSR_Graph &theGraph = theModel.getDOF_CSR_Graph();
+  size = theGraph.getNumVertex();
+  nnz = theGraph.getNumEdge()*2 + size;
+  const int *start = theGraph.getStart();
+  const int *adjacency = theGraph.getAdjacency();
+
+  rowStart = new int[size+1];
+  colIndex = new int[nnz];
+  D0 = new double[nnz];
+  D = new double[nnz];
+  force = new double[size];
+  if (betaKc != 0.0)
+    Kc = new double[nnz];
+
+  if (rowStart == 0 || colIndex == 0 || D0 == 0 || D == 0 || force == 0 ||
+      (betaKc != 0.0 && Kc == 0)) {
+    opserr << "WARNING SparseRayleighDamping::setSize() - out of memory for ";
+    opserr << size << " equations and " << nnz << " entries\n";
+    this->clear();
+    return -1;
+  }
+
+  rowStart[0] = 0;
+  int lastLoc = 0;
+  for (int a = 0; a < size; a++) {
+    int j = start[a];
+    int endJ = start[a+1];
+    while (j < endJ && adjacency[j] < a)
+      colIndex[lastLoc++] = adjacency[j++];
+    colIndex[lastLoc++] = a;
+    while (j < endJ)
+      colIndex[lastLoc++] = adjacency[j++];
+    rowStart[a+1] = lastLoc;
+  }
+
+  allEqn.resize(size);
+  for (int i = 0; i < size; i++)
+    allEqn(i) = i;
+
+  theScatterMap.setSize(theModel, size, rowStart, colIndex, false);
+
+  // D0 = alphaM*M + betaK0*K0, formed now as neither changes
+  int result = 0;
+  for (int k = 0; k < nnz; k++)
+    D0[k] = 0.0;
+
+  if (alphaM != 0.0) {
+    if (this->assemble(theModel, RAYLEIGH_MASS, D) < 0)
+      result = -1;
+    for (int k = 0; k < nnz; k++)
+      D0[k] += alphaM * D[k];
+  }
+
+  if (betaK0 != 0.0) {
+    if (this->assemble(theModel, RAYLEIGH_INITIAL, D) < 0)
+      result = -1;
+    for (int k = 0; k < nnz; k++)
+      D0[k] += betaK0 * D[k];
+  }
+
+  // the Kc contribution is that of the current committed state
+  if (this->commitState(theModel) < 0)
+    result = -1;
+
+  return result;
+}
+
+
+int
+SparseRayleighDamping::commitState(AnalysisModel &theModel)
+{
+  int result = 0;
+
+  if (betaKc != 0.0 && Kc != 0) {
+    result = this->assemble(theModel, RAYLEIGH_COMMITTED, Kc);
+    for (int k = 0; k < nnz; k++)
+      D[k] = D0[k] + betaKc * Kc[k];
+  } else {
+    for (int k = 0; k < nnz; k++)
+      D[k] = D0[k];
+  }
+
+  return result;
+}
+
+
+int
+SparseRayleighDamping::addToTang(LinearSOE &theSOE, double fact)
+{
+  if (D == 0 || theSOE.getNumEqn() != size) {
+    opserr << "WARNING SparseRayleighDamping::addToTang() - ";
+    opserr << "setSize() has not been invoked for the model of the SOE\n";
+    return -1;
+  }
+
+  return theSOE.addA(rowStart, colIndex, D, fact);
+}
+
+
+int
+SparseRayleighDamping::addToResidual(LinearSOE &theSOE, const Vector &vel, 
+				     double fact)
+{
+  if (D == 0 || vel.Size() != size) {
+    opserr << "WARNING SparseRayleighDamping::addToResidual() - ";
+    opserr << "setSize() has not been invoked for the model of the SOE\n";
+    return -1;
+  }
+
+  // force = D * vel
+  for (int i = 0; i < size; i++) {
+    double sum = 0.0;
+    for (int k = rowStart[i]; k < rowStart[i+1]; k++)
+      sum += D[k] * vel(colIndex[k]);
+    force[i] = sum;
+  }
+
+  Vector theForce(force, size);
+  return theSOE.addB(theForce, allEqn, fact);
+}
+
+
+double
+SparseRayleighDamping::getAlphaM(void) const
+{
+  return alphaM;
+}
+
+
+double
+SparseRayleighDamping::getBetaK0(void) const
+{
+  return betaK0;
+}
+
+
+double
+SparseRayleighDamping::getBetaKc(void) const
+{
+  return betaKc;
+}
+
+
+// int assemble():
+//	forms the mass, initial or committed stiffness matrix of the model in
+//	values through the FE_Elements and DOF_Groups, so the matrices are 
+//	those seen by the SOE, i.e. after any constraint transformation.
+int
+SparseRayleighDamping::assemble(AnalysisModel &theModel, int type, 
+				double *values)
+{
+  PerformanceTimer theTimer(PERF_FORM_TANGENT);
+
+  for (int k = 0; k < nnz; k++)
+    values[k] = 0.0;
+
+  int result = 0;
+
+  FE_EleIter &theEles = theModel.getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+
+    // penalty and Lagrange FE_Elements have no element
+    Element *theEle = elePtr->getElement();
+    if (theEle == 0)
+      continue;
+
+    elePtr->zeroTangent();
+    if (type == RAYLEIGH_MASS)
+      elePtr->addMtoTang(1.0);
+    else if (type == RAYLEIGH_INITIAL)
+      elePtr->addKiToTang(1.0);
+    else
+      elePtr->addKtToTang(1.0);
+
+    if (this->addMatrix(elePtr->getTangent(0), elePtr->getID(), values) < 0)
+      result = -1;
+  }
+
+  // the nodal masses
+  if (type == RAYLEIGH_MASS) {
+    DOF_GrpIter &theDOFs = theModel.getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+      dofPtr->zeroTangent();
+      dofPtr->addMtoTang(1.0);
+      if (this->addMatrix(dofPtr->getTangent(0), dofPtr->getID(), values) < 0)
+	result = -1;
+    }
+  }
+
+  return result;
+}
+
+
+int
+SparseRayleighDamping::addMatrix(const Matrix &m, const ID &id, double *values)
+{
+  int idSize = id.Size();
+  if (idSize != m.noRows() || idSize != m.noCols()) {
+    opserr << "WARNING SparseRayleighDamping::addMatrix() - Matrix and ID not of similar sizes\n";
+    return -1;
+  }
+
+  // the location of entry (j,i) is at theLocs[i*idSize+j]
+  const int *theLocs = theScatterMap.getLocations(id);
+  if (theLocs != 0) {
+    for (int i = 0; i < idSize; i++)
+      for (int j = 0; j < idSize; j++) {
+	int loc = *theLocs++;
+	if (loc >= 0)
+	  values[loc] += m(j,i);
+      }
+    return 0;
+  }
+
+  // no map, search the sorted rows
+  for (int i = 0; i < idSize; i++) {
+    int row = id(i);
+    if (row < 0 || row >= size)
+      continue;
+    for (int j = 0; j < idSize; j++) {
+      int col = id(j);
+      if (col < 0 || col >= size)
+	continue;
+      int low = rowStart[row];
+      int high = rowStart[row+1] - 1;
+      while (low <= high) {
+	int middle = (low + high)/2;
+	if (colIndex[middle] < col)
+	  low = middle + 1;
+	else if (colIndex[middle] > col)
+	  high = middle - 1;
+	else {
+	  values[middle] += m(i,j);
+	  break;
+	}
+      }
+    }
+  }
+
+  return 0;
+}
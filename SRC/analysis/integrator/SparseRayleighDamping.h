@@ -0,0 +1,92 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/SparseRayleighDamping.h,v $
+                                                                        
+                                                                        
+// File: ~/analysis/integrator/SparseRayleighDamping.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseRayleighDamping. A SparseRayleighDamping object holds the global
+// Rayleigh damping matrix D = alphaM*M + betaK0*K0 + betaKc*Kc of an
+// AnalysisModel in compressed sparse row form, on the sparsity pattern of
+// the DOF graph. M and K0 are assembled once when the model changes and Kc
+// when the model is committed, so an integrator using it can add c*D to
+// the tangent of the SOE and D*v to the residual without the elements
+// forming their damping matrices on every call. The elements must then be
+// given zero Rayleigh factors for the terms handled here.
+//
+// What: "@(#) SparseRayleighDamping.h, revA"
+
+#ifndef SparseRayleighDamping_h
+#define SparseRayleighDamping_h
+
+#include <ID.h>
+#include <SparseGenScatterMap.h>
+
+class AnalysisModel;
+class LinearSOE;
+class Matrix;
+class Vector;
+
+class SparseRayleighDamping
+{
+  public:
+    SparseRayleighDamping(double alphaM, double betaK0, double betaKc);
+    ~SparseRayleighDamping();
+
+    // sizes the storage on the DOF graph of theModel and forms D
+    int setSize(AnalysisModel &theModel);
+    // re-forms the Kc contribution, to be invoked after a commit
+    int commitState(AnalysisModel &theModel);
+
+    // add fact*D to the A, and fact*D*vel to the B, of theSOE
+    int addToTang(LinearSOE &theSOE, double fact);
+    int addToResidual(LinearSOE &theSOE, const Vector &vel, double fact);
+
+    double getAlphaM(void) const;
+    double getBetaK0(void) const;
+    double getBetaKc(void) const;
+
+  private:
+    int assemble(AnalysisModel &theModel, int type, double *values);
+    int addMatrix(const Matrix &m, const ID &id, double *values);
+    void clear(void);
+
+    double alphaM, betaK0, betaKc;
+
+    int size;          // number of equations
+    int nnz;           // number of entries in the pattern
+    int *rowStart;     // size+1, start of each row in colIndex
+    int *colIndex;     // sorted column of each entry, diagonal included
+    double *D0;        // alphaM*M + betaK0*K0
+    double *Kc;        // committed tangent, 0 if betaKc is 0
+    double *D;         // D0 + betaKc*Kc
+    double *force;     // D*vel
+    ID allEqn;         // 0 through size-1, to add force to the B of the SOE
+    SparseGenScatterMap theScatterMap;
+};
+
+#endif
@@ -45,6 +45,8 @@
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
+#include <ThreadPool.h>
 #include <Vertex.h>
 #include <Node.h>
 #include <NodeIter.h>
@@ -62,8 +64,8 @@
 AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
- myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ myDOFGraph(0), myDOF_CSR_Graph(0), myGroupGraph(0), myGroup_CSR_Graph(0),
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), numThreads(1)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    =  new ArrayOfTaggedObjects(1024);
@@ -76,8 +78,8 @@ AnalysisModel::AnalysisModel(int theClassTag)
 AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
- myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ myDOFGraph(0), myDOF_CSR_Graph(0), myGroupGraph(0), myGroup_CSR_Graph(0),
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), numThreads(1)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -89,8 +91,8 @@ AnalysisModel::AnalysisModel()
 AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &theDofs)
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
- myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ myDOFGraph(0), myDOF_CSR_Graph(0), myGroupGraph(0), myGroup_CSR_Graph(0),
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0), numThreads(1)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -125,6 +127,12 @@ AnalysisModel::~AnalysisModel()
   if (myDOFGraph != 0) {
     delete myDOFGraph;
   }
+
+  if (myDOF_CSR_Graph != 0)
+    delete myDOF_CSR_Graph;
+
+  if (myGroup_CSR_Graph != 0)
+    delete myGroup_CSR_Graph;
 }    
 
 void
@@ -210,11 +218,19 @@ AnalysisModel::clearAll(void)
     if (myGroupGraph != 0)
 	delete myGroupGraph;    
 
+    if (myDOF_CSR_Graph != 0)
+	delete myDOF_CSR_Graph;
+
+    if (myGroup_CSR_Graph != 0)
+	delete myGroup_CSR_Graph;
+
     theFEs->clearAll();
     theDOFs->clearAll();
 
     myDOFGraph = 0;
+    myDOF_CSR_Graph = 0;
     myGroupGraph = 0;
+    myGroup_CSR_Graph = 0;
     
     numFE_Ele =0;
     numDOF_Grp = 0;
@@ -227,7 +243,11 @@ AnalysisModel::clearDOFGraph(void)
   if (myDOFGraph != 0)
     delete myDOFGraph;
 
+  if (myDOF_CSR_Graph != 0)
+    delete myDOF_CSR_Graph;
+
     myDOFGraph = 0;
+    myDOF_CSR_Graph = 0;
 }
 
 void
@@ -235,8 +255,12 @@ AnalysisModel::clearDOFGroupGraph(void)
 {
   if (myGroupGraph != 0)
     delete myGroupGraph;    
+
+  if (myGroup_CSR_Graph != 0)
+    delete myGroup_CSR_Graph;
   
   myGroupGraph = 0;
+  myGroup_CSR_Graph = 0;
 }
 
 
@@ -292,10 +316,16 @@ Graph &
 AnalysisModel::getDOFGraph(void)
 {
   if (myDOFGraph == 0) {
-    int numVertex = this->getNumDOF_Groups();
 
-    //    myDOFGraph = new Graph(numVertex);
-    MapOfTaggedObjects *graphStorage = new MapOfTaggedObjects();
+    //
+    // the edges are obtained from the compressed adjacency, the Graph
+    // only holds a vertex for each equation number present in the model
+    //
+
+    CSR_Graph &theCSR_Graph = this->getDOF_CSR_Graph();
+    int numVertex = theCSR_Graph.getNumVertex();
+
+    ArrayOfTaggedObjects *graphStorage = new ArrayOfTaggedObjects(numVertex+1);
     myDOFGraph = new Graph(*graphStorage);
 
     //
@@ -327,39 +357,65 @@ AnalysisModel::getDOFGraph(void)
       }
     }
     
-    // now add the edges, by looping over the FE_elements, getting their
-    // IDs and adding edges between DOFs for equation numbers >= START_EQN_NUM
-    
-    FE_Element *elePtr =0;
-    FE_EleIter &eleIter = this->getFEs();
-    int cnt = 0;
-    
-    while((elePtr = eleIter()) != 0) {
-      const ID &id = elePtr->getID();
-      cnt++;
-      int size = id.Size();
-      for (int i=0; i<size; i++) {
-	int eqn1 = id(i);
-	
-	// if eqnNum of DOF is a valid eqn number add an edge
-	// to all other DOFs with valid eqn numbers.
-	
-	if (eqn1 >=START_EQN_NUM) {
-	  for (int j=i+1; j<size; j++) {
-	    int eqn2 = id(j);
-	    if (eqn2 >=START_EQN_NUM)
-	      myDOFGraph->addEdge(eqn1-START_EQN_NUM+START_VERTEX_NUM,
-				  eqn2-START_EQN_NUM+START_VERTEX_NUM);
-	  }
-	}
-      }
-    }
+    // now add the edges
+    if (theCSR_Graph.addEdges(*myDOFGraph) < 0)
+      opserr << "WARNING AnalysisModel::getDOFGraph - error adding edges\n";
   }    
 
   return *myDOFGraph;
 }
 
 
+CSR_Graph &
+AnalysisModel::getDOF_CSR_Graph(void)
+{
+  if (myDOF_CSR_Graph == 0) {
+    myDOF_CSR_Graph = new CSR_Graph();
+
+    // the number of vertices, numEqn unless some DOF_Group has a larger eqn number
+    int numVertex = numEqn;
+    DOF_Group *dofPtr =0;
+    DOF_GrpIter &theDOFs = this->getDOFs();
+    while ((dofPtr = theDOFs()) != 0) {
+      const ID &id = dofPtr->getID();
+      int size = id.Size();
+      for (int i=0; i<size; i++) 
+	if (id(i) - START_EQN_NUM + 1 > numVertex)
+	  numVertex = id(i) - START_EQN_NUM + 1;
+    }
+
+    // the equation numbers of each FE_Element are mutually adjacent
+    const ID **theIDs = new const ID *[numFE_Ele+1];
+    int numID = 0;
+    FE_Element *elePtr =0;
+    FE_EleIter &eleIter = this->getFEs();
+    while((elePtr = eleIter()) != 0 && numID < numFE_Ele)
+      theIDs[numID++] = &(elePtr->getID());
+
+    // large models have the vertices processed by a number of threads
+    ThreadPool *thePool = 0;
+    if (numVertex > 50000 && numThreads > 1) 
+      thePool = new ThreadPool(numThreads);
+
+    if (myDOF_CSR_Graph->build(numVertex, theIDs, numID, thePool) < 0)
+      opserr << "WARNING AnalysisModel::getDOF_CSR_Graph - failed to build the graph\n";
+
+    if (thePool != 0)
+      delete thePool;
+    delete [] theIDs;
+  }
+
+  return *myDOF_CSR_Graph;
+}
+
+
+void
+AnalysisModel::setNumThreads(int num)
+{
+  numThreads = (num > 1) ? num : 1;
+}
+
+
 Graph &
 AnalysisModel::getDOFGroupGraph(void)
 {
@@ -429,6 +485,48 @@ AnalysisModel::getDOFGroupGraph(void)
 }
 
 
+// the DOF_Group graph in compact form, the vertices are the DOF_Group tags
+// and the weights the number of free DOF; if the tags do not range from
+// 0 through numDOF_Grp-1 the graph returned has no vertices
+CSR_Graph &
+AnalysisModel::getDOFGroup_CSR_Graph(void)
+{
+  if (myGroup_CSR_Graph == 0) {
+    myGroup_CSR_Graph = new CSR_Graph();
+
+    ID theWeights(numDOF_Grp);
+    int numTags = 0;
+    DOF_Group *dofPtr =0;
+    DOF_GrpIter &theDOFs = this->getDOFs();
+    while ((dofPtr = theDOFs()) != 0) {
+      int tag = dofPtr->getTag();
+      if (tag < 0 || tag >= numDOF_Grp) 
+	return *myGroup_CSR_Graph;
+      theWeights(tag) = dofPtr->getNumFreeDOF();
+      numTags++;
+    }
+    if (numTags != numDOF_Grp)
+      return *myGroup_CSR_Graph;
+
+    const ID **theIDs = new const ID *[numFE_Ele+1];
+    int numID = 0;
+    FE_Element *elePtr =0;
+    FE_EleIter &eleIter = this->getFEs();
+    while((elePtr = eleIter()) != 0 && numID < numFE_Ele)
+      theIDs[numID++] = &(elePtr->getDOFtags());
+
+    if (myGroup_CSR_Graph->build(numDOF_Grp, theIDs, numID) < 0)
+      opserr << "WARNING AnalysisModel::getDOFGroup_CSR_Graph - failed to build the graph\n";
+    else
+      myGroup_CSR_Graph->setWeights(theWeights);
+
+    delete [] theIDs;
+  }
+
+  return *myGroup_CSR_Graph;
+}
+
+
 
 
 void 
@@ -46,6 +46,7 @@ class Domain;
 class FE_EleIter;
 class DOF_GrpIter;
 class Graph;
+class CSR_Graph;
 class FE_Element;
 class DOF_Group;
 class Vector;
@@ -78,7 +79,13 @@ class AnalysisModel: public MovableObject
     virtual void setNumEqn(int) ;	
     virtual int getNumEqn(void) const ; 
     virtual Graph &getDOFGraph(void);
+    virtual CSR_Graph &getDOF_CSR_Graph(void);
     virtual Graph &getDOFGroupGraph(void);
+    virtual CSR_Graph &getDOFGroup_CSR_Graph(void);
+
+    // number of threads used to build the graphs of large models,
+    // set by the integrator to the number it assembles with
+    void setNumThreads(int numThreads);
     
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new nodal trial response quantities.
@@ -127,11 +134,14 @@ class AnalysisModel: public MovableObject
     ConstraintHandler *myHandler;
 
     Graph *myDOFGraph;
+    CSR_Graph *myDOF_CSR_Graph;
     Graph *myGroupGraph;    
+    CSR_Graph *myGroup_CSR_Graph;
     
     int numFE_Ele;             // number of FE_Elements objects added
     int numDOF_Grp;            // number of DOF_Group objects added
     int numEqn;                // numEqn set by the ConstraintHandler typically
+    int numThreads;            // threads used to build the DOF graph
 
     TaggedObjectStorage  *theFEs;
     TaggedObjectStorage  *theDOFs;
@@ -818,6 +818,7 @@
 #define HANDLER_TAG_PenaltyConstraintHandler    	3
 #define HANDLER_TAG_TransformationConstraintHandler    	4
 #define HANDLER_TAG_PenaltyHandlerNoHomoSPMultipliers   5
+#define HANDLER_TAG_SparseTransformationConstraintHandler 6
 
 #define NUMBERER_TAG_DOF_Numberer      	1
 #define NUMBERER_TAG_PlainNumberer 	2
@@ -828,6 +829,8 @@
 #define GraphNUMBERER_TAG_MyRCM   		3
 #define GraphNUMBERER_TAG_Metis   		4
 #define GraphNUMBERER_TAG_AMD   		5
+#define GraphNUMBERER_TAG_NestedDissection  	6
+#define GraphNUMBERER_TAG_Auto  		7
 
 
 #define AnaMODEL_TAGS_AnalysisModel 	1
@@ -846,6 +849,7 @@
 #define EquiALGORITHM_TAGS_AcceleratedNewtonLineSearch          12
 #define EquiALGORITHM_TAGS_InitialNewton          13
 #define EquiALGORITHM_TAGS_ElasticAlgorithm 14
+#define EquiALGORITHM_TAGS_AdaptiveNewton 15
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -971,6 +975,7 @@
 #define SOLVER_TAGS_CulaSparseS5 30
 #define SOLVER_TAGS_CulaSparseS6 31
 #define SOLVER_TAGS_CuSP  32
+#define SOLVER_TAGS_SparseGenRowKrylovSolver  33
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -994,6 +999,7 @@
 
 #define RECORDER_TAGS_NodeGiDRecorder	21
 #define RECORDER_TAGS_ElementGiDRecorder	22
+#define RECORDER_TAGS_AlgorithmIterationRecorder	23
 
 #define OPS_STREAM_TAGS_FileStream		1
 #define OPS_STREAM_TAGS_StandardStream		2
@@ -1005,6 +1011,7 @@
 #define OPS_STREAM_TAGS_TCP_Stream              8
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
+#define OPS_STREAM_TAGS_FastBinaryFileStream   11
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
 
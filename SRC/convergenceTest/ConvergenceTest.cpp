@@ -34,6 +34,7 @@
 // to test the convergence of an algorithm. 
 
 #include <ConvergenceTest.h>
+#include <PerformanceMonitor.h>
 
 ConvergenceTest::ConvergenceTest(int clasTag)
 :MovableObject(clasTag)
@@ -46,3 +47,10 @@ ConvergenceTest::~ConvergenceTest()
 
 }
 
+int
+ConvergenceTest::runTest(void)
+{
+    PerformanceTimer theTimer(PERF_TEST);
+    return this->test();
+}
+
@@ -55,6 +55,10 @@ class ConvergenceTest: public MovableObject
     virtual int setEquiSolnAlgo(EquiSolnAlgo &theAlgorithm) =0;
     virtual int start(void) =0;
     virtual int test(void) = 0;
+
+    // invokes test(), timing it as PERF_TEST for the PerformanceMonitor;
+    // the algorithms call this rather than test() directly
+    int runTest(void);
     
     virtual int getNumTests(void) =0;    
     virtual int getMaxNumTests(void) =0;        
@@ -80,6 +80,7 @@ public:
 // AddingSensitivity:END //////////////////////////////////
 
     CrdTransf *getCopy2d(void);
+    bool isThreadSafe(void) const {return true;};
     
     int sendSelf(int cTag, Channel &theChannel);
     int recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -118,13 +119,13 @@ private:
     Vector ubcommit;           // commited basic displacements
     Vector ubpr;               // previous basic displacements
     
-    static Matrix Tlg;         // matrix that transforms from global to local coordinates
-    static Matrix Tbl;         // matrix that transforms from local  to basic coordinates
-    static Matrix kg;          // global stiffness matrix
-    static Vector uxg;     
-    static Vector pg;     
-    static Vector dub;     
-    static Vector Dub;     
+    static OPS_THREAD_LOCAL Matrix Tlg;         // matrix that transforms from global to local coordinates
+    static OPS_THREAD_LOCAL Matrix Tbl;         // matrix that transforms from local  to basic coordinates
+    static OPS_THREAD_LOCAL Matrix kg;          // global stiffness matrix
+    static OPS_THREAD_LOCAL Vector uxg;     
+    static OPS_THREAD_LOCAL Vector pg;     
+    static OPS_THREAD_LOCAL Vector dub;     
+    static OPS_THREAD_LOCAL Vector Dub;     
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
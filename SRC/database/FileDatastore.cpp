@@ -83,6 +83,8 @@ FileDatastore::~FileDatastore()
       theFile->close();
       delete theFile;
     }
+    if (theFileStruct->indexName != 0)
+      delete [] theFileStruct->indexName;
     delete theFileStruct;
   }
 
@@ -95,6 +97,8 @@ FileDatastore::~FileDatastore()
       theFile->close();
       delete theFile;
     }
+    if (theFileStruct->indexName != 0)
+      delete [] theFileStruct->indexName;
     delete theFileStruct;
   }
   theMatFiles.clear();
@@ -105,6 +109,8 @@ FileDatastore::~FileDatastore()
       theFile->close();
       delete theFile;
     }
+    if (theFileStruct->indexName != 0)
+      delete [] theFileStruct->indexName;
     delete theFileStruct;
   }
   theVectFiles.clear();
@@ -125,44 +131,15 @@ FileDatastore::commitState(int commitTag)
 void
 FileDatastore::resetFilePointers(void) {
 
-  for (theIDFilesIter = theIDFiles.begin(); theIDFilesIter != theIDFiles.end(); theIDFilesIter++) {
-    FileDatastoreOutputFile *theFileStruct = theIDFilesIter->second;
-    fstream *theFile = theFileStruct->theFile;
-    if (theFile != 0) {
-      theFile->seekp(0, ios::beg);
-      *(theIntData.dbTag) = theFileStruct->maxDbTag;
-      theFile->write(data, sizeof(int));    
-      theFile->close();
-      delete theFile;
-      theFileStruct->theFile = 0;
-    }
-  }
+  for (theIDFilesIter = theIDFiles.begin(); theIDFilesIter != theIDFiles.end(); theIDFilesIter++) 
+    this->closeFile(theIDFilesIter->second);
 
-  for (theMatFilesIter = theMatFiles.begin(); theMatFilesIter != theMatFiles.end(); theMatFilesIter++) {
-    FileDatastoreOutputFile *theFileStruct = theMatFilesIter->second;
-    fstream *theFile = theFileStruct->theFile;
-    if (theFile != 0) {
-      theFile->seekp(0, ios::beg);
-      *(theIntData.dbTag) = theFileStruct->maxDbTag;
-      theFile->write(data, sizeof(int));    
-      theFile->close();
-      delete theFile;
-      theFileStruct->theFile = 0;
-    }
-  }
+  for (theMatFilesIter = theMatFiles.begin(); theMatFilesIter != theMatFiles.end(); theMatFilesIter++) 
+    this->closeFile(theMatFilesIter->second);
+
+  for (theVectFilesIter = theVectFiles.begin(); theVectFilesIter != theVectFiles.end(); theVectFilesIter++) 
+    this->closeFile(theVectFilesIter->second);
 
-  for (theVectFilesIter = theVectFiles.begin(); theVectFilesIter != theVectFiles.end(); theVectFilesIter++) {
-    FileDatastoreOutputFile *theFileStruct = theVectFilesIter->second;
-    fstream *theFile = theFileStruct->theFile;
-    if (theFile != 0) {
-      theFile->seekp(0, ios::beg);
-      *(theIntData.dbTag) = theFileStruct->maxDbTag;
-      theFile->write(data, sizeof(int));    
-      theFile->close();
-      delete theFile;
-      theFileStruct->theFile = 0;
-    }
-  }
   currentCommitTag = -1;
 }
 
@@ -234,6 +211,7 @@ FileDatastore::sendID(int dataTag, int commitTag,
       opserr << "FileDatastore::sendID() - out of memory\n";
       return -1;
     }
+    theFileStruct->indexName = 0;
 
     static char intName[20];
     strcpy(fileName, dataBase);
@@ -285,49 +263,18 @@ FileDatastore::sendID(int dataTag, int commitTag,
   //
 
   fstream *theStream = theFileStruct->theFile;
-  bool found = false;  
-  STREAM_POSITION_TYPE pos = theStream->tellg();  
   STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
-  
-  // we first check if the data can go at the end of the file
-  // true if commitTag larger than any we have encountered so far
+  STREAM_POSITION_TYPE pos = this->findPosition(theFileStruct, dataTag);
 
-  if (theFileStruct->maxDbTag < dataTag)  {
+  // if there is no record for dataTag yet it is appended to the end
+  if (pos < 0) {
     pos = fileEnd;
-    found = true;
-    theFileStruct->maxDbTag = dataTag;
-  } 
-  
-  // try current location    
-  if (pos < fileEnd && found == false) {
-// #ifdef _WIN32
-    // must be a bug in the vc compiler! .. we are here already tellg() above!!
-    theStream->seekg(pos, ios::beg);
-// #endif
-    theStream->read(data, stepSize);
-    if (*(theIntData.dbTag) == dataTag ) { 
-      found = true;
-    }
-  }
-  
-  // we have to search from the beginning of the file  
-  if (found == false) {
-    *(theIntData.dbTag) = -1;
-    pos = sizeof(int);
-    theStream->seekg(pos, ios::beg);
-    while (pos < fileEnd && found == false) {
-      theStream->read(data, stepSize);
-      
-      if (*(theIntData.dbTag) == dataTag) 
-	found = true;
-      else 
-	pos += stepSize;
-    }
-    
-    if (found == false) {
-      pos = fileEnd;
-    }
+    theFileStruct->theIndex.insert(MAP_POSITIONS_TYPE(dataTag, pos));
+    theFileStruct->indexChanged = true;
   }
+
+  if (theFileStruct->maxDbTag < dataTag)
+    theFileStruct->maxDbTag = dataTag;
   
   //
   // we now place the data to be sent into our buffer
@@ -397,6 +344,7 @@ FileDatastore::recvID(int dataTag, int commitTag,
       opserr << "FileDatastore::recvID() - out of memory\n";
       return -1;
     }
+    theFileStruct->indexName = 0;
 
     static char intName[20];
     strcpy(fileName, dataBase);
@@ -442,43 +390,20 @@ FileDatastore::recvID(int dataTag, int commitTag,
   }
 
   fstream *theStream = theFileStruct->theFile;
-  STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
-  STREAM_POSITION_TYPE pos = theStream->tellg();
-  
+
   //
-  // find location in file to place the data
+  // find location in file of the data
   //
-  
-  bool found = false;  
-
-  // we try the current file position first
-
-  if (pos < fileEnd) {
-    theStream->read(data, stepSize);
-    if (*(theIntData.dbTag) == dataTag) {
-      found = true;
-      pos += stepSize;
-    } 
-  }
-
-  // we must search from the beginning of the file
-  if (found == false) {
-    pos = sizeof(int);
-    theStream->seekg(pos, ios::beg); 
-    while ((pos < fileEnd) && (found == false)) {
-      theStream->read(data, stepSize);
-      if (*(theIntData.dbTag) == dataTag) 
-	found = true;
-      else 
-	pos += stepSize;
-    }
-  }
 
-  if (found == false) {
+  STREAM_POSITION_TYPE pos = this->findPosition(theFileStruct, dataTag);
+  if (pos < 0) {
     opserr << "FileDatastore::recvID() - failed\n";
     return -1;
   }
 
+  theStream->seekg(pos, ios::beg);
+  theStream->read(data, stepSize);
+
   //opserr << "READ: " << dataTag << " " << pos << endln;
 
   // we now place the received data into the ID 
@@ -534,6 +459,7 @@ FileDatastore::sendMatrix(int dataTag, int commitTag,
       opserr << "FileDatastore::sendMatrix() - out of memory\n";
       return -1;
     }
+    theFileStruct->indexName = 0;
 
     static char intName[20];
     strcpy(fileName, dataBase);
@@ -585,50 +511,19 @@ FileDatastore::sendMatrix(int dataTag, int commitTag,
   //
   
   fstream *theStream = theFileStruct->theFile;
-  bool found = false;  
-  STREAM_POSITION_TYPE pos = theStream->tellg();  
   STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
-  
-  // we first check if the data can go at the end of the file
-  // true if commitTag larger than any we have encountered so far
-  
-  if (theFileStruct->maxDbTag < dataTag)  {
+  STREAM_POSITION_TYPE pos = this->findPosition(theFileStruct, dataTag);
+
+  // if there is no record for dataTag yet it is appended to the end
+  if (pos < 0) {
     pos = fileEnd;
-    found = true;
-    theFileStruct->maxDbTag = dataTag;
-  } 
-  
-  // try current location    
-  if (pos < fileEnd && found == false) {
-// #ifdef _WIN32
-    // must be a bug in the vc compiler! .. we are here already tellg() above!!
-    theStream->seekg(pos, ios::beg);
-// #endif
-    theStream->read(data, stepSize);
-    if (*(theIntData.dbTag) == dataTag ) { 
-      found = true;
-    }
-  }
-  
-  // we have to search from the beginning of the file  
-  if (found == false) {
-    *(theIntData.dbTag) = -1;
-    pos = sizeof(int);
-    theStream->seekg(pos, ios::beg);
-    while (pos < fileEnd && found == false) {
-      theStream->read(data, stepSize);
-      
-      if (*(theIntData.dbTag) == dataTag) 
-	found = true;
-      else 
-	pos += stepSize;
-    }
-    
-    if (found == false) {
-      pos = fileEnd;
-    }
+    theFileStruct->theIndex.insert(MAP_POSITIONS_TYPE(dataTag, pos));
+    theFileStruct->indexChanged = true;
   }
 
+  if (theFileStruct->maxDbTag < dataTag)
+    theFileStruct->maxDbTag = dataTag;
+
   //
   // we now place the data to be sent into our buffer
   //
@@ -701,6 +596,7 @@ FileDatastore::recvMatrix(int dataTag, int commitTag,
       opserr << "FileDatastore::recvMatrix() - out of memory\n";
       return -1;
     }
+    theFileStruct->indexName = 0;
 
     static char intName[20];
     strcpy(fileName, dataBase);
@@ -749,43 +645,20 @@ FileDatastore::recvMatrix(int dataTag, int commitTag,
 
 
   fstream *theStream = theFileStruct->theFile;
-  STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
-  STREAM_POSITION_TYPE pos = theStream->tellg();
-  
+
   //
-  // find location in file to place the data
+  // find location in file of the data
   //
-  
-  bool found = false;  
-
-  // we try the current file position first
-
-  if (pos < fileEnd) {
-    theStream->read(data, stepSize);
-    if ((*(theIntData.dbTag) == dataTag)) {
-      found = true;
-      pos += stepSize;
-    } 
-  }
-
-  // we must search from the beginning of the file
-  if (found == false) {
-    pos = sizeof(int);
-    theStream->seekg(pos, ios::beg); 
-    while ((pos < fileEnd) && (found == false)) {
-      theStream->read(data, stepSize);
-      if (*(theIntData.dbTag) == dataTag) 
-	found = true;
-      else 
-	pos += stepSize;
-    }
-  }
 
-  if (found == false) {
+  STREAM_POSITION_TYPE pos = this->findPosition(theFileStruct, dataTag);
+  if (pos < 0) {
     opserr << "FileDatastore::recvMatrix() - failed\n";
     return -1;
   }
 
+  theStream->seekg(pos, ios::beg);
+  theStream->read(data, stepSize);
+
   int loc=0;
   for (int j=0; j<noMatCols; j++)
     for (int k=0; k < noMatRows; k++) {
@@ -839,6 +712,7 @@ FileDatastore::sendVector(int dataTag, int commitTag,
       opserr << "FileDatastore::sendVector() - out of memory\n";
       return -1;
     }
+    theFileStruct->indexName = 0;
 
     static char intName[20];
     strcpy(fileName, dataBase);
@@ -890,53 +764,19 @@ FileDatastore::sendVector(int dataTag, int commitTag,
   //
   
   fstream *theStream = theFileStruct->theFile;
-  bool found = false;  
-  STREAM_POSITION_TYPE pos = theStream->tellg();  
   STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
-  
-  // we first check if the data can go at the end of the file
-  // true if commitTag larger than any we have encountered so far
-  found = false;
-  
-  
-  if (theFileStruct->maxDbTag < dataTag)  {
-    pos = fileEnd;
-    found = true;
-    theFileStruct->maxDbTag = dataTag;
-  } 
+  STREAM_POSITION_TYPE pos = this->findPosition(theFileStruct, dataTag);
 
-  
-  // try current location    
-  if (pos < fileEnd && found == false) {
-// #ifdef _WIN32
-    // must be a bug in the vc compiler! .. we are here already tellg() above!!
-    theStream->seekg(pos, ios::beg);
-// #endif
-    theStream->read(data, stepSize);
-    if (*(theIntData.dbTag) == dataTag ) { 
-      found = true;
-    }
-  }
-  
-  // we have to search from the beginning of the file  
-  if (found == false) {
-    *(theIntData.dbTag) = -1;
-    pos = sizeof(int);
-    theStream->seekg(pos, ios::beg);
-    while (pos < fileEnd && found == false) {
-      theStream->read(data, stepSize);
-      
-      if (*(theIntData.dbTag) == dataTag) 
-	found = true;
-      else 
-	pos += stepSize;
-    }
-    
-    if (found == false) {
-      pos = fileEnd;
-    }
+  // if there is no record for dataTag yet it is appended to the end
+  if (pos < 0) {
+    pos = fileEnd;
+    theFileStruct->theIndex.insert(MAP_POSITIONS_TYPE(dataTag, pos));
+    theFileStruct->indexChanged = true;
   }
 
+  if (theFileStruct->maxDbTag < dataTag)
+    theFileStruct->maxDbTag = dataTag;
+
   //
   // we now place the data to be sent into our buffer
   //
@@ -1000,6 +840,7 @@ FileDatastore::recvVector(int dataTag, int commitTag,
       opserr << "FileDatastore::recvVectrix() - out of memory\n";
       return -1;
     }
+    theFileStruct->indexName = 0;
 
     static char intName[20];
     strcpy(fileName, dataBase);
@@ -1047,43 +888,20 @@ FileDatastore::recvVector(int dataTag, int commitTag,
   }
 
   fstream *theStream = theFileStruct->theFile;
-  STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
-  STREAM_POSITION_TYPE pos = theStream->tellg();
-  
+
   //
-  // find location in file to place the data
+  // find location in file of the data
   //
-  
-  bool found = false;  
-
-  // we try the current file position first
-
-  if (pos < fileEnd) {
-    theStream->read(data, stepSize);
-    if ((*(theIntData.dbTag) == dataTag)) {
-      found = true;
-      pos += stepSize;
-    } 
-  }
 
-  // we must search from the beginning of the file
-  if (found == false) {
-    pos = sizeof(int);
-    theStream->seekg(pos, ios::beg); 
-    while ((pos < fileEnd) && (found == false)) {
-      theStream->read(data, stepSize);
-      if (*(theIntData.dbTag) == dataTag) 
-	found = true;
-      else 
-	pos += stepSize;
-    }
-  }
-
-  if (found == false) {
+  STREAM_POSITION_TYPE pos = this->findPosition(theFileStruct, dataTag);
+  if (pos < 0) {
     opserr << "FileDatastore::recvVector() - failed\n";
     return -1;
   }
 
+  theStream->seekg(pos, ios::beg);
+  theStream->read(data, stepSize);
+
   for (int i=0; i<vectSize; i++)
     theVector(i) = theDoubleData.data[i];
 
@@ -1241,9 +1059,133 @@ FileDatastore::openFile(char *fileName, FileDatastoreOutputFile *theFileStruct,
 
   theFileStruct->maxDbTag = maxDataTag; 	      
 
+  // obtain the dbTag -> position index for the records in the file
+  int len = strlen(fileName);
+  if (theFileStruct->indexName != 0)
+    delete [] theFileStruct->indexName;
+  theFileStruct->indexName = new char[len+5];
+  strcpy(theFileStruct->indexName, fileName);
+  strcpy(&(theFileStruct->indexName[len]), ".idx");
+
+  return this->readIndex(theFileStruct, dataSize);
+}
+
+
+// reads the index persisted in the last commit; if there is none, or if it
+// does not describe the file as it now exists, the index is rebuilt with a 
+// single pass over the record headers.
+int
+FileDatastore::readIndex(FileDatastoreOutputFile *theFileStruct, int dataSize)
+{
+  MAP_POSITIONS &theIndex = theFileStruct->theIndex;
+  theIndex.clear();
+  theFileStruct->indexChanged = false;
+
+  STREAM_POSITION_TYPE fileEnd = theFileStruct->fileEnd;
+  if (fileEnd <= (STREAM_POSITION_TYPE)sizeof(int)) 
+    return 0;
+
+  int header[2];
+  fstream theIndexFile(theFileStruct->indexName, ios::in | ios::binary);
+  if (theIndexFile.is_open() == true) {
+    theIndexFile.read((char *)header, 2*sizeof(int));
+    if (theIndexFile.good() && header[0] == fileEnd && header[1] >= 0) {
+      int numEntries = header[1];
+      int *entries = new int[2*numEntries+1];
+      theIndexFile.read((char *)entries, 2*numEntries*sizeof(int));
+      if (theIndexFile.good()) {
+	MAP_POSITIONS_ITERATOR hint = theIndex.begin();
+	for (int i=0; i<numEntries; i++)
+	  hint = theIndex.insert(hint, MAP_POSITIONS_TYPE(entries[2*i], entries[2*i+1]));
+	delete [] entries;
+	return 0;
+      }
+      delete [] entries;
+      theIndex.clear();
+    }
+  }
+
+  // no valid index; scan the dbTag at the start of each record
+  fstream *theStream = theFileStruct->theFile;
+  int dbTag;
+  for (STREAM_POSITION_TYPE pos = sizeof(int); pos + dataSize <= fileEnd; pos += dataSize) {
+    theStream->seekg(pos, ios::beg);
+    theStream->read((char *)&dbTag, sizeof(int));
+    if (theStream->bad()) {
+      opserr << "FileDatastore::readIndex() - error reading file\n";
+      return -1;
+    }
+    theIndex.insert(MAP_POSITIONS_TYPE(dbTag, pos));
+  }
+  theStream->clear();
+  theStream->seekg(sizeof(int), ios::beg);
+  theFileStruct->indexChanged = true;
+
+  return 0;
+}
+
+
+int
+FileDatastore::writeIndex(FileDatastoreOutputFile *theFileStruct)
+{
+  if (theFileStruct->indexChanged == false || theFileStruct->indexName == 0)
+    return 0;
+
+  MAP_POSITIONS &theIndex = theFileStruct->theIndex;
+  int numEntries = theIndex.size();
+  int *entries = new int[2*numEntries+2];
+  entries[0] = theFileStruct->fileEnd;
+  entries[1] = numEntries;
+
+  int loc = 2;
+  for (MAP_POSITIONS_ITERATOR theIter = theIndex.begin(); theIter != theIndex.end(); theIter++) {
+    entries[loc++] = theIter->first;
+    entries[loc++] = theIter->second;
+  }
+
+  fstream theIndexFile(theFileStruct->indexName, ios::out | ios::trunc | ios::binary);
+  if (theIndexFile.is_open() == false) {
+    opserr << "FileDatastore::writeIndex() - could not open file " << theFileStruct->indexName << endln;
+    delete [] entries;
+    return -1;
+  }
+  theIndexFile.write((char *)entries, loc*sizeof(int));
+  theIndexFile.close();
+  delete [] entries;
+
+  theFileStruct->indexChanged = false;
   return 0;
 }
 
+
+STREAM_POSITION_TYPE
+FileDatastore::findPosition(FileDatastoreOutputFile *theFileStruct, int dataTag)
+{
+  MAP_POSITIONS_ITERATOR theIter = theFileStruct->theIndex.find(dataTag);
+  if (theIter == theFileStruct->theIndex.end())
+    return -1;
+
+  return theIter->second;
+}
+
+
+void
+FileDatastore::closeFile(FileDatastoreOutputFile *theFileStruct)
+{
+  fstream *theFile = theFileStruct->theFile;
+  if (theFile == 0)
+    return;
+
+  theFile->seekp(0, ios::beg);
+  *(theIntData.dbTag) = theFileStruct->maxDbTag;
+  theFile->write(data, sizeof(int));    
+  theFile->close();
+  delete theFile;
+  theFileStruct->theFile = 0;
+
+  this->writeIndex(theFileStruct);
+}
+
 int 
 FileDatastore::resizeInt(int newSize) {
   int sizeOfChar = sizeof(char);
@@ -49,10 +49,17 @@ using std::map;
 
 class FEM_ObjectBroker;
 
+typedef map<int, STREAM_POSITION_TYPE>            MAP_POSITIONS;
+typedef MAP_POSITIONS::value_type                MAP_POSITIONS_TYPE;
+typedef MAP_POSITIONS::iterator                  MAP_POSITIONS_ITERATOR;
+
 typedef struct fileDatastoreOutputFile {
   fstream *theFile;
   STREAM_POSITION_TYPE fileEnd;
   int      maxDbTag;
+  MAP_POSITIONS theIndex;  // dbTag -> position of record in theFile
+  char    *indexName;      // file the index is persisted to on a commit
+  bool     indexChanged;   // true if records appended since index written
 } FileDatastoreOutputFile;
 
 typedef map<int, FileDatastoreOutputFile *>      MAP_FILES;
@@ -136,6 +143,10 @@ class FileDatastore: public FE_Datastore
     int resizeDouble(int newSize);
     void resetFilePointers(void);
     int openFile(char *fileName, FileDatastoreOutputFile *, int dataSize);
+    int readIndex(FileDatastoreOutputFile *, int dataSize);
+    int writeIndex(FileDatastoreOutputFile *);
+    STREAM_POSITION_TYPE findPosition(FileDatastoreOutputFile *, int dataTag);
+    void closeFile(FileDatastoreOutputFile *);
 
     // private attributes
     char *dataBase;
@@ -65,6 +65,7 @@
 #include <LoadPatternIter.h>
 #include <SingleDomAllSP_Iter.h>
 #include <SingleDomParamIter.h>
+#include <NodalStatePool.h>
 
 #include <Vertex.h>
 #include <Matrix.h>
@@ -74,6 +75,7 @@
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <PerformanceMonitor.h>
 
 //
 // global variables
@@ -92,7 +94,8 @@ Domain::Domain()
  theElementGraph(0), 
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ theStatePool(0), statePoolOK(false)
 {
   
     // init the arrays for storing the domain components
@@ -145,7 +148,8 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  theElementGraph(0),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ theStatePool(0), statePoolOK(false)
 {
     // init the arrays for storing the domain components
     theElements = new MapOfTaggedObjects();
@@ -204,7 +208,8 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theLoadPatterns(&theLoadPatternsStorage),
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ theStatePool(0), statePoolOK(false)
 {
     // init the arrays for storing the domain components
     thePCs      = new MapOfTaggedObjects();
@@ -261,7 +266,8 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  theElementGraph(0), 
  theRegions(0), numRegions(0), commitTag(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ paramIndex(0), paramSize(0), numParameters(0),
+ theStatePool(0), statePoolOK(false)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -389,6 +395,62 @@ Domain::~Domain()
 }
 
 
+// int setStorage(TaggedObjectStorage &theStorageType);
+//	Method to replace the storage objects for the nodes, elements, SPs
+//	and MPs by empty copies of theStorageType. The domain must not yet
+//	hold any of these components; theStorageType itself is not kept.
+
+int
+Domain::setStorage(TaggedObjectStorage &theStorageType)
+{
+  if (theElements->getNumComponents() != 0 ||
+      theNodes->getNumComponents() != 0 ||
+      theSPs->getNumComponents() != 0 ||
+      theMPs->getNumComponents() != 0) {
+    opserr << "WARNING Domain::setStorage() - domain is not empty, storage not changed\n";
+    return -1;
+  }
+
+  TaggedObjectStorage *newElements = theStorageType.getEmptyCopy();
+  TaggedObjectStorage *newNodes    = theStorageType.getEmptyCopy();
+  TaggedObjectStorage *newSPs      = theStorageType.getEmptyCopy();
+  TaggedObjectStorage *newMPs      = theStorageType.getEmptyCopy();
+
+  if (newElements == 0 || newNodes == 0 || newSPs == 0 || newMPs == 0) {
+    opserr << "WARNING Domain::setStorage() - out of memory, storage not changed\n";
+    if (newElements != 0) delete newElements;
+    if (newNodes != 0) delete newNodes;
+    if (newSPs != 0) delete newSPs;
+    if (newMPs != 0) delete newMPs;
+    return -2;
+  }
+
+  // the iters hold on to the storage, so they are replaced too
+  delete theEleIter;
+  delete theNodIter;
+  delete theSP_Iter;
+  delete theMP_Iter;
+  delete theElements;
+  delete theNodes;
+  delete theSPs;
+  delete theMPs;
+
+  theElements = newElements;
+  theNodes    = newNodes;
+  theSPs      = newSPs;
+  theMPs      = newMPs;
+
+  theEleIter = new SingleDomEleIter(theElements);
+  theNodIter = new SingleDomNodIter(theNodes);
+  theSP_Iter = new SingleDomSP_Iter(theSPs);
+  theMP_Iter = new SingleDomMP_Iter(theMPs);
+
+  this->domainChange();
+
+  return 0;
+}
+
+
 // void addElement(Element *);
 //	Method to add an element to the model.
 
@@ -462,6 +524,7 @@ Domain::addNode(Node * node)
   if (result == true) {
       node->setDomain(this);
       this->domainChange();
+      statePoolOK = false;
       
       // see if the physical bounds are changed
       // note this assumes 0,0,0,0,0,0 as startup min,max values
@@ -887,6 +950,12 @@ Domain::clearAll(void) {
   theParameters->clearAll();
   numParameters = 0;
 
+  // the nodes are gone, so is the need for their state pool
+  if (theStatePool != 0)
+    delete theStatePool;
+  theStatePool = 0;
+  statePoolOK = false;
+
   // remove the recorders
   int i;
   for (i=0; i<numRecorders; i++)
@@ -988,6 +1057,13 @@ Domain::removeNode(int tag)
   // perform a downward cast to a Node (safe as only Node added to
   // this container and return the result of the cast
   Node *result = (Node *)mc;
+
+  // the node may outlive the pool, give it back its own storage
+  if (theStatePool != 0) {
+    result->setStatePool(0, 0);
+    statePoolOK = false;
+  }
+
   // result->setDomain(0);
   return result;
 }
@@ -1802,6 +1878,8 @@ Domain::setRayleighDampingFactors(double alphaM, double betaK, double betaK0, do
 int
 Domain::record(bool fromAnalysis)
 {
+  PerformanceTimer theTimer(PERF_DOMAIN_RECORD);
+
   int res = 0;
 
   // invoke record on all recorders
@@ -1821,16 +1899,27 @@ Domain::commit(void)
     // 
     // first invoke commit on all nodes and elements in the domain
     //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0) {
-      nodePtr->commitState();
-    }
+    // if the nodal response quantities are all in the state pool
+    // they are committed with a few block copies
+    {
+      PerformanceTimer theTimer(PERF_DOMAIN_COMMIT);
+
+      if (this->buildStatePool() == 0)
+	theStatePool->commitState();
+      else {
+	Node *nodePtr;
+	NodeIter &theNodeIter = this->getNodes();
+	while ((nodePtr = theNodeIter()) != 0) {
+	  nodePtr->commitState();
+	}
+      }
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-      elePtr->commitState();
+      Element *elePtr;
+      ElementIter &theElemIter = this->getElements();    
+      while ((elePtr = theElemIter()) != 0) {
+	PerformanceTimer theEleTimer(PERF_DOMAIN_COMMIT, elePtr);
+	elePtr->commitState();
+      }
     }
 
     // set the new committed time in the domain
@@ -1838,9 +1927,12 @@ Domain::commit(void)
     dT = 0.0;
 
     // invoke record on all recorders
-    for (int i=0; i<numRecorders; i++)
-      if (theRecorders[i] != 0)
-	theRecorders[i]->record(commitTag, currentTime);
+    {
+      PerformanceTimer theTimer(PERF_DOMAIN_RECORD);
+      for (int i=0; i<numRecorders; i++)
+	if (theRecorders[i] != 0)
+	  theRecorders[i]->record(commitTag, currentTime);
+    }
 
     // update the commitTag
     commitTag++;
@@ -1854,10 +1946,14 @@ Domain::revertToLastCommit(void)
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     //
     
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0)
+    if (this->buildStatePool() == 0)
+      theStatePool->revertToLastCommit();
+    else {
+      Node *nodePtr;
+      NodeIter &theNodeIter = this->getNodes();
+      while ((nodePtr = theNodeIter()) != 0)
 	nodePtr->revertToLastCommit();
+    }
     
     Element *elePtr;
     ElementIter &theElemIter = this->getElements();    
@@ -1914,6 +2010,8 @@ Domain::revertToStart(void)
 int
 Domain::update(void)
 {
+  PerformanceTimer theTimer(PERF_DOMAIN_UPDATE);
+
   // set the global constants
   ops_Dt = dT;
   ops_TheActiveDomain = this;
@@ -1926,6 +2024,7 @@ Domain::update(void)
 
   while ((theEle = theEles()) != 0) {
     ops_TheActiveElement = theEle;
+    PerformanceTimer theEleTimer(PERF_DOMAIN_UPDATE, theEle);
     ok += theEle->update();
   }
 
@@ -2485,6 +2584,70 @@ Domain::buildNodeGraph(Graph *theNodeGraph)
     return 0;
 }
 
+
+// int buildStatePool(void);
+//	Method to place the response quantities of all the nodes in a
+//	NodalStatePool, so that they can be committed and reverted as a
+//	whole. The pool is only rebuilt if nodes have been added or removed.
+//	Returns 0 if all the nodes of the domain are in the pool.
+
+int
+Domain::buildStatePool(void)
+{
+  if (statePoolOK == true)
+    return 0;
+
+  // only nodes held in this domains storage can be placed in the pool
+  if (theNodes->getNumComponents() != this->getNumNodes())
+    return -1;
+
+  Node *nodPtr;
+  int numDOF = 0;
+  theNodIter->reset();
+  while ((nodPtr = (*theNodIter)()) != 0)
+    numDOF += nodPtr->getNumberDOF();
+
+  NodalStatePool *newPool = new NodalStatePool();
+  if (newPool == 0 || newPool->setSize(numDOF) < 0) {
+    opserr << "WARNING Domain::buildStatePool() - out of memory\n";
+    if (newPool != 0)
+      delete newPool;
+    return -2;
+  }
+
+  // move the nodes over, the values are copied from where they are now
+  int offset = 0;
+  int res = 0;
+  theNodIter->reset();
+  while ((nodPtr = (*theNodIter)()) != 0 && res == 0) {
+    int numNodeDOF = nodPtr->getNumberDOF();
+    if (numNodeDOF > 0) {
+      res = nodPtr->setStatePool(newPool, offset);
+      offset += numNodeDOF;
+    }
+  }
+
+  if (res != 0) {
+    // failed, back out by giving the nodes their own storage
+    theNodIter->reset();
+    while ((nodPtr = (*theNodIter)()) != 0)
+      if (nodPtr->getNumberDOF() > 0)
+	nodPtr->setStatePool(0, 0);
+    delete newPool;
+    if (theStatePool != 0)
+      delete theStatePool;
+    theStatePool = 0;
+    return -3;
+  }
+
+  if (theStatePool != 0)
+    delete theStatePool;
+  theStatePool = newPool;
+  statePoolOK = true;
+
+  return 0;
+}
+
 int 
 Domain::sendSelf(int cTag, Channel &theChannel)
 {
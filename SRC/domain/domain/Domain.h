@@ -74,6 +74,7 @@ class Channel;
 class FEM_ObjectBroker;
 
 class TaggedObjectStorage;
+class NodalStatePool;
 
 class Domain
 {
@@ -92,6 +93,10 @@ class Domain
     
     virtual ~Domain();    
 
+    // method to change the type of storage used for the nodes, elements
+    // and constraints; only allowed while the domain holds none of them
+    virtual int setStorage(TaggedObjectStorage &theStorageType);
+
     // methods to populate a domain
     virtual  bool addElement(Element *);
     virtual  bool addNode(Node *);
@@ -232,6 +237,7 @@ class Domain
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    int buildStatePool(void);
 
     Recorder **theRecorders;
     int numRecorders;    
@@ -288,6 +294,9 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    NodalStatePool *theStatePool;  // holds the nodal response quantities
+    bool statePoolOK;              // false if nodes added/removed since built
 };
 
 #endif
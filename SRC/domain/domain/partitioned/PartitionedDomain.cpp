@@ -65,6 +65,7 @@
 
 #include <MapOfTaggedObjects.h>
 #include <MapOfTaggedObjectsIter.h>
+#include <ThreadPool.h>
 
 typedef map<int, int>         MAP_INT;
 typedef MAP_INT::value_type   MAP_INT_TYPE;
@@ -74,10 +75,62 @@ typedef map<int, ID *> MAP_ID;
 typedef MAP_ID::value_type   MAP_ID_TYPE;
 typedef MAP_ID::iterator     MAP_ID_ITERATOR;
 
+// ThreadTask used to do the state determination of thread safe
+// subdomains in parallel, the actions are or'ed together and done
+// in the order listed for each subdomain
+enum {SUB_RESPONSE = 1, SUB_UPDATE = 2, SUB_COMMIT = 4,
+      SUB_REVERT = 8, SUB_REVERT_START = 16};
+
+class SubdomainTask: public ThreadTask
+{
+  public:
+    SubdomainTask(Subdomain **theSubs, int action)
+      :theSubs(theSubs), action(action) {};
+    int run(int first, int last, int threadID) {
+      int res = 0;
+      for (int i=first; i<last; i++) {
+	Subdomain *theSub = theSubs[i];
+	if (action & SUB_RESPONSE)
+	  theSub->computeNodalResponse();
+	if (action & SUB_UPDATE)
+	  res += theSub->update();
+	if (action & SUB_COMMIT) {
+	  int ok = theSub->commit();
+	  if (ok < 0) {
+	    opserr << "PartitionedDomain::commit(void)";
+	    opserr << " - failed in Subdomain::commit()\n";
+	    return ok;
+	  }
+	}
+	if (action & SUB_REVERT) {
+	  int ok = theSub->revertToLastCommit();
+	  if (ok < 0) {
+	    opserr << "PartitionedDomain::revertToLastCommit(void)";
+	    opserr << " - failed in Subdomain::revertToLastCommit()\n";
+	    return ok;
+	  }
+	}
+	if (action & SUB_REVERT_START) {
+	  int ok = theSub->revertToStart();
+	  if (ok < 0) {
+	    opserr << "PartitionedDomain::revertToStart(void)";
+	    opserr << " - failed in Subdomain::revertToStart()\n";
+	    return ok;
+	  }
+	}
+      }
+      return res;
+    }
+  private:
+    Subdomain **theSubs;
+    int action;
+};
+
 PartitionedDomain::PartitionedDomain()
 :Domain(),
  theSubdomains(0),theDomainPartitioner(0),
- theSubdomainIter(0), mySubdomainGraph(0)
+ theSubdomainIter(0), mySubdomainGraph(0),
+ thePool(0), theSubs(0), sizeSubs(0)
 {
     elements = new ArrayOfTaggedObjects(1024);    
     theSubdomains = new ArrayOfTaggedObjects(32);
@@ -100,7 +153,8 @@ PartitionedDomain::PartitionedDomain()
 PartitionedDomain::PartitionedDomain(DomainPartitioner &thePartitioner)
 :Domain(),
  theSubdomains(0),theDomainPartitioner(&thePartitioner),
- theSubdomainIter(0), mySubdomainGraph(0)
+ theSubdomainIter(0), mySubdomainGraph(0),
+ thePool(0), theSubs(0), sizeSubs(0)
 {
     elements = new ArrayOfTaggedObjects(1024);    
     theSubdomains = new ArrayOfTaggedObjects(32);
@@ -127,7 +181,8 @@ PartitionedDomain::PartitionedDomain(int numNodes, int numElements,
 
 :Domain(numNodes,0,numSPs,numMPs,numLoadPatterns),
  theSubdomains(0),theDomainPartitioner(&thePartitioner),
- theSubdomainIter(0), mySubdomainGraph(0)
+ theSubdomainIter(0), mySubdomainGraph(0),
+ thePool(0), theSubs(0), sizeSubs(0)
 {
     elements = new ArrayOfTaggedObjects(numElements);    
     theSubdomains = new ArrayOfTaggedObjects(numSubdomains);
@@ -164,6 +219,12 @@ PartitionedDomain::~PartitionedDomain()
 
   if (theEleIter != 0)
     delete theEleIter;
+
+  if (thePool != 0)
+    delete thePool;
+
+  if (theSubs != 0)
+    delete [] theSubs;
 }
 
 void
@@ -943,7 +1004,11 @@ PartitionedDomain::update(void)
   int res = this->Domain::update();
 
   // do the same for all the subdomains
-  if (theSubdomains != 0) {
+  bool done;
+  int ok = this->runSubdomainTask(SUB_RESPONSE | SUB_UPDATE, done);
+  if (done == true)
+    res += ok;
+  else if (theSubdomains != 0) {
     ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
@@ -995,8 +1060,13 @@ PartitionedDomain::update(double newTime, double dT)
   this->applyLoad(newTime);
   int res = this->Domain::update();
 
-  // do the same for all the subdomains
-  if (theSubdomains != 0) {
+  // do the same for all the subdomains; applyLoad() above has already
+  // loaded them
+  bool done;
+  int ok = this->runSubdomainTask(SUB_RESPONSE | SUB_UPDATE, done);
+  if (done == true)
+    res += ok;
+  else if (theSubdomains != 0) {
     ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
@@ -1175,7 +1245,11 @@ PartitionedDomain::commit(void)
   }
 
   // do the same for all the subdomains
-  if (theSubdomains != 0) {
+  bool done;
+  int ok = this->runSubdomainTask(SUB_COMMIT, done);
+  if (ok < 0)
+    return ok;
+  else if (done == false && theSubdomains != 0) {
     ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
     TaggedObject *theObject;
     while ((theObject = theSubsIter()) != 0) {
@@ -1210,7 +1284,11 @@ PartitionedDomain::revertToLastCommit(void)
     }
 
     // do the same for all the subdomains
-    if (theSubdomains != 0) {
+    bool done;
+    int ok = this->runSubdomainTask(SUB_REVERT, done);
+    if (ok < 0)
+	return ok;
+    else if (done == false && theSubdomains != 0) {
 	ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
 	TaggedObject *theObject;
 	while ((theObject = theSubsIter()) != 0) {
@@ -1237,7 +1315,11 @@ PartitionedDomain::revertToStart(void)
     }
 
     // do the same for all the subdomains
-    if (theSubdomains != 0) {
+    bool done;
+    int ok = this->runSubdomainTask(SUB_REVERT_START, done);
+    if (ok < 0)
+	return ok;
+    else if (done == false && theSubdomains != 0) {
 	ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
 	TaggedObject *theObject;
 	while ((theObject = theSubsIter()) != 0) {
@@ -1497,6 +1579,85 @@ PartitionedDomain::getPartitioner(void) const
 {
     return theDomainPartitioner;
 }
+
+
+int
+PartitionedDomain::setNumThreads(int numThreads)
+{
+  if (numThreads <= 0)
+    numThreads = ThreadPool::getNumProcessors();
+
+  if (thePool != 0) {
+    if (thePool->getNumThreads() == numThreads)
+      return 0;
+    delete thePool;
+    thePool = 0;
+  }
+
+  if (numThreads == 1)
+    return 0;
+
+  thePool = new ThreadPool(numThreads);
+  if (thePool == 0) {
+    opserr << "WARNING PartitionedDomain::setNumThreads() - out of memory creating ThreadPool\n";
+    return -1;
+  }
+
+  if (thePool->getNumThreads() == 1) {
+    delete thePool;
+    thePool = 0;
+  }
+
+  return 0;
+}
+
+
+int
+PartitionedDomain::getNumThreads(void) const
+{
+  if (thePool == 0)
+    return 1;
+
+  return thePool->getNumThreads();
+}
+
+
+// runs the action on all the subdomains using the ThreadPool and returns
+// the result; done is set false, and nothing is done, if there is no pool
+// or a subdomain that is not thread safe, in which case the caller does
+// the subdomains in turn
+int
+PartitionedDomain::runSubdomainTask(int action, bool &done)
+{
+  done = false;
+  if (thePool == 0 || theSubdomains == 0)
+    return 0;
+
+  int numSubs = theSubdomains->getNumComponents();
+  if (numSubs < 2)
+    return 0;
+
+  if (numSubs > sizeSubs) {
+    if (theSubs != 0)
+      delete [] theSubs;
+    theSubs = new Subdomain *[numSubs];
+    sizeSubs = numSubs;
+  }
+
+  ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);	
+  TaggedObject *theObject;
+  int cnt = 0;
+  while ((theObject = theSubsIter()) != 0) {
+    Subdomain *theSub = (Subdomain *)theObject;	    
+    if (theSub->isThreadSafe() == false)
+      return 0;
+    theSubs[cnt++] = theSub;
+  }
+
+  done = true;
+  SubdomainTask theTask(theSubs, action);
+  return thePool->execute(theTask, cnt, 1);
+}
 	
 
 
@@ -50,6 +50,7 @@ class  PartitionedDomainSubIter;
 class  PartitionedDomainEleIter;
 class SingleDomEleIter;
 class Parameter;
+class ThreadPool;
 
 class PartitionedDomain: public Domain
 {
@@ -138,6 +139,11 @@ class PartitionedDomain: public Domain
     virtual Node *removeExternalNode(int tag);        
     virtual Graph &getSubdomainGraph(void);
 
+    // number of threads used for the state determination of the
+    // subdomains; only used if every subdomain is thread safe
+    int setNumThreads(int numThreads);
+    int getNumThreads(void) const;
+
     // nodal methods required in domain interface for parallel interprter
     virtual const Vector *getNodeResponse(int nodeTag, NodeResponseType); 
     virtual const Vector *getElementResponse(int eleTag, const char **argv, int argc); 
@@ -156,6 +162,8 @@ class PartitionedDomain: public Domain
     virtual int buildEleGraph(Graph *theEleGraph);
     
   private:
+    int runSubdomainTask(int action, bool &done);
+
     TaggedObjectStorage  *elements;    
     ArrayOfTaggedObjects *theSubdomains;
     DomainPartitioner    *theDomainPartitioner;
@@ -165,6 +173,10 @@ class PartitionedDomain: public Domain
     PartitionedDomainEleIter   *theEleIter;
     
     Graph *mySubdomainGraph;    // a graph of subdomain connectivity
+
+    ThreadPool *thePool;        // 0 if the subdomains are done in turn
+    Subdomain **theSubs;        // the subdomains handed to the pool
+    int sizeSubs;
 };
 
 #endif
@@ -0,0 +1,191 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/loadBalancer/MeasuredCostBalancer.cpp,v $
+                                                                        
+                                                                        
+// File: ~/domain/loadBalancer/MeasuredCostBalancer.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation for 
+// MeasuredCostBalancer.
+//
+// What: "@(#) MeasuredCostBalancer.cpp, revA"
+
+#include <MeasuredCostBalancer.h>
+#include <Graph.h>
+#include <VertexIter.h>
+#include <Vertex.h>
+#include <Vector.h>
+#include <ID.h>
+#include <PerformanceMonitor.h>
+ 
+MeasuredCostBalancer::MeasuredCostBalancer()
+ :imbalanceTol(1.1), balanceInterval(1), numCommits(0)
+{
+    
+}
+
+MeasuredCostBalancer::MeasuredCostBalancer(double tol, int interval)
+ :imbalanceTol(tol), balanceInterval(interval), numCommits(0)
+{
+    if (imbalanceTol < 1.0)
+	imbalanceTol = 1.0;
+    if (balanceInterval < 1)
+	balanceInterval = 1;
+}
+
+MeasuredCostBalancer::~MeasuredCostBalancer()
+{
+    // stop the elements measuring a cost no one is using
+    PerformanceMonitor::setElementCostOn(false);
+}
+
+void
+MeasuredCostBalancer::setLinks(DomainPartitioner &thePartitioner)
+{
+    this->LoadBalancer::setLinks(thePartitioner);
+
+    // the elements now have to measure their cost
+    PerformanceMonitor::setElementCostOn(true);
+}
+
+int
+MeasuredCostBalancer::balance(Graph &theWeightedGraph)
+{
+    // check to see a domain partitioner has been set
+    DomainPartitioner *thePartitioner = this->getDomainPartitioner();
+    if (thePartitioner == 0) {
+	opserr << "MeasuredCostBalancer::balance - No DomainPartitioner has been set\n";
+	return -1;
+    }
+
+    numCommits++;
+    if (numCommits < balanceInterval)
+	return 0;
+    numCommits = 0;
+
+    // the vertex weights of the colored graph hold the cost of the
+    // elements accumulated since the last time we were here
+    Graph &theColoredGraph = thePartitioner->getColoredGraph();
+    int numPartitions = thePartitioner->getNumPartitions();
+    Vector cost(numPartitions+1);
+
+    VertexIter &theVertices = theColoredGraph.getVertices();
+    Vertex *vertexPtr;
+    while ((vertexPtr = theVertices()) != 0) {
+	int color = vertexPtr->getColor();
+	if (color > 0 && color <= numPartitions)
+	    cost(color) += vertexPtr->getWeight();
+    }
+
+    // determine the most expensive partition and the average; partitions
+    // without a measured cost (remote or the main domain) are ignored
+    int from = 0;
+    int numMeasured = 0;
+    double totalCost = 0.0;
+    for (int i=1; i<=numPartitions; i++)
+	if (cost(i) > 0.0) {
+	    numMeasured++;
+	    totalCost += cost(i);
+	    if (from == 0 || cost(i) > cost(from))
+		from = i;
+	}
+
+    int res = 0;
+    if (numMeasured > 1 && cost(from) > imbalanceTol*totalCost/numMeasured) {
+
+	// the cheapest partition adjacent to it
+	int to = 0;
+	Vertex *fromVertex = theWeightedGraph.getVertexPtr(from);
+	if (fromVertex != 0) {
+	    const ID &adjacent = fromVertex->getAdjacency();
+	    for (int i=0; i<adjacent.Size(); i++) {
+		int other = adjacent(i);
+		if (other > 0 && other <= numPartitions && cost(other) > 0.0 &&
+		    (to == 0 || cost(other) < cost(to)))
+		    to = other;
+	    }
+	}
+
+	if (to != 0) {
+
+	    // the elements of from adjacent to elements of to
+	    ID candidates(0, 64);
+	    int numCandidates = 0;
+	    VertexIter &theBoundary = theColoredGraph.getVertices();
+	    while ((vertexPtr = theBoundary()) != 0) {
+		if (vertexPtr->getColor() != from || vertexPtr->getWeight() <= 0.0)
+		    continue;
+		const ID &adjacent = vertexPtr->getAdjacency();
+		for (int i=0; i<adjacent.Size(); i++)
+		    if (theColoredGraph.getVertexPtr(adjacent(i))->getColor() == to) {
+			candidates[numCandidates++] = vertexPtr->getTag();
+			break;
+		    }
+	    }
+
+	    // move the most expensive first until half the difference
+	    // in cost has been moved
+	    double toMove = 0.5*(cost(from) - cost(to));
+	    double moved = 0.0;
+	    for (int i=0; i<numCandidates && moved < toMove; i++) {
+		int maxLoc = i;
+		double maxWeight = theColoredGraph.getVertexPtr(candidates(i))->getWeight();
+		for (int j=i+1; j<numCandidates; j++) {
+		    double weight = theColoredGraph.getVertexPtr(candidates(j))->getWeight();
+		    if (weight > maxWeight) {
+			maxWeight = weight;
+			maxLoc = j;
+		    }
+		}
+		int vertexTag = candidates(maxLoc);
+		candidates[maxLoc] = candidates(i);
+		candidates[i] = vertexTag;
+
+		if (moved + maxWeight > toMove)
+		    continue;
+
+		res = thePartitioner->swapVertex(from, to, vertexTag, false);
+		if (res < 0) {
+		    opserr << "WARNING MeasuredCostBalancer::balance() ";
+		    opserr << " - DomainPartitioner::swapVertex returned ";
+		    opserr << res << endln;
+		    break;
+		} else if (res == 0)
+		    moved += maxWeight;
+	    }
+	    if (res > 0)
+		res = 0;
+	}
+    }
+
+    // start accumulating the cost for the next interval
+    VertexIter &theVertices2 = theColoredGraph.getVertices();
+    while ((vertexPtr = theVertices2()) != 0)
+	vertexPtr->setWeight(0.0);
+
+    return res;
+}
+
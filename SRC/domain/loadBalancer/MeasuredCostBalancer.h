@@ -0,0 +1,68 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/loadBalancer/MeasuredCostBalancer.h,v $
+                                                                        
+                                                                        
+// File: ~/domain/loadBalancer/MeasuredCostBalancer.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// MeasuredCostBalancer. A MeasuredCostBalancer is a LoadBalancer that 
+// balances using the time measured in the elements of the subdomains 
+// instead of static graph weights. Every balanceInterval commits the 
+// accumulated cost of each subdomain is compared with the average; if the 
+// most expensive subdomain exceeds the average by more than the factor 
+// imbalanceTol, its most expensive elements on the boundary with the 
+// cheapest adjacent subdomain are moved there until about half the 
+// difference in cost between the two has been moved.
+//
+// What: "@(#) MeasuredCostBalancer.h, revA"
+
+#ifndef MeasuredCostBalancer_h
+#define MeasuredCostBalancer_h
+
+#include <LoadBalancer.h>
+
+class MeasuredCostBalancer: public LoadBalancer
+{
+  public:
+    MeasuredCostBalancer();
+    MeasuredCostBalancer(double imbalanceTol, int balanceInterval);
+
+    virtual  ~MeasuredCostBalancer();    
+
+    virtual void setLinks(DomainPartitioner &thePartitioner);
+    virtual int balance(Graph &theWeightedGraph);
+
+  protected:    
+	
+  private:
+    double imbalanceTol;
+    int balanceInterval;
+    int numCommits;
+};
+
+#endif
+
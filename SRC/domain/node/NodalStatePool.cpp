@@ -0,0 +1,120 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/node/NodalStatePool.cpp,v $
+
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of NodalStatePool.
+//
+// What: "@(#) NodalStatePool.cpp, revA"
+
+#include <NodalStatePool.h>
+#include <OPS_Globals.h>
+
+#include <string.h>
+
+NodalStatePool::NodalStatePool()
+  :size(0), theData(0)
+{
+
+}
+
+NodalStatePool::~NodalStatePool()
+{
+  if (theData != 0)
+    delete [] theData;
+}
+
+int
+NodalStatePool::setSize(int numDOF)
+{
+  if (numDOF < 0) {
+    opserr << "NodalStatePool::setSize() - invalid size " << numDOF << endln;
+    return -1;
+  }
+
+  if (numDOF != size) {
+    if (theData != 0)
+      delete [] theData;
+    theData = 0;
+    size = 0;
+
+    if (numDOF > 0) {
+      theData = new double[NumQuantities*numDOF];
+      if (theData == 0) {
+	opserr << "NodalStatePool::setSize() - ran out of memory for size " << numDOF << endln;
+	return -2;
+      }
+    }
+    size = numDOF;
+  }
+
+  for (int i=0; i<NumQuantities*size; i++)
+    theData[i] = 0.0;
+
+  return 0;
+}
+
+int
+NodalStatePool::getSize(void) const
+{
+  return size;
+}
+
+double *
+NodalStatePool::getData(int quantity)
+{
+  if (theData == 0 || quantity < 0 || quantity >= NumQuantities)
+    return 0;
+
+  return &theData[quantity*size];
+}
+
+void
+NodalStatePool::commitState(void)
+{
+  if (size == 0)
+    return;
+
+  // commit = trial, incr = 0.0
+  int numBytes = size*sizeof(double);
+  memcpy(&theData[CommitDisp*size], &theData[TrialDisp*size], numBytes);
+  memset(&theData[IncrDisp*size], 0, 2*numBytes);
+  memcpy(&theData[CommitVel*size], &theData[TrialVel*size], numBytes);
+  memcpy(&theData[CommitAccel*size], &theData[TrialAccel*size], numBytes);
+}
+
+void
+NodalStatePool::revertToLastCommit(void)
+{
+  if (size == 0)
+    return;
+
+  // trial = commit, incr = 0.0
+  int numBytes = size*sizeof(double);
+  memcpy(&theData[TrialDisp*size], &theData[CommitDisp*size], numBytes);
+  memset(&theData[IncrDisp*size], 0, 2*numBytes);
+  memcpy(&theData[TrialVel*size], &theData[CommitVel*size], numBytes);
+  memcpy(&theData[TrialAccel*size], &theData[CommitAccel*size], numBytes);
+}
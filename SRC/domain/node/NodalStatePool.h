@@ -0,0 +1,65 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/node/NodalStatePool.h,v $
+
+#ifndef NodalStatePool_h
+#define NodalStatePool_h
+
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for NodalStatePool.
+// A NodalStatePool holds the response quantities (trial, committed and
+// incremental displacements, trial and committed velocities and
+// accelerations) of all the nodes in a Domain. Each quantity is stored in
+// its own contiguous array, a node with ndof dof occupying the locations
+// offset through offset+ndof-1 of every array. Committing or reverting
+// the state of all the nodes is thus a few block copies.
+//
+// What: "@(#) NodalStatePool.h, revA"
+
+class NodalStatePool
+{
+  public:
+    enum Quantity {TrialDisp = 0, CommitDisp, IncrDisp, IncrDeltaDisp,
+		   TrialVel, CommitVel, TrialAccel, CommitAccel,
+		   NumQuantities};
+
+    NodalStatePool();
+    ~NodalStatePool();
+
+    int setSize(int numDOF);
+    int getSize(void) const;
+    double *getData(int quantity);
+
+    // the same as invoking Node::commitState() and 
+    // Node::revertToLastCommit() on all the nodes in the pool
+    void commitState(void);
+    void revertToLastCommit(void);
+
+  private:
+    int size;          // number of dof in the pool
+    double *theData;   // quantity q is stored at theData[q*size]
+};
+
+#endif
@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <DOF_Group.h>
+#include <NodalStatePool.h>
 #include <Renderer.h>
 #include <string.h>
 #include <Information.h>
@@ -65,7 +66,10 @@ Node::Node(int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0), 
  incrDeltaDisp(0),
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0),
+ trialDispData(0), commitDispData(0), incrDispData(0), incrDeltaDispData(0),
+ trialVelData(0), commitVelData(0), trialAccelData(0), commitAccelData(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0)
 {
@@ -86,7 +90,10 @@ Node::Node(int tag, int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0),
+ trialDispData(0), commitDispData(0), incrDispData(0), incrDeltaDispData(0),
+ trialVelData(0), commitVelData(0), trialAccelData(0), commitAccelData(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0)
 {
@@ -108,7 +115,10 @@ Node::Node(int tag, int ndof, double Crd1)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0),
+ trialDispData(0), commitDispData(0), incrDispData(0), incrDeltaDispData(0),
+ trialVelData(0), commitVelData(0), trialAccelData(0), commitAccelData(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
  index(-1), reaction(0)
 {
@@ -162,7 +172,10 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0),
+ trialDispData(0), commitDispData(0), incrDispData(0), incrDeltaDispData(0),
+ trialVelData(0), commitVelData(0), trialAccelData(0), commitAccelData(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0)
 {
@@ -218,7 +231,10 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, double Crd3)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0),
+ trialDispData(0), commitDispData(0), incrDispData(0), incrDeltaDispData(0),
+ trialVelData(0), commitVelData(0), trialAccelData(0), commitAccelData(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0)
 {
@@ -275,7 +291,10 @@ Node::Node(const Node &otherNode, bool copyMass)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0),
+ trialDispData(0), commitDispData(0), incrDispData(0), incrDeltaDispData(0),
+ trialVelData(0), commitVelData(0), trialAccelData(0), commitAccelData(0),
+ dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0)
 {
@@ -298,8 +317,12 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for displacement\n";
       exit(-1);
     }
-    for (int i=0; i<4*numberDOF; i++)
-      disp[i] = otherNode.disp[i];
+    for (int i=0; i<numberDOF; i++) {
+      trialDispData[i] = otherNode.trialDispData[i];
+      commitDispData[i] = otherNode.commitDispData[i];
+      incrDispData[i] = otherNode.incrDispData[i];
+      incrDeltaDispData[i] = otherNode.incrDeltaDispData[i];
+    }
   }    
   
   if (otherNode.commitVel != 0) {
@@ -307,8 +330,10 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for velocity\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
-      vel[i] = otherNode.vel[i];
+    for (int i=0; i<numberDOF; i++) {
+      trialVelData[i] = otherNode.trialVelData[i];
+      commitVelData[i] = otherNode.commitVelData[i];
+    }
   }    
   
   if (otherNode.commitAccel != 0) {
@@ -316,8 +341,10 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for acceleration\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
-      accel[i] = otherNode.accel[i];
+    for (int i=0; i<numberDOF; i++) {
+      trialAccelData[i] = otherNode.trialAccelData[i];
+      commitAccelData[i] = otherNode.commitAccelData[i];
+    }
   }    
   
   
@@ -475,6 +502,110 @@ Node::getDOF_GroupPtr(void)
 }
 
 
+int
+Node::setStatePool(NodalStatePool *thePool, int offset)
+{
+    // the disp, vel and accel are always moved together, so make
+    // sure they all exist
+    if ((trialDisp == 0 && this->createDisp() < 0) ||
+	(trialVel == 0 && this->createVel() < 0) ||
+	(trialAccel == 0 && this->createAccel() < 0)) {
+      opserr << "WARNING Node::setStatePool() - node: " << this->getTag();
+      opserr << " ran out of memory creating the response quantities\n";
+      return -1;
+    }
+
+    double *newDisp = 0;
+    double *newVel = 0;
+    double *newAccel = 0;
+    double *newData[NodalStatePool::NumQuantities];
+
+    if (thePool != 0) {
+      if (offset < 0 || offset+numberDOF > thePool->getSize()) {
+	opserr << "WARNING Node::setStatePool() - node: " << this->getTag();
+	opserr << " does not fit in the pool at offset " << offset << endln;
+	return -2;
+      }
+      for (int q=0; q<NodalStatePool::NumQuantities; q++)
+	newData[q] = thePool->getData(q) + offset;
+
+    } else {
+      // quick return if already holding own storage
+      if (disp != 0)
+	return 0;
+
+      newDisp = new double[4*numberDOF];
+      newVel = new double[2*numberDOF];
+      newAccel = new double[2*numberDOF];
+      if (newDisp == 0 || newVel == 0 || newAccel == 0) {
+	opserr << "WARNING Node::setStatePool() - node: " << this->getTag();
+	opserr << " ran out of memory\n";
+	if (newDisp != 0) delete [] newDisp;
+	if (newVel != 0) delete [] newVel;
+	if (newAccel != 0) delete [] newAccel;
+	return -1;
+      }
+      newData[NodalStatePool::TrialDisp] = newDisp;
+      newData[NodalStatePool::CommitDisp] = &newDisp[numberDOF];
+      newData[NodalStatePool::IncrDisp] = &newDisp[2*numberDOF];
+      newData[NodalStatePool::IncrDeltaDisp] = &newDisp[3*numberDOF];
+      newData[NodalStatePool::TrialVel] = newVel;
+      newData[NodalStatePool::CommitVel] = &newVel[numberDOF];
+      newData[NodalStatePool::TrialAccel] = newAccel;
+      newData[NodalStatePool::CommitAccel] = &newAccel[numberDOF];
+    }
+
+    // copy the current values over
+    double *oldData[NodalStatePool::NumQuantities];
+    oldData[NodalStatePool::TrialDisp] = trialDispData;
+    oldData[NodalStatePool::CommitDisp] = commitDispData;
+    oldData[NodalStatePool::IncrDisp] = incrDispData;
+    oldData[NodalStatePool::IncrDeltaDisp] = incrDeltaDispData;
+    oldData[NodalStatePool::TrialVel] = trialVelData;
+    oldData[NodalStatePool::CommitVel] = commitVelData;
+    oldData[NodalStatePool::TrialAccel] = trialAccelData;
+    oldData[NodalStatePool::CommitAccel] = commitAccelData;
+
+    for (int q=0; q<NodalStatePool::NumQuantities; q++)
+      if (newData[q] != oldData[q])
+	for (int i=0; i<numberDOF; i++)
+	  newData[q][i] = oldData[q][i];
+
+    // release the storage held before
+    if (disp != 0)
+      delete [] disp;
+    if (vel != 0)
+      delete [] vel;
+    if (accel != 0)
+      delete [] accel;
+
+    disp = newDisp;
+    vel = newVel;
+    accel = newAccel;
+
+    trialDispData = newData[NodalStatePool::TrialDisp];
+    commitDispData = newData[NodalStatePool::CommitDisp];
+    incrDispData = newData[NodalStatePool::IncrDisp];
+    incrDeltaDispData = newData[NodalStatePool::IncrDeltaDisp];
+    trialVelData = newData[NodalStatePool::TrialVel];
+    commitVelData = newData[NodalStatePool::CommitVel];
+    trialAccelData = newData[NodalStatePool::TrialAccel];
+    commitAccelData = newData[NodalStatePool::CommitAccel];
+
+    // the Vector objects stay the same, they just look at new data
+    trialDisp->setData(trialDispData, numberDOF);
+    commitDisp->setData(commitDispData, numberDOF);
+    incrDisp->setData(incrDispData, numberDOF);
+    incrDeltaDisp->setData(incrDeltaDispData, numberDOF);
+    trialVel->setData(trialVelData, numberDOF);
+    commitVel->setData(commitVelData, numberDOF);
+    trialAccel->setData(trialAccelData, numberDOF);
+    commitAccel->setData(commitAccelData, numberDOF);
+
+    return 0;
+}
+
+
 const Vector &
 Node::getCrds() const
 {
@@ -634,9 +765,9 @@ Node::setTrialDisp(double value, int dof)
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
     double tDisp = value;
-    disp[dof+2*numberDOF] = tDisp - disp[dof+numberDOF];
-    disp[dof+3*numberDOF] = tDisp - disp[dof];	
-    disp[dof] = tDisp;
+    incrDispData[dof] = tDisp - commitDispData[dof];
+    incrDeltaDispData[dof] = tDisp - trialDispData[dof];	
+    trialDispData[dof] = tDisp;
 
     return 0;
 }
@@ -664,9 +795,9 @@ Node::setTrialDisp(const Vector &newTrialDisp)
     // as we are sure of size and this way is quicker
     for (int i=0; i<numberDOF; i++) {
         double tDisp = newTrialDisp(i);
-	disp[i+2*numberDOF] = tDisp - disp[i+numberDOF];
-	disp[i+3*numberDOF] = tDisp - disp[i];	
-	disp[i] = tDisp;
+	incrDispData[i] = tDisp - commitDispData[i];
+	incrDeltaDispData[i] = tDisp - trialDispData[i];	
+	trialDispData[i] = tDisp;
     }
 
     return 0;
@@ -693,7 +824,7 @@ Node::setTrialVel(const Vector &newTrialVel)
     
     // set the trial quantities
     for (int i=0; i<numberDOF; i++)
-	vel[i] = newTrialVel(i);
+	trialVelData[i] = newTrialVel(i);
     return 0;
 }
 
@@ -717,7 +848,7 @@ Node::setTrialAccel(const Vector &newTrialAccel)
     
     // use vector assignment otherwise        
     for (int i=0; i<numberDOF; i++)
-	accel[i] = newTrialAccel(i);
+	trialAccelData[i] = newTrialAccel(i);
 
     return 0;
 }
@@ -739,9 +870,9 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	}    
 	for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
-	  disp[i] = incrDispI;
-	  disp[i+2*numberDOF] = incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  trialDispData[i] = incrDispI;
+	  incrDispData[i] = incrDispI;
+	  incrDeltaDispData[i] = incrDispI;
 	}
 	return 0;
     }
@@ -749,9 +880,9 @@ Node::incrTrialDisp(const Vector &incrDispl)
     // otherwise set trial = incr + trial
     for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
-	  disp[i] += incrDispI;
-	  disp[i+2*numberDOF] += incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  trialDispData[i] += incrDispI;
+	  incrDispData[i] += incrDispI;
+	  incrDeltaDispData[i] = incrDispI;
     }
 
     return 0;
@@ -774,14 +905,14 @@ Node::incrTrialVel(const Vector &incrVel)
 	    exit(-1);
 	}    
 	for (int i = 0; i<numberDOF; i++)
-	    vel[i] = incrVel(i);
+	    trialVelData[i] = incrVel(i);
 
 	return 0;
     }
 
     // otherwise set trial = incr + trial
     for (int i = 0; i<numberDOF; i++)
-	vel[i] += incrVel(i);    
+	trialVelData[i] += incrVel(i);    
 
     return 0;
 }
@@ -803,14 +934,14 @@ Node::incrTrialAccel(const Vector &incrAccel)
 	    exit(-1);
 	}    
 	for (int i = 0; i<numberDOF; i++)
-	    accel[i] = incrAccel(i);
+	    trialAccelData[i] = incrAccel(i);
 
 	return 0;
     }
 
     // otherwise set trial = incr + trial
     for (int i = 0; i<numberDOF; i++)
-	accel[i] += incrAccel(i);    
+	trialAccelData[i] += incrAccel(i);    
 
     return 0;
 }
@@ -988,22 +1119,22 @@ Node::commitState()
     // check disp exists, if does set commit = trial, incr = 0.0
     if (trialDisp != 0) {
       for (int i=0; i<numberDOF; i++) {
-	disp[i+numberDOF] = disp[i];  
-        disp[i+2*numberDOF] = 0.0;
-        disp[i+3*numberDOF] = 0.0;
+	commitDispData[i] = trialDispData[i];  
+        incrDispData[i] = 0.0;
+        incrDeltaDispData[i] = 0.0;
       }
     }		    
     
     // check vel exists, if does set commit = trial    
     if (trialVel != 0) {
       for (int i=0; i<numberDOF; i++)
-	vel[i+numberDOF] = vel[i];
+	commitVelData[i] = trialVelData[i];
     }
     
     // check accel exists, if does set commit = trial        
     if (trialAccel != 0) {
       for (int i=0; i<numberDOF; i++)
-	accel[i+numberDOF] = accel[i];
+	commitAccelData[i] = trialAccelData[i];
     }
 
     // if we get here we are done
@@ -1016,24 +1147,24 @@ int
 Node::revertToLastCommit()
 {
     // check disp exists, if does set trial = last commit, incr = 0
-    if (disp != 0) {
+    if (trialDisp != 0) {
       for (int i=0 ; i<numberDOF; i++) {
-	disp[i] = disp[i+numberDOF];
-	disp[i+2*numberDOF] = 0.0;
-	disp[i+3*numberDOF] = 0.0;
+	trialDispData[i] = commitDispData[i];
+	incrDispData[i] = 0.0;
+	incrDeltaDispData[i] = 0.0;
       }
     }
     
     // check vel exists, if does set trial = last commit
-    if (vel != 0) {
+    if (trialVel != 0) {
       for (int i=0 ; i<numberDOF; i++)
-	vel[i] = vel[numberDOF+i];
+	trialVelData[i] = commitVelData[i];
     }
 
     // check accel exists, if does set trial = last commit
-    if (accel != 0) {    
+    if (trialAccel != 0) {    
       for (int i=0 ; i<numberDOF; i++)
-	accel[i] = accel[numberDOF+i];
+	trialAccelData[i] = commitAccelData[i];
     }
 
     // if we get here we are done
@@ -1045,21 +1176,29 @@ int
 Node::revertToStart()
 {
     // check disp exists, if does set all to zero
-    if (disp != 0) {
-      for (int i=0 ; i<4*numberDOF; i++)
-	disp[i] = 0.0;
+    if (trialDisp != 0) {
+      for (int i=0 ; i<numberDOF; i++) {
+	trialDispData[i] = 0.0;
+	commitDispData[i] = 0.0;
+	incrDispData[i] = 0.0;
+	incrDeltaDispData[i] = 0.0;
+      }
     }
 
     // check vel exists, if does set all to zero
-    if (vel != 0) {
-      for (int i=0 ; i<2*numberDOF; i++)
-	vel[i] = 0.0;
+    if (trialVel != 0) {
+      for (int i=0 ; i<numberDOF; i++) {
+	trialVelData[i] = 0.0;
+	commitVelData[i] = 0.0;
+      }
     }
 
     // check accel exists, if does set all to zero
-    if (accel != 0) {    
-      for (int i=0 ; i<2*numberDOF; i++)
-	accel[i] = 0.0;
+    if (trialAccel != 0) {    
+      for (int i=0 ; i<numberDOF; i++) {
+	trialAccelData[i] = 0.0;
+	commitAccelData[i] = 0.0;
+      }
     }
     
     if (unbalLoad != 0) 
@@ -1105,6 +1244,13 @@ Node::setRayleighDampingFactor(double alpham) {
 }
 
 
+double
+Node::getRayleighDampingFactor(void) const
+{
+  return alphaM;
+}
+
+
 const Matrix &
 Node::getDamp(void) 
 {
@@ -1313,6 +1459,16 @@ Node::getEigenvectors(void)
   return *theEigenvectors;
 }
 
+int
+Node::getNumEigenvectors(void) const
+{
+  // 0 if the eigenvectors have not been set
+  if (theEigenvectors == 0)
+    return 0;
+
+  return theEigenvectors->noCols();
+}
+
 
 int 
 Node::sendSelf(int cTag, Channel &theChannel)
@@ -1324,9 +1480,9 @@ Node::sendSelf(int cTag, Channel &theChannel)
     data(1) = numberDOF; 
     
     // indicate whether vector quantaties have been formed
-    if (disp == 0)       data(2) = 1; else data(2) = 0;
-    if (vel == 0)        data(3) = 1; else data(3) = 0;
-    if (accel == 0)      data(4) = 1; else data(4) = 0;
+    if (trialDisp == 0)  data(2) = 1; else data(2) = 0;
+    if (trialVel == 0)   data(3) = 1; else data(3) = 0;
+    if (trialAccel == 0) data(4) = 1; else data(4) = 0;
     if (mass == 0)       data(5) = 1; else data(5) = 0;
     if (unbalLoad  == 0) data(6) = 1; else data(6) = 0;    
     if (R == 0) 	 
@@ -1472,7 +1628,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 
       // set the trial quantities equal to committed
       for (int i=0; i<numberDOF; i++)
-	disp[i] = disp[i+numberDOF];  // set trial equal commited
+	trialDispData[i] = commitDispData[i];  // set trial equal commited
 
     } else if (commitDisp != 0) {
       // if going back to initial we will just zero the vectors
@@ -1494,7 +1650,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 
       // set the trial quantity
       for (int i=0; i<numberDOF; i++)
-	vel[i] = vel[i+numberDOF];  // set trial equal commited
+	trialVelData[i] = commitVelData[i];  // set trial equal commited
     }
 
     if (data(4) == 0) {
@@ -1510,7 +1666,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
       
       // set the trial values
       for (int i=0; i<numberDOF; i++)
-	accel[i] = accel[i+numberDOF];  // set trial equal commited
+	trialAccelData[i] = commitAccelData[i];  // set trial equal commited
     }
 
     if (data(5) == 0) {
@@ -1676,11 +1832,16 @@ Node::createDisp(void)
   }
   for (int i=0; i<4*numberDOF; i++)
     disp[i] = 0.0;
+
+  trialDispData = disp;
+  commitDispData = &disp[numberDOF];
+  incrDispData = &disp[2*numberDOF];
+  incrDeltaDispData = &disp[3*numberDOF];
     
-  commitDisp = new Vector(&disp[numberDOF], numberDOF); 
-  trialDisp = new Vector(disp, numberDOF);
-  incrDisp = new Vector(&disp[2*numberDOF], numberDOF);
-  incrDeltaDisp = new Vector(&disp[3*numberDOF], numberDOF);
+  commitDisp = new Vector(commitDispData, numberDOF); 
+  trialDisp = new Vector(trialDispData, numberDOF);
+  incrDisp = new Vector(incrDispData, numberDOF);
+  incrDeltaDisp = new Vector(incrDeltaDispData, numberDOF);
   
   if (commitDisp == 0 || trialDisp == 0 || incrDisp == 0 || incrDeltaDisp == 0) {
     opserr << "WARNING - Node::createDisp() " <<
@@ -1703,9 +1864,12 @@ Node::createVel(void)
     }
     for (int i=0; i<2*numberDOF; i++)
       vel[i] = 0.0;
+
+    trialVelData = vel;
+    commitVelData = &vel[numberDOF];
     
-    commitVel = new Vector(&vel[numberDOF], numberDOF); 
-    trialVel = new Vector(vel, numberDOF);
+    commitVel = new Vector(commitVelData, numberDOF); 
+    trialVel = new Vector(trialVelData, numberDOF);
     
     if (commitVel == 0 || trialVel == 0) {
       opserr << "WARNING - Node::createVel() %s" <<
@@ -1727,9 +1891,12 @@ Node::createAccel(void)
     }
     for (int i=0; i<2*numberDOF; i++)
 	accel[i] = 0.0;
+
+    trialAccelData = accel;
+    commitAccelData = &accel[numberDOF];
     
-    commitAccel = new Vector(&accel[numberDOF], numberDOF);
-    trialAccel = new Vector(accel, numberDOF);
+    commitAccel = new Vector(commitAccelData, numberDOF);
+    trialAccel = new Vector(trialAccelData, numberDOF);
     
     if (commitAccel == 0 || trialAccel == 0) {
       opserr << "WARNING - Node::createAccel() ran out of memory creating Vectors(double *,int)\n";
@@ -48,6 +48,7 @@ class Channel;
 class Renderer;
 class NodalLoad; //Added by Liming Jiang,UOE2013
 class DOF_Group;
+class NodalStatePool;
 
 class Node : public DomainComponent
 {
@@ -68,6 +69,10 @@ class Node : public DomainComponent
     virtual void setDOF_GroupPtr(DOF_Group *theDOF_Grp);
     virtual DOF_Group *getDOF_GroupPtr(void);
 
+    // method to have the response quantities held in thePool starting 
+    // at location offset, if thePool is 0 the node holds them itself
+    int setStatePool(NodalStatePool *thePool, int offset);
+
     // public methods for obtaining the nodal coordinates
     virtual const Vector &getCrds(void) const;
 
@@ -113,12 +118,14 @@ class Node : public DomainComponent
     virtual const Vector &getRV(const Vector &V);        
 
     virtual int setRayleighDampingFactor(double alphaM);
+    double getRayleighDampingFactor(void) const;
     virtual const Matrix &getDamp(void);
 
     // public methods for eigen vector
     virtual int setNumEigenvectors(int numVectorsToStore);
     virtual int setEigenvector(int mode, const Vector &eigenVector);
     virtual const Matrix &getEigenvectors(void);
+    virtual int getNumEigenvectors(void) const;
     
     // public methods for output
     virtual int sendSelf(int commitTag, Channel &theChannel);
@@ -182,7 +189,12 @@ class Node : public DomainComponent
     NodalLoad *theNodalLoadPtr; //Added by Liming Jiang for pointer to nodalThermalAction, UOE2013
 
     double *disp, *vel, *accel; // double arrays holding the displ, 
-                                // vel and accel values
+                                // vel and accel values, 0 if in a pool
+
+    // the locations of the response quantities, in the above arrays
+    // or in a NodalStatePool
+    double *trialDispData, *commitDispData, *incrDispData, *incrDeltaDispData;
+    double *trialVelData, *commitVelData, *trialAccelData, *commitAccelData;
 
     int dbTag1, dbTag2, dbTag3, dbTag4; // needed for database
     Matrix *R;                          // nodal participation matrix
@@ -68,7 +68,9 @@ public:
   NodeLocations(int tag);
   void Print(OPS_Stream &s, int flag =0);  
   int addPartition(int partition);
+  int removePartition(int partition);
   ID nodePartitions;
+  ID numElements;    // number of elements in each partition using the node
   int numPartitions;
 };
 
@@ -77,6 +79,7 @@ public:
 NodeLocations::NodeLocations(int tag)
 :TaggedObject(tag), 
  nodePartitions(0,1), 
+ numElements(0,1),
  numPartitions(0)
 {
 
@@ -91,15 +94,64 @@ NodeLocations::Print(OPS_Stream &s, int flag)
 int
 NodeLocations::addPartition(int partition)
 {
-  if (nodePartitions.insert(partition) != 1)
-    numPartitions++;
+  int loc = nodePartitions.getLocation(partition);
+  if (loc < 0) {
+    loc = numPartitions++;
+    nodePartitions[loc] = partition;
+    numElements[loc] = 0;
+  }
+  numElements[loc]++;
   return 0;
 }
 
+// removes an element of the partition, returning the number of elements
+// of the partition still using the node
+int
+NodeLocations::removePartition(int partition)
+{
+  int loc = nodePartitions.getLocation(partition);
+  if (loc < 0)
+    return -1;
+
+  numElements[loc]--;
+  if (numElements(loc) > 0)
+    return numElements(loc);
+
+  for (int i=loc; i<numPartitions-1; i++) {
+    nodePartitions[i] = nodePartitions(i+1);
+    numElements[i] = numElements(i+1);
+  }
+  numPartitions--;
+  if (numPartitions > 0) {
+    nodePartitions.resize(numPartitions);
+    numElements.resize(numPartitions);
+  }
+
+  return 0;
+}
+
+// the boundary graphs share the vertices of the element graph, the
+// vertices are removed before a boundary graph is deleted
+static void
+releaseVertices(Graph *theGraph)
+{
+  ID theTags(0, theGraph->getNumVertex()+1);
+  int numVertex = 0;
+
+  VertexIter &theVertices = theGraph->getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = theVertices()) != 0)
+    theTags[numVertex++] = vertexPtr->getTag();
+
+  for (int i=0; i<numVertex; i++)
+    theGraph->removeVertex(theTags(i), false);
+}
+
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(0),
  theElementGraph(0), theBoundaryElements(0), 
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ pinnedElements(0,1), numSwapped(0)
 {
 
 }    
@@ -108,7 +160,8 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 				     LoadBalancer &theLoadBalancer)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(&theLoadBalancer),
  theElementGraph(0), theBoundaryElements(0),
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ pinnedElements(0,1), numSwapped(0)
 {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -119,10 +172,20 @@ DomainPartitioner::~DomainPartitioner()
 {
   if (theBoundaryElements != 0) {
     for (int i=0; i<numPartitions; i++)
-      if (theBoundaryElements[i] != 0)
+      if (theBoundaryElements[i] != 0) {
+	releaseVertices(theBoundaryElements[i]);
 	delete theBoundaryElements[i];
+      }
     delete []theBoundaryElements;
   }
+
+  if (theElementGraph != 0)
+    delete theElementGraph;
+
+  if (theNodeLocations != 0) {
+    theNodeLocations->clearAll();
+    delete theNodeLocations;
+  }
 }
 
 void 
@@ -155,9 +218,9 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   //    Graph &theEleGraph = myDomain->getElementGraph();
   //    theElementGraph = new Graph(myDomain->getElementGraph());
 
-  theElementGraph = &(myDomain->getElementGraph());
+  Graph &theDomainGraph = myDomain->getElementGraph();
 
-  int theError = thePartitioner.partition(*theElementGraph, numParts);
+  int theError = thePartitioner.partition(theDomainGraph, numParts);
 
   if (theError < 0) {
     opserr << "DomainPartitioner::partition";
@@ -166,6 +229,36 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     return -10+theError;
   }
 
+  // the domain clears its graph once the elements have been moved, we keep
+  // a colored copy of it for balancing. the old boundary graphs share the
+  // vertices of the old copy so are removed first
+
+  if (theBoundaryElements != 0) {
+    for (int i=0; i<numPartitions; i++)
+      if (theBoundaryElements[i] != 0) {
+	releaseVertices(theBoundaryElements[i]);
+	delete theBoundaryElements[i];
+      }
+    delete [] theBoundaryElements;
+    theBoundaryElements = 0;
+  }
+
+  if (theElementGraph != 0)
+    delete theElementGraph;
+
+  theElementGraph = new Graph(theDomainGraph);
+  if (theElementGraph == 0) {
+    opserr << "DomainPartitioner::partition(int numParts)";
+    opserr << " - ran out of memory copying the element graph\n";
+    numPartitions = 0;  
+    return -1;
+  }
+
+  VertexIter &theDomainVertices = theDomainGraph.getVertices();
+  Vertex *theDomainVertex;
+  while ((theDomainVertex = theDomainVertices()) != 0)
+    theElementGraph->getVertexPtr(theDomainVertex->getTag())->setColor(theDomainVertex->getColor());
+
   /* print graph */
   //  opserr << "DomainPartitioner::partition - eleGraph: \n";
   //  theElementGraph->Print(opserr, 4);
@@ -210,12 +303,9 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   // we create empty graphs for the numParts subdomains,
   // in the graphs we place the vertices for the elements on the boundaries
   
-  // we do not invoke the destructor on the individual graphs as 
-  // this would invoke the destructor on the individual vertices
+  // the individual graphs share the vertices of the element graph, so
+  // the vertices are removed before the graphs are deleted
 
-  if (theBoundaryElements != 0)
-    delete [] theBoundaryElements;
-  
   theBoundaryElements = new Graph * [numParts];
   if (theBoundaryElements == 0) {
     opserr << "DomainPartitioner::partition(int numParts)";
@@ -242,6 +332,11 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
   // we now create a MapOfTaggedObjectStorage to store the NodeLocations
   // and create a new NodeLocation for each node; adding it to the map object
 
+  if (theNodeLocations != 0) {
+    theNodeLocations->clearAll();
+    delete theNodeLocations;
+  }
+
   theNodeLocations = new MapOfTaggedObjects();
   if (theNodeLocations == 0) {
     opserr << "DomainPartitioner::partition(int numParts)";
@@ -268,6 +363,42 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     }
   }
 
+  //
+  // elements connected to nodes with constraints or nodal loads and the
+  // elements with elemental loads are kept in their partition when the
+  // domain is balanced. 
+  //
+
+  ID pinnedNodes(0, 64);
+  pinnedElements = ID(0, 64);
+  numSwapped = 0;
+
+  SP_ConstraintIter &thePinnedSPs = myDomain->getDomainAndLoadPatternSPs();
+  SP_Constraint *thePinnedSP;
+  while ((thePinnedSP = thePinnedSPs()) != 0)
+    pinnedNodes.insert(thePinnedSP->getNodeTag());
+
+  MP_ConstraintIter &thePinnedMPs = myDomain->getMPs();
+  MP_Constraint *thePinnedMP;
+  while ((thePinnedMP = thePinnedMPs()) != 0) {
+    pinnedNodes.insert(thePinnedMP->getNodeRetained());
+    pinnedNodes.insert(thePinnedMP->getNodeConstrained());
+  }
+
+  LoadPatternIter &thePinnedPatterns = myDomain->getLoadPatterns();
+  LoadPattern *thePinnedPattern;
+  while ((thePinnedPattern = thePinnedPatterns()) != 0) {
+    NodalLoadIter &thePinnedNodalLoads = thePinnedPattern->getNodalLoads();
+    NodalLoad *thePinnedNodalLoad;
+    while ((thePinnedNodalLoad = thePinnedNodalLoads()) != 0)
+      pinnedNodes.insert(thePinnedNodalLoad->getNodeTag());
+
+    ElementalLoadIter &thePinnedEleLoads = thePinnedPattern->getElementalLoads();
+    ElementalLoad *thePinnedEleLoad;
+    while ((thePinnedEleLoad = thePinnedEleLoads()) != 0)
+      pinnedElements.insert(thePinnedEleLoad->getElementTag());
+  }
+
   //
   // we now iterate through the vertices of the element graph
   // to see if the vertex is a boundary vertex or not - if it is
@@ -306,6 +437,9 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
       }
       NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
       theNodeLocation->addPartition(vertexColor);
+
+      if (pinnedNodes.getLocationOrdered(nodeTag) >= 0)
+	pinnedElements.insert(eleTag);
     }
   }
 
@@ -333,7 +467,7 @@ DomainPartitioner::partition(int numParts, bool usingMain, int mainPartitionTag,
     NodeLocations *theRetainedLocation = (NodeLocations *)theRetainedObject;
     NodeLocations *theConstrainedLocation = (NodeLocations *)theConstrainedObject;
     ID &theConstrainedNodesPartitions = theConstrainedLocation->nodePartitions;
-    int numPartitions = theConstrainedNodesPartitions.Size();
+    int numPartitions = theConstrainedLocation->numPartitions;
     for (int i=0; i<numPartitions; i++) {
       theRetainedLocation->addPartition(theConstrainedNodesPartitions(i));
     }
@@ -588,18 +722,48 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
 
     if (theBalancer != 0) {
 
+	// add the cost measured in the elements since the last commit to the
+	// weights of the vertices of the colored graph, a balancer using the
+	// weights resets them; a remote subdomain holds no elements locally
+	Subdomain *theSub;
+	VertexIter &theVertices = theElementGraph->getVertices();
+	Vertex *vertexPtr;
+	while ((vertexPtr = theVertices()) != 0) {
+	  theSub = myDomain->getSubdomainPtr(vertexPtr->getColor());
+	  Element *elePtr = 0;
+	  if (theSub != 0)
+	    elePtr = theSub->Domain::getElement(vertexPtr->getRef());
+	  if (elePtr != 0)
+	    vertexPtr->setWeight(vertexPtr->getWeight() + elePtr->getMeasuredCost());
+	}
+
 	// call on the LoadBalancer to partition		
+	numSwapped = 0;
 	res = theBalancer->balance(theWeightedPGraph);
-	    
-	// now invoke domainChanged on Subdomains and PartitionedDomain
-	SubdomainIter &theSubDomains = myDomain->getSubdomains();
-	Subdomain *theSubDomain;
 
-	while ((theSubDomain = theSubDomains()) != 0) 
-	  theSubDomain->domainChange();
+	// start measuring the cost again
+	SubdomainIter &theSubs = myDomain->getSubdomains();
+	while ((theSub = theSubs()) != 0) {
+	  ElementIter &theElements = theSub->Domain::getElements();
+	  Element *elePtr;
+	  while ((elePtr = theElements()) != 0)
+	    elePtr->zeroMeasuredCost();
+	}
+
+	// now invoke domainChanged on Subdomains and PartitionedDomain
+	// if any elements have been moved
+	if (numSwapped != 0) {
+	  SubdomainIter &theSubDomains = myDomain->getSubdomains();
+	  Subdomain *theSubDomain;
+
+	  while ((theSubDomain = theSubDomains()) != 0) {
+	    theSubDomain->domainChange();
+	    theSubDomain->invokeChangeOnAnalysis();
+	  }
 	
-	// we invoke change on the PartitionedDomain
-	myDomain->domainChange();
+	  // we invoke change on the PartitionedDomain
+	  myDomain->domainChange();
+	}
     }
 
     return res;
@@ -634,25 +798,40 @@ DomainPartitioner::getColoredGraph(void)
       opserr << " - No domain has been set";
       exit(0);
     }
+
+    // once partitioned the colors of the domain's graph are lost
+    if (theElementGraph != 0)
+      return *theElementGraph;
     
     return myDomain->getElementGraph();
 }
 
 
+// int swapVertex(int from, int to, int vertexTag, bool adjacentVertexNotInOther);
+// Moves the element of the vertex from Subdomain from to Subdomain to. The
+// element and any nodes that become internal to to are migrated with the
+// Subdomain add and remove methods, i.e. using sendSelf()/recvSelf() if the
+// Subdomain is remote. Nodes connected to elements in both become external
+// nodes of both, with the real node in the PartitionedDomain. Returns 0 if
+// the vertex was moved, 1 if it may not be moved and a negative number if
+// an error occurs.
+
 int 
 DomainPartitioner::swapVertex(int from, int to, int vertexTag,
 			      bool adjacentVertexNotInOther)
 {
-  opserr << "DomainPartitioner::swapVertex() " << from << " " << to << " " << vertexTag << endln;
-
-  /*
   // check that the object did the partitioning
   if (partitionFlag == false) {
-    opserr << "DomainPartitioner::balance(const Vector &load)";
+    opserr << "DomainPartitioner::swapVertex()";
     opserr << " - not partitioned or DomainPartitioner did not partition\n";
     return -1;
   }
-  
+
+  // the elements of the main partition live in the PartitionedDomain
+  if (from == to || (usingMainDomain == true && 
+		     (from == mainPartition || to == mainPartition)))
+    return 1;
+
   // check that the subdomain exist in partitioned domain
   Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
   if (fromSubdomain == 0) {
@@ -666,309 +845,148 @@ DomainPartitioner::swapVertex(int from, int to, int vertexTag,
     opserr << to << " exists\n";
     return -3;
   }    
-  
-  // remove the vertex from the boundary if there
-  // if not there we have to get a pointer to it from the ele graph.
-  
-  //    Graph &theEleGraph = myDomain->getElementGraph();    
-  Graph *fromBoundary = theBoundaryElements[from-1];
-  Graph *toBoundary = theBoundaryElements[to-1];    
-  Vertex *vertexPtr;
-  
-  // get a pointer to the vertex in the element graph
-  if (adjacentVertexNotInOther  == false) {
-    vertexPtr = fromBoundary->removeVertex(vertexTag,false);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;
-  } else { // get a pointer and check vertex not adjacent to another partition
-    vertexPtr = fromBoundary->getVertexPtr(vertexTag);    
-    if (vertexPtr == 0) 
-      vertexPtr = theElementGraph->getVertexPtr(vertexTag);
-    if (vertexPtr == 0)  // if still 0 no vertex given by tag exists
-      return -4;	
-    const ID &adjacent = vertexPtr->getAdjacency();
-    bool inTo = false;
-    bool inOther = false;
-    int adjacentSize = adjacent.Size();
-    for (int i=0; i<adjacentSize; i++) {
-      Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
-      if (other->getColor() == to) 
-	inTo = true;
-      else if (other->getColor() != from) {
-	inOther = true;
-	i = adjacentSize;
-      }
-    }
-    if (inTo != true || inOther == true) // we cannot remove the vertex
-      return -5;
-    // if can remove the vertex from the fromBoundary
-    Vertex *theVertex = fromBoundary->removeVertex(vertexTag,false);
-  }
-  
-  int eleTag = vertexPtr->getRef();
-  
-  //
-  // in the FROM subdomain we:
-  //  1. remove the element
-  //  2. remove all nodes connected to the element divide color by prime
-  //  3. see if have to add nodes back as external
-  //  4. remove from the PartitionedDomain if node was external
-  //  5. add new elements to the boundary vertices for from
-  
-  //  1. remove the element from the fromSubdomain
-    //          this gives us a pointer to the element as well.
-
-    Element *elePtr = fromSubdomain->removeElement(eleTag);
-    if (elePtr == 0) // if ele not there we can just return but ERROR it should be
-  return -6;
-
-    //  2. remove all nodes connected to the element divide color by prime    
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-    int primeFrom = primes(from);
-    const ID  &nodes1 = elePtr->getExternalNodes(); // create a copy, need after send ele
-    ID  nodes(nodes1);
-
-    int nodesSize = nodes.Size();
-    Node **nodesArray = new Node *[nodesSize];
-    for (int i=0; i<nodesSize; i++) {
-  int nodeTag = nodes(i);
-
-  // remove the node
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-
-  (*nodePlace)(nodeTag) /= primeFrom;
-  nodesArray[i] = nodePtr;
-        // opserr << "DomainPartitioner::swapVertex -NODE " << *nodePtr;
-  // add back as external if still needed
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
-    }
-
-    // 5. add new elements to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    const ID &eleAdjacent = vertexPtr->getAdjacency();
-    int eleAdjacentSize = eleAdjacent.Size();
-
-    for (int a=0; a<eleAdjacentSize; a++) {
-	int otherEleVertexTag = eleAdjacent(a);
-	Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	if (other == 0) {
-	    other = theElementGraph->getVertexPtr(otherEleVertexTag);
-	    if (other->getColor() == from)
-		fromBoundary->addVertex(other,false);
-	}
-    }
 
+  Vertex *vertexPtr = theElementGraph->getVertexPtr(vertexTag);
+  if (vertexPtr == 0 || vertexPtr->getColor() != from)
+    return -4;
 
-    
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
-    int primeTo = primes(to);
-    for (int l=0; l<nodesSize; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  int nodeColor = (*nodePlace)(nodeTag);
-  if (nodeColor % primeTo == 0) {
-      Node *nodePtr;
-      nodePtr = toSubdomain->removeNode(nodes(l));
+  // check the vertex is adjacent to to, and if required to no other partition
+  const ID &adjacent = vertexPtr->getAdjacency();
+  bool inTo = false;
+  bool inOther = false;
+  int adjacentSize = adjacent.Size();
+  for (int i=0; i<adjacentSize; i++) {
+    Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
+    if (other->getColor() == to) 
+      inTo = true;
+    else if (other->getColor() != from)
+      inOther = true;
   }
-    }
-
+  if (inTo == false || (adjacentVertexNotInOther == true && inOther == true))
+    return 1;
 
-    for (int m=0; m<nodesSize; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  2. mark all connecting nodes of elements as belonging to To      
-  (*nodePlace)(nodeTag) *= primeTo;
-
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
+  // elements with constrained or loaded nodes and loaded elements stay put
+  int eleTag = vertexPtr->getRef();
+  if (pinnedElements.getLocationOrdered(eleTag) >= 0)
+    return 1;
+
+  // move the element
+  Element *elePtr = fromSubdomain->removeElement(eleTag);
+  if (elePtr == 0) {
+    opserr << "DomainPartitioner::swapVertex - element: " << eleTag;
+    opserr << " not in Subdomain: " << from << endln;
+    return -5;
   }
+  ID nodes(elePtr->getExternalNodes());
+  elePtr->zeroMeasuredCost();
+
+  // now move the nodes of the element, noting if a node the elements
+  // left in from or already in to were connected to has been replaced
+  bool fromNodeReplaced = false;
+  bool toNodeReplaced = false;
+  int numNodes = nodes.Size();
+  for (int i=0; i<numNodes; i++) {
+    int nodeTag = nodes(i);
+    TaggedObject *theTaggedObject = theNodeLocations->getComponentPtr(nodeTag);
+    if (theTaggedObject == 0) {
+      opserr << "DomainPartitioner::swapVertex";
+      opserr << " - failed to find NodeLocation in Map for Node: " << nodeTag << " -- A BUG!!\n";
+      return -6;
     }
+    NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
 
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the element
-    
-    toSubdomain->addElement(elePtr);
-    
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-
-    vertexPtr->setColor(to);
-    toBoundary->addVertex(vertexPtr,false);
-
-    for (int n=0; n<eleAdjacentSize; n++) {
-	int otherEleVertexTag = eleAdjacent(n);
-	Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	if (other != 0) {
-	    const ID &othersAdjacency = other->getAdjacency();
-	    int otherSize = othersAdjacency.Size();
-	    for (int b=0; b<otherSize; b++) {
-		int anotherEleVertexTag = othersAdjacency(b);
-		Vertex *otherOther = theElementGraph->getVertexPtr(anotherEleVertexTag);
-		if (otherOther->getColor() != to) {
-		    toBoundary->addVertex(other,false);
-		    b=otherSize;
-		}
-	    }
-	}
-    }
+    bool wasExternal = (theNodeLocation->numPartitions > 1);
+    bool wasInTo = (theNodeLocation->nodePartitions.getLocation(to) >= 0);
+    theNodeLocation->addPartition(to);
+    int numLeftInFrom = theNodeLocation->removePartition(from);
+    bool isExternal = (theNodeLocation->numPartitions > 1);
+
+    Node *nodePtr;
+    if (wasExternal == false) {
+
+      // an internal node of from, it becomes internal to to or
+      // if still needed by from is placed on the boundary
+      nodePtr = fromSubdomain->removeNode(nodeTag);
+      if (isExternal == false)
+	toSubdomain->addNode(nodePtr);
+      else {
+	myDomain->addNode(nodePtr);
+	fromSubdomain->addExternalNode(nodePtr);
+	toSubdomain->addExternalNode(nodePtr);
+	fromNodeReplaced = true;
+      }
 
+    } else {
 
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
+      // a boundary node, remove the external node from from if no
+      // longer needed there and add one to to if not already there
+      if (numLeftInFrom == 0) {
+	nodePtr = fromSubdomain->removeNode(nodeTag);
+	if (nodePtr != 0)
+	  delete nodePtr;
       }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeSP_Constraint(spPtr->getTag());
-        toSubdomain->addSP_Constraint(spPtr);
-    }
-      }
-  }
-    }
 
-    
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeSP_Constraint(spPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addSP_Constraint(spPtr);
-    else
-        myDomain->addSP_Constraint(spPtr);
-      }
-  }
+      if (isExternal == false) {
+	if (wasInTo == true) {
+	  nodePtr = toSubdomain->removeNode(nodeTag);
+	  if (nodePtr != 0)
+	    delete nodePtr;
+	  toNodeReplaced = true;
+	}
+	nodePtr = myDomain->Domain::removeNode(nodeTag);
+	toSubdomain->addNode(nodePtr);
+      } else if (wasInTo == false)
+	toSubdomain->addExternalNode(myDomain->getNode(nodeTag));
     }
+  }
 
+  toSubdomain->addElement(elePtr);
 
-
-  */
-    /*
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) { // add to toSubdomain if inteernal
-        myDomain->removeNodalLoad(loadPtr->getTag());
-        toSubdomain->addNodalLoad(loadPtr);
-    }
-      }
+  // the elements hold pointers to their nodes, have them look up
+  // any that have been replaced
+  Element *otherPtr;
+  if (fromNodeReplaced == true) {
+    ElementIter &theElements = fromSubdomain->getElements();
+    while ((otherPtr = theElements()) != 0)
+      otherPtr->setDomain(fromSubdomain);
+  }
+  if (toNodeReplaced == true) {
+    ElementIter &theElements = toSubdomain->getElements();
+    while ((otherPtr = theElements()) != 0)
+      if (otherPtr != elePtr)
+	otherPtr->setDomain(toSubdomain);
   }
-    }
-
 
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  for (int i=0; i<nodesSize; i++) {
-      if (nodeTag == nodes(i)) {
-    fromSubdomain->removeNodalLoad(loadPtr->getTag());
-    int internal = 0;
-    for (int j=1; j<=numPartitions; j++) 
-        if (j != to) {
-      int prime = primes(j);
-      if ((*nodePlace)(nodeTag)%prime == 0) {
-          internal = 1;
-          j = numPartitions+1;
-      }
-        }
-    if (internal == 0) 
-        toSubdomain->addNodalLoad(loadPtr);
-    else
-        myDomain->addNodalLoad(loadPtr);
-      }  
+  // recolor the vertex and update the boundaries of the two partitions
+  vertexPtr->setColor(to);
+  theBoundaryElements[from-1]->removeVertex(vertexTag, false);
+
+  for (int j=-1; j<adjacentSize; j++) {
+    Vertex *theVertex = (j < 0) ? vertexPtr : 
+      theElementGraph->getVertexPtr(adjacent(j));
+    int color = theVertex->getColor();
+    if (color != from && color != to)
+      continue;
+
+    bool onBoundary = false;
+    const ID &otherAdjacent = theVertex->getAdjacency();
+    int otherSize = otherAdjacent.Size();
+    for (int k=0; k<otherSize && onBoundary == false; k++)
+      if (theElementGraph->getVertexPtr(otherAdjacent(k))->getColor() != color)
+	onBoundary = true;
+
+    Graph *theBoundary = theBoundaryElements[color-1];
+    int theTag = theVertex->getTag();
+    if (onBoundary == true) {
+      if (theBoundary->getVertexPtr(theTag) == 0)
+	theBoundary->addVertex(theVertex, false);
+    } else
+      theBoundary->removeVertex(theTag, false);
   }
-    }
-    */
 
-    return 0;
+  numSwapped++;
 
+  return 0;
 }
 
 
@@ -978,382 +996,38 @@ DomainPartitioner::swapVertex(int from, int to, int vertexTag,
 
 int 
 DomainPartitioner::swapBoundary(int from, int to, bool adjacentVertexNotInOther)
-          
 {
-  opserr << "DomainPartitioner::swapBoundary: from "  << from << " to " << to << endln;
-  /***********************************************************************************
-    opserr << "DomainPartitioner::swapBoundary from " << from << "  to " << to << endln;
-    Timer timer;
-    timer.start();
-
-    // check that the object did the partitioning
-    if (partitionFlag == false) {
-  opserr << "DomainPartitioner::balance(const Vector &load)";
-  opserr << " - not partitioned or DomainPartitioner did not partition\n";
-  return -1;
-    }
-
-    // check that the subdomains exist in partitioned domain
-    Subdomain *fromSubdomain = myDomain->getSubdomainPtr(from);
-    if (fromSubdomain == 0) {
-  opserr << "DomainPartitioner::swapBoundary - No from Subdomain: ";
-  opserr << from << " exists\n";
-  return -2;
-    }
-
-    Subdomain *toSubdomain = myDomain->getSubdomainPtr(to);
-    if (toSubdomain == 0) {
-  opserr << "DomainPartitioner::swapBoundary - No to Subdomain: ";
-  opserr << to << " exists\n";
-  return -3;
-    }    
-
-    // get the element graph
-    //    Graph &theEleGraph = myDomain->getElementGraph();    
-    Graph *fromBoundary = theBoundaryElements[from-1];
-    Graph *toBoundary = theBoundaryElements[to-1];
-
-    // into a new graph place the vertices that are to be swapped
-    Graph *swapVertices = new Graph(fromBoundary->getNumVertex());
-
-    VertexIter &swappableVertices = fromBoundary->getVertices();
-    Vertex *vertexPtr;
-
-    while ((vertexPtr = swappableVertices()) != 0) {
-	if (adjacentVertexNotInOther == false) {   
-	    const ID &adjacency=vertexPtr->getAdjacency();
-	    int size = adjacency.Size();
-	    for (int i=0; i<size; i++) {
-		int otherTag = adjacency(i);
-		Vertex *otherVertex = toBoundary->getVertexPtr(otherTag);
-		if (otherVertex != 0) {
-		    swapVertices->addVertex(vertexPtr,false);
-		    i = size;
-		}
-	    }
-	}
-	else {
-	    const ID &adjacent = vertexPtr->getAdjacency();
-	    bool inTo = false;
-	    bool inOther = false;
-	    int adjacentSize = adjacent.Size();
-	    for (int i=0; i<adjacentSize; i++) {
-		Vertex *other = theElementGraph->getVertexPtr(adjacent(i));
-		if (other->getColor() == to) 
-		    inTo = true;
-		else if (other->getColor() != from) {
-		    inOther = true;
-		    i = adjacentSize;
-		}
-	    }
-	    if (inTo == true && inOther == false) { // we remove the vertex
-		swapVertices->addVertex(vertexPtr,false);
-		vertexPtr->setColor(to);
-	    }
-	}
-    }
-
-    //
-    // in the FROM subdomain we:
-    //  1. remove the elements corresponding to the vertices
-    //  2. remove all nodes connected to the elements divide color by prime
-    //  3. see if have to add nodes back as external
-    //  4. remove from the PartitionedDomain if node was external
-    //  5. add new elements to the boundary vertices for from
-
-    // 1. first remove all the elements from from subdomain
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-
-    int numEleToSwap = swapVertices->getNumVertex();
-    Element **elementsArray = new Element *[numEleToSwap];
-
-    int count =0; 
-    int numCannotRemove =0;
-    for (int i=0; i<numEleToSwap; i++) {
-      vertexPtr = verticesToSwap();
-  if (vertexPtr == 0) 
-      return -1;
-
-  int vertexTag = vertexPtr->getTag();
-  int eleTag = vertexPtr->getRef();
-
-  // remove the vertex from fromBoundary, set color to to
-  // and add to toBoundary
-  bool inFrom = true;
-  vertexPtr = fromBoundary->removeVertex(vertexTag,false);
-
-
-  if (inFrom == true) {
-      vertexPtr->setColor(to);
-      toBoundary->addVertex(vertexPtr,false);
-      Element *elePtr = fromSubdomain->removeElement(eleTag);
-      if (elePtr == 0) // if ele not there we can just return IT SHOULD BE
-    return -4;
-      elementsArray[count] = elePtr;
-      count++;
-  }
-  else  // we cannot remove the element
-      numCannotRemove++;
-    }
-    numEleToSwap -= numCannotRemove;
-
-    //  2. remove all nodes connected to the elements divide color by prime    
-    //     for each element and add back if still in subdomain
-    //  3. add back if still in subdomain
-    //  4. if node external remove from PartitionedDomains external nodes
-
-    // first determine which nodes to remove
-    int primeFrom = primes(from);
-    int primeTo = primes(to);
-    int numNodToSwap = 0;
-    ID nodesToRemove(0,128);
-    for (int j=0; j<numEleToSwap; j++) {
-  Element *elePtr = elementsArray[j];
-  const ID  &nodes = elePtr->getExternalNodes(); 
-  
-  int nodesSize = nodes.Size();
-
-  for (int k=0; k<nodesSize; k++) {
-      int nodeTag = nodes(k);
-      int loc = nodesToRemove.getLocation(nodeTag);
-      if (loc < 0) {
-    nodesToRemove[numNodToSwap] = nodeTag;
-    numNodToSwap++;
-      }
-      (*nodePlace)(nodeTag) /= primeFrom;    
-      (*nodePlace)(nodeTag) *= primeTo;        
+  // check that the object did the partitioning
+  if (partitionFlag == false) {
+    opserr << "DomainPartitioner::swapBoundary()";
+    opserr << " - not partitioned or DomainPartitioner did not partition\n";
+    return -1;
   }
-    }
-
-    // remove the nodes
-    Node **nodesArray = new Node *[numNodToSwap];  
-    for (int k=0; k<numNodToSwap; k++) {
-  int nodeTag = nodesToRemove(k); 
-  Node *nodePtr = fromSubdomain->removeNode(nodeTag);
-  nodesArray[k] = nodePtr;
-
-  // add the node back to from if still external
-  if ((*nodePlace)(nodeTag)%primeFrom == 0)
-      fromSubdomain->addExternalNode(nodePtr);
-
-  // if it was external remove from PartitionedDomains external nodes
-  int partition = (*nodePlace)(nodeTag);
-  for (int j=1; j<=numPartitions; j++) 
-      if (j != from) {
-    int prime = primes(j);
-    if (partition%prime == 0) {
-        myDomain->removeExternalNode(nodeTag);
-        j = numPartitions+1;
-    }
-      }
-    }
-
-    // 5. add new vertices to boundary vertices of from if connected to
-    //    vertex we just removed and of color of from and not already in boundary
-
-    VertexIter &verticesToSwap2 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap2()) != 0) {
-  const ID &vertexAdjacent = vertexPtr->getAdjacency();
-  int vertexAdjacentSize = vertexAdjacent.Size();
-
-	for (int a=0; a<vertexAdjacentSize; a++) {
-	    int otherEleVertexTag = vertexAdjacent(a);
-	    Vertex *other = fromBoundary->getVertexPtr(otherEleVertexTag);
-	    if (other == 0) {
-		other = theElementGraph->getVertexPtr(otherEleVertexTag);
-		if (other->getColor() == from)
-		    fromBoundary->addVertex(other,false);
-	    }
-	}	
-    }
-
-
-    // in the TO subdomain we:
-    //  1. remove all nodes connected to the element, may or may not be there
-    //     if there don't divide by primeTo. 
-    //  2. mark all connecting nodes of elements as belonging to To
-    //  3. add the nodes, checking if external or internal
-    //  3. add the element
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of boundary
-    //     of boundary of to vertices
-
-    //  1. remove all nodes connected to the element, may or may not be there
-    //      if there divide by primeTo, do this as may have been added as extnl
 
-    for (int l=0; l<numNodToSwap; l++) {    
-  int nodeTag = nodesArray[l]->getTag();
-  Node *nodePtr;
-  nodePtr = toSubdomain->removeNode(nodesToRemove(l));
-    }
-
-
-    for (int m=0; m<numNodToSwap; m++) {
-  Node *nodePtr = nodesArray[m];
-  int nodeTag = nodePtr->getTag();
-  
-  //  3. add the nodes, checking if external or internal  
-  int internal = 0;
-  for (int n=1; n<=numPartitions; n++) 
-      if (n != to) {
-    int prime = primes(n);
-    if ((*nodePlace)(nodeTag)%prime == 0) { // its external
-        internal = 1;
-        n = numPartitions+1;
-    }
-      }
-  
-  if (internal == 0)
-      toSubdomain->addNode(nodePtr);
-  else {
-      toSubdomain->addExternalNode(nodePtr);
-      myDomain->addNode(nodePtr);
+  if (from < 1 || from > numPartitions) {
+    opserr << "DomainPartitioner::swapBoundary - No from Subdomain: ";
+    opserr << from << " exists\n";
+    return -2;
   }
-    }
 
+  // the boundary changes as vertices are swapped, so first
+  // get the tags of the vertices on it
+  Graph *fromBoundary = theBoundaryElements[from-1];
+  ID swapVertices(0, fromBoundary->getNumVertex()+1);
+  int numSwap = 0;
 
-    delete [] nodesArray; // DELETE nodesArray here should not use nodePtrs
-                          // after here as node objects deleted if parallel    
-    
-    //  3. add the elements
-    for (int a=0; a<numEleToSwap; a++)
-  toSubdomain->addElement(elementsArray[a]);
-
-
-    //  4. change the vertex color to be to and add vertex to boundary
-    //     also see if we can reduce the size of to's boundary vertices
-
-    VertexIter &verticesToSwap3 = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap3()) != 0) {
-	const ID &vertexAdjacent = vertexPtr->getAdjacency();
-	int vertexAdjacentSize = vertexAdjacent.Size();
-	for (int n=0; n<vertexAdjacentSize; n++) {
-	    int otherEleVertexTag = vertexAdjacent(n);
-	    Vertex *other = toBoundary->removeVertex(otherEleVertexTag,false);
-	    if (other != 0) {
-		const ID &othersAdjacency = other->getAdjacency();
-		int otherSize = othersAdjacency.Size();
-		for (int b=0; b<otherSize; b++) {
-		    int anotherEleVertexTag = othersAdjacency(b);
-		    Vertex *otherOther 
-			= theElementGraph->getVertexPtr(anotherEleVertexTag);
-		    if (otherOther->getColor() != to) {
-			toBoundary->addVertex(other,false);
-			b=otherSize;
-		    }
-		}
-	    }
-	}
-    }
-
-    // now remove any SP_Constraints that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    SP_ConstraintIter &theSPs = myDomain->getSPs();
-    SP_Constraint *spPtr;
-    while ((spPtr = theSPs()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeSP_Constraint(spPtr->getTag());
-    toSubdomain->addSP_Constraint(spPtr);
-      }
-  }
-    }
-
-    
-    // now remove any SP_Constraints that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-    SP_ConstraintIter &theSPs2 = fromSubdomain->getSPs();
-    while ((spPtr = theSPs2()) != 0) {
-  int nodeTag = spPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeSP_Constraint(spPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) 
-    toSubdomain->addSP_Constraint(spPtr);
-      else
-    myDomain->addSP_Constraint(spPtr);
-  }  
-    }
+  VertexIter &swappableVertices = fromBoundary->getVertices();
+  Vertex *vertexPtr;
+  while ((vertexPtr = swappableVertices()) != 0) 
+    swapVertices[numSwap++] = vertexPtr->getTag();
 
-    // now remove any NodalLoads that may have been external to 
-    // PartitionedDomain and are now internal to toSubdomain
-    NodalLoadIter &theNodalLoads = myDomain->getNodalLoads();
-    NodalLoad *loadPtr;
-    while ((loadPtr = theNodalLoads()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) { // add to toSubdomain if inteernal
-    myDomain->removeNodalLoad(loadPtr->getTag());
-    toSubdomain->addNodalLoad(loadPtr);
-      }
+  for (int i=0; i<numSwap; i++) {
+    int res = this->swapVertex(from, to, swapVertices(i), adjacentVertexNotInOther);
+    if (res < 0)
+      return res;
   }
-    }
-
-
-    // now remove any NodalLoads that may have been internal to fromSubdomain
-    // and are now external to PartitionedDomain or internal to toSubdomain 
-
-    NodalLoadIter &theNodalLoads2 = myDomain->getNodalLoads();
-    while ((loadPtr = theNodalLoads2()) != 0) {
-  int nodeTag = loadPtr->getNodeTag();
-  int loc = nodesToRemove.getLocation(nodeTag);
-  if (loc >= 0) {
-      fromSubdomain->removeNodalLoad(loadPtr->getTag());
-      int internal = 0;
-      for (int j=1; j<=numPartitions; j++) 
-    if (j != to) {
-        int prime = primes(j);
-        if ((*nodePlace)(nodeTag)%prime == 0) {
-      internal = 1;
-      j = numPartitions+1;
-        }
-    }
-      if (internal == 0) 
-    toSubdomain->addNodalLoad(loadPtr);
-      else
-    myDomain->addNodalLoad(loadPtr);
-  }  
-    }
-
-
-    delete swapVertices;
-
-    timer.pause();
-    opserr << "DomainPartitioner::swapBoundary DONE" << timer.getReal() << endln;
 
-  ***************************************************************************/
-    return 0;
+  return 0;
 }
 
 
@@ -1466,29 +1140,27 @@ DomainPartitioner::releaseBoundary(int from,
     //    Graph &theEleGraph = myDomain->getElementGraph();    
     Graph *fromBoundary = theBoundaryElements[from-1];
 
-    // into a new graph place the vertices on the fromBoundary
+    // get the tags of the vertices on the fromBoundary
     // we cannot use fromBoundary as this would empty all the nodes
     // as fromBoundary changes in called methods
 
-    Graph *swapVertices = new Graph(fromBoundary->getNumVertex());
+    ID swapVertices(0, fromBoundary->getNumVertex()+1);
+    int numSwap = 0;
 
     VertexIter &swappableVertices = fromBoundary->getVertices();
     Vertex *vertexPtr;
 
     while ((vertexPtr = swappableVertices()) != 0) 
-      swapVertices->addVertex(vertexPtr,false);
+      swapVertices[numSwap++] = vertexPtr->getTag();
 
     // release all the vertices in the swapVertices
-    VertexIter &verticesToSwap = swapVertices->getVertices();
-    while ((vertexPtr = verticesToSwap()) != 0)
+    for (int i=0; i<numSwap; i++)
       releaseVertex(from,
-		    vertexPtr->getTag(),
+		    swapVertices(i),
 		    theWeightedPartitionGraph,
 		    mustReleaseToLighter,
 		    factorGreater,
 		    adjacentVertexNotInOther);
-    
-    delete swapVertices;    
 
     return 0;
 }
@@ -107,6 +107,9 @@ class DomainPartitioner
     
     bool usingMainDomain;
     int mainPartition;
+
+    ID pinnedElements;  // elements not moved when balancing, in order
+    int numSwapped;     // number of vertices swapped in current balance()
 };
 
 #endif
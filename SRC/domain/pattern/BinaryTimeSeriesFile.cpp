@@ -0,0 +1,368 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/pattern/BinaryTimeSeriesFile.cpp,v $
+
+// File: ~/domain/pattern/BinaryTimeSeriesFile.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// BinaryTimeSeriesFile.
+//
+// What: "@(#) BinaryTimeSeriesFile.cpp, revA"
+
+#include <BinaryTimeSeriesFile.h>
+#include <OPS_Globals.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <fstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char binaryTimeSeriesMagic[8] = {'O','P','S','B','T','S','1','\0'};
+static const int binaryTimeSeriesByteOrder = 0x01020304;
+
+// checks the header, returning the number of rows or -1 if not valid
+static long long
+readBinaryTimeSeriesHeader(const char *header, long long fileSize,
+			   int &valueSize, int &hasTime, int &numColumns, double &timeIncr)
+{
+  if (fileSize < BINARY_TIME_SERIES_HEADER_SIZE || 
+      memcmp(header, binaryTimeSeriesMagic, 8) != 0)
+    return -1;
+
+  int byteOrder;
+  long long numRows;
+  memcpy(&byteOrder, &header[8], sizeof(int));
+  memcpy(&valueSize, &header[12], sizeof(int));
+  memcpy(&hasTime, &header[16], sizeof(int));
+  memcpy(&numColumns, &header[20], sizeof(int));
+  memcpy(&numRows, &header[24], sizeof(long long));
+  memcpy(&timeIncr, &header[32], sizeof(double));
+
+  if (byteOrder != binaryTimeSeriesByteOrder) {
+    opserr << "WARNING BinaryTimeSeriesFile - file written with a different byte order\n";
+    return -1;
+  }
+
+  if ((valueSize != 8 && valueSize != 4) || numColumns < 1 || numRows < 0 ||
+      BINARY_TIME_SERIES_HEADER_SIZE + numRows*numColumns*valueSize > fileSize) {
+    opserr << "WARNING BinaryTimeSeriesFile - corrupt or truncated file\n";
+    return -1;
+  }
+
+  return numRows;
+}
+
+
+BinaryTimeSeriesFile::BinaryTimeSeriesFile()
+  :fileName(0), theMap(0), mapSize(0), data(0), valueSize(8), 
+   numColumns(0), numRows(0), numValues(0), next(0), 
+   timeColumn(false), timeIncr(0.0)
+{
+
+}
+
+BinaryTimeSeriesFile::~BinaryTimeSeriesFile()
+{
+  this->close();
+}
+
+int
+BinaryTimeSeriesFile::open(const char *name)
+{
+  this->close();
+
+  if (name == 0)
+    return -1;
+
+#ifdef _WIN32
+  HANDLE fileHandle = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, NULL, 
+				  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (fileHandle == INVALID_HANDLE_VALUE)
+    return -1;
+
+  LARGE_INTEGER theSize;
+  if (GetFileSizeEx(fileHandle, &theSize) == 0 || 
+      theSize.QuadPart < BINARY_TIME_SERIES_HEADER_SIZE) {
+    CloseHandle(fileHandle);
+    return -1;
+  }
+
+  HANDLE mapHandle = CreateFileMapping(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(fileHandle);
+  if (mapHandle == NULL)
+    return -1;
+
+  // the view keeps the mapping open
+  void *newMap = MapViewOfFile(mapHandle, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapHandle);
+  if (newMap == NULL)
+    return -1;
+
+  long long fileSize = theSize.QuadPart;
+#else
+  int fd = ::open(name, O_RDONLY);
+  if (fd < 0)
+    return -1;
+
+  struct stat theStat;
+  if (fstat(fd, &theStat) != 0 || theStat.st_size < BINARY_TIME_SERIES_HEADER_SIZE) {
+    ::close(fd);
+    return -1;
+  }
+
+  // the map remains valid after the file is closed
+  void *newMap = mmap(0, theStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (newMap == MAP_FAILED)
+    return -1;
+
+#ifdef MADV_SEQUENTIAL
+  madvise(newMap, theStat.st_size, MADV_SEQUENTIAL);
+#endif
+
+  long long fileSize = theStat.st_size;
+#endif
+
+  theMap = newMap;
+  mapSize = (size_t)fileSize;
+
+  int hasTime;
+  long long rows = readBinaryTimeSeriesHeader((const char *)theMap, fileSize, 
+					      valueSize, hasTime, numColumns, timeIncr);
+  if (rows < 0 || rows > 2147483647) {
+    this->close();
+    return -1;
+  }
+
+  numRows = (int)rows;
+  numValues = (size_t)rows*numColumns;
+  timeColumn = (hasTime != 0);
+  data = (const char *)theMap + BINARY_TIME_SERIES_HEADER_SIZE;
+  next = 0;
+
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  return 0;
+}
+
+void
+BinaryTimeSeriesFile::close(void)
+{
+  if (theMap != 0) {
+#ifdef _WIN32
+    UnmapViewOfFile(theMap);
+#else
+    munmap(theMap, mapSize);
+#endif
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+
+  fileName = 0;
+  theMap = 0;
+  mapSize = 0;
+  data = 0;
+  numColumns = 0;
+  numRows = 0;
+  numValues = 0;
+  next = 0;
+  timeColumn = false;
+  timeIncr = 0.0;
+}
+
+bool
+BinaryTimeSeriesFile::isBinaryTimeSeriesFile(const char *name)
+{
+  FILE *theFile = fopen(name, "rb");
+  if (theFile == 0)
+    return false;
+
+  char magic[8];
+  size_t numRead = fread(magic, 1, 8, theFile);
+  fclose(theFile);
+
+  return (numRead == 8 && memcmp(magic, binaryTimeSeriesMagic, 8) == 0);
+}
+
+const char *
+BinaryTimeSeriesFile::getFileName(void) const
+{
+  return fileName;
+}
+
+int
+BinaryTimeSeriesFile::getNumRows(void) const
+{
+  return numRows;
+}
+
+int
+BinaryTimeSeriesFile::getNumColumns(void) const
+{
+  return numColumns;
+}
+
+bool
+BinaryTimeSeriesFile::hasTime(void) const
+{
+  return timeColumn;
+}
+
+double
+BinaryTimeSeriesFile::getTimeIncr(void) const
+{
+  return timeIncr;
+}
+
+void
+BinaryTimeSeriesFile::rewind(void)
+{
+  next = 0;
+}
+
+int
+BinaryTimeSeriesFile::convertText(const char *inputFile, const char *outputFile,
+				  bool singlePrecision, bool hasTime, double dt)
+{
+  std::ifstream input(inputFile);
+  if (!input.is_open()) {
+    opserr << "WARNING BinaryTimeSeriesFile::convertText() - could not open file " << inputFile << endln;
+    return -1;
+  }
+
+  FILE *output = fopen(outputFile, "wb");
+  if (output == 0) {
+    opserr << "WARNING BinaryTimeSeriesFile::convertText() - could not open file " << outputFile << endln;
+    return -1;
+  }
+
+  // the header is written once the size is known
+  char header[BINARY_TIME_SERIES_HEADER_SIZE];
+  memset(header, 0, BINARY_TIME_SERIES_HEADER_SIZE);
+  fwrite(header, 1, BINARY_TIME_SERIES_HEADER_SIZE, output);
+
+  int valueSize = singlePrecision ? 4 : 8;
+  int numColumns = -1;
+  long long numValues = 0;
+  long long numRows = 0;
+  bool sameLength = true;
+
+  std::string inputLine;
+  std::vector<double> doubles;
+  std::vector<float> floats;
+  while (std::getline(input, inputLine)) {
+    const char *c = inputLine.c_str();
+    char *cNext;
+
+    doubles.clear();
+    floats.clear();
+    while (true) {
+      double d = strtod(c, &cNext);
+      if (cNext == c)
+	break;
+      if (singlePrecision == true)
+	floats.push_back((float)d);
+      else
+	doubles.push_back(d);
+      c = cNext;
+
+      // skip separators other than white space
+      while (*c == ',' || *c == ';')
+	c++;
+    }
+
+    int numInLine = singlePrecision ? floats.size() : doubles.size();
+    if (numInLine == 0)
+      continue;
+
+    if (numColumns < 0)
+      numColumns = numInLine;
+    else if (numInLine != numColumns)
+      sameLength = false;
+
+    size_t numWritten;
+    if (singlePrecision == true)
+      numWritten = fwrite(&floats[0], sizeof(float), numInLine, output);
+    else
+      numWritten = fwrite(&doubles[0], sizeof(double), numInLine, output);
+
+    if (numWritten != (size_t)numInLine) {
+      opserr << "WARNING BinaryTimeSeriesFile::convertText() - failed writing " << outputFile << endln;
+      fclose(output);
+      return -1;
+    }
+
+    numValues += numInLine;
+    numRows++;
+  }
+
+  if (numColumns < 0)
+    numColumns = 1;
+
+  if (sameLength == false) {
+    numColumns = 1;
+    numRows = numValues;
+  }
+
+  int byteOrder = binaryTimeSeriesByteOrder;
+  int timeFlag = (hasTime == true && sameLength == true && numColumns > 1) ? 1 : 0;
+  memcpy(header, binaryTimeSeriesMagic, 8);
+  memcpy(&header[8], &byteOrder, sizeof(int));
+  memcpy(&header[12], &valueSize, sizeof(int));
+  memcpy(&header[16], &timeFlag, sizeof(int));
+  memcpy(&header[20], &numColumns, sizeof(int));
+  memcpy(&header[24], &numRows, sizeof(long long));
+  memcpy(&header[32], &dt, sizeof(double));
+
+  int ok = fseek(output, 0, SEEK_SET);
+  if (ok == 0 && fwrite(header, 1, BINARY_TIME_SERIES_HEADER_SIZE, output) != BINARY_TIME_SERIES_HEADER_SIZE)
+    ok = -1;
+  if (fclose(output) != 0)
+    ok = -1;
+
+  if (ok != 0) {
+    opserr << "WARNING BinaryTimeSeriesFile::convertText() - failed writing " << outputFile << endln;
+    return -1;
+  }
+
+  if (hasTime == true && timeFlag == 0)
+    opserr << "WARNING BinaryTimeSeriesFile::convertText() - rows of " << inputFile << " differ in length, time column ignored\n";
+
+  return 0;
+}
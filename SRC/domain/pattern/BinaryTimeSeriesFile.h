@@ -0,0 +1,109 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/pattern/BinaryTimeSeriesFile.h,v $
+
+// File: ~/domain/pattern/BinaryTimeSeriesFile.h
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// BinaryTimeSeriesFile. A BinaryTimeSeriesFile provides read access to
+// a binary file of time series data without reading it into memory:
+// the file is memory mapped and values are read from the map as they
+// are needed. The file is a 64 byte header followed by the values of
+// numRows rows of numColumns values, row after row, stored as float64 
+// or float32 in the byte order of the machine that wrote it:
+//
+//   bytes  0- 7  "OPSBTS1" and a 0
+//   bytes  8-11  int, 0x01020304 to detect the byte order
+//   bytes 12-15  int, size of a value: 8 or 4
+//   bytes 16-19  int, 1 if the first column is time, 0 otherwise
+//   bytes 20-23  int, number of columns
+//   bytes 24-31  long long, number of rows
+//   bytes 32-39  double, time increment, 0.0 if not given
+//   bytes 40-63  unused
+//
+// What: "@(#) BinaryTimeSeriesFile.h, revA"
+
+#ifndef BinaryTimeSeriesFile_h
+#define BinaryTimeSeriesFile_h
+
+#include <stddef.h>
+
+#define BINARY_TIME_SERIES_HEADER_SIZE 64
+
+class BinaryTimeSeriesFile
+{
+  public:
+    BinaryTimeSeriesFile();
+    ~BinaryTimeSeriesFile();
+
+    // maps the file, returns < 0 if it is not a binary time series file
+    int open(const char *fileName);
+    void close(void);
+    static bool isBinaryTimeSeriesFile(const char *fileName);
+
+    const char *getFileName(void) const;
+    int getNumRows(void) const;
+    int getNumColumns(void) const;
+    bool hasTime(void) const;
+    double getTimeIncr(void) const;
+
+    // random access
+    inline double getValue(int row, int column) const
+      {size_t loc = (size_t)row*numColumns + column;
+       return (valueSize == 8) ? ((const double *)data)[loc] : ((const float *)data)[loc];}
+
+    // sequential access to all the values, row after row; at the end 
+    // of the file false is returned and value is left unchanged
+    inline bool getNext(double &value)
+      {if (next >= numValues) return false; 
+       value = (valueSize == 8) ? ((const double *)data)[next] : ((const float *)data)[next];
+       next++; return true;}
+    void rewind(void);
+
+    // converts a text file, a row to a line, into a binary time series 
+    // file; if the lines are not all of the same length the values are
+    // written as a single column
+    static int convertText(const char *inputFile, const char *outputFile, 
+			   bool singlePrecision = false, bool hasTime = false,
+			   double timeIncr = 0.0);
+    
+  protected:
+    
+  private:
+    char *fileName;
+    void *theMap;           // the mapped file
+    size_t mapSize;
+    const char *data;       // the first value in the map
+    int valueSize;          // 8 or 4
+    int numColumns;
+    int numRows;
+    size_t numValues;
+    size_t next;            // the next value for getNext()
+    bool timeColumn;
+    double timeIncr;
+};
+
+#endif
@@ -884,7 +884,9 @@ LoadPattern::getCopy(void)
   theCopy->loadFactor = loadFactor;
   theCopy->scaleFactor = scaleFactor;
   theCopy->isConstant = isConstant;
-  theCopy->theSeries = theSeries;
+  // the copy deletes its series, so it cannot share this one
+  if (theSeries != 0)
+    theCopy->theSeries = theSeries->getCopy();
   return theCopy;
 }
 
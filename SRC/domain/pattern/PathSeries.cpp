@@ -35,6 +35,7 @@
 
 
 #include <PathSeries.h>
+#include <BinaryTimeSeriesFile.h>
 #include <Vector.h>
 #include <Channel.h>
 #include <math.h>
@@ -47,7 +48,7 @@ using std::ios;
 
 PathSeries::PathSeries()	
   :TimeSeries(TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1)
+   thePath(0), thePathFile(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1)
 {
   // does nothing
 }
@@ -58,7 +59,7 @@ PathSeries::PathSeries(int tag,
 		       double theFactor,
 		       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1), useLast(last)
+   thePath(0), thePathFile(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1), useLast(last)
 {
   // create a copy of the vector containg path points
   thePath = new Vector(theLoadPath);
@@ -80,8 +81,20 @@ PathSeries::PathSeries(int tag,
 		       double theFactor,
 		       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1), useLast(last)
+   thePath(0), thePathFile(0), pathTimeIncr(theTimeIncr), cFactor(theFactor), otherDbTag(0), lastSendCommitTag(-1), useLast(last)
 {
+  // a binary file is mapped, the values are not read until needed
+  if (BinaryTimeSeriesFile::isBinaryTimeSeriesFile(fileName) == true) {
+    thePathFile = new BinaryTimeSeriesFile();
+    if (thePathFile->open(fileName) < 0 || thePathFile->getNumRows() == 0) {
+      opserr << "WARNING - PathSeries::PathSeries()";
+      opserr << " - could not map binary file " << fileName << endln;
+      delete thePathFile;
+      thePathFile = 0;
+    }
+    return;
+  }
+
   // determine the number of data points .. open file and count num entries
   int numDataPoints =0;
   double dataPoint;
@@ -142,18 +155,54 @@ PathSeries::~PathSeries()
 {
   if (thePath != 0)
     delete thePath;
+  if (thePathFile != 0)
+    delete thePathFile;
 }
 
 TimeSeries *
 PathSeries::getCopy(void) {
-  return new PathSeries(this->getTag(), *thePath, pathTimeIncr, cFactor);
+  // the copy maps the same file
+  if (thePathFile != 0)
+    return new PathSeries(this->getTag(), thePathFile->getFileName(), pathTimeIncr, cFactor, useLast);
+
+  return new PathSeries(this->getTag(), *thePath, pathTimeIncr, cFactor, useLast);
+}
+
+int
+PathSeries::getNumPathPoints(void)
+{
+  if (thePath != 0)
+    return thePath->Size();
+
+  if (thePathFile != 0) {
+    // if the file has a time column the values are in the second
+    if (thePathFile->hasTime() == true)
+      return thePathFile->getNumRows();
+    else
+      return thePathFile->getNumRows()*thePathFile->getNumColumns();
+  }
+
+  return 0;
+}
+
+double
+PathSeries::getPathPoint(int i)
+{
+  if (thePath != 0)
+    return (*thePath)[i];
+
+  if (thePathFile->hasTime() == true)
+    return thePathFile->getValue(i, 1);
+
+  int numColumns = thePathFile->getNumColumns();
+  return thePathFile->getValue(i/numColumns, i%numColumns);
 }
 
 double
 PathSeries::getFactor(double pseudoTime)
 {
   // check for a quick return
-  if (pseudoTime < 0.0 || thePath == 0)
+  if (pseudoTime < 0.0 || (thePath == 0 && thePathFile == 0))
     return 0.0;
 
   // determine indexes into the data array whose boundary holds the time
@@ -161,14 +210,15 @@ PathSeries::getFactor(double pseudoTime)
   int incr1 = floor(incr);
   int incr2 = incr1+1;
 
-  if (incr2 >= thePath->Size()) {
+  int numPoints = this->getNumPathPoints();
+  if (incr2 >= numPoints) {
     if (useLast == false)
       return 0.0;
     else
-      return (*thePath)[thePath->Size()];
+      return cFactor*this->getPathPoint(numPoints-1);
   } else {
-    double value1 = (*thePath)[incr1];
-    double value2 = (*thePath)[incr2];
+    double value1 = this->getPathPoint(incr1);
+    double value2 = this->getPathPoint(incr2);
     return cFactor*(value1 + (value2-value1)*(pseudoTime/pathTimeIncr - incr1));
   }
 }
@@ -177,30 +227,30 @@ PathSeries::getFactor(double pseudoTime)
 double
 PathSeries::getDuration()
 {
-  if (thePath == 0)
+  if (thePath == 0 && thePathFile == 0)
   {
     opserr << "WARNING -- PathSeries::getDuration() on empty Vector" << endln;
 	return 0.0;
   }
-  return (thePath->Size() * pathTimeIncr);
+  return (this->getNumPathPoints() * pathTimeIncr);
 }
 
 double
 PathSeries::getPeakFactor()
 {
-  if (thePath == 0)
+  if (thePath == 0 && thePathFile == 0)
   {
     opserr << "WARNING -- PathSeries::getPeakFactor() on empty Vector" << endln;
 	return 0.0;
   }
 
-  double peak = fabs((*thePath)[0]);
-  int num = thePath->Size();
+  double peak = fabs(this->getPathPoint(0));
+  int num = this->getNumPathPoints();
   double temp;
 
   for (int i = 1; i < num; i++)
   {
-	temp = fabs((*thePath)[i]);
+	temp = fabs(this->getPathPoint(i));
 	if (temp > peak)
 	  peak = temp;
   }
@@ -218,8 +268,8 @@ PathSeries::sendSelf(int commitTag, Channel &theChannel)
   data(1) = pathTimeIncr;
   data(2) = -1;
   
-  if (thePath != 0) {
-    int size = thePath->Size();
+  if (thePath != 0 || thePathFile != 0) {
+    int size = this->getNumPathPoints();
     data(2) = size;
     if (otherDbTag == 0)
       otherDbTag = theChannel.getDbTag();
@@ -247,7 +297,19 @@ PathSeries::sendSelf(int commitTag, Channel &theChannel)
   // or the channel is for sending the data to a remote process
 
   if ((lastSendCommitTag == commitTag) || (theChannel.isDatastore() == 0)) {
-    if (thePath != 0) {
+    if (thePathFile != 0) {
+      // the receiving process may not see the file, the values are sent
+      int size = this->getNumPathPoints();
+      Vector values(size);
+      for (int i = 0; i < size; i++)
+	values(i) = this->getPathPoint(i);
+      result = theChannel.sendVector(otherDbTag, commitTag, values);
+      if (result < 0) {
+	opserr << "PathSeries::sendSelf() - ";
+	opserr << "channel failed to send tha Path Vector\n";
+	return result;  
+      }
+    } else if (thePath != 0) {
       result = theChannel.sendVector(otherDbTag, commitTag, *thePath);
       if (result < 0) {
 	opserr << "PathSeries::sendSelf() - ";
@@ -319,4 +381,10 @@ PathSeries::Print(OPS_Stream &s, int flag)
     if (flag == 1 && thePath != 0)
       //s << " specified path: " << *thePath;
 	  s << *thePath;
+    else if (flag == 1 && thePathFile != 0) {
+      int num = this->getNumPathPoints();
+      for (int i = 0; i < num; i++)
+	s << this->getPathPoint(i) << " ";
+      s << endln;
+    }
 }
@@ -35,12 +35,15 @@
 // load factor using user specified control points provided in a vector object.
 // the points in the vector are given at regular time increments pathTimeIncr
 // apart. (could be provided in another vector if different)
+// If the file is a BinaryTimeSeriesFile the points are not read into 
+// memory, they are read from the memory mapped file when needed.
 //
 // What: "@(#) PathSeries.h, revA"
 
 #include <TimeSeries.h>
 
 class Vector;
+class BinaryTimeSeriesFile;
 
 class PathSeries : public TimeSeries
 {
@@ -79,7 +82,11 @@ class PathSeries : public TimeSeries
   protected:
     
   private:
+    int getNumPathPoints(void);
+    double getPathPoint(int i);
+
     Vector *thePath;      // vector containg the data points
+    BinaryTimeSeriesFile *thePathFile; // or the mapped file containg them
     double pathTimeIncr;  // specifies the time increment used in load path vector
     double cFactor;       // additional factor on the returned load factor
     int otherDbTag;       // a database tag needed for the vector object
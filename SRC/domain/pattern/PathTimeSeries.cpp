@@ -36,6 +36,7 @@
 
 
 #include <PathTimeSeries.h>
+#include <BinaryTimeSeriesFile.h>
 #include <Vector.h>
 #include <Channel.h>
 #include <math.h>
@@ -48,7 +49,7 @@ using std::ios;
 
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
-   thePath(0), time(0), currentTimeLoc(0), 
+   thePath(0), time(0), thePathFile(0), currentTimeLoc(0), 
    cFactor(0.0), dbTag1(0), dbTag2(0), lastSendCommitTag(-1)
 {
   // does nothing
@@ -60,7 +61,7 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       const Vector &theTimePath, 
 			       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
-   thePath(0), time(0), currentTimeLoc(0), 
+   thePath(0), time(0), thePathFile(0), currentTimeLoc(0), 
    cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0)
 {
   // check vectors are of same size
@@ -95,7 +96,7 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       double theFactor)
 			       
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
-   thePath(0), time(0), currentTimeLoc(0), 
+   thePath(0), time(0), thePathFile(0), currentTimeLoc(0), 
    cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0)
 {
 
@@ -203,10 +204,26 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       const char *fileName, 
 			       double theFactor)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
-   thePath(0), time(0), currentTimeLoc(0), 
-   cFactor(theFactor), dbTag1(0), dbTag2(0), lastChannel(0)
+   thePath(0), time(0), thePathFile(0), currentTimeLoc(0), 
+   cFactor(theFactor), dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0)
 {
-
+  // a binary file is mapped, time in the first column and the values in 
+  // the second or, for a single column, time value pairs one after another
+  if (BinaryTimeSeriesFile::isBinaryTimeSeriesFile(fileName) == true) {
+    thePathFile = new BinaryTimeSeriesFile();
+    if (thePathFile->open(fileName) < 0) {
+      opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
+      opserr << " - could not map binary file " << fileName << endln;
+      delete thePathFile;
+      thePathFile = 0;
+    } else if (this->getNumPoints() == 0) {
+      opserr << "WARNING - PathTimeSeries::PathTimeSeries()";
+      opserr << " - no time value pairs in binary file " << fileName << endln;
+      delete thePathFile;
+      thePathFile = 0;
+    }
+    return;
+  }
 
   // determine the number of data points
   int numDataPoints = 0;
@@ -288,14 +305,60 @@ PathTimeSeries::~PathTimeSeries()
     delete thePath;
   if (time != 0)
     delete time;
+  if (thePathFile != 0)
+    delete thePathFile;
 }
 
 TimeSeries *
 PathTimeSeries::getCopy(void) 
 {
+  // the copy maps the same file
+  if (thePathFile != 0)
+    return new PathTimeSeries(this->getTag(), thePathFile->getFileName(), cFactor);
+
   return new PathTimeSeries(this->getTag(), *thePath, *time, cFactor);
 }
 
+int
+PathTimeSeries::getNumPoints(void)
+{
+  if (thePath != 0)
+    return thePath->Size();
+
+  if (thePathFile != 0) {
+    if (thePathFile->getNumColumns() == 1)
+      return thePathFile->getNumRows()/2;
+    else
+      return thePathFile->getNumRows();
+  }
+
+  return 0;
+}
+
+double
+PathTimeSeries::getTimePoint(int i)
+{
+  if (time != 0)
+    return (*time)(i);
+
+  if (thePathFile->getNumColumns() == 1)
+    return thePathFile->getValue(2*i, 0);
+  else
+    return thePathFile->getValue(i, 0);
+}
+
+double
+PathTimeSeries::getPathPoint(int i)
+{
+  if (thePath != 0)
+    return (*thePath)(i);
+
+  if (thePathFile->getNumColumns() == 1)
+    return thePathFile->getValue(2*i+1, 0);
+  else
+    return thePathFile->getValue(i, 1);
+}
+
 
 double
 PathTimeSeries::getTimeIncr (double pseudoTime)
@@ -308,17 +371,17 @@ double
 PathTimeSeries::getFactor(double pseudoTime)
 {
   // check for a quick return
-  if (thePath == 0)
+  if (thePath == 0 && thePathFile == 0)
     return 0.0;
 
   // determine indexes into the data array whose boundary holds the time
-  double time1 = (*time)(currentTimeLoc);
+  double time1 = this->getTimePoint(currentTimeLoc);
 
   // check for another quick return
   if (pseudoTime == time1)
-    return cFactor * (*thePath)[currentTimeLoc];
+    return cFactor * this->getPathPoint(currentTimeLoc);
 
-  int size = time->Size();
+  int size = this->getNumPoints();
   int sizem1 = size - 1;
   int sizem2 = size - 2;
   
@@ -330,12 +393,12 @@ PathTimeSeries::getFactor(double pseudoTime)
     return 0.0;
 
   // otherwise go find the current interval
-  double time2 = (*time)(currentTimeLoc+1);
+  double time2 = this->getTimePoint(currentTimeLoc+1);
   if (pseudoTime > time2) {
     while ((pseudoTime > time2) && (currentTimeLoc < sizem2)) {
       currentTimeLoc++;
       time1 = time2;
-      time2 = (*time)(currentTimeLoc+1);
+      time2 = this->getTimePoint(currentTimeLoc+1);
     }
     // if pseudo time greater than ending time reurn 0
     if (pseudoTime > time2)
@@ -345,47 +408,47 @@ PathTimeSeries::getFactor(double pseudoTime)
     while ((pseudoTime < time1) && (currentTimeLoc > 0)) {
       currentTimeLoc--;
       time2 = time1;	
-      time1 = (*time)(currentTimeLoc);
+      time1 = this->getTimePoint(currentTimeLoc);
     }
     // if starting time less than initial starting time return 0
     if (pseudoTime < time1)
       return 0.0;
   }
 
-  double value1 = (*thePath)[currentTimeLoc];
-  double value2 = (*thePath)[currentTimeLoc+1];
+  double value1 = this->getPathPoint(currentTimeLoc);
+  double value2 = this->getPathPoint(currentTimeLoc+1);
   return cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
 }
 
 double
 PathTimeSeries::getDuration()
 {
-  if (thePath == 0)
+  if (thePath == 0 && thePathFile == 0)
   {
     opserr << "WARNING -- PathTimeSeries::getDuration() on empty Vector" << endln;
 	return 0.0;
   }
 
-  int lastIndex = time->Size(); // index to last entry in time vector
-  return ((*time)[lastIndex-1]);
+  int lastIndex = this->getNumPoints(); // index to last entry in time vector
+  return this->getTimePoint(lastIndex-1);
 }
 
 double
 PathTimeSeries::getPeakFactor()
 {
-  if (thePath == 0)
+  if (thePath == 0 && thePathFile == 0)
   {
     opserr << "WARNING -- PathTimeSeries::getPeakFactor() on empty Vector" << endln;
 	return 0.0;
   }
 
-  double peak = fabs((*thePath)[0]);
-  int num = thePath->Size();
+  double peak = fabs(this->getPathPoint(0));
+  int num = this->getNumPoints();
   double temp;
 
   for (int i = 1; i < num; i++)
   {
-	temp = fabs((*thePath)[i]);
+	temp = fabs(this->getPathPoint(i));
 	if (temp > peak)
 	  peak = temp;
   }
@@ -401,8 +464,8 @@ PathTimeSeries::sendSelf(int commitTag, Channel &theChannel)
   data(0) = cFactor;
   data(1) = -1;
   
-  if (thePath != 0) {
-    int size = thePath->Size();
+  if (thePath != 0 || thePathFile != 0) {
+    int size = this->getNumPoints();
     data(1) = size;
     if (dbTag1 == 0) {
       dbTag1 = theChannel.getDbTag();
@@ -431,6 +494,26 @@ PathTimeSeries::sendSelf(int commitTag, Channel &theChannel)
 
     lastChannel = &theChannel;
 
+    if (thePathFile != 0) {
+      // the receiving process may not see the file, the values are sent
+      int size = this->getNumPoints();
+      Vector values(size);
+      Vector times(size);
+      for (int i = 0; i < size; i++) {
+	values(i) = this->getPathPoint(i);
+	times(i) = this->getTimePoint(i);
+      }
+      result = theChannel.sendVector(dbTag1, commitTag, values);
+      if (result == 0)
+	result = theChannel.sendVector(dbTag2, commitTag, times);
+      if (result < 0) {
+	opserr << "PathTimeSeries::sendSelf() - ";
+	opserr << "channel failed to send tha Path Vector\n";
+	return result;  
+      }
+      return 0;
+    }
+
     if (thePath != 0) {
       result = theChannel.sendVector(dbTag1, commitTag, *thePath);
       if (result < 0) {
@@ -513,5 +596,7 @@ PathTimeSeries::Print(OPS_Stream &s, int flag)
     if (flag == 1 && thePath != 0) {
       s << " specified path: " << *thePath;
       s << " specified time: " << *time;
+    } else if (flag == 1 && thePathFile != 0) {
+      s << " specified path: " << thePathFile->getFileName();
     }
 }
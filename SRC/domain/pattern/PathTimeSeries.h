@@ -34,13 +34,15 @@
 // PathTimeSeries is a TimeSeries class which linear interpolates the
 // load factor using user specified control points provided in a vector object.
 // the points in the vector are given at time points specified in another vector.
-// object. 
+// object. If the single file given is a BinaryTimeSeriesFile the time and 
+// data points are read from the memory mapped file when needed.
 //
 // What: "@(#) PathTimeSeries.h, revA"
 
 #include <TimeSeries.h>
 
 class Vector;
+class BinaryTimeSeriesFile;
 
 class PathTimeSeries : public TimeSeries
 {
@@ -83,8 +85,13 @@ class PathTimeSeries : public TimeSeries
   protected:
     
   private:
+    int getNumPoints(void);
+    double getTimePoint(int i);
+    double getPathPoint(int i);
+
     Vector *thePath;      // vector containg the data points
     Vector *time;		  // vector containg the time values of data points
+    BinaryTimeSeriesFile *thePathFile; // or the mapped file containg both
     int currentTimeLoc;   // current location in time
     double cFactor;       // additional factor on the returned load factor
     int dbTag1, dbTag2;   // additional database tags needed for vector objects
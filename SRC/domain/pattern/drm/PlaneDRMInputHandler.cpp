@@ -112,14 +112,20 @@ PlaneDRMInputHandler::PlaneDRMInputHandler(int tag, char** in_files, int files,
     exit(-1);
   }
 	
-  // Open File streams
+  // Open File streams, or map the files given in binary
   
-  this->ifile1.open(filePtrs[0]);
-  this->ifile2.open(filePtrs[1]);
-  this->ifile3.open(filePtrs[2]);
-  this->ifile4.open(filePtrs[3]);
-  this->ifile5a.open(filePtrs[4]);
-  this->ifile5b.open(filePtrs[5]);
+  std::ifstream *ifiles[6] = {&ifile1, &ifile2, &ifile3, &ifile4, &ifile5a, &ifile5b};
+  for (int i=0; i<6; i++) {
+    mappedFiles[i] = 0;
+    if (BinaryTimeSeriesFile::isBinaryTimeSeriesFile(filePtrs[i]) == true) {
+      mappedFiles[i] = new BinaryTimeSeriesFile();
+      if (mappedFiles[i]->open(filePtrs[i]) < 0) {
+	opserr << " Bad binary file " << filePtrs[i] << endln;
+	exit(-1);
+      }
+    } else
+      ifiles[i]->open(filePtrs[i]);
+  }
 
   if (ifile1.bad() ) {
     opserr << " Bad file 1 " << endln;
@@ -184,6 +190,10 @@ PlaneDRMInputHandler::~PlaneDRMInputHandler()
   delete [] buffers;
   delete [] which;
   delete myDecorator;
+
+  for (int i=0; i<6; i++)
+    if (mappedFiles[i] != 0)
+      delete mappedFiles[i];
 }
 
 
@@ -201,7 +211,7 @@ void PlaneDRMInputHandler::populateBuffers()
       f1buffer[i] = 0.0;
     }
     for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile1 >> dataIn;
+      this->readValue(0, ifile1, dataIn);
       f1buffer[i] = dataIn;
     }
     temp = this->fileData[3];
@@ -209,7 +219,7 @@ void PlaneDRMInputHandler::populateBuffers()
       f2buffer[i] = 0.0;
     }
     for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile2 >> dataIn;
+      this->readValue(1, ifile2, dataIn);
       f2buffer[i] = dataIn;
     }
     temp = this->fileData[6];
@@ -217,7 +227,7 @@ void PlaneDRMInputHandler::populateBuffers()
       f3buffer[i] = 0.0;
     }
     for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile3 >> dataIn;
+      this->readValue(2, ifile3, dataIn);
       f3buffer[i] = dataIn;
     }
     temp = this->fileData[9];
@@ -225,7 +235,7 @@ void PlaneDRMInputHandler::populateBuffers()
       f4buffer[i] = 0.0;
     }
     for (int i=3*temp; i<3*(cacheValue + 4)*temp; i++) {
-      ifile4 >> dataIn;
+      this->readValue(3, ifile4, dataIn);
       f4buffer[i] = dataIn;
     }
     temp = this->fileData[12];
@@ -235,11 +245,11 @@ void PlaneDRMInputHandler::populateBuffers()
     int index = 3*temp;
     for (int k=1; k<(cacheValue +4); k++) {
       for (int i=0; i<3*nd1; i++) {
-	ifile5a >> dataIn;
+	this->readValue(4, ifile5a, dataIn);
 	f5buffer[index++] = dataIn;
       }
       for (int i=0; i<3*nd2; i++) {
-	ifile5b >> dataIn;
+	this->readValue(5, ifile5b, dataIn);
 	f5buffer[index++] = dataIn;
       }
     } 
@@ -271,7 +281,7 @@ void PlaneDRMInputHandler::populateBuffers()
     }
     double dataIn=0.0;
     for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile1 >> dataIn;
+      this->readValue(0, ifile1, dataIn);
       f1buffer[i] = dataIn;
     }
     temp = this->fileData[3];
@@ -282,7 +292,7 @@ void PlaneDRMInputHandler::populateBuffers()
     }
     dataIn=0.0;
     for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile2 >> dataIn;
+      this->readValue(1, ifile2, dataIn);
       f2buffer[i] = dataIn;
     }
     temp = this->fileData[6];
@@ -293,7 +303,7 @@ void PlaneDRMInputHandler::populateBuffers()
     }
     dataIn=0.0;
     for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile3 >> dataIn;
+      this->readValue(2, ifile3, dataIn);
       f3buffer[i] = dataIn;
     }
     temp = this->fileData[9];
@@ -304,7 +314,7 @@ void PlaneDRMInputHandler::populateBuffers()
     }
     dataIn=0.0;
     for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile4 >> dataIn;
+      this->readValue(3, ifile4, dataIn);
       f4buffer[i] = dataIn;
     }
     temp = this->fileData[12];
@@ -319,11 +329,11 @@ void PlaneDRMInputHandler::populateBuffers()
     //for (int i=6*temp; i<3*(rem + 3)*temp; i++) {
     for (int k=3; k<(cacheValue +4); k++) {
       for (int i=0; i<3*nd1; i++) {
-	ifile5a >> dataIn;
+	this->readValue(4, ifile5a, dataIn);
 	f5buffer[index++] = dataIn;
       }
       for (int i=0; i<3*nd2; i++) {
-	ifile5b >> dataIn;
+	this->readValue(5, ifile5b, dataIn);
 	f5buffer[index++] = dataIn;
       }
     }
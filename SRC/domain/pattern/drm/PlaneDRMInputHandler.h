@@ -19,6 +19,7 @@
 #include "DRMInputHandler.h"
 #include "GeometricBrickDecorator.h"
 #include "Mesh3DSubdomain.h"
+#include <BinaryTimeSeriesFile.h>
 #include <math.h>
 
 class PlaneDRMInputHandler : public DRMInputHandler {
@@ -76,6 +77,12 @@ class PlaneDRMInputHandler : public DRMInputHandler {
   std::ifstream ifile4;
   std::ifstream ifile5a;
   std::ifstream ifile5b;
+
+  // files given in the binary time series format are memory mapped
+  // and read in place of the matching ifstream
+  BinaryTimeSeriesFile *mappedFiles[6];
+  inline void readValue(int file, std::ifstream &ifile, double &dataIn)
+    {if (mappedFiles[file] != 0) mappedFiles[file]->getNext(dataIn); else ifile >> dataIn;}
   
 
   static Vector Vtm2;
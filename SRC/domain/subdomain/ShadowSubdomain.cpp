@@ -964,6 +964,7 @@ ShadowSubdomain::update(void)
   if (theDDA != 0 && theDDA->doesIndependentAnalysis() != true) {
     msgData(0) =  ShadowActorSubdomain_update;
     this->sendID(msgData);
+    this->flush();
   }
   return 0;
 }
@@ -979,6 +980,7 @@ ShadowSubdomain::update(double newTime, double dT)
     data(0) = newTime;
     data(1) = dT;
     this->sendVector(data);
+    this->flush();
   }
 
   return 0;
@@ -999,6 +1001,7 @@ ShadowSubdomain::barrierCheckOUT(int result)
   static ID data(1);
   data(0) = result;
   this->sendID(data);
+  this->flush();
 
   return 0;
 }
@@ -1049,6 +1052,7 @@ ShadowSubdomain::commit(void)
   if (theDDA != 0 && theDDA->doesIndependentAnalysis() != true) {
     msgData(0) = ShadowActorSubdomain_commit;
     this->sendID(msgData);
+    this->flush();
     return 0;
   }
   return 0;
@@ -1061,6 +1065,7 @@ ShadowSubdomain::record(bool fromAnalysis)
   if (theDDA != 0 && (fromAnalysis == false || theDDA->doesIndependentAnalysis() != true)) {
     msgData(0) = ShadowActorSubdomain_record;
     this->sendID(msgData);
+    this->flush();
     return 0;
   }
   return 0;
@@ -1073,6 +1078,7 @@ ShadowSubdomain::revertToLastCommit(void)
   if (theDDA != 0 && theDDA->doesIndependentAnalysis() != true) {
     msgData(0) = ShadowActorSubdomain_revertToLastCommit;
     this->sendID(msgData);
+    this->flush();
     return 0;
   }
   return 0;
@@ -1302,6 +1308,7 @@ ShadowSubdomain::computeTang(void)
       msgData(0) = ShadowActorSubdomain_computeTang;
       msgData(1) = this->getTag();
       this->sendID(msgData);
+      this->flush();
 
       for (int i = 0; i < numShadowSubdomains; i++) {
 	ShadowSubdomain *theShadow = theShadowSubdomains[i];
@@ -1313,6 +1320,7 @@ ShadowSubdomain::computeTang(void)
       msgData(0) = ShadowActorSubdomain_computeTang;
       msgData(1) = this->getTag();
       this->sendID(msgData);
+      this->flush();
     }
     else if (count == 2*numShadowSubdomains - 1)
       count = 0;
@@ -1328,6 +1336,7 @@ ShadowSubdomain::computeResidual(void)
     if (count == 1) {
       msgData(0) = ShadowActorSubdomain_computeResidual;
       this->sendID(msgData);
+      this->flush();
 
       for (int i = 0; i < numShadowSubdomains; i++) {
 	ShadowSubdomain *theShadow = theShadowSubdomains[i];
@@ -1338,6 +1347,7 @@ ShadowSubdomain::computeResidual(void)
     else if (count <= numShadowSubdomains) {
       msgData(0) = ShadowActorSubdomain_computeResidual;
       this->sendID(msgData);
+      this->flush();
     }
     else if (count == 2*numShadowSubdomains - 1)
       count = 0;
@@ -1381,6 +1391,7 @@ ShadowSubdomain::computeNodalResponse(void)
       this->sendID(msgData);
       Vector theChange(lastChange);
       this->sendVector(theChange);
+      this->flush();
     }
   }
   
@@ -1398,6 +1409,7 @@ ShadowSubdomain::analysisStep(double dT)
     timeStep(0) = dT;
 
     this->sendVector(timeStep);
+    this->flush();
 
     return 0;
 }
@@ -1417,6 +1429,7 @@ ShadowSubdomain::eigenAnalysis(int numMode, bool generalized, bool findSmallest)
       msgData(3) = 1;
 
     this->sendID(msgData);
+    this->flush();
     return 0;
 }
 
@@ -1651,6 +1664,7 @@ ShadowSubdomain::calculateNodalReactions(bool incInertia)
   else
     msgData(1) = 1;
   this->sendID(msgData);
+  this->flush();
   return 0;
 }
   
@@ -34,6 +34,7 @@
 #include <FEM_ObjectBroker.h>
 #include <TCP_Socket.h>
 // #include <TCP_SocketNoDelay.h>
+#include <TCP_SocketBuffered.h>
 #include <UDP_Socket.h>
 #include <SocketAddress.h>
 #include <Message.h>
@@ -63,6 +64,11 @@ int main(int argv, char **argc)
     // int port = atoi(argc[3]);	    
     // theChannel = new TCP_SocketNoDelay(port,machine);
     // }   
+    else if (channelType == 4) {
+	char *machine = argc[2];    	
+	int port = atoi(argc[3]);	
+	theChannel = new TCP_SocketBuffered(port,machine);
+    }
     else {
 	opserr << "ACTOR PROCESS: ShadowSubdomainActor Exiting ";	
 	opserr << "- invalid channel type " << channelType << endln;
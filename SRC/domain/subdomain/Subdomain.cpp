@@ -866,11 +866,19 @@ Subdomain::recvSelf(int cTag, Channel &theChannel,
     return -1;
 }
 
+// the cost is the time measured in the elements since the element
+// costs were last zeroed, see DomainPartitioner::balance(), plus any
+// time recorded by the subdomain itself since the last call.
 double    
 Subdomain::getCost(void) 
 {
     double lastRealCost = realCost;
 
+    ElementIter &theElements = this->Domain::getElements();
+    Element *elePtr;
+    while ((elePtr = theElements()) != 0)
+      lastRealCost += elePtr->getMeasuredCost();
+
     realCost = 0.0;
     cpuCost = 0.0;
     pageCost = 0;
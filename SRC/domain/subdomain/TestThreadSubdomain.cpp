@@ -0,0 +1,269 @@
+// Description: checks the ThreadSubdomain against the serial Domain. A
+// cantilever of displacement based fiber beams is pushed into the inelastic
+// range twice, once in a Domain and once in a PartitionedDomain split with
+// Metis into ThreadSubdomains that are condensed by two threads. The
+// displacements must agree at every step. The partitioned analysis is then
+// repeated with a MeasuredCostBalancer, a large cost being added to the
+// elements of the first subdomain before each step so that elements are
+// migrated at the commits; the displacements must still agree, and the
+// numbers of elements, nodes and constraints must be unchanged.
+//
+// usage: testThreadSubdomain, exits with the number of failed checks
+
+#include <StandardStream.h>
+#include <Domain.h>
+#include <PartitionedDomain.h>
+#include <DomainPartitioner.h>
+#include <Metis.h>
+#include <MeasuredCostBalancer.h>
+#include <ThreadSubdomain.h>
+#include <SubdomainIter.h>
+#include <Node.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <NodalLoad.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <Steel01.h>
+#include <UniaxialFiber2d.h>
+#include <FiberSection2d.h>
+#include <LegendreBeamIntegration.h>
+#include <LinearCrdTransf2d.h>
+#include <DispBeamColumn2d.h>
+#include <StaticAnalysis.h>
+#include <PlainHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <AnalysisModel.h>
+#include <NewtonRaphson.h>
+#include <CTestNormDispIncr.h>
+#include <LoadControl.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <Vector.h>
+#include <math.h>
+#include <stdlib.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static const int numEle = 12;
+static const int numSteps = 10;
+
+// cantilever along y, fixed at node 1 and pushed laterally at the tip
+static void
+buildModel(Domain &theDomain)
+{
+  for (int i=0; i<=numEle; i++)
+    theDomain.addNode(new Node(i+1, 3, 0.0, 12.0*i));
+
+  for (int dof=0; dof<3; dof++)
+    theDomain.addSP_Constraint(new SP_Constraint(1, dof, 0.0, true));
+
+  Steel01 theSteel(1, 60.0, 29000.0, 0.02);
+  const int numFibers = 10;
+  Fiber *theFibers[numFibers];
+  for (int j=0; j<numFibers; j++)
+    theFibers[j] = new UniaxialFiber2d(j+1, theSteel, 2.0, -9.0 + 2.0*j);
+  FiberSection2d theSection(1, numFibers, theFibers);
+  for (int j=0; j<numFibers; j++)
+    delete theFibers[j];
+
+  LegendreBeamIntegration theIntegration;
+  LinearCrdTransf2d theTransf(1);
+  for (int i=1; i<=numEle; i++) {
+    SectionForceDeformation *theSections[3];
+    for (int k=0; k<3; k++)
+      theSections[k] = &theSection;
+    theDomain.addElement(new DispBeamColumn2d(i, i, i+1, 3, theSections,
+					      theIntegration, theTransf));
+  }
+
+  LoadPattern *thePattern = new LoadPattern(1);
+  thePattern->setTimeSeries(new LinearSeries(1));
+  theDomain.addLoadPattern(thePattern);
+  Vector load(3);
+  load(0) = 40.0;
+  theDomain.addNodalLoad(new NodalLoad(1, numEle+1, load), 1);
+}
+
+static StaticAnalysis *
+createAnalysis(Domain &theDomain, int numThreads)
+{
+  AnalysisModel *theModel = new AnalysisModel();
+  CTestNormDispIncr *theTest = new CTestNormDispIncr(1.0e-12, 25, 0);
+  NewtonRaphson *theAlgorithm = new NewtonRaphson(*theTest);
+  PlainHandler *theHandler = new PlainHandler();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*(new RCM(false)));
+  LoadControl *theIntegrator = new LoadControl(1.0/numSteps, 1, 1.0/numSteps, 1.0/numSteps);
+  ProfileSPDLinSOE *theSOE = new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+
+  StaticAnalysis *theAnalysis = new StaticAnalysis(theDomain, *theHandler, *theNumberer,
+						   *theModel, *theAlgorithm, *theSOE,
+						   *theIntegrator, theTest);
+  theIntegrator->setNumThreads(numThreads);
+
+  return theAnalysis;
+}
+
+// a node is in the PartitionedDomain or in one or more of the subdomains,
+// where it may move as elements are migrated
+static Node *
+findNode(PartitionedDomain &theDomain, int tag)
+{
+  Node *theNode = theDomain.getNode(tag);
+  SubdomainIter &theSubdomains = theDomain.getSubdomains();
+  Subdomain *theSub;
+  while (theNode == 0 && (theSub = theSubdomains()) != 0)
+    theNode = theSub->getNode(tag);
+
+  return theNode;
+}
+
+// the numbers of elements, nodes found and SP and MP constraints
+static void
+getCounts(PartitionedDomain &theDomain, ID &counts)
+{
+  counts.Zero();
+  counts(2) = theDomain.getNumSPs();
+  counts(3) = theDomain.getNumMPs();
+  SubdomainIter &theSubdomains = theDomain.getSubdomains();
+  Subdomain *theSub;
+  while ((theSub = theSubdomains()) != 0) {
+    counts(0) += theSub->getNumElements();
+    counts(2) += theSub->getNumSPs();
+    counts(3) += theSub->getNumMPs();
+  }
+  for (int tag=1; tag<=numEle+1; tag++)
+    if (findNode(theDomain, tag) != 0)
+      counts(1)++;
+}
+
+// runs the partitioned analysis, with or without balancing, and the serial
+// one, returning the number of failed checks
+static int
+runPartitioned(bool balance)
+{
+  int numFailed = 0;
+  const int numSub = 3;
+
+  Domain theSerialDomain;
+  buildModel(theSerialDomain);
+  StaticAnalysis *theSerialAnalysis = createAnalysis(theSerialDomain, 1);
+
+  PartitionedDomain theDomain;
+  buildModel(theDomain);
+  for (int i=1; i<=numSub; i++)
+    theDomain.addSubdomain(new ThreadSubdomain(i));
+  Metis theMetis;
+  MeasuredCostBalancer theBalancer(1.0, 1);
+  DomainPartitioner *thePartitioner = 0;
+  if (balance == true)
+    thePartitioner = new DomainPartitioner(theMetis, theBalancer);
+  else
+    thePartitioner = new DomainPartitioner(theMetis);
+  theDomain.setPartitioner(thePartitioner);
+  if (theDomain.partition(numSub) < 0) {
+    opserr << "FAILED - the domain could not be partitioned\n";
+    return 1;
+  }
+
+  SubdomainIter &theSubdomains = theDomain.getSubdomains();
+  Subdomain *theSub;
+  while ((theSub = theSubdomains()) != 0) {
+    ThreadSubdomain *theThreadSub = (ThreadSubdomain *)theSub;
+    if (theThreadSub->setCondensationAnalysis(*(new LoadControl(0.0, 1, 0.0, 0.0))) < 0) {
+      opserr << "FAILED - no condensation analysis for subdomain " << theSub->getTag() << endln;
+      return 1;
+    }
+  }
+  theDomain.setNumThreads(2);
+  StaticAnalysis *theAnalysis = createAnalysis(theDomain, 2);
+
+  SubdomainIter &theSubdomains2 = theDomain.getSubdomains();
+  while ((theSub = theSubdomains2()) != 0)
+    if (theSub->isThreadSafe() == false) {
+      opserr << "FAILED - subdomain " << theSub->getTag() << " is not thread safe\n";
+      numFailed++;
+    }
+
+  ID counts(4), countsStart(4);
+  getCounts(theDomain, countsStart);
+  ID numEleSub(numSub+1), numEleSubStart(numSub+1);
+  for (int i=1; i<=numSub; i++)
+    numEleSubStart(i) = theDomain.getSubdomainPtr(i)->getNumElements();
+
+  for (int step=1; step<=numSteps; step++) {
+    if (balance == true) {
+      ElementIter &theElements = theDomain.getSubdomainPtr(1)->getElements();
+      Element *theEle;
+      while ((theEle = theElements()) != 0)
+	theEle->addMeasuredCost(1.0);
+    }
+
+    if (theSerialAnalysis->analyze(1) < 0) {
+      opserr << "FAILED - serial analysis step " << step << endln;
+      return numFailed+1;
+    }
+    if (theAnalysis->analyze(1) < 0) {
+      opserr << "FAILED - threaded analysis step " << step << endln;
+      return numFailed+1;
+    }
+
+    for (int tag=1; tag<=numEle+1; tag++) {
+      Node *theNode = findNode(theDomain, tag);
+      if (theNode == 0) {
+	opserr << "FAILED - step " << step << " node " << tag << " not found\n";
+	numFailed++;
+	continue;
+      }
+      const Vector &uSerial = theSerialDomain.getNode(tag)->getDisp();
+      const Vector &u = theNode->getDisp();
+      for (int dof=0; dof<3; dof++)
+	if (fabs(u(dof)-uSerial(dof)) > 1.0e-8*(1.0+fabs(uSerial(dof)))) {
+	  opserr << "FAILED - step " << step << " node " << tag << " dof " << dof << ": "
+		 << u(dof) << " serial " << uSerial(dof) << endln;
+	  numFailed++;
+	}
+    }
+
+    getCounts(theDomain, counts);
+    if (counts != countsStart) {
+      opserr << "FAILED - step " << step << " elements, nodes, SPs and MPs " << counts;
+      opserr << " at the start " << countsStart;
+      numFailed++;
+    }
+  }
+
+  if (balance == true) {
+    int numMoved = 0;
+    for (int i=1; i<=numSub; i++) {
+      numEleSub(i) = theDomain.getSubdomainPtr(i)->getNumElements();
+      numMoved += abs(numEleSub(i) - numEleSubStart(i));
+    }
+    opserr << "elements in the subdomains at the start " << numEleSubStart;
+    opserr << "elements in the subdomains at the end " << numEleSub;
+    if (numMoved == 0) {
+      opserr << "FAILED - no elements were migrated\n";
+      numFailed++;
+    }
+  }
+
+  delete theAnalysis;
+  delete theSerialAnalysis;
+
+  return numFailed;
+}
+
+// main routine
+int main(int argc, char **argv)
+{
+  int numFailed = runPartitioned(false);
+  numFailed += runPartitioned(true);
+
+  if (numFailed == 0)
+    opserr << "ThreadSubdomain - all checks passed\n";
+
+  exit(numFailed);
+}
@@ -0,0 +1,155 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/subdomain/ThreadSubdomain.cpp,v $
+                                                                        
+// File: ~/domain/subdomain/ThreadSubdomain.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of ThreadSubdomain.
+//
+// What: "@(#) ThreadSubdomain.cpp, revA"
+
+#include <ThreadSubdomain.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <DomainDecompositionAnalysis.h>
+#include <PlainHandler.h>
+#include <PlainNumberer.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <AnalysisModel.h>
+#include <DomainDecompAlgo.h>
+#include <IncrementalIntegrator.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinSubstrSolver.h>
+
+ThreadSubdomain::ThreadSubdomain(int tag)
+  :Subdomain(tag), condensationSet(false), threadSafe(-1)
+{
+
+}
+
+ThreadSubdomain::~ThreadSubdomain()
+{
+  // the analysis and all its components are owned by the subdomain
+  if (condensationSet == true)
+    this->wipeAnalysis();
+}
+
+int
+ThreadSubdomain::setCondensationAnalysis(IncrementalIntegrator &theIntegrator,
+					 bool useRCM)
+{
+  if (condensationSet == true) {
+    this->wipeAnalysis();
+    condensationSet = false;
+  }
+
+  // the PlainHandler is used as the FE_Elements it creates form their
+  // tangents in their own storage; the external nodes are numbered last
+  ConstraintHandler *theHandler = new PlainHandler();
+  DOF_Numberer *theNumberer = 0;
+  if (useRCM == true)
+    theNumberer = new DOF_Numberer(*(new RCM(false)));
+  else
+    theNumberer = new PlainNumberer();
+  AnalysisModel *theModel = new AnalysisModel();
+  DomainDecompAlgo *theAlgorithm = new DomainDecompAlgo();
+  ProfileSPDLinSubstrSolver *theSolver = new ProfileSPDLinSubstrSolver();
+  LinearSOE *theSOE = new ProfileSPDLinSOE(*theSolver);
+
+  if (theHandler == 0 || theNumberer == 0 || theModel == 0 ||
+      theAlgorithm == 0 || theSolver == 0 || theSOE == 0) {
+    opserr << "ThreadSubdomain::setCondensationAnalysis() - out of memory\n";
+    return -1;
+  }
+
+  DomainDecompositionAnalysis *theAnalysis = 
+    new DomainDecompositionAnalysis(*this, *theHandler, *theNumberer, 
+				    *theModel, *theAlgorithm, theIntegrator,
+				    *theSOE, *theSolver, 0);
+  if (theAnalysis == 0) {
+    opserr << "ThreadSubdomain::setCondensationAnalysis() - out of memory\n";
+    return -1;
+  }
+
+  // the constructor has set the analysis on the subdomain
+  condensationSet = true;
+  threadSafe = -1;
+
+  return 0;
+}
+
+void
+ThreadSubdomain::setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis)
+{
+  // an analysis set from outside may share its components
+  condensationSet = false;
+  threadSafe = -1;
+  this->Subdomain::setDomainDecompAnalysis(theAnalysis);
+}
+
+bool
+ThreadSubdomain::addElement(Element *elePtr)
+{
+  threadSafe = -1;
+  return this->Subdomain::addElement(elePtr);
+}
+
+Element *
+ThreadSubdomain::removeElement(int tag)
+{
+  threadSafe = -1;
+  return this->Subdomain::removeElement(tag);
+}
+
+void
+ThreadSubdomain::clearAll(void)
+{
+  threadSafe = -1;
+  this->Subdomain::clearAll();
+}
+
+bool
+ThreadSubdomain::isThreadSafe(void) const
+{
+  if (condensationSet == false)
+    return false;
+
+  // the subdomain is formed by one thread; it can run alongside the others
+  // if none of its elements share scratch storage with other elements
+  if (threadSafe == -1) {
+    threadSafe = 1;
+    ElementIter &theElements = const_cast<ThreadSubdomain *>(this)->getElements();
+    Element *elePtr;
+    while ((elePtr = theElements()) != 0)
+      if (elePtr->isThreadSafe() == false) {
+	threadSafe = 0;
+	break;
+      }
+  }
+
+  return (threadSafe == 1);
+}
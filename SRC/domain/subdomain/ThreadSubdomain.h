@@ -0,0 +1,73 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/subdomain/ThreadSubdomain.h,v $
+                                                                        
+#ifndef ThreadSubdomain_h
+#define ThreadSubdomain_h
+
+// File: ~/domain/subdomain/ThreadSubdomain.h
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for ThreadSubdomain.
+// A ThreadSubdomain is a Subdomain that lives in the same process as the
+// PartitionedDomain it has been added to. Unlike the ShadowSubdomain no
+// Channel is involved: the PartitionedDomain, partitioned as usual with a
+// DomainPartitioner and the Metis GraphPartitioner, works on it directly.
+// Once setCondensationAnalysis() has been invoked the subdomain owns a
+// DomainDecompositionAnalysis that condenses the subdomain onto its external
+// dof with a ProfileSPDLinSubstrSolver. If in addition all the elements of
+// the subdomain are thread safe, the subdomain reports itself as thread safe
+// so that the condensation, state determination and commit of the
+// subdomains are done in parallel by the ThreadPools of the
+// IncrementalIntegrator and the PartitionedDomain.
+//
+// What: "@(#) ThreadSubdomain.h, revA"
+
+#include <Subdomain.h>
+
+class ThreadSubdomain: public Subdomain
+{
+  public:
+    ThreadSubdomain(int tag);
+    ~ThreadSubdomain();
+
+    // builds the condensation analysis; the subdomain takes ownership of
+    // the integrator, which must not be shared with any other analysis
+    virtual int setCondensationAnalysis(IncrementalIntegrator &theIntegrator,
+					bool useRCM = true);
+
+    virtual void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
+    virtual bool addElement(Element *elePtr);
+    virtual Element *removeElement(int tag);
+    virtual void clearAll(void);
+
+    virtual bool isThreadSafe(void) const;
+
+  private:
+    bool condensationSet;     // true if analysis set by setCondensationAnalysis()
+    mutable int threadSafe;   // -1 unknown, 0 if not and 1 if thread safe
+};
+
+#endif
@@ -46,10 +46,83 @@
 
 Element  *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+// storage for the damping matrix & residual force calculations done in the
+// base class. there is one matrix and two vectors for each element size, and
+// each thread has its own set so that elements can be formed concurrently.
+class ElementWorkArea
+{
+  public:
+    ElementWorkArea()
+      :theMatrices(0), theVectors1(0), theVectors2(0), numMatrices(0)
+    {
+
+    }
+
+    ~ElementWorkArea()
+    {
+      for (int i=0; i<numMatrices; i++) {
+	delete theMatrices[i];
+	delete theVectors1[i];
+	delete theVectors2[i];
+      }
+      if (theMatrices != 0) {
+	delete [] theMatrices;
+	delete [] theVectors1;
+	delete [] theVectors2;
+      }
+    }
+
+    int getIndex(int numDOF)
+    {
+      for (int i=0; i<numMatrices; i++)
+	if (theMatrices[i]->noRows() == numDOF)
+	  return i;
+
+      Matrix **nextMatrices = new Matrix *[numMatrices+1];
+      Vector **nextVectors1 = new Vector *[numMatrices+1];
+      Vector **nextVectors2 = new Vector *[numMatrices+1];
+      if (nextMatrices == 0 || nextVectors1 == 0 || nextVectors2 == 0) {
+	opserr << "Element::getTheMatrix - out of memory\n";
+	exit(-1);
+      }
+
+      for (int j=0; j<numMatrices; j++) {
+	nextMatrices[j] = theMatrices[j];
+	nextVectors1[j] = theVectors1[j];
+	nextVectors2[j] = theVectors2[j];
+      }
+
+      Matrix *theMatrix = new Matrix(numDOF, numDOF);
+      Vector *theVector1 = new Vector(numDOF);
+      Vector *theVector2 = new Vector(numDOF);
+      if (theMatrix == 0 || theVector1 == 0 || theVector2 == 0) {
+	opserr << "Element::getTheVector - out of memory\n";
+	exit(-1);
+      }
+
+      nextMatrices[numMatrices] = theMatrix;
+      nextVectors1[numMatrices] = theVector1;
+      nextVectors2[numMatrices] = theVector2;
+
+      if (numMatrices != 0) {
+	delete [] theMatrices;
+	delete [] theVectors1;
+	delete [] theVectors2;
+      }
+      theMatrices = nextMatrices;
+      theVectors1 = nextVectors1;
+      theVectors2 = nextVectors2;
+
+      return numMatrices++;
+    }
+
+    Matrix **theMatrices;
+    Vector **theVectors1;
+    Vector **theVectors2;
+    int numMatrices;
+};
+
+static OPS_THREAD_LOCAL ElementWorkArea theElementWorkArea;
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -58,7 +131,7 @@ int  Element::numMatrices(0);
 Element::Element(int tag, int cTag) 
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
-  Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1)
+  Kc(0), previousK(0), numPreviousK(0), nodeIndex(-1), measuredCost(0.0)
 {
   // does nothing
   ops_TheActiveElement = this;
@@ -120,68 +193,6 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   betaK0 = betak0;
   betaKc = betakc;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
-
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
     if (Kc == 0) 
@@ -200,15 +211,23 @@ Element::setRayleighDampingFactors(double alpham, double betak, double betak0, d
   return 0;
 }
 
+void
+Element::getRayleighDampingFactors(double &alpham, double &betak, double &betak0, double &betakc) const
+{
+  alpham = alphaM;
+  betak  = betaK;
+  betak0 = betaK0;
+  betakc = betaKc;
+}
+
 const Matrix &
 Element::getDamp(void) 
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = theWork.theMatrices[index]; 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -228,12 +247,11 @@ Element::getDamp(void)
 const Matrix &
 Element::getMass(void)
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = theWork.theMatrices[index]; 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -241,13 +259,12 @@ Element::getMass(void)
 const Vector &
 Element::getResistingForceIncInertia(void) 
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = theWork.theMatrices[index]; 
+  Vector *theVector = theWork.theVectors2[index];
+  Vector *theVector2 = theWork.theVectors1[index];
 
   //
   // perform: R = P(U) - Pext(t);
@@ -308,13 +325,12 @@ const Vector &
 Element::getRayleighDampingForces(void) 
 {
 
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = theWork.theMatrices[index]; 
+  Vector *theVector = theWork.theVectors2[index];
+  Vector *theVector2 = theWork.theVectors1[index];
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -408,6 +424,12 @@ Element::isSubdomain(void)
     return false;
 }
 
+bool
+Element::isThreadSafe(void) const
+{
+    return false;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -486,11 +508,10 @@ Element::getResponseSensitivity(int responseID, int gradIndex,
 const Vector &
 Element::getResistingForceSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = theWork.theVectors1[index];
   theVector->Zero();
 
   return *theVector;
@@ -499,11 +520,10 @@ Element::getResistingForceSensitivity(int gradIndex)
 const Matrix &
 Element::getInitialStiffSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = theWork.theMatrices[index];
   theMatrix->Zero();
 
   return *theMatrix;
@@ -512,11 +532,10 @@ Element::getInitialStiffSensitivity(int gradIndex)
 const Matrix &
 Element::getMassSensitivity(int gradIndex)
 {
-  if (index == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = theWork.theMatrices[index];
   theMatrix->Zero();
 
   return *theMatrix;
@@ -542,12 +561,11 @@ Element::addInertiaLoadSensitivityToUnbalance(const Vector &accel, bool tag)
 const Matrix &
 Element::getDampSensitivity(int gradIndex) 
 {
-  if (index  == -1) {
-    this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
-  }
+  ElementWorkArea &theWork = theElementWorkArea;
+  int index = theWork.getIndex(this->getNumDOF());
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = theWork.theMatrices[index]; 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
@@ -576,7 +594,7 @@ Element::addResistingForceToNodalReaction(int flag)
   int numNodes = this->getNumExternalNodes();
   Node **theNodes = this->getNodePtrs();
 
-  static Vector theVector(48);
+  static OPS_THREAD_LOCAL Vector theVector(48);
 
   //
   // now determine the resisting force
@@ -622,14 +640,15 @@ double Element::getCharacteristicLength(void)
 
   for (int i=0; i<numNodes; i++) {
     Node *nodeI = theNodes[i];
-    Vector iCoords = nodeI->getCrds();
-    int iDOF = nodeI->getNumberDOF();
+    const Vector &iCoords = nodeI->getCrds();
+    int iDim = iCoords.Size();
     for (int j=i+1; j<numNodes; j++) {
       Node *nodeJ = theNodes[j];
-      Vector jCoords = nodeJ->getCrds();
-      int jDOF = nodeI->getNumberDOF();
+      const Vector &jCoords = nodeJ->getCrds();
+      int jDim = jCoords.Size();
       double ijLength = 0;
-      for (int k=0; k<iDOF && k<jDOF; k++) {
+      // loop over the coordinates, not the dof, which exceed them on beam and shell nodes
+      for (int k=0; k<iDim && k<jDim; k++) {
 	ijLength += (jCoords(k)-iCoords(k))*(jCoords(k)-iCoords(k)); //Tesser
       }	
       ijLength = sqrt(ijLength);
@@ -69,6 +69,17 @@ class Element : public DomainComponent
     virtual int revertToStart(void);                
     virtual int update(void);
     virtual bool isSubdomain(void);
+
+    // true if the state determination of the element may run concurrently
+    // with that of other elements, i.e. all scratch storage is per thread
+    virtual bool isThreadSafe(void) const;
+
+    // wall time measured in the state determination of the element since
+    // the cost was last zeroed, used to weight the element graph when
+    // balancing the subdomains of a PartitionedDomain
+    inline double getMeasuredCost(void) const {return measuredCost;}
+    inline void addMeasuredCost(double wallTime) {measuredCost += wallTime;}
+    inline void zeroMeasuredCost(void) {measuredCost = 0.0;}
     
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -84,6 +95,7 @@ class Element : public DomainComponent
 
     virtual int addInertiaLoadToUnbalance(const Vector &accel);
     virtual int setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
+    void getRayleighDampingFactors(double &alphaM, double &betaK, double &betaK0, double &betaKc) const;
 
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce(void) =0;
@@ -119,12 +131,8 @@ class Element : public DomainComponent
 	int numPreviousK;
 
   private:
-    int index, nodeIndex;
-
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    int nodeIndex;
+    double measuredCost;
 };
 
 
@@ -874,14 +874,8 @@ PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups,
     if(numeles == 0) return 0;
     int etag = starteletag-1;
     for(int i=0; i<numeles; i++) {
-        Element* theEle = 0;
-        if(type == 1) {
-            theEle = new PFEMElement2D(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk);
-        } else if(type == 3) {
-            theEle = new PFEMElement2DCompressible(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
-        } else if(type == 4) {
-            theEle = new PFEMElement2DBubble(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
-        }
+        Element* theEle = newElement(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),
+                                     rho, mu, b1, b2, thk, kappa, type);
         
         if(theEle == 0) {
             opserr<<"WARNING: no enough memory -- ";
@@ -906,6 +900,142 @@ PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups,
     
 }
 
+int
+PFEMMesher2D::remesh(int regTag, double alpha, const ID& groups, 
+                     const ID& addgroups, Domain* theDomain, 
+                     double rho, double mu, double b1, double b2, 
+                     double thk, double kappa, int type)
+{
+    if(theDomain == 0) {
+        opserr<<"WARNING: null domain";
+        opserr<<" -- PFEMMesher2D::remesh\n";
+        return -1;
+    }
+
+    int classTag = -1;
+    if(type == 1) {
+        classTag = ELE_TAG_PFEMElement2D;
+    } else if(type == 3) {
+        classTag = ELE_TAG_PFEMElement2DCompressible;
+    } else if(type == 4) {
+        classTag = ELE_TAG_PFEMElement2DBubble;
+    } else {
+        opserr<<"WARNING: unknown element type "<<type;
+        opserr<<" -- PFEMMesher2D::remesh\n";
+        return -1;
+    }
+
+    // do triangulation
+    ID eles;
+    int res = doTriangulation(alpha,groups,addgroups,theDomain,eles);
+    if(res < 0) {
+        opserr<<"WARNING: failed to do triangulation --";
+        opserr<<"PFEMMesher2D::remesh\n";
+        return res;
+    }
+
+    // triangles of the old mesh, the key is the sorted node tags
+    typedef std::pair<int,std::pair<int,int> > Triangle;
+    std::map<Triangle,int> oldeles;
+    std::vector<int> removeles;
+    MeshRegion* eleReg = theDomain->getRegion(regTag);
+    if(eleReg != 0) {
+        const ID& regEles = eleReg->getElements();
+        for(int i=0; i<regEles.Size(); i++) {
+            Element* ele = theDomain->getElement(regEles(i));
+            if(ele == 0) continue;
+            const ID& ntags = ele->getExternalNodes();
+            if(ele->getClassTag() != classTag || ntags.Size() < 5) {
+                removeles.push_back(regEles(i));
+                continue;
+            }
+
+            // the corner (velocity) nodes are at the even indices, each
+            // followed by its pressure node
+            int nds[3] = {ntags(0), ntags(2), ntags(4)};
+            std::sort(nds, nds+3);
+            oldeles[Triangle(nds[0],std::pair<int,int>(nds[1],nds[2]))] = regEles(i);
+        }
+    }
+
+    // keep the elements of the triangles in both meshes
+    int numeles = eles.Size()/3;
+    std::vector<int> regeles;
+    std::vector<int> neweles;
+    regeles.reserve(numeles);
+    for(int i=0; i<numeles; i++) {
+        int nds[3] = {eles(3*i), eles(3*i+1), eles(3*i+2)};
+        std::sort(nds, nds+3);
+        std::map<Triangle,int>::iterator it = 
+            oldeles.find(Triangle(nds[0],std::pair<int,int>(nds[1],nds[2])));
+        if(it != oldeles.end()) {
+            regeles.push_back(it->second);
+            oldeles.erase(it);
+        } else {
+            neweles.push_back(i);
+        }
+    }
+
+    // remove the elements of the triangles not in the new mesh
+    for(std::map<Triangle,int>::iterator it=oldeles.begin(); it!=oldeles.end(); it++) {
+        removeles.push_back(it->second);
+    }
+    for(int i=0; i<(int)removeles.size(); i++) {
+        Element* ele = theDomain->removeElement(removeles[i]);
+        if(ele != 0) delete ele;
+    }
+
+    // add elements for the new triangles
+    int etag = findEleTag(theDomain)-1;
+    for(int j=0; j<(int)neweles.size(); j++) {
+        int i = neweles[j];
+        Element* theEle = newElement(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),
+                                     rho, mu, b1, b2, thk, kappa, type);
+        if(theEle == 0) {
+            opserr<<"WARNING: no enough memory -- ";
+            opserr<<" -- PFEMMesher2D::remesh\n";
+            return -1;
+        }
+        if(theDomain->addElement(theEle) == false) {
+            opserr<<"WARNING: failed to add element to domain -- ";
+            opserr<<" -- PFEMMesher2D::remesh\n";
+            delete theEle;
+            return -1;
+        }
+        regeles.push_back(etag);
+    }
+
+    // set the element region
+    ID regioneles((int)regeles.size());
+    for(int i=0; i<(int)regeles.size(); i++) {
+        regioneles(i) = regeles[i];
+    }
+    bool series = true;
+    int action = 0; // set
+    setElements(regioneles,regTag,series,action,theDomain);
+
+    // identify
+    identify(b2,theDomain);
+
+    return res;
+}
+
+Element*
+PFEMMesher2D::newElement(int tag, int nd1, int nd2, int nd3, 
+                         double rho, double mu, double b1, double b2, 
+                         double thk, double kappa, int type)
+{
+    Element* theEle = 0;
+    if(type == 1) {
+        theEle = new PFEMElement2D(tag, nd1, nd2, nd3, rho, mu, b1, b2, thk);
+    } else if(type == 3) {
+        theEle = new PFEMElement2DCompressible(tag, nd1, nd2, nd3, rho, mu, b1, b2, thk, kappa);
+    } else if(type == 4) {
+        theEle = new PFEMElement2DBubble(tag, nd1, nd2, nd3, rho, mu, b1, b2, thk, kappa);
+    }
+    return theEle;
+}
+
 // solid elements
 int
 PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups, 
@@ -49,6 +49,7 @@ extern "C" {
 #include <vector>
 
 class Domain;
+class Element;
 
 
 class PFEMMesher2D 
@@ -111,6 +112,12 @@ public:
                         const ID& addgroups,Domain* theDomain,
                         double rho, double mu, double b1, double b2, 
                         double thk, double kappa, int type, int& endele);
+    // linear elements in element region regTag, elements of the 
+    // triangles which are in both the old and the new mesh are kept
+    int remesh(int regTag, double alpha, const ID& groups, 
+               const ID& addgroups, Domain* theDomain,
+               double rho, double mu, double b1, double b2, 
+               double thk, double kappa, int type);
     // solid element
     int doTriangulation(int startele, double alpha, const ID& groups, 
                         const ID& addgroups, Domain* theDomain,
@@ -161,6 +168,11 @@ public:
 
 private:
 
+    // create a linear PFEM element
+    Element* newElement(int tag, int nd1, int nd2, int nd3, 
+                        double rho, double mu, double b1, double b2, 
+                        double thk, double kappa, int type);
+
     // initialize triangulateio
     void initializeTri(triangulateio& tri);
 
@@ -2186,17 +2186,12 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     kappa = params(5);
                 }
 
-                // remove all elements in eleReg
-                theMesher2D.removeElements(eleRegTag,theDomain);
-
-                // triangulation
-                int startele = theMesher2D.findEleTag(theDomain);
-                int endele = startele;
-            
-                res = theMesher2D.doTriangulation(startele,alpha,nodes,
-                                                  addnodes,theDomain,
-                                                  rho,mu,b1,b2,thk,kappa,
-                                                  eletype,endele);
+                // triangulation, elements of unchanged triangles are
+                // kept so an unchanged mesh leaves the domain unchanged
+                res = theMesher2D.remesh(eleRegTag,alpha,nodes,
+                                         addnodes,theDomain,
+                                         rho,mu,b1,b2,thk,kappa,
+                                         eletype);
             
                 if(res < 0) {
                     opserr<<"WARNING: failed to mesh -- ";
@@ -2204,15 +2199,6 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     return TCL_ERROR; 
                 }
 
-                // add to element region
-                ID regioneles(2);
-                regioneles(0) = startele;
-                regioneles(1) = endele;
-                bool series = false;
-                int action = 1; // append
-                theMesher2D.setElements(regioneles,eleRegTag,series,action,
-                                        theDomain);
-
             } else if(eletype == 2) {
                 double thk=0, p=0,rho=0,b1=0,b2=0;
                 int matTag=0;
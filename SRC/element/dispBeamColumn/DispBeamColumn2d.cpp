@@ -46,9 +46,9 @@
 #include <math.h>
 #include <ElementalLoad.h>
 
-Matrix DispBeamColumn2d::K(6,6);
-Vector DispBeamColumn2d::P(6);
-double DispBeamColumn2d::workArea[100];
+OPS_THREAD_LOCAL Matrix DispBeamColumn2d::K(6,6);
+OPS_THREAD_LOCAL Vector DispBeamColumn2d::P(6);
+OPS_THREAD_LOCAL double DispBeamColumn2d::workArea[100];
 
 DispBeamColumn2d::DispBeamColumn2d(int tag, int nd1, int nd2,
 				   int numSec, SectionForceDeformation **s,
@@ -169,6 +169,19 @@ DispBeamColumn2d::getNumDOF()
     return 6;
 }
 
+bool
+DispBeamColumn2d::isThreadSafe(void) const
+{
+    if (crdTransf == 0 || crdTransf->isThreadSafe() == false)
+      return false;
+
+    for (int i = 0; i < numSections; i++)
+      if (theSections[i]->isThreadSafe() == false)
+        return false;
+
+    return true;
+}
+
 void
 DispBeamColumn2d::setDomain(Domain *theDomain)
 {
@@ -318,7 +331,7 @@ DispBeamColumn2d::update(void)
 const Matrix&
 DispBeamColumn2d::getTangentStiff()
 {
-  static Matrix kb(3,3);
+  static OPS_THREAD_LOCAL Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -422,7 +435,7 @@ DispBeamColumn2d::getTangentStiff()
 const Matrix&
 DispBeamColumn2d::getInitialBasicStiff()
 {
-  static Matrix kb(3,3);
+  static OPS_THREAD_LOCAL Matrix kb(3,3);
 
   // Zero for integral
   kb.Zero();
@@ -524,7 +537,7 @@ DispBeamColumn2d::getMass()
     K(0,0) = K(1,1) = K(3,3) = K(4,4) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(6,6);
+    static OPS_THREAD_LOCAL Matrix ml(6,6);
     double m = rho*L/420.0;
     ml(0,0) = ml(3,3) = m*140.0;
     ml(0,3) = ml(3,0) = m*70.0;
@@ -653,7 +666,7 @@ DispBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
       Q(4) -= m*Raccel2(1);
     } else  {
       // use matrix vector multip. for consistent mass matrix
-      static Vector Raccel(6);
+      static OPS_THREAD_LOCAL Vector Raccel(6);
       for (int i=0; i<3; i++)  {
         Raccel(i)   = Raccel1(i);
         Raccel(i+3) = Raccel2(i);
@@ -747,7 +760,7 @@ DispBeamColumn2d::getResistingForceIncInertia()
     P(4) += m*accel2(1);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(6);
+    static OPS_THREAD_LOCAL Vector accel(6);
     for (int i=0; i<3; i++)  {
       accel(i)   = accel1(i);
       accel(i+3) = accel2(i);
@@ -778,7 +791,7 @@ DispBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  static OPS_THREAD_LOCAL Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -872,7 +885,7 @@ DispBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  static OPS_THREAD_LOCAL Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn2d::recvSelf() - failed to recv data Vector\n";
@@ -1071,8 +1084,8 @@ DispBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact)
     const Vector &end1Crd = theNodes[0]->getCrds();
     const Vector &end2Crd = theNodes[1]->getCrds();	
 
-  static Vector v1(3);
-  static Vector v2(3);
+  static OPS_THREAD_LOCAL Vector v1(3);
+  static OPS_THREAD_LOCAL Vector v2(3);
 
   if (displayMode >= 0) {
     const Vector &end1Disp = theNodes[0]->getDisp();
@@ -1302,8 +1315,8 @@ DispBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(3);
-    static Vector ve(3);
+    static OPS_THREAD_LOCAL Vector vp(3);
+    static OPS_THREAD_LOCAL Vector ve(3);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1509,7 +1522,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(3);
+  static OPS_THREAD_LOCAL Vector dqdh(3);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1545,7 +1558,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(3);		// No distributed loads
+  static OPS_THREAD_LOCAL Vector dp0dh(3);		// No distributed loads
 
   P.Zero();
 
@@ -1555,7 +1568,7 @@ DispBeamColumn2d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(3,3);
+    static OPS_THREAD_LOCAL Matrix kbmine(3,3);
     kbmine.Zero();
     q.Zero();
     
@@ -1651,7 +1664,7 @@ DispBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(3);
+  static OPS_THREAD_LOCAL Vector dvdh(3);
   dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = crdTransf->getInitialLength();
@@ -64,6 +64,7 @@ class DispBeamColumn2d : public Element
     Node **getNodePtrs(void);
 
     int getNumDOF(void);
+    bool isThreadSafe(void) const;
     void setDomain(Domain *theDomain);
 
     // public methods to set the state of the element    
@@ -119,8 +120,8 @@ class DispBeamColumn2d : public Element
 
     Node *theNodes[2];
 
-    static Matrix K;		// Element stiffness, damping, and mass Matrix
-    static Vector P;		// Element resisting force vector
+    static OPS_THREAD_LOCAL Matrix K;		// Element stiffness, damping, and mass Matrix
+    static OPS_THREAD_LOCAL Vector P;		// Element resisting force vector
 
     Vector Q;      // Applied nodal loads
     Vector q;      // Basic force
@@ -132,7 +133,7 @@ class DispBeamColumn2d : public Element
 
     enum {maxNumSections = 20};
 
-    static double workArea[];
+    static OPS_THREAD_LOCAL double workArea[];
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int parameterID;
@@ -47,9 +47,9 @@
 #include <Parameter.h>
 #include <math.h>
 
-Matrix DispBeamColumn3d::K(12,12);
-Vector DispBeamColumn3d::P(12);
-double DispBeamColumn3d::workArea[200];
+OPS_THREAD_LOCAL Matrix DispBeamColumn3d::K(12,12);
+OPS_THREAD_LOCAL Vector DispBeamColumn3d::P(12);
+OPS_THREAD_LOCAL double DispBeamColumn3d::workArea[200];
 
 DispBeamColumn3d::DispBeamColumn3d(int tag, int nd1, int nd2,
 				   int numSec, SectionForceDeformation **s,
@@ -180,6 +180,19 @@ DispBeamColumn3d::getNumDOF()
     return 12;
 }
 
+bool
+DispBeamColumn3d::isThreadSafe(void) const
+{
+    if (crdTransf == 0 || crdTransf->isThreadSafe() == false)
+      return false;
+
+    for (int i = 0; i < numSections; i++)
+      if (theSections[i]->isThreadSafe() == false)
+        return false;
+
+    return true;
+}
+
 void
 DispBeamColumn3d::setDomain(Domain *theDomain)
 {
@@ -338,7 +351,7 @@ DispBeamColumn3d::update(void)
 const Matrix&
 DispBeamColumn3d::getTangentStiff()
 {
-  static Matrix kb(6,6);
+  static OPS_THREAD_LOCAL Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -470,7 +483,7 @@ DispBeamColumn3d::getTangentStiff()
 const Matrix&
 DispBeamColumn3d::getInitialBasicStiff()
 {
-  static Matrix kb(6,6);
+  static OPS_THREAD_LOCAL Matrix kb(6,6);
   
   // Zero for integral
   kb.Zero();
@@ -592,7 +605,7 @@ DispBeamColumn3d::getMass()
     K(0,0) = K(1,1) = K(2,2) = K(6,6) = K(7,7) = K(8,8) = m;
   } else  {
     // consistent mass matrix
-    static Matrix ml(12,12);
+    static OPS_THREAD_LOCAL Matrix ml(12,12);
     double m = rho*L/420.0;
     ml(0,0) = ml(6,6) = m*140.0;
     ml(0,6) = ml(6,0) = m*70.0;
@@ -755,7 +768,7 @@ DispBeamColumn3d::addInertiaLoadToUnbalance(const Vector &accel)
     Q(8) -= m*Raccel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector Raccel(12);
+    static OPS_THREAD_LOCAL Vector Raccel(12);
     for (int i=0; i<6; i++)  {
       Raccel(i)   = Raccel1(i);
       Raccel(i+6) = Raccel2(i);
@@ -856,7 +869,7 @@ DispBeamColumn3d::getResistingForceIncInertia()
     P(8) += m*accel2(2);
   } else  {
     // use matrix vector multip. for consistent mass matrix
-    static Vector accel(12);
+    static OPS_THREAD_LOCAL Vector accel(12);
     for (int i=0; i<6; i++)  {
       accel(i)   = accel1(i);
       accel(i+6) = accel2(i);
@@ -887,7 +900,7 @@ DispBeamColumn3d::sendSelf(int commitTag, Channel &theChannel)
   int i, j;
   int loc = 0;
   
-  static Vector data(14);
+  static OPS_THREAD_LOCAL Vector data(14);
   data(0) = this->getTag();
   data(1) = connectedExternalNodes(0);
   data(2) = connectedExternalNodes(1);
@@ -981,7 +994,7 @@ DispBeamColumn3d::recvSelf(int commitTag, Channel &theChannel,
   int dbTag = this->getDbTag();
   int i;
   
-  static Vector data(14);
+  static OPS_THREAD_LOCAL Vector data(14);
 
   if (theChannel.recvVector(dbTag, commitTag, data) < 0)  {
     opserr << "DispBeamColumn3d::recvSelf() - failed to recv data Vector\n";
@@ -1189,8 +1202,8 @@ DispBeamColumn3d::displaySelf(Renderer &theViewer, int displayMode, float fact)
   const Vector &end1Crd = theNodes[0]->getCrds();
   const Vector &end2Crd = theNodes[1]->getCrds();	
   
-  static Vector v1(3);
-  static Vector v2(3);
+  static OPS_THREAD_LOCAL Vector v1(3);
+  static OPS_THREAD_LOCAL Vector v2(3);
 
   if (displayMode >= 0) {
     const Vector &end1Disp = theNodes[0]->getDisp();
@@ -1438,8 +1451,8 @@ DispBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Plastic rotation
   else if (responseID == 4) {
-    static Vector vp(6);
-    static Vector ve(6);
+    static OPS_THREAD_LOCAL Vector vp(6);
+    static OPS_THREAD_LOCAL Vector ve(6);
     const Matrix &kb = this->getInitialBasicStiff();
     kb.Solve(q, ve);
     vp = crdTransf->getBasicTrialDisp();
@@ -1575,7 +1588,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   beamInt->getSectionWeights(numSections, L, wt);
 
   // Zero for integration
-  static Vector dqdh(6);
+  static OPS_THREAD_LOCAL Vector dqdh(6);
   dqdh.Zero();
   
   // Loop over the integration points
@@ -1618,7 +1631,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
   }
   
   // Transform forces
-  static Vector dp0dh(6);		// No distributed loads
+  static OPS_THREAD_LOCAL Vector dp0dh(6);		// No distributed loads
 
   P.Zero();
 
@@ -1628,7 +1641,7 @@ DispBeamColumn3d::getResistingForceSensitivity(int gradNumber)
     
     // Perform numerical integration to obtain basic stiffness matrix
     // Some extra declarations
-    static Matrix kbmine(6,6);
+    static OPS_THREAD_LOCAL Matrix kbmine(6,6);
     kbmine.Zero();
     q.Zero();
     
@@ -1751,7 +1764,7 @@ DispBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
   // Get basic deformation and sensitivities
   const Vector &v = crdTransf->getBasicTrialDisp();
   
-  static Vector dvdh(6);
+  static OPS_THREAD_LOCAL Vector dvdh(6);
   dvdh = crdTransf->getBasicDisplSensitivity(gradNumber);
   
   double L = crdTransf->getInitialLength();
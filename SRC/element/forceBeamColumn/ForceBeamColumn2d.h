@@ -92,6 +92,7 @@ class ForceBeamColumn2d: public Element
   Node **getNodePtrs(void);
   
   int getNumDOF(void);
+  bool isThreadSafe(void) const;
   
   void setDomain(Domain *theDomain);
   int commitState(void);
@@ -190,9 +191,9 @@ class ForceBeamColumn2d: public Element
 
   Matrix *Ki;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
+  static OPS_THREAD_LOCAL Matrix theMatrix;
+  static OPS_THREAD_LOCAL Vector theVector;
+  static OPS_THREAD_LOCAL double workArea[];
   
   enum {maxNumSections = 30};
   enum {maxSectionOrder = 5};
@@ -200,9 +201,9 @@ class ForceBeamColumn2d: public Element
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
   
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
+  static OPS_THREAD_LOCAL Vector vsSubdivide[maxNumSections];
+  static OPS_THREAD_LOCAL Vector SsrSubdivide[maxNumSections];
+  static OPS_THREAD_LOCAL Matrix fsSubdivide[maxNumSections];
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
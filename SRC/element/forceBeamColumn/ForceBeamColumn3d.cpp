@@ -89,13 +89,13 @@ using std::ifstream;
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3d::theMatrix(12,12);
-Vector ForceBeamColumn3d::theVector(12);
-double ForceBeamColumn3d::workArea[200];
+OPS_THREAD_LOCAL Matrix ForceBeamColumn3d::theMatrix(12,12);
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::theVector(12);
+OPS_THREAD_LOCAL double ForceBeamColumn3d::workArea[200];
 
-Vector *ForceBeamColumn3d::vsSubdivide = 0;
-Matrix *ForceBeamColumn3d::fsSubdivide = 0;
-Vector *ForceBeamColumn3d::SsrSubdivide = 0;
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::vsSubdivide[maxNumSections];
+OPS_THREAD_LOCAL Matrix ForceBeamColumn3d::fsSubdivide[maxNumSections];
+OPS_THREAD_LOCAL Vector ForceBeamColumn3d::SsrSubdivide[maxNumSections];
 
 // constructor:
 // invoked by a FEM_ObjectBroker, recvSelf() needs to be invoked on this object.
@@ -122,17 +122,6 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   v0[2] = 0.0;
   v0[3] = 0.0;
   v0[4] = 0.0;
-
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0) 
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -184,17 +173,6 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
   v0[2] = 0.0;
   v0[3] = 0.0;
   v0[4] = 0.0;
-
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn3d():
@@ -258,6 +236,19 @@ ForceBeamColumn3d::getNumDOF(void)
   return NEGD;
 }
 
+bool
+ForceBeamColumn3d::isThreadSafe(void) const
+{
+  if (crdTransf == 0 || crdTransf->isThreadSafe() == false)
+    return false;
+
+  for (int i = 0; i < numSections; i++)
+    if (sections[i]->isThreadSafe() == false)
+      return false;
+
+  return true;
+}
+
 void
 ForceBeamColumn3d::setDomain(Domain *theDomain)
 {
@@ -428,17 +419,17 @@ ForceBeamColumn3d::getInitialStiff(void)
   if (Ki != 0)
     return *Ki;
 
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix  
+  static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix  
   this->getInitialFlexibility(f);
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
+  static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
   I.Zero();
   for (int i=0; i<NEBD; i++)
     I(i,i) = 1.0;
   
   // calculate element stiffness matrix
   // invert3by3Matrix(f, kv);
-  static Matrix kvInit(NEBD, NEBD);
+  static OPS_THREAD_LOCAL Matrix kvInit(NEBD, NEBD);
   if (f.Solve(I, kvInit) < 0)
     opserr << "ForceBeamColumn3d::getInitialStiff() -- could not invert flexibility";
 
@@ -495,13 +486,13 @@ ForceBeamColumn3d::getInitialStiff(void)
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    static OPS_THREAD_LOCAL Vector dv(NEBD);
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    static OPS_THREAD_LOCAL Vector vin(NEBD);
     vin = v;
     vin -= dv;
     double L = crdTransf->getInitialLength();
@@ -513,10 +504,10 @@ ForceBeamColumn3d::getInitialStiff(void)
     double wt[maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    static OPS_THREAD_LOCAL Vector vr(NEBD);       // element residual displacements
+    static OPS_THREAD_LOCAL Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    static OPS_THREAD_LOCAL Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm 
     int i, j;
 
@@ -526,16 +517,16 @@ ForceBeamColumn3d::getInitialStiff(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    static OPS_THREAD_LOCAL Vector dSe(NEBD);
+    static OPS_THREAD_LOCAL Vector dvToDo(NEBD);
+    static OPS_THREAD_LOCAL Vector dvTrial(NEBD);
+    static OPS_THREAD_LOCAL Vector SeTrial(NEBD);
+    static OPS_THREAD_LOCAL Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    static OPS_THREAD_LOCAL double factor = 10;
     double dW0 = 0.0;
 
     maxSubdivisions = 10;
@@ -605,10 +596,10 @@ ForceBeamColumn3d::getInitialStiff(void)
 	      int order      = sections[i]->getOrder();
 	      const ID &code = sections[i]->getType();
 
-	      static Vector Ss;
-	      static Vector dSs;
-	      static Vector dvs;
-	      static Matrix fb;
+	      static OPS_THREAD_LOCAL Vector Ss;
+	      static OPS_THREAD_LOCAL Vector dSs;
+	      static OPS_THREAD_LOCAL Vector dvs;
+	      static OPS_THREAD_LOCAL Matrix fb;
 
 	      Ss.setData(workArea, order);
 	      dSs.setData(&workArea[order], order);
@@ -1781,13 +1772,13 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 					      Vector sectionDispls[]) const
   {
      // get basic displacements and increments
-     static Vector ub(NEBD);
+     static OPS_THREAD_LOCAL Vector ub(NEBD);
      ub = crdTransf->getBasicTrialDisp();    
 
      double L = crdTransf->getInitialLength();
 
      // get integration point positions and weights
-     static double pts[maxNumSections];
+     static OPS_THREAD_LOCAL double pts[maxNumSections];
      beamIntegr->getSectionLocations(numSections, L, pts);
 
      // setup Vandermode and CBDI influence matrices
@@ -1801,7 +1792,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      // get section curvatures
      Vector kappa_y(numSections);  // curvature
      Vector kappa_z(numSections);  // curvature
-     static Vector vs;                // section deformations 
+     static OPS_THREAD_LOCAL Vector vs;                // section deformations 
 
      for (i=0; i<numSections; i++) {
 	 // THIS IS VERY INEFFICIENT ... CAN CHANGE IF RUNS TOO SLOW
@@ -1836,8 +1827,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
      //cout << "kappa_z: " << kappa_z;   
 
      Vector v(numSections), w(numSections);
-     static Vector xl(NDM), uxb(NDM);
-     static Vector xg(NDM), uxg(NDM); 
+     static OPS_THREAD_LOCAL Vector xl(NDM), uxb(NDM);
+     static OPS_THREAD_LOCAL Vector xg(NDM), uxg(NDM); 
      // double theta;                             // angle of twist of the sections
 
      // v = ls * kappa_z;  
@@ -1908,9 +1899,9 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 
     // flag set to 2 used to print everything .. used for viewing data for UCSD renderer  
      else if (flag == 2) {
-       static Vector xAxis(3);
-       static Vector yAxis(3);
-       static Vector zAxis(3);
+       static OPS_THREAD_LOCAL Vector xAxis(3);
+       static OPS_THREAD_LOCAL Vector yAxis(3);
+       static OPS_THREAD_LOCAL Vector zAxis(3);
 
 
        crdTransf->getLocalAxes(xAxis, yAxis, zAxis);
@@ -1950,8 +1941,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 	 << T << ' ' << MY2 << ' '  <<  MZ2 << endln;
 
        // plastic hinge rotation
-       static Vector vp(6);
-       static Matrix fe(6,6);
+       static OPS_THREAD_LOCAL Vector vp(6);
+       static OPS_THREAD_LOCAL Matrix fe(6,6);
        this->getInitialFlexibility(fe);
        vp = crdTransf->getBasicTrialDisp();
        vp.addMatrixVector(1.0, fe, Se, -1.0);
@@ -2047,8 +2038,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
     const Vector &end1Crd = theNodes[0]->getCrds();
     const Vector &end2Crd = theNodes[1]->getCrds();	
 
-    static Vector v1(3);
-    static Vector v2(3);
+    static OPS_THREAD_LOCAL Vector v1(3);
+    static OPS_THREAD_LOCAL Vector v2(3);
 
     if (displayMode >= 0) {
       const Vector &end1Disp = theNodes[0]->getDisp();
@@ -2228,8 +2219,8 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
 int 
 ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
+  static OPS_THREAD_LOCAL Vector vp(6);
+  static OPS_THREAD_LOCAL Matrix fe(6,6);
 
   if (responseID == 1)
     return eleInfo.setVector(this->getResistingForce());
@@ -2290,7 +2281,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
+    static OPS_THREAD_LOCAL Vector LI(2);
     LI(0) = 0.0;
     LI(1) = 0.0;
 
@@ -2380,7 +2371,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static Vector d(4);
+    static OPS_THREAD_LOCAL Vector d(4);
     d(0) = d2z;
     d(1) = d3z;
     d(2) = d2y;
@@ -2494,7 +2485,7 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
 	indata.close();
       }
 
-      static Vector result8(2);
+      static OPS_THREAD_LOCAL Vector result8(2);
       result8(0) = value;
       result8(1) = checkvalue1;      
       
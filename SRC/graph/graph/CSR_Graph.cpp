@@ -0,0 +1,421 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/graph/CSR_Graph.cpp,v $
+                                                                        
+// File: ~/graph/graph/CSR_Graph.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of CSR_Graph.
+//
+// What: "@(#) CSR_Graph.cpp, revA"
+
+#include <CSR_Graph.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <ID.h>
+#include <ArrayOfTaggedObjects.h>
+#include <ThreadPool.h>
+#include <algorithm>
+
+//
+// the adjacency of a vertex is obtained by gathering the entries of the
+// IDs it appears in, then sorting them and removing the duplicates. the
+// count and fill passes share this task; in the count pass only the 
+// number of adjacent vertices is stored.
+//
+
+class CSR_GraphTask : public ThreadTask
+{
+  public:
+    CSR_GraphTask(int numVertex, const ID **theIDs, 
+		  const int *vertexIDsStart, const int *vertexIDs,
+		  int *start, int *adjacency, int numThreads);
+    ~CSR_GraphTask();
+
+    int run(int first, int last, int threadID);
+    
+  private:
+    int numVertex;
+    const ID **theIDs;
+    const int *vertexIDsStart;
+    const int *vertexIDs;
+    int *start;
+    int *adjacency;    // 0 in the count pass
+
+    int numThreads;
+    int **work;
+    int *workSize;
+};
+
+CSR_GraphTask::CSR_GraphTask(int nV, const ID **IDs, 
+			     const int *vIDsStart, const int *vIDs,
+			     int *theStart, int *theAdjacency, int nT)
+  :numVertex(nV), theIDs(IDs), vertexIDsStart(vIDsStart), vertexIDs(vIDs),
+   start(theStart), adjacency(theAdjacency), numThreads(nT)
+{
+  work = new int *[numThreads];
+  workSize = new int[numThreads];
+  for (int i=0; i<numThreads; i++) {
+    work[i] = 0;
+    workSize[i] = 0;
+  }
+}
+
+CSR_GraphTask::~CSR_GraphTask()
+{
+  for (int i=0; i<numThreads; i++)
+    if (work[i] != 0)
+      delete [] work[i];
+  delete [] work;
+  delete [] workSize;
+}
+
+int
+CSR_GraphTask::run(int first, int last, int threadID)
+{
+  for (int vertex=first; vertex<last; vertex++) {
+
+    // make sure the work array can hold all entries of the IDs
+    int numEntries = 0;
+    for (int j=vertexIDsStart[vertex]; j<vertexIDsStart[vertex+1]; j++)
+      numEntries += theIDs[vertexIDs[j]]->Size();
+
+    if (numEntries > workSize[threadID]) {
+      if (work[threadID] != 0)
+	delete [] work[threadID];
+      work[threadID] = new int[2*numEntries];
+      workSize[threadID] = 2*numEntries;
+    }
+    int *theWork = work[threadID];
+    
+    // gather
+    int numAdjacent = 0;
+    for (int j=vertexIDsStart[vertex]; j<vertexIDsStart[vertex+1]; j++) {
+      const ID &theID = *(theIDs[vertexIDs[j]]);
+      int size = theID.Size();
+      for (int k=0; k<size; k++) {
+	int other = theID(k);
+	if (other >= 0 && other < numVertex && other != vertex)
+	  theWork[numAdjacent++] = other;
+      }
+    }
+
+    // sort and remove the duplicates
+    std::sort(theWork, theWork+numAdjacent);
+    numAdjacent = std::unique(theWork, theWork+numAdjacent) - theWork;
+
+    if (adjacency == 0)
+      start[vertex+1] = numAdjacent;
+    else {
+      int *theAdjacency = &adjacency[start[vertex]];
+      for (int k=0; k<numAdjacent; k++)
+	theAdjacency[k] = theWork[k];
+    }
+  }
+
+  return 0;
+}
+
+
+CSR_Graph::CSR_Graph()
+  :numVertex(0), start(0), adjacency(0), weights(0), theGraph(0)
+{
+
+}
+
+CSR_Graph::~CSR_Graph()
+{
+  this->clear();
+}
+
+void
+CSR_Graph::clear(void)
+{
+  if (start != 0)
+    delete [] start;
+  if (adjacency != 0)
+    delete [] adjacency;
+  if (weights != 0)
+    delete [] weights;
+  if (theGraph != 0)
+    delete theGraph;
+
+  numVertex = 0;
+  start = 0;
+  adjacency = 0;
+  weights = 0;
+  theGraph = 0;
+}
+
+int
+CSR_Graph::build(int nV, const ID **theIDs, int numID, ThreadPool *thePool)
+{
+  this->clear();
+
+  if (nV <= 0)
+    return 0;
+
+  numVertex = nV;
+  start = new int[numVertex+1];
+  if (start == 0) {
+    opserr << "WARNING CSR_Graph::build() - out of memory\n";
+    numVertex = 0;
+    return -1;
+  }
+
+  //
+  // first determine for each vertex the IDs in which it appears
+  //
+
+  int *vertexIDsStart = new int[numVertex+1];
+  for (int i=0; i<=numVertex; i++)
+    vertexIDsStart[i] = 0;
+
+  for (int i=0; i<numID; i++) {
+    const ID &theID = *(theIDs[i]);
+    int size = theID.Size();
+    for (int j=0; j<size; j++) {
+      int vertex = theID(j);
+      if (vertex >= 0 && vertex < numVertex)
+	vertexIDsStart[vertex+1]++;
+    }
+  }
+
+  for (int i=0; i<numVertex; i++)
+    vertexIDsStart[i+1] += vertexIDsStart[i];
+
+  int *vertexIDs = new int[vertexIDsStart[numVertex]+1];
+  int *next = new int[numVertex];
+  for (int i=0; i<numVertex; i++)
+    next[i] = vertexIDsStart[i];
+
+  for (int i=0; i<numID; i++) {
+    const ID &theID = *(theIDs[i]);
+    int size = theID.Size();
+    for (int j=0; j<size; j++) {
+      int vertex = theID(j);
+      if (vertex >= 0 && vertex < numVertex)
+	vertexIDs[next[vertex]++] = i;
+    }
+  }
+  delete [] next;
+
+  //
+  // count pass, then the fill pass into storage of the exact size
+  //
+
+  int numThreads = (thePool != 0) ? thePool->getNumThreads() : 1;
+  int result = 0;
+
+  start[0] = 0;
+  CSR_GraphTask countTask(numVertex, theIDs, vertexIDsStart, vertexIDs, 
+			  start, 0, numThreads);
+  if (thePool != 0)
+    result = thePool->execute(countTask, numVertex);
+  else
+    result = countTask.run(0, numVertex, 0);
+
+  for (int i=0; i<numVertex; i++)
+    start[i+1] += start[i];
+
+  adjacency = new int[start[numVertex]+1];
+  if (adjacency == 0) {
+    opserr << "WARNING CSR_Graph::build() - out of memory for " << start[numVertex] << " entries\n";
+    result = -1;
+  }
+
+  if (result == 0) {
+    CSR_GraphTask fillTask(numVertex, theIDs, vertexIDsStart, vertexIDs, 
+			   start, adjacency, numThreads);
+    if (thePool != 0)
+      result = thePool->execute(fillTask, numVertex);
+    else
+      result = fillTask.run(0, numVertex, 0);
+  }
+
+  delete [] vertexIDsStart;
+  delete [] vertexIDs;
+
+  if (result != 0)
+    this->clear();
+
+  return result;
+}
+
+int
+CSR_Graph::build(Graph &theGraph)
+{
+  this->clear();
+
+  int nV = theGraph.getNumVertex();
+  if (nV <= 0)
+    return 0;
+
+  // check the tags and count the entries
+  int nnz = 0;
+  for (int i=0; i<nV; i++) {
+    Vertex *vertexPtr = theGraph.getVertexPtr(i);
+    if (vertexPtr == 0) {
+      opserr << "WARNING CSR_Graph::build() - vertex " << i << " not in the Graph\n";
+      return -1;
+    }
+    nnz += vertexPtr->getAdjacency().Size();
+  }
+
+  numVertex = nV;
+  start = new int[numVertex+1];
+  adjacency = new int[nnz+1];
+  if (start == 0 || adjacency == 0) {
+    opserr << "WARNING CSR_Graph::build() - out of memory\n";
+    this->clear();
+    return -1;
+  }
+
+  start[0] = 0;
+  for (int i=0; i<numVertex; i++) {
+    const ID &theAdjacency = theGraph.getVertexPtr(i)->getAdjacency();
+    int size = theAdjacency.Size();
+    int *theEntries = &adjacency[start[i]];
+    int numAdjacent = 0;
+    for (int j=0; j<size; j++) 
+      if (theAdjacency(j) >= 0 && theAdjacency(j) < numVertex && theAdjacency(j) != i)
+	theEntries[numAdjacent++] = theAdjacency(j);
+    std::sort(theEntries, theEntries+numAdjacent);
+    start[i+1] = start[i] + numAdjacent;
+  }
+
+  return 0;
+}
+
+int
+CSR_Graph::setWeights(const ID &theWeights)
+{
+  if (theWeights.Size() != numVertex) {
+    opserr << "WARNING CSR_Graph::setWeights() - size " << theWeights.Size() << " not numVertex " << numVertex << endln;
+    return -1;
+  }
+
+  if (weights == 0)
+    weights = new int[numVertex];
+  for (int i=0; i<numVertex; i++)
+    weights[i] = theWeights(i);
+
+  return 0;
+}
+
+int
+CSR_Graph::getWeight(int vertex) const
+{
+  if (weights == 0)
+    return 1;
+  return weights[vertex];
+}
+
+int
+CSR_Graph::getNumVertex(void) const
+{
+  return numVertex;
+}
+
+int
+CSR_Graph::getNumEdge(void) const
+{
+  if (start == 0)
+    return 0;
+  return start[numVertex]/2;
+}
+
+int
+CSR_Graph::getDegree(int vertex) const
+{
+  if (vertex < 0 || vertex >= numVertex)
+    return 0;
+  return start[vertex+1] - start[vertex];
+}
+
+const int *
+CSR_Graph::getStart(void) const
+{
+  return start;
+}
+
+const int *
+CSR_Graph::getAdjacency(void) const
+{
+  return adjacency;
+}
+
+// adds the edges to a Graph that already holds the vertices; as the
+// adjacencies are sorted each Vertex adjacency is built by appending
+int
+CSR_Graph::addEdges(Graph &theGraph) const
+{
+  for (int i=0; i<numVertex; i++) 
+    for (int j=start[i]; j<start[i+1]; j++) {
+      int other = adjacency[j];
+      if (other > i)
+	if (theGraph.addEdge(i, other) < 0)
+	  return -1;
+    }
+  
+  return 0;
+}
+
+Graph &
+CSR_Graph::getGraph(void)
+{
+  if (theGraph != 0)
+    return *theGraph;
+
+  ArrayOfTaggedObjects *graphStorage = new ArrayOfTaggedObjects(numVertex+1);
+  theGraph = new Graph(*graphStorage);
+
+  for (int i=0; i<numVertex; i++) {
+    Vertex *vertexPtr = new Vertex(i, i);
+    if (vertexPtr == 0 || theGraph->addVertex(vertexPtr, false) == false) {
+      opserr << "WARNING CSR_Graph::getGraph() - error adding vertex " << i << endln;
+      return *theGraph;
+    }
+  }
+
+  this->addEdges(*theGraph);
+
+  return *theGraph;
+}
+
+void
+CSR_Graph::Print(OPS_Stream &s, int flag)
+{
+  s << "CSR_Graph: numVertex: " << numVertex << " numEdge: " << this->getNumEdge() << endln;
+  if (flag == 0)
+    return;
+
+  for (int i=0; i<numVertex; i++) {
+    s << i << ": ";
+    for (int j=start[i]; j<start[i+1]; j++)
+      s << adjacency[j] << " ";
+    s << endln;
+  }
+}
@@ -0,0 +1,90 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/graph/CSR_Graph.h,v $
+                                                                        
+// File: ~/graph/graph/CSR_Graph.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for CSR_Graph.
+// CSR_Graph is a compact, read-only graph in compressed sparse row form:
+// the vertices are 0 through numVertex-1 and the sorted adjacency of
+// vertex i is adjacency[start[i]] through adjacency[start[i+1]-1]. The
+// graph is built in two passes (count, then fill) from a set of IDs, 
+// the entries of each ID being mutually adjacent, so the memory used is
+// proportional to the number of edges. The vertices can be processed by 
+// the threads of a ThreadPool. getGraph() returns an equivalent Graph
+// for the objects that work on the Vertex based representation.
+//
+// What: "@(#) CSR_Graph.h, revA"
+
+#ifndef CSR_Graph_h
+#define CSR_Graph_h
+
+#include <OPS_Stream.h>
+
+class ID;
+class Graph;
+class ThreadPool;
+
+class CSR_Graph
+{
+  public:
+    CSR_Graph();
+    ~CSR_Graph();
+
+    // entries of theIDs outside [0, numVertex) are ignored
+    int build(int numVertex, const ID **theIDs, int numID, 
+	      ThreadPool *thePool = 0);
+    // the vertex tags of theGraph must be 0 through numVertex-1
+    int build(Graph &theGraph);
+    void clear(void);
+
+    int getNumVertex(void) const;
+    int getNumEdge(void) const;
+    int getDegree(int vertex) const;
+    const int *getStart(void) const;
+    const int *getAdjacency(void) const;
+
+    // optional integer vertex weights, all 1 if not set
+    int setWeights(const ID &theWeights);
+    int getWeight(int vertex) const;
+
+    // methods to obtain the Vertex based representation
+    int addEdges(Graph &theGraph) const;
+    Graph &getGraph(void);
+
+    void Print(OPS_Stream &s, int flag =0);
+    
+  protected:
+    
+  private:
+    int numVertex;
+    int *start;        // size numVertex+1
+    int *adjacency;    // size start[numVertex]
+    int *weights;      // 0 or size numVertex
+    Graph *theGraph;   // created by getGraph()
+};
+
+#endif
@@ -31,6 +31,7 @@
 
 #include <AMDNumberer.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <ID.h>
@@ -105,6 +106,31 @@ AMD::number(Graph &theGraph, int startVertex)
 
 
 
+// the CSR arrays are passed directly to amd_order()
+const ID &
+AMD::number(CSR_Graph &theGraph, int startVertex)
+{
+  int numVertex = theGraph.getNumVertex();
+
+  if (numVertex == 0) 
+    return theResult;
+
+  theResult.resize(numVertex);
+
+  int *P = new int[numVertex];
+
+  amd_order(numVertex, theGraph.getStart(), theGraph.getAdjacency(), P, 
+	    (double *)NULL, (double *)NULL);
+  
+  for (int i=0; i<numVertex; i++)
+    theResult[i] = P[i];
+
+  delete [] P;
+
+  return theResult;
+}
+
+
 int
 AMD::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -0,0 +1,217 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/numberer/AutoNumberer.cpp,v $
+                                                                        
+// File: ~/graph/numberer/AutoNumberer.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of AutoNumberer.
+//
+// What: "@(#) AutoNumberer.cpp, revA"
+
+#include <AutoNumberer.h>
+#include <SimpleNumberer.h>
+#include <RCM.h>
+#include <AMDNumberer.h>
+#include <NestedDissection.h>
+#include <CSR_Graph.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+static const char *candidateNames[] = {"Plain", "RCM", "AMD", "NestedDissection"};
+
+AutoNumberer::AutoNumberer(int crit, bool print)
+:GraphNumberer(GraphNUMBERER_TAG_Auto), criterion(crit), printCosts(print)
+{
+  theCandidates[0] = new SimpleNumberer();
+  theCandidates[1] = new RCM(false);
+  theCandidates[2] = new AMD();
+  theCandidates[3] = new NestedDissection();
+}
+
+AutoNumberer::~AutoNumberer()
+{
+  for (int i=0; i<numCandidates; i++)
+    if (theCandidates[i] != 0)
+      delete theCandidates[i];
+}
+
+const ID &
+AutoNumberer::number(Graph &theGraph, int lastVertex)
+{
+  CSR_Graph theCSR_Graph;
+  if (theCSR_Graph.build(theGraph) < 0) {
+    // the candidates need the vertices 0 through numVertex-1, use RCM
+    return theCandidates[1]->number(theGraph, lastVertex);
+  }
+
+  int numVertex = theCSR_Graph.getNumVertex();
+  ID theWeights(numVertex);
+  for (int i=0; i<numVertex; i++) {
+    int numDOF = theGraph.getVertexPtr(i)->getColor();
+    theWeights(i) = (numDOF > 0) ? numDOF : 1;
+  }
+  theCSR_Graph.setWeights(theWeights);
+
+  return this->number(theCSR_Graph, lastVertex);
+}
+
+const ID &
+AutoNumberer::number(Graph &theGraph, const ID &lastVertices)
+{
+  opserr << "WARNING:  AutoNumberer::number - Not implemented with lastVertices";
+  return theResult;
+}
+
+const ID &
+AutoNumberer::number(CSR_Graph &theGraph, int lastVertex)
+{
+  int numVertex = theGraph.getNumVertex();
+  theResult.resize(numVertex);
+
+  double bestCost = -1.0;
+  int best = -1;
+
+  for (int i=0; i<numCandidates; i++) {
+    const ID &theNumbering = theCandidates[i]->number(theGraph, lastVertex);
+    if (theNumbering.Size() != numVertex)
+      continue;
+
+    double cost = this->getCost(theGraph, theNumbering, bestCost);
+    if (printCosts == true) {
+      opserr << "AutoNumberer - " << candidateNames[i] << " cost: ";
+      if (criterion == AUTO_NUMBERER_FILL && best >= 0 && cost > bestCost)
+	opserr << "> " << bestCost << endln; // fill computation stopped
+      else
+	opserr << cost << endln;
+    }
+
+    if (best < 0 || cost < bestCost) {
+      theResult = theNumbering;
+      bestCost = cost;
+      best = i;
+    }
+  }
+
+  if (best < 0) 
+    opserr << "WARNING AutoNumberer::number - no numbering obtained\n";
+  else if (printCosts == true)
+    opserr << "AutoNumberer - using " << candidateNames[best] << endln;
+
+  return theResult;
+}
+
+double
+AutoNumberer::getCost(CSR_Graph &theGraph, const ID &theNumbering, double bound)
+{
+  int numVertex = theGraph.getNumVertex();
+  if (theNumbering.Size() != numVertex)
+    return -1.0;
+
+  const int *start = theGraph.getStart();
+  const int *adjacency = theGraph.getAdjacency();
+
+  // position of each vertex and the equations before each position
+  int *pos = new int[numVertex];
+  double *eqnStart = new double[numVertex+1];
+  eqnStart[0] = 0.0;
+  for (int k=0; k<numVertex; k++) {
+    pos[theNumbering(k)] = k;
+    eqnStart[k+1] = eqnStart[k] + theGraph.getWeight(theNumbering(k));
+  }
+
+  double cost = 0.0;
+
+  if (criterion == AUTO_NUMBERER_FILL) {
+
+    // the entries in the factor are found from the elimination tree, the
+    // column entries of row k are those reached from the lower entries 
+    // of row k going up the tree
+    int *parent = new int[numVertex];
+    int *flag = new int[numVertex];
+
+    for (int k=0; k<numVertex && (bound <= 0.0 || cost <= bound); k++) {
+      int vertex = theNumbering(k);
+      double weight = theGraph.getWeight(vertex);
+      parent[k] = -1;
+      flag[k] = k;
+      cost += 0.5*weight*(weight+1.0);
+
+      for (int j=start[vertex]; j<start[vertex+1]; j++) {
+	int i = pos[adjacency[j]];
+	if (i < k) {
+	  for ( ; flag[i] != k; i = parent[i]) {
+	    if (parent[i] == -1)
+	      parent[i] = k;
+	    cost += weight * theGraph.getWeight(theNumbering(i));
+	    flag[i] = k;
+	  }
+	}
+      }
+    }
+
+    delete [] parent;
+    delete [] flag;
+
+  } else {
+
+    // the height of a column is set by the first entry in it
+    for (int k=0; k<numVertex; k++) {
+      int vertex = theNumbering(k);
+      double weight = theGraph.getWeight(vertex);
+      int minPos = k;
+      for (int j=start[vertex]; j<start[vertex+1]; j++)
+	if (pos[adjacency[j]] < minPos)
+	  minPos = pos[adjacency[j]];
+
+      if (criterion == AUTO_NUMBERER_BANDWIDTH) {
+	double bandwidth = eqnStart[k+1] - 1.0 - eqnStart[minPos];
+	if (bandwidth > cost)
+	  cost = bandwidth;
+      } else
+	cost += weight*(eqnStart[k] - eqnStart[minPos]) + 0.5*weight*(weight+1.0);
+    }
+  }
+
+  delete [] pos;
+  delete [] eqnStart;
+
+  return cost;
+}
+
+int
+AutoNumberer::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+AutoNumberer::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
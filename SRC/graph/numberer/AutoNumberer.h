@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/numberer/AutoNumberer.h,v $
+                                                                        
+// File: ~/graph/numberer/AutoNumberer.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for AutoNumberer.
+// AutoNumberer is a GraphNumberer which numbers the graph in the plain
+// order and with RCM, AMD and NestedDissection, and keeps the numbering 
+// with the smallest predicted cost: the profile or the bandwidth of the 
+// matrix for profile and band solvers, the number of entries in the
+// Cholesky factor for sparse solvers. The cost counts the vertex weights of the CSR_Graph, which for
+// a Graph are taken from the vertex colors (the number of DOF of a 
+// DOF_Group in the AnalysisModel DOF_Group graph).
+//
+// What: "@(#) AutoNumberer.h, revA"
+
+#ifndef AutoNumberer_h
+#define AutoNumberer_h
+
+#include <GraphNumberer.h>
+#include <ID.h>
+
+#define AUTO_NUMBERER_PROFILE   1
+#define AUTO_NUMBERER_BANDWIDTH 2
+#define AUTO_NUMBERER_FILL      3
+
+class AutoNumberer: public GraphNumberer
+{
+  public:
+    AutoNumberer(int criterion = AUTO_NUMBERER_PROFILE, bool printCosts = false); 
+    ~AutoNumberer();
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(CSR_Graph &theGraph, int lastVertex = -1);
+
+    // the predicted cost of theNumbering, the computation of the fill
+    // stops once bound is exceeded if bound > 0
+    double getCost(CSR_Graph &theGraph, const ID &theNumbering, 
+		   double bound = 0.0);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+    
+  private:
+    int criterion;
+    bool printCosts;
+
+    enum {numCandidates = 4};
+    GraphNumberer *theCandidates[numCandidates];
+    ID theResult;
+};
+
+#endif
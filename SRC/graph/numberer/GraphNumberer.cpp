@@ -33,6 +33,9 @@
 
 
 #include <GraphNumberer.h>
+#include <CSR_Graph.h>
+#include <Graph.h>
+
 GraphNumberer::GraphNumberer(int cTag)
 :MovableObject(cTag)
 {
@@ -44,6 +47,12 @@ GraphNumberer::~GraphNumberer()
     // does nothing
 }
 
+const ID &
+GraphNumberer::number(CSR_Graph &theGraph, int lastVertex)
+{
+    return this->number(theGraph.getGraph(), lastVertex);
+}
+
 
 
 
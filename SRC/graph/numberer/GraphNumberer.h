@@ -41,6 +41,7 @@
 
 class ID;
 class Graph;
+class CSR_Graph;
 class Channel;
 class ObjectBroker;
 
@@ -52,6 +53,10 @@ class GraphNumberer : public MovableObject
     
     virtual const ID &number(Graph &theGraph, int lastVertex = -1) =0;
     virtual const ID &number(Graph &theGraph, const ID &lastVertices) =0;
+
+    // numbers the vertices 0 through numVertex-1 of a CSR_Graph, by 
+    // default through the Graph the CSR_Graph provides
+    virtual const ID &number(CSR_Graph &theGraph, int lastVertex = -1);
     
   protected:
     
@@ -0,0 +1,304 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/numberer/NestedDissection.cpp,v $
+                                                                        
+// File: ~/graph/numberer/NestedDissection.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of NestedDissection.
+//
+// What: "@(#) NestedDissection.cpp, revA"
+
+#include <NestedDissection.h>
+#include <CSR_Graph.h>
+#include <Graph.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <vector>
+
+//
+// level structure of the subgraph formed by the vertices with mark == label,
+// rooted at root. the vertices are placed in queue in level order and the 
+// number of vertices reached is returned in numReached. the caller resets
+// level to -1 for the vertices in queue.
+//
+
+static int
+levelStructure(int root, int label, const int *start, const int *adjacency,
+	       const int *mark, int *level, int *queue, int &numReached)
+{
+  queue[0] = root;
+  level[root] = 0;
+  int numInQueue = 1;
+  int head = 0;
+
+  while (head < numInQueue) {
+    int vertex = queue[head++];
+    int nextLevel = level[vertex] + 1;
+    for (int j=start[vertex]; j<start[vertex+1]; j++) {
+      int other = adjacency[j];
+      if (mark[other] == label && level[other] < 0) {
+	level[other] = nextLevel;
+	queue[numInQueue++] = other;
+      }
+    }
+  }
+
+  numReached = numInQueue;
+  return level[queue[numInQueue-1]] + 1;
+}
+
+static void
+resetLevels(int *level, const int *queue, int numInQueue)
+{
+  for (int i=0; i<numInQueue; i++)
+    level[queue[i]] = -1;
+}
+
+
+NestedDissection::NestedDissection(int leaf)
+:GraphNumberer(GraphNUMBERER_TAG_NestedDissection), leafSize(leaf)
+{
+  if (leafSize < 2)
+    leafSize = 2;
+}
+
+NestedDissection::~NestedDissection()
+{
+
+}
+
+const ID &
+NestedDissection::number(Graph &theGraph, int lastVertex)
+{
+  CSR_Graph theCSR_Graph;
+  if (theCSR_Graph.build(theGraph) < 0) {
+    opserr << "WARNING NestedDissection::number - vertex tags of the Graph must be 0 through numVertex-1\n";
+    theResult.resize(0);
+    return theResult;
+  }
+
+  return this->number(theCSR_Graph, lastVertex);
+}
+
+const ID &
+NestedDissection::number(Graph &theGraph, const ID &lastVertices)
+{
+  opserr << "WARNING:  NestedDissection::number - Not implemented with lastVertices";
+  return theResult;
+}
+
+const ID &
+NestedDissection::number(CSR_Graph &theGraph, int lastVertex)
+{
+  int numVertex = theGraph.getNumVertex();
+  theResult.resize(numVertex);
+
+  if (numVertex == 0) 
+    return theResult;
+
+  const int *start = theGraph.getStart();
+  const int *adjacency = theGraph.getAdjacency();
+
+  // list holds the vertices of each subgraph in a contiguous range, once
+  // all ranges are processed it holds the new numbering
+  int *list = new int[numVertex];
+  int *mark = new int[numVertex];
+  int *level = new int[numVertex];
+  int *queue = new int[numVertex];
+  int *work = new int[numVertex];
+
+  for (int i=0; i<numVertex; i++) {
+    list[i] = i;
+    mark[i] = 0;
+    level[i] = -1;
+  }
+
+  std::vector<int> ranges;
+  ranges.push_back(0);
+  ranges.push_back(numVertex);
+  int label = 0;
+
+  while (ranges.empty() == false) {
+    int hi = ranges.back(); ranges.pop_back();
+    int lo = ranges.back(); ranges.pop_back();
+    int numSub = hi - lo;
+    if (numSub < 2)
+      continue;
+
+    label++;
+    for (int i=lo; i<hi; i++)
+      mark[list[i]] = label;
+
+    //
+    // level structure from a pseudo-peripheral vertex
+    //
+
+    int root = list[lo];
+    int numReached = 0;
+    int numLevels = levelStructure(root, label, start, adjacency, mark, 
+				   level, queue, numReached);
+
+    for (int iter=0; iter<8 && numLevels > 1; iter++) {
+      int candidate = -1;
+      int minDegree = 0;
+      for (int i=numReached-1; i>=0 && level[queue[i]] == numLevels-1; i--) {
+	int degree = start[queue[i]+1] - start[queue[i]];
+	if (candidate < 0 || degree < minDegree) {
+	  candidate = queue[i];
+	  minDegree = degree;
+	}
+      }
+      resetLevels(level, queue, numReached);
+      int candidateLevels = levelStructure(candidate, label, start, adjacency, 
+					   mark, level, queue, numReached);
+      root = candidate;
+      bool improved = (candidateLevels > numLevels);
+      numLevels = candidateLevels;
+      if (improved == false)
+	break;
+    }
+
+    //
+    // a disconnected subgraph is split into the component reached and the rest
+    //
+
+    if (numReached < numSub) {
+      int numRest = 0;
+      for (int i=lo; i<hi; i++)
+	if (level[list[i]] < 0)
+	  work[numRest++] = list[i];
+      for (int i=0; i<numReached; i++)
+	list[lo+i] = queue[i];
+      for (int i=0; i<numRest; i++)
+	list[lo+numReached+i] = work[i];
+      resetLevels(level, queue, numReached);
+
+      ranges.push_back(lo);
+      ranges.push_back(lo+numReached);
+      ranges.push_back(lo+numReached);
+      ranges.push_back(hi);
+      continue;
+    }
+
+    //
+    // small or nearly complete subgraphs are numbered in reverse
+    // Cuthill-McKee order
+    //
+
+    if (numSub <= leafSize || numLevels < 3) {
+      for (int i=0; i<numSub; i++)
+	list[lo+i] = queue[numSub-1-i];
+      resetLevels(level, queue, numReached);
+      continue;
+    }
+
+    //
+    // the separator is the level splitting the weight in two, vertices of
+    // it with no neighbours beyond it are moved to the first part
+    //
+
+    double totalWeight = 0.0;
+    for (int i=0; i<numSub; i++)
+      totalWeight += theGraph.getWeight(queue[i]);
+
+    int sepLevel = 1;
+    double weight = 0.0;
+    for (int i=0; i<numSub; i++) {
+      weight += theGraph.getWeight(queue[i]);
+      if (weight >= 0.5*totalWeight) {
+	sepLevel = level[queue[i]];
+	break;
+      }
+    }
+    if (sepLevel < 1)
+      sepLevel = 1;
+    if (sepLevel > numLevels-2)
+      sepLevel = numLevels-2;
+
+    for (int i=0; i<numSub; i++) {
+      int vertex = queue[i];
+      if (level[vertex] == sepLevel) {
+	bool connected = false;
+	for (int j=start[vertex]; j<start[vertex+1] && connected == false; j++) {
+	  int other = adjacency[j];
+	  if (mark[other] == label && level[other] == sepLevel+1)
+	    connected = true;
+	}
+	if (connected == false)
+	  level[vertex] = sepLevel-1;
+      }
+    }
+
+    int loc = lo;
+    for (int i=0; i<numSub; i++)
+      if (level[queue[i]] < sepLevel)
+	list[loc++] = queue[i];
+    int numFirst = loc - lo;
+    for (int i=0; i<numSub; i++)
+      if (level[queue[i]] > sepLevel)
+	list[loc++] = queue[i];
+    int numSecond = loc - lo - numFirst;
+    for (int i=0; i<numSub; i++)
+      if (level[queue[i]] == sepLevel)
+	list[loc++] = queue[i];
+
+    resetLevels(level, queue, numReached);
+
+    ranges.push_back(lo);
+    ranges.push_back(lo+numFirst);
+    ranges.push_back(lo+numFirst);
+    ranges.push_back(lo+numFirst+numSecond);
+  }
+
+  // if requested lastVertex is numbered last
+  int loc = 0;
+  for (int i=0; i<numVertex; i++)
+    if (list[i] != lastVertex)
+      theResult(loc++) = list[i];
+  if (loc < numVertex)
+    theResult(loc) = lastVertex;
+
+  delete [] list;
+  delete [] mark;
+  delete [] level;
+  delete [] queue;
+  delete [] work;
+
+  return theResult;
+}
+
+int
+NestedDissection::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+NestedDissection::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
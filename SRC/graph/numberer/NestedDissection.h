@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/numberer/NestedDissection.h,v $
+                                                                        
+// File: ~/graph/numberer/NestedDissection.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for NestedDissection.
+// NestedDissection is a GraphNumberer which orders the vertices by 
+// recursive bisection of the graph. Each subgraph is split by the middle
+// level of a level structure rooted at a pseudo-peripheral vertex; the 
+// two parts are numbered first and the separator last. Subgraphs smaller
+// than leafSize are numbered in Cuthill-McKee order. The numbering works
+// on the CSR arrays of a CSR_Graph, a Graph is first copied to one.
+//
+// What: "@(#) NestedDissection.h, revA"
+
+#ifndef NestedDissection_h
+#define NestedDissection_h
+
+#include <GraphNumberer.h>
+#include <ID.h>
+
+class NestedDissection: public GraphNumberer
+{
+  public:
+    NestedDissection(int leafSize = 64); 
+    ~NestedDissection();
+
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(CSR_Graph &theGraph, int lastVertex = -1);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+    
+  private:
+    int leafSize;
+    ID theResult;
+};
+
+#endif
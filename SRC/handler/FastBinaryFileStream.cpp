@@ -0,0 +1,503 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/FastBinaryFileStream.cpp,v $
+
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// FastBinaryFileStream.
+//
+// What: "@(#) FastBinaryFileStream.cpp, revA"
+
+#include <FastBinaryFileStream.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <Message.h>
+#include <classTags.h>
+
+#include <string.h>
+
+static bool
+isBigEndian(void)
+{
+  int one = 1;
+  return (*((char *)&one) == 0);
+}
+
+// copy n values of numBytes each into to, little-endian
+static void
+copyLittleEndian(char *to, const void *from, int n, int numBytes)
+{
+  if (isBigEndian() == false) {
+    memcpy(to, from, n*numBytes);
+    return;
+  }
+
+  const char *fromC = (const char *)from;
+  for (int i=0; i<n; i++) 
+    for (int j=0; j<numBytes; j++)
+      to[i*numBytes+j] = fromC[i*numBytes+numBytes-1-j];
+}
+
+FastBinaryFileStream::FastBinaryFileStream()
+  :OPS_Stream(OPS_STREAM_TAGS_FastBinaryFileStream), 
+   theFile(0), fileOpen(0), theOpenMode(OVERWRITE), fileName(0), numColumns(-1),
+   bufferSize(4194304), numBuffers(3), theBuffers(0), bufferFill(0), currentBuffer(-1),
+   theQueue(0), queueStart(0), queueCount(0), freeBuffers(0), numFree(0), writeError(0), sendSelfCount(0)
+{
+#ifndef _WIN32
+  writerRunning = false;
+  shutdown = false;
+#endif
+}
+
+FastBinaryFileStream::FastBinaryFileStream(const char *file, openMode mode, 
+					   int size, int num)
+  :OPS_Stream(OPS_STREAM_TAGS_FastBinaryFileStream), 
+   theFile(0), fileOpen(0), theOpenMode(OVERWRITE), fileName(0), numColumns(-1),
+   bufferSize(size), numBuffers(num), theBuffers(0), bufferFill(0), currentBuffer(-1),
+   theQueue(0), queueStart(0), queueCount(0), freeBuffers(0), numFree(0), writeError(0), sendSelfCount(0)
+{
+#ifndef _WIN32
+  writerRunning = false;
+  shutdown = false;
+#endif
+
+  if (bufferSize < 4096)
+    bufferSize = 4096;
+  if (numBuffers < 2)
+    numBuffers = 2;
+
+  this->setFile(file, mode);
+}
+
+FastBinaryFileStream::~FastBinaryFileStream()
+{
+  // makes sure all is written
+  this->close();
+
+  if (theBuffers != 0) {
+    for (int i=0; i<numBuffers; i++)
+      if (theBuffers[i] != 0)
+	delete [] theBuffers[i];
+    delete [] theBuffers;
+    delete [] bufferFill;
+    delete [] theQueue;
+    delete [] freeBuffers;
+  }
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int 
+FastBinaryFileStream::setFile(const char *name, openMode mode)
+{
+  if (name == 0) {
+    opserr << "FastBinaryFileStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  // if file already open, close it
+  if (fileOpen == 1)
+    this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+
+  fileName = new char[strlen(name)+5];
+  if (fileName == 0) {
+    opserr << "FastBinaryFileStream::setFile() - out of memory copying name: " << name << endln;
+    return -1;
+  }
+  strcpy(fileName, name);
+
+  theOpenMode = mode;
+
+  return 0;
+}
+
+int 
+FastBinaryFileStream::open(void)
+{
+  // check setFile has been called
+  if (fileName == 0) {
+    opserr << "FastBinaryFileStream::open(void) - no file name has been set\n";
+    return -1;
+  }
+
+  // if file already open, return
+  if (fileOpen == 1)
+    return 0;
+
+  if (theOpenMode == OVERWRITE) 
+    theFile = fopen(fileName, "wb");
+  else
+    theFile = fopen(fileName, "ab");
+
+  if (theFile == 0) {
+    opserr << "WARNING - FastBinaryFileStream::open()";
+    opserr << " - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  // appending to a file gives a second header, so the number of
+  // columns may differ from what was there before
+  theOpenMode = APPEND;
+  numColumns = -1;
+  writeError = 0;
+
+  // get the buffers
+  if (theBuffers == 0) {
+    theBuffers = new char *[numBuffers];
+    bufferFill = new int[numBuffers];
+    theQueue = new int[numBuffers];
+    freeBuffers = new int[numBuffers];
+    if (theBuffers == 0 || bufferFill == 0 || theQueue == 0 || freeBuffers == 0) {
+      opserr << "WARNING - FastBinaryFileStream::open() - out of memory\n";
+      fclose(theFile);
+      theFile = 0;
+      return -2;
+    }
+    for (int i=0; i<numBuffers; i++) {
+      theBuffers[i] = new char[bufferSize];
+      if (theBuffers[i] == 0) {
+	opserr << "WARNING - FastBinaryFileStream::open() - out of memory\n";
+	fclose(theFile);
+	theFile = 0;
+	return -2;
+      }
+    }
+  }
+
+  for (int i=0; i<numBuffers; i++) {
+    bufferFill[i] = 0;
+    freeBuffers[i] = i;
+  }
+  numFree = numBuffers;
+  queueStart = 0;
+  queueCount = 0;
+  currentBuffer = -1;
+
+#ifndef _WIN32
+  // start the writer
+  pthread_mutex_init(&theMutex, 0);
+  pthread_cond_init(&workCond, 0);
+  pthread_cond_init(&freeCond, 0);
+  shutdown = false;
+  if (pthread_create(&theWriter, 0, FastBinaryFileStream::writerMain, this) == 0)
+    writerRunning = true;
+  else {
+    opserr << "WARNING - FastBinaryFileStream::open() - could not start writer thread";
+    opserr << ", will write from the calling thread\n";
+    writerRunning = false;
+  }
+#endif
+
+  fileOpen = 1;
+
+  return 0;
+}
+
+int 
+FastBinaryFileStream::close(void)
+{
+  if (fileOpen == 0)
+    return 0;
+
+  // hand over what is left and wait for it all to be written
+  if (currentBuffer >= 0 && bufferFill[currentBuffer] > 0)
+    this->submitBuffer();
+
+#ifndef _WIN32
+  if (writerRunning == true) {
+    pthread_mutex_lock(&theMutex);
+    shutdown = true;
+    pthread_cond_signal(&workCond);
+    pthread_mutex_unlock(&theMutex);
+    pthread_join(theWriter, 0);
+    writerRunning = false;
+  }
+  pthread_cond_destroy(&freeCond);
+  pthread_cond_destroy(&workCond);
+  pthread_mutex_destroy(&theMutex);
+#endif
+
+  if (fclose(theFile) != 0)
+    writeError = 1;
+  theFile = 0;
+  fileOpen = 0;
+
+  if (writeError != 0) 
+    opserr << "WARNING - FastBinaryFileStream::close() - error writing file " << fileName << endln;
+
+  return (writeError == 0) ? 0 : -1;
+}
+
+int 
+FastBinaryFileStream::write(Vector &data)
+{
+  int n = data.Size();
+  if (n == 0)
+    return 0;
+
+  return this->writeRow(&data(0), n);
+}
+
+OPS_Stream& 
+FastBinaryFileStream::write(const double *s, int n)
+{
+  this->writeRow(s, n);
+  return *this;
+}
+
+int
+FastBinaryFileStream::writeRow(const double *data, int n)
+{
+  if (fileOpen == 0)
+    if (this->open() < 0)
+      return -1;
+
+  // the first row fixes the number of columns, it goes in the header
+  if (numColumns < 0) {
+    numColumns = n;
+
+    char header[24];
+    int headerData[4];
+    headerData[0] = 1;
+    headerData[1] = 24;
+    headerData[2] = numColumns;
+    headerData[3] = 8;
+    memcpy(header, "OPSFASTB", 8);
+    copyLittleEndian(&header[8], headerData, 4, 4);
+    if (this->append(header, 24) < 0)
+      return -1;
+
+  } else if (n != numColumns) {
+    opserr << "WARNING - FastBinaryFileStream::write() - row of size " << n;
+    opserr << " does not match the " << numColumns << " columns in file " << fileName;
+    opserr << ", row not written\n";
+    return -1;
+  }
+
+  if (isBigEndian() == false)
+    return this->append((const char *)data, n*8);
+
+  // swap the bytes a double at a time
+  for (int i=0; i<n; i++) {
+    char value[8];
+    copyLittleEndian(value, &data[i], 1, 8);
+    if (this->append(value, 8) < 0)
+      return -1;
+  }
+
+  return 0;
+}
+
+int
+FastBinaryFileStream::append(const char *data, int numBytes)
+{
+  while (numBytes > 0) {
+
+    // get an empty buffer if needed, waiting on the writer if none free
+    if (currentBuffer < 0) {
+#ifndef _WIN32
+      if (writerRunning == true) {
+	pthread_mutex_lock(&theMutex);
+	while (numFree == 0)
+	  pthread_cond_wait(&freeCond, &theMutex);
+	currentBuffer = freeBuffers[--numFree];
+	pthread_mutex_unlock(&theMutex);
+      } else
+#endif
+	currentBuffer = freeBuffers[--numFree];
+
+      bufferFill[currentBuffer] = 0;
+    }
+
+    int fill = bufferFill[currentBuffer];
+    int numCopy = bufferSize - fill;
+    if (numCopy > numBytes)
+      numCopy = numBytes;
+
+    memcpy(&theBuffers[currentBuffer][fill], data, numCopy);
+    bufferFill[currentBuffer] += numCopy;
+    data += numCopy;
+    numBytes -= numCopy;
+
+    if (bufferFill[currentBuffer] == bufferSize)
+      if (this->submitBuffer() < 0)
+	return -1;
+  }
+
+  return 0;
+}
+
+int
+FastBinaryFileStream::submitBuffer(void)
+{
+  int index = currentBuffer;
+  currentBuffer = -1;
+
+#ifndef _WIN32
+  if (writerRunning == true) {
+    pthread_mutex_lock(&theMutex);
+    theQueue[(queueStart+queueCount) % numBuffers] = index;
+    queueCount++;
+    pthread_cond_signal(&workCond);
+    int res = writeError;
+    pthread_mutex_unlock(&theMutex);
+    return (res == 0) ? 0 : -1;
+  }
+#endif
+
+  // no writer thread, write it now
+  int res = this->writeBuffer(index);
+  freeBuffers[numFree++] = index;
+  return res;
+}
+
+int
+FastBinaryFileStream::writeBuffer(int index)
+{
+  int numBytes = bufferFill[index];
+  if (numBytes > 0 && fwrite(theBuffers[index], 1, numBytes, theFile) != (size_t)numBytes) {
+    writeError = 1;
+    return -1;
+  }
+  bufferFill[index] = 0;
+  return 0;
+}
+
+#ifndef _WIN32
+void *
+FastBinaryFileStream::writerMain(void *arg)
+{
+  FastBinaryFileStream *theStream = (FastBinaryFileStream *)arg;
+
+  pthread_mutex_lock(&theStream->theMutex);
+  while (true) {
+    while (theStream->queueCount == 0 && theStream->shutdown == false)
+      pthread_cond_wait(&theStream->workCond, &theStream->theMutex);
+
+    // all written and asked to stop
+    if (theStream->queueCount == 0)
+      break;
+
+    int index = theStream->theQueue[theStream->queueStart];
+    theStream->queueStart = (theStream->queueStart+1) % theStream->numBuffers;
+    theStream->queueCount--;
+    pthread_mutex_unlock(&theStream->theMutex);
+
+    // only this thread touches the file while it is running
+    int numBytes = theStream->bufferFill[index];
+    bool ok = true;
+    if (numBytes > 0) 
+      ok = (fwrite(theStream->theBuffers[index], 1, numBytes, theStream->theFile) == (size_t)numBytes);
+
+    pthread_mutex_lock(&theStream->theMutex);
+    if (ok == false)
+      theStream->writeError = 1;
+    theStream->freeBuffers[theStream->numFree++] = index;
+    pthread_cond_signal(&theStream->freeCond);
+  }
+  pthread_mutex_unlock(&theStream->theMutex);
+
+  return 0;
+}
+#endif
+
+int 
+FastBinaryFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  sendSelfCount++;
+
+  static ID idData(3);
+  int fileNameLength = 0;
+  if (fileName != 0)
+    fileNameLength = strlen(fileName);
+
+  idData(0) = fileNameLength;
+  if (theOpenMode == OVERWRITE)
+    idData(1) = 0;
+  else
+    idData(1) = 1;
+  idData(2) = sendSelfCount;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "FastBinaryFileStream::sendSelf() - failed to send id data\n";
+    return -1;
+  }
+
+  if (fileNameLength != 0) {
+    Message theMessage(fileName, fileNameLength);
+    if (theChannel.sendMsg(0, commitTag, theMessage) < 0) {
+      opserr << "FastBinaryFileStream::sendSelf() - failed to send message\n";
+      return -1;
+    }
+  }
+  
+  return 0;
+}
+
+int 
+FastBinaryFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  static ID idData(3);
+
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "FastBinaryFileStream::recvSelf() - failed to recv id data\n";
+    return -1;
+  }
+
+  int fileNameLength = idData(0);
+  openMode mode = (idData(1) == 0) ? OVERWRITE : APPEND;
+
+  if (fileNameLength != 0) {
+    char *name = new char[fileNameLength+16];
+    if (name == 0) {
+      opserr << "FastBinaryFileStream::recvSelf() - out of memory\n";
+      return -1;
+    }
+
+    Message theMessage(name, fileNameLength);
+    if (theChannel.recvMsg(0, commitTag, theMessage) < 0) {
+      opserr << "FastBinaryFileStream::recvSelf() - failed to recv message\n";
+      delete [] name;
+      return -1;
+    }
+
+    // each process writes its own file
+    sprintf(&name[fileNameLength],".%d",idData(2));
+    int res = this->setFile(name, mode);
+    delete [] name;
+    if (res < 0) {
+      opserr << "FastBinaryFileStream::recvSelf() - setFile() failed\n";
+      return -1;
+    }
+  }
+  
+  return 0;
+}
@@ -0,0 +1,127 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/FastBinaryFileStream.h,v $
+
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// FastBinaryFileStream. A FastBinaryFileStream writes the data rows passed
+// to write(Vector &) as raw little-endian doubles. The file starts with a
+// 24 byte header:
+//	char[8]  "OPSFASTB"
+//	int32    version (1)
+//	int32    size of the header in bytes (24)
+//	int32    number of doubles in each row
+//	int32    number of bytes in each value (8)
+// The rows are copied into a few large buffers; a background thread 
+// writes the full buffers to disk while the analysis carries on. At most
+// numBuffers*bufferSize bytes are held in memory, the recorder waiting if
+// the disk can not keep up. Everything is written out when the stream is
+// closed or destroyed, i.e. on wipe and exit.
+//
+// What: "@(#) FastBinaryFileStream.h, revA"
+
+#ifndef _FastBinaryFileStream
+#define _FastBinaryFileStream
+
+#include <OPS_Stream.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class FastBinaryFileStream : public OPS_Stream
+{
+ public:
+  FastBinaryFileStream();
+  FastBinaryFileStream(const char *fileName, openMode mode = OVERWRITE,
+		       int bufferSize = 4194304, int numBuffers = 3);
+  ~FastBinaryFileStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE);
+  int open(void);
+  int close(void);
+
+  const char *getFileName(void) {return fileName;}
+
+  // xml stuff
+  int tag(const char *) {return 0;};
+  int tag(const char *, const char *) {return 0;};
+  int endTag() {return 0;};
+  int attr(const char *name, int value) {return 0;};
+  int attr(const char *name, double value) {return 0;};
+  int attr(const char *name, const char *value) {return 0;};
+  int write(Vector &data);
+  int write(int data) {return 0;};
+  int write(double data) {return 0;};
+
+  // regular stuff
+  OPS_Stream& write(const double *s, int n);
+
+  // parallel stuff
+  int sendSelf(int commitTag, Channel &theChannel);  
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int writeRow(const double *data, int n);
+  int append(const char *data, int numBytes);
+  int submitBuffer(void);
+  int writeBuffer(int index);
+
+#ifndef _WIN32
+  static void *writerMain(void *theStream);
+#endif
+
+  FILE *theFile;
+  int fileOpen;
+  openMode theOpenMode;
+  char *fileName;
+  int numColumns;             // doubles per row, -1 until the first row
+
+  int bufferSize;             // size of each buffer in bytes
+  int numBuffers;
+  char **theBuffers;
+  int *bufferFill;            // number of bytes used in each buffer
+  int currentBuffer;          // buffer being filled, -1 if none
+
+  int *theQueue;              // buffers waiting to be written, in order
+  int queueStart, queueCount;
+  int *freeBuffers;           // buffers that can be filled
+  int numFree;
+  int writeError;
+  int sendSelfCount;
+
+#ifndef _WIN32
+  pthread_t theWriter;
+  pthread_mutex_t theMutex;
+  pthread_cond_t workCond;    // signalled when a buffer is queued
+  pthread_cond_t freeCond;    // signalled when a buffer is written
+  bool writerRunning;
+  bool shutdown;
+#endif
+};
+
+#endif
@@ -0,0 +1,171 @@
+// Description: loopback test of TCP_SocketBuffered. A child process
+// connects to the parent and sends a mix of small entries, which are
+// coalesced in the send buffer, and entries larger than the flush size,
+// which are written directly; the parent checks what it receives and
+// echoes a checksum back, the receive forcing the client to flush.
+//
+// usage: testTCP_SocketBuffered <inetPort>, exits with the number of
+// failed checks
+
+#include <StandardStream.h>
+#include <TCP_SocketBuffered.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Message.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static const int numSmall = 50;
+static const int sizeLarge = 20000;
+static const int flushSize = 4096;
+
+static int
+runClient(int inetPort)
+{
+  // give the server time to listen
+  sleep(1);
+
+  TCP_SocketBuffered theSocket(inetPort, "127.0.0.1", flushSize);
+  if (theSocket.setUpConnection() != 0)
+    return 1;
+
+  ID header(2);
+  header(0) = numSmall;
+  header(1) = sizeLarge;
+  theSocket.sendID(0, 0, header);
+
+  Vector small(3);
+  for (int i=0; i<numSmall; i++) {
+    small(0) = i; small(1) = 2.0*i; small(2) = -0.5*i;
+    theSocket.sendVector(0, 0, small);
+  }
+
+  Matrix theMatrix(3,4);
+  for (int i=0; i<3; i++)
+    for (int j=0; j<4; j++)
+      theMatrix(i,j) = 10.0*i + j;
+  theSocket.sendMatrix(0, 0, theMatrix);
+
+  Vector large(sizeLarge);
+  for (int i=0; i<sizeLarge; i++)
+    large(i) = 0.25*i;
+  theSocket.sendVector(0, 0, large);
+
+  char text[] = "buffered";
+  Message theMessage(text, strlen(text));
+  theSocket.sendMsg(0, 0, theMessage);
+
+  Vector checksum(2);
+  if (theSocket.recvVector(0, 0, checksum) != 0)
+    return 1;
+
+  double sumLarge = 0.25*(sizeLarge-1.0)*sizeLarge/2.0;
+  if (checksum(0) != numSmall*(numSmall-1)/2.0 || checksum(1) != sumLarge) {
+    opserr << "FAILED - client received wrong checksum\n";
+    return 1;
+  }
+
+  return 0;
+}
+
+static int
+runServer(int inetPort)
+{
+  int numFailed = 0;
+
+  TCP_SocketBuffered theSocket(inetPort, flushSize);
+  if (theSocket.setUpConnection() != 0) {
+    opserr << "FAILED - server could not set up the connection\n";
+    return 1;
+  }
+
+  ID header(2);
+  theSocket.recvID(0, 0, header);
+  if (header(0) != numSmall || header(1) != sizeLarge) {
+    opserr << "FAILED - wrong ID received\n";
+    numFailed++;
+  }
+
+  Vector small(3);
+  double sumSmall = 0.0;
+  for (int i=0; i<numSmall; i++) {
+    theSocket.recvVector(0, 0, small);
+    if (small(0) != i || small(1) != 2.0*i || small(2) != -0.5*i) {
+      opserr << "FAILED - wrong small vector " << i << " received\n";
+      numFailed++;
+    }
+    sumSmall += small(0);
+  }
+
+  Matrix theMatrix(3,4);
+  theSocket.recvMatrix(0, 0, theMatrix);
+  for (int i=0; i<3; i++)
+    for (int j=0; j<4; j++)
+      if (theMatrix(i,j) != 10.0*i + j) {
+	opserr << "FAILED - wrong matrix term " << i << " " << j << " received\n";
+	numFailed++;
+      }
+
+  Vector large(sizeLarge);
+  theSocket.recvVector(0, 0, large);
+  double sumLarge = 0.0;
+  for (int i=0; i<sizeLarge; i++) {
+    if (large(i) != 0.25*i) {
+      opserr << "FAILED - wrong large vector term " << i << " received\n";
+      numFailed++;
+      break;
+    }
+    sumLarge += large(i);
+  }
+
+  char text[9];
+  Message theMessage(text, 8);
+  theSocket.recvMsg(0, 0, theMessage);
+  if (strncmp(text, "buffered", 8) != 0) {
+    opserr << "FAILED - wrong message received\n";
+    numFailed++;
+  }
+
+  Vector checksum(2);
+  checksum(0) = sumSmall;
+  checksum(1) = sumLarge;
+  theSocket.sendVector(0, 0, checksum);
+  theSocket.flush();
+
+  return numFailed;
+}
+
+// main routine
+int main(int argc, char **argv)
+{
+  if (argc != 2) {
+    opserr << "ERROR - Usage testTCP_SocketBuffered inetPort\n";
+    exit(1);
+  }
+
+  int inetPort = atoi(argv[1]);
+
+  pid_t pid = fork();
+  if (pid == 0)
+    exit(runClient(inetPort));
+
+  int numFailed = runServer(inetPort);
+
+  int status = 0;
+  waitpid(pid, &status, 0);
+  if (WIFEXITED(status) == 0 || WEXITSTATUS(status) != 0) {
+    opserr << "FAILED - client process\n";
+    numFailed++;
+  }
+
+  if (numFailed == 0)
+    opserr << "TCP_SocketBuffered - all checks passed\n";
+
+  exit(numFailed);
+}
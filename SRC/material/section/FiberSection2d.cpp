@@ -47,10 +47,81 @@
 
 ID FiberSection2d::code(2);
 
+// work arrays for the fiber locations and weights (and their derivatives)
+// obtained from the section integration. each thread has its own set so that
+// sections can be updated concurrently; the arrays grow to the largest
+// number of fibers seen in the thread.
+class FiberSection2dWorkArea
+{
+  public:
+    FiberSection2dWorkArea()
+      :size(0), fiberLocs(0), fiberArea(0), locsDeriv(0), areaDeriv(0),
+       strains(0), stresses(0), tangents(0)
+    {
+
+    }
+
+    ~FiberSection2dWorkArea()
+    {
+      this->free();
+    }
+
+    void setSize(int num)
+    {
+      if (num > size) {
+	this->free();
+	fiberLocs = new double[num];
+	fiberArea = new double[num];
+	locsDeriv = new double[num];
+	areaDeriv = new double[num];
+	strains = new double[num];
+	stresses = new double[num];
+	tangents = new double[num];
+	if (fiberLocs == 0 || fiberArea == 0 || locsDeriv == 0 || areaDeriv == 0 ||
+	    strains == 0 || stresses == 0 || tangents == 0) {
+	  opserr << "FiberSection2d - out of memory allocating work arrays of size " << num << endln;
+	  exit(-1);
+	}
+	size = num;
+      }
+    }
+
+    int size;
+    double *fiberLocs;
+    double *fiberArea;
+    double *locsDeriv;
+    double *areaDeriv;
+    double *strains;    // fiber strains, stresses and tangents by group
+    double *stresses;
+    double *tangents;
+
+  private:
+    void free(void)
+    {
+      if (fiberLocs != 0)
+	delete [] fiberLocs;
+      if (fiberArea != 0)
+	delete [] fiberArea;
+      if (locsDeriv != 0)
+	delete [] locsDeriv;
+      if (areaDeriv != 0)
+	delete [] areaDeriv;
+      if (strains != 0)
+	delete [] strains;
+      if (stresses != 0)
+	delete [] stresses;
+      if (tangents != 0)
+	delete [] tangents;
+    }
+};
+
+static OPS_THREAD_LOCAL FiberSection2dWorkArea theWorkArea;
+
 // constructors:
 FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(num), theMaterials(0), matData(0),
+  numGroups(0), fiberPosition(0), groupStart(0), groupMaterials(0), threadSafe(false),
   yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers > 0) {
@@ -104,6 +175,8 @@ FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers):
   kData[2] = 0.0;
   kData[3] = 0.0;
 
+  this->setThreadSafe();
+
   code(0) = SECTION_RESPONSE_P;
   code(1) = SECTION_RESPONSE_MZ;
 }
@@ -112,6 +185,7 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si):
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
   numFibers(num), theMaterials(0), matData(0),
+  numGroups(0), fiberPosition(0), groupStart(0), groupMaterials(0), threadSafe(false),
   yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers != 0) {
@@ -135,10 +209,12 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double fiberLocs[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
   sectionIntegr->getFiberLocations(numFibers, fiberLocs);
   
-  static double fiberArea[10000];
+  double *fiberArea = theWork.fiberArea;
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
 
   double Qz = 0.0;
@@ -170,6 +246,8 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
   kData[2] = 0.0;
   kData[3] = 0.0;
   
+  this->setThreadSafe();
+
   code(0) = SECTION_RESPONSE_P;
   code(1) = SECTION_RESPONSE_MZ;
 }
@@ -178,6 +256,7 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 FiberSection2d::FiberSection2d():
   SectionForceDeformation(0, SEC_TAG_FiberSection2d),
   numFibers(0), theMaterials(0), matData(0),
+  numGroups(0), fiberPosition(0), groupStart(0), groupMaterials(0), threadSafe(false),
   yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   s = new Vector(sData, 2);
@@ -191,6 +270,8 @@ FiberSection2d::FiberSection2d():
   kData[2] = 0.0;
   kData[3] = 0.0;
 
+  this->setThreadSafe();
+
   code(0) = SECTION_RESPONSE_P;
   code(1) = SECTION_RESPONSE_MZ;
 }
@@ -240,6 +321,9 @@ FiberSection2d::addFiber(Fiber &newFiber)
   theMaterials = newArray;
   matData = newMatData;
 
+  this->clearFiberGroups();
+  this->setThreadSafe();
+
   double Qz = 0.0;
   double A  = 0.0;
 
@@ -260,6 +344,8 @@ FiberSection2d::addFiber(Fiber &newFiber)
 // destructor:
 FiberSection2d::~FiberSection2d()
 {
+  this->clearFiberGroups();
+
   if (theMaterials != 0) {
     for (int i = 0; i < numFibers; i++)
       if (theMaterials[i] != 0)
@@ -294,8 +380,10 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   double d0 = deforms(0);
   double d1 = deforms(1);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -308,15 +396,30 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
     }
   }
   
+  // determine the material strains, placed by group, and set them
+  // with one call for each group of fibers of the same material class
+  if (groupMaterials == 0)
+    this->groupFibers();
+
+  double *strains = theWork.strains;
+  double *stresses = theWork.stresses;
+  double *tangents = theWork.tangents;
+
+  for (int i = 0; i < numFibers; i++)
+    strains[fiberPosition[i]] = d0 - (fiberLocs[i] - yBar)*d1;
+
+  for (int j = 0; j < numGroups; j++) {
+    int first = groupStart[j];
+    res += groupMaterials[first]->setTrialStrains(&groupMaterials[first], &strains[first],
+						   &stresses[first], &tangents[first],
+						   groupStart[j+1] - first);
+  }
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = fiberLocs[i] - yBar;
     double A = fiberArea[i];
-
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
+    double tangent = tangents[fiberPosition[i]];
+    double stress = stresses[fiberPosition[i]];
 
     double ks0 = tangent * A;
     double ks1 = ks0 * -y;
@@ -334,6 +437,54 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   return res;
 }
 
+// groups the fibers by the class of their material, the materials of
+// a group are then evaluated with one call to setTrialStrains()
+void
+FiberSection2d::groupFibers(void)
+{
+  this->clearFiberGroups();
+  if (numFibers == 0)
+    return;
+
+  fiberPosition = new int[numFibers];
+  groupStart = new int[numFibers+1];
+  groupMaterials = new UniaxialMaterial *[numFibers];
+  if (fiberPosition == 0 || groupStart == 0 || groupMaterials == 0) {
+    opserr << "FiberSection2d::groupFibers -- failed to allocate fiber groups\n";
+    exit(-1);
+  }
+
+  numGroups = UniaxialMaterial::groupByClass(theMaterials, numFibers, fiberPosition,
+					     groupMaterials, groupStart);
+}
+
+// the section may be formed concurrently with others only if all its
+// materials may be
+void
+FiberSection2d::setThreadSafe(void)
+{
+  threadSafe = true;
+  for (int i = 0; i < numFibers && threadSafe == true; i++)
+    if (theMaterials[i] == 0 || theMaterials[i]->isThreadSafe() == false)
+      threadSafe = false;
+}
+
+void
+FiberSection2d::clearFiberGroups(void)
+{
+  if (fiberPosition != 0)
+    delete [] fiberPosition;
+  if (groupStart != 0)
+    delete [] groupStart;
+  if (groupMaterials != 0)
+    delete [] groupMaterials;
+
+  numGroups = 0;
+  fiberPosition = 0;
+  groupStart = 0;
+  groupMaterials = 0;
+}
+
 const Vector&
 FiberSection2d::getSectionDeformation(void)
 {
@@ -343,12 +494,14 @@ FiberSection2d::getSectionDeformation(void)
 const Matrix&
 FiberSection2d::getInitialTangent(void)
 {
-  static double kInitial[4];
-  static Matrix kInitialMatrix(kInitial, 2, 2);
+  static OPS_THREAD_LOCAL double kInitial[4];
+  static OPS_THREAD_LOCAL Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -443,6 +596,8 @@ FiberSection2d::getCopy(void)
   else
     theCopy->sectionIntegr = 0;
 
+  theCopy->threadSafe = threadSafe;
+
   return theCopy;
 }
 
@@ -477,8 +632,10 @@ FiberSection2d::revertToLastCommit(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -527,8 +684,10 @@ FiberSection2d::revertToStart(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -630,6 +789,9 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
+  // the materials may be replaced
+  this->clearFiberGroups();
+
   static ID data(3);
   
   int dbTag = this->getDbTag();
@@ -727,6 +889,8 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
     }
     
     yBar = Qz/A;
+
+    this->setThreadSafe();
   }    
 
   return res;
@@ -999,7 +1163,7 @@ FiberSection2d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(2);
+  static OPS_THREAD_LOCAL Vector dummy(2);
 
   return dummy;
 }
@@ -1007,7 +1171,7 @@ FiberSection2d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(2);
+  static OPS_THREAD_LOCAL Vector ds(2);
   
   ds.Zero();
   
@@ -1017,8 +1181,10 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double tangent = 0.0;
   double sig_dAdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1031,8 +1197,8 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = theWork.locsDeriv;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1085,7 +1251,7 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection2d::getInitialTangentSensitivity(int gradIndex)
 {
-  static Matrix dksdh(2,2);
+  static OPS_THREAD_LOCAL Matrix dksdh(2,2);
   
   dksdh.Zero();
 
@@ -1093,8 +1259,10 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
   double tangent = 0.0;
   double dtangentdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1107,8 +1275,8 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
     }
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = theWork.locsDeriv;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1151,7 +1319,9 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double fiberLocs[10000];
+  FiberSection2dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *fiberLocs = theWork.fiberLocs;
 
   if (sectionIntegr != 0)
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1160,8 +1330,8 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
       fiberLocs[i] = matData[2*i];
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = theWork.locsDeriv;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
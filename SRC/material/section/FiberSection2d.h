@@ -65,6 +65,7 @@ class FiberSection2d : public SectionForceDeformation
     int   revertToStart(void);
  
     SectionForceDeformation *getCopy(void);
+    bool isThreadSafe(void) const {return threadSafe;};
     const ID &getType (void);
     int getOrder (void) const;
     
@@ -97,6 +98,16 @@ class FiberSection2d : public SectionForceDeformation
     double   *matData;               // data for the materials [yloc and area]
     double   kData[4];               // data for ks matrix 
     double   sData[2];               // data for s vector 
+
+    int numGroups;                     // number of groups of fibers of one material class
+    int *fiberPosition;                // location of each fiber in groupMaterials
+    int *groupStart;                   // location of the first fiber of each group
+    UniaxialMaterial **groupMaterials; // the materials ordered by group
+    bool threadSafe;                   // true if all the materials are thread safe
+
+    void groupFibers(void);
+    void clearFiberGroups(void);
+    void setThreadSafe(void);
     
     double yBar;       // Section centroid
   
@@ -48,10 +48,89 @@
 
 ID FiberSection3d::code(3);
 
+// work arrays for the fiber locations and weights (and their derivatives)
+// obtained from the section integration. each thread has its own set so that
+// sections can be updated concurrently; the arrays grow to the largest
+// number of fibers seen in the thread.
+class FiberSection3dWorkArea
+{
+  public:
+    FiberSection3dWorkArea()
+      :size(0), yLocs(0), zLocs(0), fiberArea(0), dydh(0), dzdh(0), areaDeriv(0),
+       strains(0), stresses(0), tangents(0)
+    {
+
+    }
+
+    ~FiberSection3dWorkArea()
+    {
+      this->free();
+    }
+
+    void setSize(int num)
+    {
+      if (num > size) {
+	this->free();
+	yLocs = new double[num];
+	zLocs = new double[num];
+	fiberArea = new double[num];
+	dydh = new double[num];
+	dzdh = new double[num];
+	areaDeriv = new double[num];
+	strains = new double[num];
+	stresses = new double[num];
+	tangents = new double[num];
+	if (yLocs == 0 || zLocs == 0 || fiberArea == 0 || dydh == 0 || dzdh == 0 || areaDeriv == 0 ||
+	    strains == 0 || stresses == 0 || tangents == 0) {
+	  opserr << "FiberSection3d - out of memory allocating work arrays of size " << num << endln;
+	  exit(-1);
+	}
+	size = num;
+      }
+    }
+
+    int size;
+    double *yLocs;
+    double *zLocs;
+    double *fiberArea;
+    double *dydh;
+    double *dzdh;
+    double *areaDeriv;
+    double *strains;    // fiber strains, stresses and tangents by group
+    double *stresses;
+    double *tangents;
+
+  private:
+    void free(void)
+    {
+      if (yLocs != 0)
+	delete [] yLocs;
+      if (zLocs != 0)
+	delete [] zLocs;
+      if (fiberArea != 0)
+	delete [] fiberArea;
+      if (dydh != 0)
+	delete [] dydh;
+      if (dzdh != 0)
+	delete [] dzdh;
+      if (areaDeriv != 0)
+	delete [] areaDeriv;
+      if (strains != 0)
+	delete [] strains;
+      if (stresses != 0)
+	delete [] stresses;
+      if (tangents != 0)
+	delete [] tangents;
+    }
+};
+
+static OPS_THREAD_LOCAL FiberSection3dWorkArea theWorkArea;
+
 // constructors:
 FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), theMaterials(0), matData(0),
+  numGroups(0), fiberPosition(0), groupStart(0), groupMaterials(0), threadSafe(false),
   yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
 {
   if (numFibers != 0) {
@@ -109,6 +188,8 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers):
   for (int i=0; i<9; i++)
     kData[i] = 0.0;
 
+  this->setThreadSafe();
+
   code(0) = SECTION_RESPONSE_P;
   code(1) = SECTION_RESPONSE_MZ;
   code(2) = SECTION_RESPONSE_MY;
@@ -118,6 +199,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si):
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
   numFibers(num), theMaterials(0), matData(0),
+  numGroups(0), fiberPosition(0), groupStart(0), groupMaterials(0), threadSafe(false),
   yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
 {
   if (numFibers != 0) {
@@ -141,11 +223,13 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
   sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
   
-  static double fiberArea[10000];
+  double *fiberArea = theWork.fiberArea;
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
 
   double Qz = 0.0;
@@ -178,6 +262,8 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
   for (int i = 0; i < 3*3; i++)
     kData[i] = 0.0;
   
+  this->setThreadSafe();
+
   code(0) = SECTION_RESPONSE_P;
   code(1) = SECTION_RESPONSE_MZ;
   code(2) = SECTION_RESPONSE_MY;
@@ -187,6 +273,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 FiberSection3d::FiberSection3d():
   SectionForceDeformation(0, SEC_TAG_FiberSection3d),
   numFibers(0), theMaterials(0), matData(0),
+  numGroups(0), fiberPosition(0), groupStart(0), groupMaterials(0), threadSafe(false),
   yBar(0.0), zBar(0.0), sectionIntegr(0), e(3), s(0), ks(0)
 {
   s = new Vector(sData, 3);
@@ -199,6 +286,8 @@ FiberSection3d::FiberSection3d():
   for (int i=0; i<9; i++)
     kData[i] = 0.0;
 
+  this->setThreadSafe();
+
   code(0) = SECTION_RESPONSE_P;
   code(1) = SECTION_RESPONSE_MZ;
   code(2) = SECTION_RESPONSE_MY;
@@ -255,6 +344,9 @@ FiberSection3d::addFiber(Fiber &newFiber)
   theMaterials = newArray;
   matData = newMatData;
 
+  this->clearFiberGroups();
+  this->setThreadSafe();
+
   double Qz = 0.0;
   double Qy = 0.0;
   double A  = 0.0;
@@ -280,6 +372,8 @@ FiberSection3d::addFiber(Fiber &newFiber)
 // destructor:
 FiberSection3d::~FiberSection3d()
 {
+  this->clearFiberGroups();
+
   if (theMaterials != 0) {
     for (int i = 0; i < numFibers; i++)
       if (theMaterials[i] != 0)
@@ -316,9 +410,11 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   double d1 = deforms(1);
   double d2 = deforms(2);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -332,16 +428,31 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     }
   }
 
+  // determine the material strains, placed by group, and set them
+  // with one call for each group of fibers of the same material class
+  if (groupMaterials == 0)
+    this->groupFibers();
+
+  double *strains = theWork.strains;
+  double *stresses = theWork.stresses;
+  double *tangents = theWork.tangents;
+
+  for (int i = 0; i < numFibers; i++)
+    strains[fiberPosition[i]] = d0 - (yLocs[i] - yBar)*d1 + (zLocs[i] - zBar)*d2;
+
+  for (int j = 0; j < numGroups; j++) {
+    int first = groupStart[j];
+    res += groupMaterials[first]->setTrialStrains(&groupMaterials[first], &strains[first],
+						   &stresses[first], &tangents[first],
+						   groupStart[j+1] - first);
+  }
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
-
-    // determine material strain and set it
-    double strain = d0 - y*d1 + z*d2;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
+    double tangent = tangents[fiberPosition[i]];
+    double stress = stresses[fiberPosition[i]];
 
     double value = tangent * A;
     double vas1 = -y*value;
@@ -371,11 +482,59 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   return res;
 }
 
+// groups the fibers by the class of their material, the materials of
+// a group are then evaluated with one call to setTrialStrains()
+void
+FiberSection3d::groupFibers(void)
+{
+  this->clearFiberGroups();
+  if (numFibers == 0)
+    return;
+
+  fiberPosition = new int[numFibers];
+  groupStart = new int[numFibers+1];
+  groupMaterials = new UniaxialMaterial *[numFibers];
+  if (fiberPosition == 0 || groupStart == 0 || groupMaterials == 0) {
+    opserr << "FiberSection3d::groupFibers -- failed to allocate fiber groups\n";
+    exit(-1);
+  }
+
+  numGroups = UniaxialMaterial::groupByClass(theMaterials, numFibers, fiberPosition,
+					     groupMaterials, groupStart);
+}
+
+// the section may be formed concurrently with others only if all its
+// materials may be
+void
+FiberSection3d::setThreadSafe(void)
+{
+  threadSafe = true;
+  for (int i = 0; i < numFibers && threadSafe == true; i++)
+    if (theMaterials[i] == 0 || theMaterials[i]->isThreadSafe() == false)
+      threadSafe = false;
+}
+
+void
+FiberSection3d::clearFiberGroups(void)
+{
+  if (fiberPosition != 0)
+    delete [] fiberPosition;
+  if (groupStart != 0)
+    delete [] groupStart;
+  if (groupMaterials != 0)
+    delete [] groupMaterials;
+
+  numGroups = 0;
+  fiberPosition = 0;
+  groupStart = 0;
+  groupMaterials = 0;
+}
+
 const Matrix&
 FiberSection3d::getInitialTangent(void)
 {
-  static double kInitialData[9];
-  static Matrix kInitial(kInitialData, 3, 3);
+  static OPS_THREAD_LOCAL double kInitialData[9];
+  static OPS_THREAD_LOCAL Matrix kInitial(kInitialData, 3, 3);
   
   kInitialData[0] = 0.0; kInitialData[1] = 0.0; 
   kInitialData[2] = 0.0; kInitialData[3] = 0.0;
@@ -383,9 +542,11 @@ FiberSection3d::getInitialTangent(void)
   kInitialData[6] = 0.0; kInitialData[7] = 0.0;
   kInitialData[8] = 0.0; 
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -500,6 +661,8 @@ FiberSection3d::getCopy(void)
   else
     theCopy->sectionIntegr = 0;
 
+  theCopy->threadSafe = threadSafe;
+
   return theCopy;
 }
 
@@ -536,9 +699,11 @@ FiberSection3d::revertToLastCommit(void)
   kData[8] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; 
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -603,9 +768,11 @@ FiberSection3d::revertToStart(void)
   kData[8] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; 
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -719,6 +886,9 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 {
   int res = 0;
 
+  // the materials may be replaced
+  this->clearFiberGroups();
+
   static ID data(3);
   
   int dbTag = this->getDbTag();
@@ -823,6 +993,8 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
     
     yBar = Qz/A;
     zBar = Qy/A;
+
+    this->setThreadSafe();
   }    
 
   return res;
@@ -1183,7 +1355,7 @@ FiberSection3d::setParameter(const char **argv, int argc, Parameter &param)
 const Vector &
 FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 {
-  static Vector dummy(3);
+  static OPS_THREAD_LOCAL Vector dummy(3);
   
   dummy.Zero();
   
@@ -1194,7 +1366,7 @@ FiberSection3d::getSectionDeformationSensitivity(int gradIndex)
 const Vector &
 FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 {
-  static Vector ds(3);
+  static OPS_THREAD_LOCAL Vector ds(3);
   
   ds.Zero();
   
@@ -1204,9 +1376,11 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double sig_dAdh = 0;
   double tangent = 0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
+  double *fiberArea = theWork.fiberArea;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -1220,9 +1394,9 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  double *dydh = theWork.dydh;
+  double *dzdh = theWork.dzdh;
+  double *areaDeriv = theWork.areaDeriv;
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1267,16 +1441,16 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
     if (dzdh[i] != 0.0)
       ds(2) +=  dzdh[i] * (stress*A);
 
-    static Matrix as(1,3);
+    static OPS_THREAD_LOCAL Matrix as(1,3);
     as(0,0) = 1;
     as(0,1) = -y;
     as(0,2) = z;
     
-    static Matrix dasdh(1,3);
+    static OPS_THREAD_LOCAL Matrix dasdh(1,3);
     dasdh(0,1) = -dydh[i];
     dasdh(0,2) = dzdh[i];
     
-    static Matrix tmpMatrix(3,3);
+    static OPS_THREAD_LOCAL Matrix tmpMatrix(3,3);
     tmpMatrix.addMatrixTransposeProduct(0.0, as, dasdh, tangent);
     
     ds.addMatrixVector(1.0, tmpMatrix, e, A);
@@ -1288,7 +1462,7 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
 const Matrix &
 FiberSection3d::getSectionTangentSensitivity(int gradIndex)
 {
-  static Matrix something(3,3);
+  static OPS_THREAD_LOCAL Matrix something(3,3);
   
   something.Zero();
   
@@ -1305,8 +1479,10 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  FiberSection3dWorkArea &theWork = theWorkArea;
+  theWork.setSize(numFibers);
+  double *yLocs = theWork.yLocs;
+  double *zLocs = theWork.zLocs;
 
   if (sectionIntegr != 0)
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -1317,8 +1493,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  double *dydh = theWork.dydh;
+  double *dzdh = theWork.dzdh;
 
   if (sectionIntegr != 0)
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -102,6 +102,7 @@ class SectionForceDeformation : public Material
   virtual int revertToStart (void) = 0;
   
   virtual SectionForceDeformation *getCopy (void) = 0;
+  virtual bool isThreadSafe(void) const {return false;};
   virtual const ID &getType (void) = 0;
   virtual int getOrder (void) const = 0;
   
@@ -141,8 +142,8 @@ class SectionForceDeformation : public Material
 
 };
 
-extern bool OPS_addSectionForceDeformation(SectionForceDeformation *newComponent);
-extern SectionForceDeformation *OPS_getSectionForceDeformation(int tag);
+extern bool OPS_addSectionForceDeformation(SectionForceDeformation *newComponent);
+extern SectionForceDeformation *OPS_getSectionForceDeformation(int tag);
 extern void OPS_clearAllSectionForceDeformation(void);
 
 #endif
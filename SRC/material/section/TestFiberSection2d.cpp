@@ -0,0 +1,152 @@
+// Description: checks and times the evaluation of the fibers of a
+// FiberSection2d in groups of the same material class. A reinforced
+// concrete section, Concrete02 fibers with a Steel02 fiber in every fifth
+// place and a few Steel01 fibers, is taken through a growing cyclic
+// curvature history, each step with a few trial deformations before the
+// commit. The same fibers are also evaluated one at a time in fiber order
+// through the virtual setTrial() of a copy of each material, as the section
+// did before the fibers were grouped. The stress resultant and tangent of
+// the section must be the same bit for bit; the wall time of each is
+// printed.
+//
+// usage: testFiberSection2d ?numFibers numSteps?, exits with the number of
+// failed checks
+
+#include <StandardStream.h>
+#include <FiberSection2d.h>
+#include <UniaxialFiber2d.h>
+#include <Steel01.h>
+#include <Steel02.h>
+#include <Concrete02.h>
+#include <Timer.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int numFibers = 500;
+static int numSteps = 2000;
+static const int numTrials = 4;
+
+// main routine
+int main(int argc, char **argv)
+{
+  if (argc == 3) {
+    numFibers = atoi(argv[1]);
+    numSteps = atoi(argv[2]);
+  }
+
+  int numFailed = 0;
+
+  Steel01 theSteel01(1, 60.0, 29000.0, 0.02);
+  Steel02 theSteel02(2, 60.0, 29000.0, 0.01, 18.0, 0.925, 0.15);
+  Concrete02 theConcrete(3, -5.0, -0.002, -1.0, -0.006, 0.1, 0.5, 250.0);
+
+  // a 24 deep section with a thin unit width layer of fibers
+  const double d = 24.0;
+  Fiber **theFibers = new Fiber *[numFibers];
+  UniaxialMaterial **theMaterials = new UniaxialMaterial *[numFibers];
+  double *y = new double[numFibers];
+  double *A = new double[numFibers];
+  double Qz = 0.0;
+  double Atotal = 0.0;
+  for (int i=0; i<numFibers; i++) {
+    y[i] = -0.5*d + d*(i+0.5)/numFibers;
+    A[i] = d/numFibers;
+    UniaxialMaterial *theMat = &theConcrete;
+    if (i%5 == 0)
+      theMat = &theSteel02;
+    else if (i%50 == 1)
+      theMat = &theSteel01;
+    theFibers[i] = new UniaxialFiber2d(i+1, *theMat, A[i], y[i]);
+    theMaterials[i] = theMat->getCopy();
+    Atotal += A[i];
+    Qz += y[i]*A[i];
+  }
+  double yBar = Qz/Atotal;
+
+  FiberSection2d theSection(1, numFibers, theFibers);
+
+  Vector e(2);
+  Vector s(2);
+  Matrix k(2,2);
+  double timeGrouped = 0.0;
+  double timeFibers = 0.0;
+  int numDiffer = 0;
+
+  for (int step=0; step<numSteps; step++) {
+    double kappa = 0.0004*sin(0.02*step)*(1.0 + step/500.0);
+    for (int trial=0; trial<numTrials; trial++) {
+      e(0) = -0.0002;
+      e(1) = kappa*(1.0 + 0.1/(trial+1));
+
+      double tStart = Timer::getWallTime();
+      theSection.setTrialSectionDeformation(e);
+      timeGrouped += Timer::getWallTime() - tStart;
+
+      // the fibers one at a time
+      tStart = Timer::getWallTime();
+      s.Zero();
+      k.Zero();
+      for (int i=0; i<numFibers; i++) {
+	double yi = y[i] - yBar;
+	double stress, tangent;
+	theMaterials[i]->setTrial(e(0) - yi*e(1), stress, tangent);
+	double ks0 = tangent*A[i];
+	double ks1 = ks0*-yi;
+	k(0,0) += ks0;
+	k(0,1) += ks1;
+	k(1,1) += ks1*-yi;
+	double fs0 = stress*A[i];
+	s(0) += fs0;
+	s(1) += fs0*-yi;
+      }
+      k(1,0) = k(0,1);
+      timeFibers += Timer::getWallTime() - tStart;
+
+      const Vector &sSection = theSection.getStressResultant();
+      const Matrix &kSection = theSection.getSectionTangent();
+      if (sSection(0) != s(0) || sSection(1) != s(1) ||
+	  kSection(0,0) != k(0,0) || kSection(0,1) != k(0,1) ||
+	  kSection(1,0) != k(1,0) || kSection(1,1) != k(1,1)) {
+	if (numDiffer == 0) {
+	  opserr << "FAILED - step " << step+1 << " trial " << trial+1;
+	  opserr << " section " << sSection << " fibers " << s;
+	}
+	numDiffer++;
+      }
+    }
+
+    theSection.commitState();
+    for (int i=0; i<numFibers; i++)
+      theMaterials[i]->commitState();
+  }
+
+  if (numDiffer != 0) {
+    opserr << "FAILED - " << numDiffer << " evaluations differ\n";
+    numFailed++;
+  }
+
+  char buffer[200];
+  sprintf(buffer, "fibers %d, evaluations %d: grouped %.4f s, one at a time %.4f s, ratio %.3f\n",
+	  numFibers, numSteps*numTrials, timeGrouped, timeFibers, timeFibers/timeGrouped);
+  opserr << buffer;
+
+  for (int i=0; i<numFibers; i++) {
+    delete theFibers[i];
+    delete theMaterials[i];
+  }
+  delete [] theFibers;
+  delete [] theMaterials;
+  delete [] y;
+  delete [] A;
+
+  if (numFailed == 0)
+    opserr << "FiberSection2d - all checks passed\n";
+
+  exit(numFailed);
+}
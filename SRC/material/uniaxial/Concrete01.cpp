@@ -383,6 +383,23 @@ void Concrete01::unload ()
   }
 }
 
+// all the materials are Concrete01, so their state determination is invoked
+// directly rather than through a virtual call for each
+int
+Concrete01::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+                            double *stresses, double *tangents, int n)
+{
+  // a subclass does its own state determination
+  if (this->getClassTag() != MAT_TAG_Concrete01)
+    return this->UniaxialMaterial::setTrialStrains(theMaterials, strains, stresses, tangents, n);
+
+  int res = 0;
+  for (int i=0; i<n; i++)
+    res += ((Concrete01 *)theMaterials[i])->Concrete01::setTrial(strains[i], stresses[i], tangents[i]);
+
+  return res;
+}
+
 double Concrete01::getStress ()
 {
    return Tstress;
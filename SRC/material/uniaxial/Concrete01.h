@@ -52,6 +52,7 @@ class Concrete01 : public UniaxialMaterial
   
   int setTrialStrain(double strain, double strainRate = 0.0); 
   int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
+  int setTrialStrains(UniaxialMaterial **theMaterials, const double *strains, double *stresses, double *tangents, int n);
   double getStrain(void);      
   double getStress(void);
   double getTangent(void);
@@ -62,6 +63,7 @@ class Concrete01 : public UniaxialMaterial
   int revertToStart(void);        
   
   UniaxialMaterial *getCopy(void);
+  bool isThreadSafe(void) const {return true;};
   
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
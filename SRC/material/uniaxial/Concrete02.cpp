@@ -232,6 +232,27 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
 
 
 
+// all the materials are Concrete02, so their state determination is invoked
+// directly rather than through a virtual call for each
+int
+Concrete02::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+                            double *stresses, double *tangents, int n)
+{
+  // a subclass does its own state determination
+  if (this->getClassTag() != MAT_TAG_Concrete02)
+    return this->UniaxialMaterial::setTrialStrains(theMaterials, strains, stresses, tangents, n);
+
+  int res = 0;
+  for (int i=0; i<n; i++) {
+    Concrete02 *theMat = (Concrete02 *)theMaterials[i];
+    res += theMat->Concrete02::setTrialStrain(strains[i]);
+    stresses[i] = theMat->sig;
+    tangents[i] = theMat->e;
+  }
+
+  return res;
+}
+
 double 
 Concrete02::getStrain(void)
 {
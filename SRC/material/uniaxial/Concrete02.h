@@ -55,8 +55,10 @@ class Concrete02 : public UniaxialMaterial
     const char *getClassType(void) const {return "Concrete02";};    
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) const {return true;};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrains(UniaxialMaterial **theMaterials, const double *strains, double *stresses, double *tangents, int n);
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
@@ -65,6 +65,7 @@ class Concrete04 : public UniaxialMaterial
   int revertToStart(void);        
   
   UniaxialMaterial *getCopy(void);
+  bool isThreadSafe(void) const {return true;};
   
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
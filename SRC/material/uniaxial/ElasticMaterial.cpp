@@ -160,6 +160,23 @@ ElasticMaterial::setTrial(double strain, double &stress, double &tangent, double
 }
 
 
+// all the materials are ElasticMaterial, so their state determination is invoked
+// directly rather than through a virtual call for each
+int
+ElasticMaterial::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+                                 double *stresses, double *tangents, int n)
+{
+  // a subclass does its own state determination
+  if (this->getClassTag() != MAT_TAG_ElasticMaterial)
+    return this->UniaxialMaterial::setTrialStrains(theMaterials, strains, stresses, tangents, n);
+
+  int res = 0;
+  for (int i=0; i<n; i++)
+    res += ((ElasticMaterial *)theMaterials[i])->ElasticMaterial::setTrial(strains[i], stresses[i], tangents[i]);
+
+  return res;
+}
+
 double 
 ElasticMaterial::getStress(void)
 {
@@ -202,6 +202,27 @@ HystereticMaterial::setTrialStrain(double strain, double strainRate)
 }
 
 
+// all the materials are HystereticMaterial, so their state determination is invoked
+// directly rather than through a virtual call for each
+int
+HystereticMaterial::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+                                    double *stresses, double *tangents, int n)
+{
+  // a subclass does its own state determination
+  if (this->getClassTag() != MAT_TAG_Hysteretic)
+    return this->UniaxialMaterial::setTrialStrains(theMaterials, strains, stresses, tangents, n);
+
+  int res = 0;
+  for (int i=0; i<n; i++) {
+    HystereticMaterial *theMat = (HystereticMaterial *)theMaterials[i];
+    res += theMat->HystereticMaterial::setTrialStrain(strains[i]);
+    stresses[i] = theMat->Tstress;
+    tangents[i] = theMat->Ttangent;
+  }
+
+  return res;
+}
+
 double
 HystereticMaterial::getStrain(void)
 {
@@ -60,6 +60,7 @@ class HystereticMaterial : public UniaxialMaterial
   const char *getClassType(void) const {return "HystereticMaterial";};
   
   int setTrialStrain(double strain, double strainRate = 0.0);
+  int setTrialStrains(UniaxialMaterial **theMaterials, const double *strains, double *stresses, double *tangents, int n);
   double getStrain(void);
   double getStress(void);
   double getTangent(void);
@@ -70,6 +71,7 @@ class HystereticMaterial : public UniaxialMaterial
   int revertToStart(void);
   
   UniaxialMaterial *getCopy(void);
+  bool isThreadSafe(void) const {return true;};
   
   int sendSelf(int commitTag, Channel &theChannel);  
   int recvSelf(int commitTag, Channel &theChannel, 
@@ -321,6 +321,23 @@ void Steel01::detectLoadReversal (double dStrain)
    }
 }
 
+// all the materials are Steel01, so their state determination is invoked
+// directly rather than through a virtual call for each
+int
+Steel01::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+                         double *stresses, double *tangents, int n)
+{
+  // a subclass does its own state determination
+  if (this->getClassTag() != MAT_TAG_Steel01)
+    return this->UniaxialMaterial::setTrialStrains(theMaterials, strains, stresses, tangents, n);
+
+  int res = 0;
+  for (int i=0; i<n; i++)
+    res += ((Steel01 *)theMaterials[i])->Steel01::setTrial(strains[i], stresses[i], tangents[i]);
+
+  return res;
+}
+
 double Steel01::getStrain ()
 {
    return Tstrain;
@@ -364,6 +364,27 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
 
 
+// all the materials are Steel02, so their state determination is invoked
+// directly rather than through a virtual call for each
+int
+Steel02::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+                         double *stresses, double *tangents, int n)
+{
+  // a subclass does its own state determination
+  if (this->getClassTag() != MAT_TAG_Steel02)
+    return this->UniaxialMaterial::setTrialStrains(theMaterials, strains, stresses, tangents, n);
+
+  int res = 0;
+  for (int i=0; i<n; i++) {
+    Steel02 *theMat = (Steel02 *)theMaterials[i];
+    res += theMat->Steel02::setTrialStrain(strains[i]);
+    stresses[i] = theMat->sig;
+    tangents[i] = theMat->e;
+  }
+
+  return res;
+}
+
 double 
 Steel02::getStrain(void)
 {
@@ -66,8 +66,10 @@ class Steel02 : public UniaxialMaterial
 
     double getInitialTangent(void);
     UniaxialMaterial *getCopy(void);
+    bool isThreadSafe(void) const {return true;};
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialStrains(UniaxialMaterial **theMaterials, const double *strains, double *stresses, double *tangents, int n);
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
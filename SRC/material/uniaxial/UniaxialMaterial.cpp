@@ -100,6 +100,52 @@ UniaxialMaterial::setTrial(double strain, double &stress, double &tangent, doubl
 }
 
 
+int
+UniaxialMaterial::setTrialStrains(UniaxialMaterial **theMaterials, const double *strains,
+				  double *stresses, double *tangents, int n)
+{
+  int res = 0;
+  for (int i=0; i<n; i++)
+    res += theMaterials[i]->setTrial(strains[i], stresses[i], tangents[i]);
+
+  return res;
+}
+
+
+// places the n materials in groups of the same class, keeping their order
+// within a group. the materials of group g are placed in groupMaterials in
+// locations groupStart[g] through groupStart[g+1]-1 and position[i] is the
+// location of material i in groupMaterials; groupStart must be of size n+1.
+
+int
+UniaxialMaterial::groupByClass(UniaxialMaterial **theMaterials, int n, int *position,
+			       UniaxialMaterial **groupMaterials, int *groupStart)
+{
+  int numGroups = 0;
+  int numPlaced = 0;
+
+  for (int i=0; i<n; i++)
+    position[i] = -1;
+
+  groupStart[0] = 0;
+  for (int i=0; i<n; i++) {
+    if (position[i] >= 0)
+      continue;
+
+    int classTag = theMaterials[i]->getClassTag();
+    for (int j=i; j<n; j++)
+      if (position[j] < 0 && theMaterials[j]->getClassTag() == classTag) {
+	position[j] = numPlaced;
+	groupMaterials[numPlaced++] = theMaterials[j];
+      }
+
+    groupStart[++numGroups] = numPlaced;
+  }
+
+  return numGroups;
+}
+
+
 int
 UniaxialMaterial::setTrial(double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate)
 {
@@ -60,6 +60,17 @@ class UniaxialMaterial : public Material
 	virtual int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
 	virtual int setTrial (double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
 
+	// sets the trial strains of n materials, all of the same class as this
+	// one, and returns their stresses and tangents; a section so evaluates
+	// a group of fibers of the same material without a virtual call per fiber
+	virtual int setTrialStrains (UniaxialMaterial **theMaterials, const double *strains,
+				     double *stresses, double *tangents, int n);
+
+	// orders the n materials in groups of the same class, returning the
+	// number of groups; see UniaxialMaterial.cpp
+	static int groupByClass (UniaxialMaterial **theMaterials, int n, int *position,
+				 UniaxialMaterial **groupMaterials, int *groupStart);
+
 	virtual double getStrain (void) = 0;
     virtual double getStrainRate (void);
     virtual double getStress (void) = 0;
@@ -74,6 +85,10 @@ class UniaxialMaterial : public Material
     virtual int revertToStart (void) = 0;        
     
     virtual UniaxialMaterial *getCopy (void) = 0;
+
+    // true if the state determination of the material may run concurrently
+    // with that of other materials, i.e. it uses no shared scratch storage
+    virtual bool isThreadSafe(void) const {return false;};
     virtual UniaxialMaterial *getCopy(SectionForceDeformation *s);
     
     virtual Response *setResponse (const char **argv, int argc, 
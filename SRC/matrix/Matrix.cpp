@@ -51,13 +51,62 @@ using std::nothrow;
 
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
 
-//double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
+// work areas used by Solve(), Invert() and addMatrixTripleProduct(). each
+// thread has its own copy; the areas only ever grow, so once a large matrix
+// has passed through no further allocation takes place in that thread.
+class MatrixWorkArea
+{
+  public:
+    MatrixWorkArea()
+      :doubleWork(0), intWork(0), sizeDoubleWork(0), sizeIntWork(0)
+    {
+      this->setSize(MATRIX_WORK_AREA, INT_WORK_AREA);
+    }
+
+    ~MatrixWorkArea()
+    {
+      if (doubleWork != 0)
+	delete [] doubleWork;
+      if (intWork != 0)
+	delete [] intWork;
+    }
+
+    int setSize(int sizeDouble, int sizeInt)
+    {
+      if (sizeDouble > sizeDoubleWork) {
+	if (doubleWork != 0)
+	  delete [] doubleWork;
+	doubleWork = new (nothrow) double[sizeDouble];
+	sizeDoubleWork = sizeDouble;
+	if (doubleWork == 0) {
+	  sizeDoubleWork = 0;
+	  return -1;
+	}
+      }
+
+      if (sizeInt > sizeIntWork) {
+	if (intWork != 0)
+	  delete [] intWork;
+	intWork = new (nothrow) int[sizeInt];
+	sizeIntWork = sizeInt;
+	if (intWork == 0) {
+	  sizeIntWork = 0;
+	  return -1;
+	}
+      }
+
+      return 0;
+    }
+
+    double *doubleWork;
+    int *intWork;
+    int sizeDoubleWork;
+    int sizeIntWork;
+};
+
+static OPS_THREAD_LOCAL MatrixWorkArea theMatrixWorkArea;
 
 //
 // CONSTRUCTORS
@@ -66,32 +115,13 @@ int    *Matrix::intWork =0;
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
+
 }
 
 
 Matrix::Matrix(int nRows,int nCols)
 :numRows(nRows), numCols(nCols), dataSize(0), data(0), fromFree(0)
 {
-
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
-
 #ifdef _G3DEBUG
     if (nRows < 0) {
       opserr << "WARNING: Matrix::Matrix(int,int): tried to init matrix ";
@@ -126,16 +156,6 @@ Matrix::Matrix(int nRows,int nCols)
 Matrix::Matrix(double *theData, int row, int col) 
 :numRows(row),numCols(col),dataSize(row*col),data(theData),fromFree(1)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
-
 #ifdef _G3DEBUG
     if (row < 0) {
       opserr << "WARNING: Matrix::Matrix(int,int): tried to init matrix with numRows: ";
@@ -155,16 +175,6 @@ Matrix::Matrix(double *theData, int row, int col)
 Matrix::Matrix(const Matrix &other)
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
-
     numRows = other.numRows;
     numCols = other.numCols;
     dataSize = other.dataSize;
@@ -368,37 +378,14 @@ Matrix::Solve(const Vector &b, Vector &x) const
     }
 #endif
     
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    // check this thread's work area can hold all the data
+    MatrixWorkArea &theWork = theMatrixWorkArea;
+    if (theWork.setSize(dataSize, n) < 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
+    double *matrixWork = theWork.doubleWork;
+    int *intWork = theWork.intWork;
 
     
     // copy the data
@@ -462,37 +449,14 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
     }
 #endif
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    // check this thread's work area can hold all the data
+    MatrixWorkArea &theWork = theMatrixWorkArea;
+    if (theWork.setSize(dataSize, n) < 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
+    double *matrixWork = theWork.doubleWork;
+    int *intWork = theWork.intWork;
     
     x = b;
 
@@ -558,37 +522,14 @@ Matrix::Invert(Matrix &theInverse) const
     }
 #endif
 
-    // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    // check this thread's work area can hold all the data
+    MatrixWorkArea &theWork = theMatrixWorkArea;
+    if (theWork.setSize(dataSize, n) < 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
+    double *matrixWork = theWork.doubleWork;
+    int *intWork = theWork.intWork;
     
     // copy the data
     theInverse = *this;
@@ -600,7 +541,7 @@ Matrix::Invert(Matrix &theInverse) const
     int info;
     double *Wptr = matrixWork;
     double *Aptr = theInverse.data;
-    int workSize = sizeDoubleWork;
+    int workSize = theWork.sizeDoubleWork;
     
     int *iPIV = intWork;
     
@@ -938,10 +879,12 @@ Matrix::addMatrixTripleProduct(double thisFact,
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    MatrixWorkArea &theWork = theMatrixWorkArea;
+    if (theWork.setSize(sizeWork, 0) < 0) {
       this->addMatrix(thisFact, T^B*T, otherFact);
       return 0;
     }
+    double *matrixWork = theWork.doubleWork;
 
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
@@ -1032,10 +975,12 @@ Matrix::addMatrixTripleProduct(double thisFact,
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    MatrixWorkArea &theWork = theMatrixWorkArea;
+    if (theWork.setSize(sizeWork, 0) < 0) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
     }
+    double *matrixWork = theWork.doubleWork;
 
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
@@ -1853,11 +1798,11 @@ Matrix::Eigen3(const Matrix &M)
   int     rot, its, i, j , k ;
   double  g, h, aij, sm, thresh, t, c, s, tau ;
 
-  static Matrix  v(3,3) ;
-  static Vector  d(3) ;
-  static Vector  a(3) ;
-  static Vector  b(3) ; 
-  static Vector  z(3) ;
+  static OPS_THREAD_LOCAL Matrix  v(3,3) ;
+  static OPS_THREAD_LOCAL Vector  d(3) ;
+  static OPS_THREAD_LOCAL Vector  a(3) ;
+  static OPS_THREAD_LOCAL Vector  b(3) ; 
+  static OPS_THREAD_LOCAL Vector  z(3) ;
 
   static const double tol = 1.0e-08 ;
 
@@ -1977,7 +1922,7 @@ Matrix::Eigen3(const Matrix &M)
     sm = fabs(a(0)) + fabs(a(1)) + fabs(a(2)) ;
 
   } //end while sm
-  static Vector  dd(3) ;
+  static OPS_THREAD_LOCAL Vector  dd(3) ;
   if (d(0)>d(1))
     {
       if (d(0)>d(2))
@@ -38,6 +38,10 @@
 #include "TclNDMaterialTester.h"
 #include "Tcl2DMaterialTester.h"
 
+#include <MapOfTaggedObjects.h>
+#include <ArrayOfTaggedObjects.h>
+#include <HashOfTaggedObjects.h>
+
 #include <tcl.h>
 
 #include <stdio.h>
@@ -94,10 +98,11 @@ specifyModelBuilder(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
       (strcmp(argv[1],"Basic") == 0) || (strcmp(argv[1],"basicBuilder") == 0)) {
     int ndm =0;
     int ndf = 0;
+    TaggedObjectStorage *theStorage = 0;
     
     if (argc < 4) {
       opserr << "WARNING incorrect number of command arguments\n";
-      opserr << "model modelBuilderType -ndm ndm? <-ndf ndf?> \n";
+      opserr << "model modelBuilderType -ndm ndm? <-ndf ndf?> <-storage type?>\n";
       return TCL_ERROR;
     }
     
@@ -126,11 +131,43 @@ specifyModelBuilder(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
 	  }	  
 	argPos++;
       }
+
+      else if (strcmp(argv[argPos],"-storage") == 0) {
+	argPos++;
+	if (argPos < argc) {
+	  if (theStorage != 0)
+	    delete theStorage;
+	  theStorage = 0;
+	  if (strcmp(argv[argPos],"Hash") == 0 || strcmp(argv[argPos],"hash") == 0)
+	    theStorage = new HashOfTaggedObjects();
+	  else if (strcmp(argv[argPos],"Map") == 0 || strcmp(argv[argPos],"map") == 0)
+	    theStorage = new MapOfTaggedObjects();
+	  else if (strcmp(argv[argPos],"Array") == 0 || strcmp(argv[argPos],"array") == 0)
+	    theStorage = new ArrayOfTaggedObjects(1024);
+	  else {
+	    opserr << "WARNING unknown storage type: " << argv[argPos];
+	    opserr << "\nmodel modelBuilderType -ndm ndm? <-ndf ndf?> <-storage Hash|Map|Array>\n";
+	    return TCL_ERROR;
+	  }
+	}
+	argPos++;
+      }
       
       else // Advance to next input argument if there are no matches -- MHS
 	argPos++;
     }
     
+    // switch the domain over to the requested storage type, the
+    // domain only keeps empty copies of it
+    if (theStorage != 0) {
+      int res = theDomain.setStorage(*theStorage);
+      delete theStorage;
+      if (res < 0) {
+	opserr << "WARNING could not change the storage type - use wipe first\n";
+	return TCL_ERROR;
+      }
+    }
+
     // check that ndm was specified
     if (ndm == 0) {
       opserr << "WARNING need to specify ndm\n";
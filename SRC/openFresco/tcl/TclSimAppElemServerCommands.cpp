@@ -35,6 +35,7 @@
 #include <Node.h>
 #include <TCP_Socket.h>
 #include <TCP_SocketSSL.h>
+#include <TCP_SocketBuffered.h>
 #include <UDP_Socket.h>
 
 #include <ExperimentalElement.h>
@@ -45,12 +46,12 @@ int TclStartSimAppElemServer(ClientData clientData, Tcl_Interp *interp,
 { 
     if (argc < 3)  {
         opserr << "WARNING insufficient arguments\n"
-            << "Want: startSimAppElemServer eleTag ipPort <-udp> <-ssl>\n";
+            << "Want: startSimAppElemServer eleTag ipPort <-udp> <-ssl> <-buffered>\n";
         return TCL_ERROR;
     }
     
     int eleTag, ipPort;
-    int ssl = 0, udp = 0;
+    int ssl = 0, udp = 0, buffered = 0;
     Channel *theChannel = 0;
     
     if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK)  {
@@ -73,6 +74,8 @@ int TclStartSimAppElemServer(ClientData clientData, Tcl_Interp *interp,
             ssl = 1;
         else if (strcmp(argv[3], "-udp") == 0)
             udp = 1;
+        else if (strcmp(argv[3], "-buffered") == 0)
+            buffered = 1;
     }
     
     // setup the connection
@@ -96,6 +99,16 @@ int TclStartSimAppElemServer(ClientData clientData, Tcl_Interp *interp,
             return TCL_ERROR;
         }
     }
+    else if (buffered)  {
+        theChannel = new TCP_SocketBuffered(ipPort);
+        if (theChannel != 0) {
+            opserr << "\nBuffered TCP Channel successfully created: "
+                << "Waiting for Simulation Application Client...\n";
+        } else {
+            opserr << "WARNING could not create buffered TCP channel\n";
+            return TCL_ERROR;
+        }
+    }
     else  {
         theChannel = new TCP_Socket(ipPort);
         if (theChannel != 0) {
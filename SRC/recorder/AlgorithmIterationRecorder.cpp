@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/recorder/AlgorithmIterationRecorder.cpp,v $
+                                                                        
+                                                                        
+// File: ~/recorder/AlgorithmIterationRecorder.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// AlgorithmIterationRecorder.
+//
+// What: "@(#) AlgorithmIterationRecorder.cpp, revA"
+
+#include <AlgorithmIterationRecorder.h>
+#include <EquiSolnAlgo.h>
+#include <OPS_Stream.h>
+#include <Vector.h>
+#include <classTags.h>
+
+AlgorithmIterationRecorder::AlgorithmIterationRecorder(EquiSolnAlgo &theEquiAlgo,
+						       OPS_Stream &theOutput)
+  :Recorder(RECORDER_TAGS_AlgorithmIterationRecorder),
+   theAlgo(&theEquiAlgo), theOutputHandler(&theOutput), initializationDone(false)
+{
+
+}
+
+AlgorithmIterationRecorder::~AlgorithmIterationRecorder()
+{
+  if (theOutputHandler != 0) {
+    if (initializationDone == true) {
+      theOutputHandler->endTag(); // Data
+      theOutputHandler->endTag(); // OpenSeesOutput
+    }
+    delete theOutputHandler;
+  }
+}
+
+int 
+AlgorithmIterationRecorder::record(int commitTag, double timeStamp)
+{
+  if (theAlgo == 0 || theOutputHandler == 0)
+    return 0;
+
+  const Vector *data = theAlgo->getIterationData();
+  if (data == 0)
+    return 0;
+
+  if (initializationDone == false) {
+    theOutputHandler->tag("OpenSeesOutput");
+    theOutputHandler->tag("AlgorithmOutput");
+    theOutputHandler->attr("classTag", theAlgo->getClassTag());
+    theOutputHandler->attr("numColumns", data->Size());
+    theOutputHandler->endTag();
+    theOutputHandler->tag("Data");
+    initializationDone = true;
+  }
+
+  Vector values(*data);
+  return theOutputHandler->write(values);
+}
+
+int
+AlgorithmIterationRecorder::restart(void)
+{
+  return 0;
+}
@@ -0,0 +1,63 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/recorder/AlgorithmIterationRecorder.h,v $
+                                                                        
+                                                                        
+#ifndef AlgorithmIterationRecorder_h
+#define AlgorithmIterationRecorder_h
+
+// File: ~/recorder/AlgorithmIterationRecorder.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// AlgorithmIterationRecorder. An AlgorithmIterationRecorder is added to
+// an EquiSolnAlgo and writes the data the algorithm gives on each
+// iteration, see EquiSolnAlgo::getIterationData(), to an OPS_Stream.
+//
+// What: "@(#) AlgorithmIterationRecorder.h, revA"
+
+#include <Recorder.h>
+
+class EquiSolnAlgo;
+class OPS_Stream;
+
+class AlgorithmIterationRecorder : public Recorder
+{
+  public:
+    AlgorithmIterationRecorder(EquiSolnAlgo &theAlgo, OPS_Stream &theOutput);
+    ~AlgorithmIterationRecorder();    
+
+    int record(int commitTag, double timeStamp);
+    int restart(void);    
+
+  protected:
+
+  private:
+    EquiSolnAlgo *theAlgo;
+    OPS_Stream *theOutputHandler;
+    bool initializationDone;
+};
+
+#endif
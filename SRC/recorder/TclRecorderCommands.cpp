@@ -70,6 +70,7 @@
  #include <DataFileStream.h>
  #include <XmlFileStream.h>
  #include <BinaryFileStream.h>
+#include <FastBinaryFileStream.h>
  #include <DatabaseStream.h>
  #include <DummyStream.h>
  #include <TCP_Stream.h>
@@ -103,6 +104,7 @@
 
  #include <EquiSolnAlgo.h>
  #include <TclFeViewer.h>
+ #include <AlgorithmIterationRecorder.h>
 
  #ifdef _NOGRAPHICS
 
@@ -163,6 +165,7 @@
        int inetPort;
 	   bool closeOnWrite = false;
        bool doScientific = false;
+       bool fastOutput = false;
 
        ID *specificIndices = 0;
 
@@ -339,6 +342,11 @@
      } else if (strcmp(argv[loc], "-closeOnWrite") == 0) {
        closeOnWrite = true;
        loc += 1;
+
+     } else if (strcmp(argv[loc], "-fast") == 0) {
+       // buffered binary output written by a separate thread
+       fastOutput = true;
+       loc += 1;
      }
 
 	 else if ((strcmp(argv[loc],"-fileCSV") == 0) || (strcmp(argv[loc],"-csv") == 0)) {
@@ -410,7 +418,10 @@
 
 
        // construct the DataHandler
-       if (eMode == DATA_STREAM && fileName != 0) {
+       if (fastOutput == true && fileName != 0 && 
+	   (eMode == DATA_STREAM || eMode == DATA_STREAM_CSV || eMode == BINARY_STREAM)) {
+	 theOutputStream = new FastBinaryFileStream(fileName);
+       } else if (eMode == DATA_STREAM && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
        } else if (eMode == DATA_STREAM_CSV && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 1, closeOnWrite, precision, doScientific);
@@ -1052,6 +1063,7 @@
        int inetPort;
 
        bool closeOnWrite = false;
+       bool fastOutput = false;
 
        while (flags == 0 && pos < argc) {
 
@@ -1085,6 +1097,12 @@
        pos += 1;
      }
 
+     else if (strcmp(argv[pos], "-fast") == 0)  {
+       // buffered binary output written by a separate thread
+       fastOutput = true;
+       pos += 1;
+     }
+
 	 else if (strcmp(argv[pos],"-fileCSV") == 0) {
 	   fileName = argv[pos+1];
 	   const char *pwd = getInterpPWD(interp);
@@ -1292,7 +1310,10 @@
        }
 
        // construct the DataHandler
-       if (eMode == DATA_STREAM && fileName != 0) {
+       if (fastOutput == true && fileName != 0 && 
+	   (eMode == DATA_STREAM || eMode == DATA_STREAM_CSV || eMode == BINARY_STREAM)) {
+	 theOutputStream = new FastBinaryFileStream(fileName);
+       } else if (eMode == DATA_STREAM && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
        } else if (eMode == DATA_STREAM_CSV && fileName != 0) {
 	 theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 1, closeOnWrite, precision, doScientific);
@@ -1727,6 +1748,97 @@
      }
 
 
+     else if (strcmp(argv[1],"iterations") == 0) {
+
+	 if (theAlgorithm == 0) {
+	     opserr << "WARNING recorder iterations - only allowed as algorithmRecorder";
+	     return TCL_ERROR;
+	 }
+	 outputMode eMode = STANDARD_STREAM;
+	 const char *fileName = 0;
+	 const char *inetAddr = 0;
+	 int inetPort = 0;
+	 int precision = 6;
+	 bool doScientific = false;
+	 bool closeOnWrite = false;
+
+	 int pos = 2;
+	 while (pos < argc) {
+	   if (strcmp(argv[pos],"-file") == 0 && pos+1 < argc) {
+	     fileName = argv[pos+1];
+	     eMode = DATA_STREAM;
+	     pos += 2;
+	   }
+	   else if (strcmp(argv[pos],"-fileCSV") == 0 && pos+1 < argc) {
+	     fileName = argv[pos+1];
+	     eMode = DATA_STREAM_CSV;
+	     pos += 2;
+	   }
+	   else if ((strcmp(argv[pos],"-nees") == 0 || strcmp(argv[pos],"-xml") == 0) && pos+1 < argc) {
+	     fileName = argv[pos+1];
+	     eMode = XML_STREAM;
+	     pos += 2;
+	   }
+	   else if (strcmp(argv[pos],"-binary") == 0 && pos+1 < argc) {
+	     fileName = argv[pos+1];
+	     eMode = BINARY_STREAM;
+	     pos += 2;
+	   }
+	   else if ((strcmp(argv[pos],"-TCP") == 0 || strcmp(argv[pos],"-tcp") == 0) && pos+2 < argc) {
+	     inetAddr = argv[pos+1];
+	     if (Tcl_GetInt(interp, argv[pos+2], &inetPort) != TCL_OK) {
+	       opserr << "WARNING algorithmRecorder iterations -tcp inetAddress? port? - invalid port " << argv[pos+2] << endln;
+	       return TCL_ERROR;
+	     }
+	     eMode = TCP_STREAM;
+	     pos += 3;
+	   }
+	   else if (strcmp(argv[pos],"-precision") == 0 && pos+1 < argc) {
+	     if (Tcl_GetInt(interp, argv[pos+1], &precision) != TCL_OK) {
+	       opserr << "WARNING algorithmRecorder iterations -precision precision? - invalid precision " << argv[pos+1] << endln;
+	       return TCL_ERROR;
+	     }
+	     pos += 2;
+	   }
+	   else if (strcmp(argv[pos],"-scientific") == 0) {
+	     doScientific = true;
+	     pos++;
+	   }
+	   else if (strcmp(argv[pos],"-closeOnWrite") == 0) {
+	     closeOnWrite = true;
+	     pos++;
+	   }
+	   else {
+	     opserr << "WARNING algorithmRecorder iterations ?-file fileName? ?-fileCSV fileName? ?-xml fileName? ?-binary fileName? ?-tcp inetAddress port? ?-precision precision? ?-scientific? ?-closeOnWrite? - unknown option " << argv[pos] << endln;
+	     return TCL_ERROR;
+	   }
+	 }
+
+	 if (fileName != 0) {
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	 }
+
+	 OPS_Stream *theOutputStream = 0;
+	 if (eMode == DATA_STREAM && fileName != 0) {
+	   theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 0, closeOnWrite, precision, doScientific);
+	 } else if (eMode == DATA_STREAM_CSV && fileName != 0) {
+	   theOutputStream = new DataFileStream(fileName, OVERWRITE, 2, 1, closeOnWrite, precision, doScientific);
+	 } else if (eMode == XML_STREAM && fileName != 0) {
+	   theOutputStream = new XmlFileStream(fileName);
+	 } else if (eMode == BINARY_STREAM && fileName != 0) {
+	   theOutputStream = new BinaryFileStream(fileName);
+	 } else if (eMode == TCP_STREAM && inetAddr != 0) {
+	   theOutputStream = new TCP_Stream(inetPort, inetAddr);
+	 } else {
+	   theOutputStream = new StandardStream();
+	 }
+
+	 theOutputStream->setPrecision(precision);
+
+	 (*theRecorder) = new AlgorithmIterationRecorder(*theAlgorithm, *theOutputStream);
+     }
+
      else if (strcmp(argv[1],"increments") == 0) {
 
 	 int xLoc, yLoc, width, height;
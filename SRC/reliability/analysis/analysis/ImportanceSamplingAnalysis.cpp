@@ -43,6 +43,8 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <MatrixOperations.h>
+#include <Channel.h>
+#include <ID.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -80,6 +82,13 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+
+	processID = 0;
+	numChannels = 0;
+	theChannels = 0;
+	batchResults = 0;
+	batchStart = 0;
+	batchSize = 0;
 }
 
 
@@ -87,7 +96,37 @@ theOpenSeesDomain(passedOpenSeesDomain)
 
 ImportanceSamplingAnalysis::~ImportanceSamplingAnalysis()
 {
+	if (theChannels != 0)
+		delete [] theChannels;
+	if (batchResults != 0)
+		delete batchResults;
+}
+
+
+int
+ImportanceSamplingAnalysis::setProcessID(int dTag)
+{
+	processID = dTag;
+	return 0;
+}
+
+
+int
+ImportanceSamplingAnalysis::setChannels(int nChannels, Channel **theC)
+{
+	if (theChannels != 0)
+		delete [] theChannels;
+	theChannels = 0;
+
+	numChannels = nChannels;
+	if (numChannels == 0)
+		return 0;
 
+	theChannels = new Channel *[numChannels];
+	for (int i=0; i<numChannels; i++)
+		theChannels[i] = theC[i];
+
+	return 0;
 }
 
 
@@ -111,7 +150,7 @@ ImportanceSamplingAnalysis::analyze(void)
 	Vector x(numRV);
 	Vector z(numRV);
 	Vector u(numRV);
-	Vector randomArray(numRV);
+	Vector gValues(numLsf);
 	static NormalRV aStdNormRV(1,0.0,1.0);
 	bool failureHasOccured = false;
 
@@ -189,6 +228,27 @@ ImportanceSamplingAnalysis::analyze(void)
 	    return -1;
     }
 
+
+	// In a parallel analysis each sample uses its own stream of random
+	// numbers, so the results do not depend on the number of processes
+	if (numChannels != 0 && theRandomNumberGenerator->setStream(0) < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - a parallel analysis needs a " << endln
+		       << " random number generator with independent streams, e.g. Philox" << endln;
+		return -1;
+	}
+
+	// The other processes evaluate the samples the master sends them
+	if (numChannels != 0 && processID != 0) 
+		return this->runWorker(startPointY);
+
+	if (batchResults != 0)
+		delete batchResults;
+	batchResults = 0;
+	if (numChannels != 0)
+		batchResults = new Matrix(numRV+numLsf, numChannels+1);
+	batchStart = 0;
+	batchSize = 0;
+
     
 	// Initial declarations
 	Vector cov_of_q_bar(numLsf);
@@ -206,7 +266,6 @@ ImportanceSamplingAnalysis::analyze(void)
 	double govCov = 999.0;
 	//Vector temp1;
 	double temp2, denumerator;
-	bool FEconvergence;
 
 
 	// Prepare output file
@@ -223,59 +282,13 @@ ImportanceSamplingAnalysis::analyze(void)
 		}
 
 		
-		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
-		}
-		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-		}
-		seed = theRandomNumberGenerator->getSeed();
-		if (result < 0) {
-			opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
-				<< " random numbers for simulation." << endln;
+		// Obtain the sampling point and the limit-state function values; in a
+		// parallel analysis these may have been evaluated by another process
+		if (this->getSample(k, startPointY, u, gValues, isFirstSimulation, seed) < 0) {
+			opserr << "ImportanceSamplingAnalysis::analyze() - failed to evaluate sample" << endln;
+			this->stopWorkers();
 			return -1;
 		}
-		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
-
-		// Compute the point in standard normal space
-		//u = startPointY + chol_covariance * randomArray;
-        u = startPointY;
-		u.addVector(1.0, randomArray, samplingStdv);
-
-		// Transform into original space
-		result = theProbabilityTransformation->transform_u_to_x(u, x);
-		if (result < 0) {
-		  opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
-		  return -1;
-		}
-        
-        // update domain with new x values
-        for (int j = 0; j < numRV; j++) {
-            RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
-            int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
-            Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
-            
-            // now we should update the parameter value
-            theParam->update( x(j) );
-        }
-		
-        
-        // set values in the variable namespace
-        if (theGFunEvaluator->setVariables() < 0) {
-            opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
-                << " could not set variables in namespace. " << endln;
-            return -1;
-        }
-        
-		// Evaluate limit-state function
-		FEconvergence = true;
-		if (theGFunEvaluator -> runAnalysis() < 0) {
-			// In this case a failure happened during the analysis
-			// Hence, register this as failure
-            opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
-			FEconvergence = false;
-		}
 
 
 		LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
@@ -286,17 +299,7 @@ ImportanceSamplingAnalysis::analyze(void)
             theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
             int lsfTag = theLimitStateFunction->getTag();
 
-			// Set tag of "active" limit-state function
-			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
-
-            // set and evaluate LSF
-            const char *lsfExpression = theLimitStateFunction->getExpression();
-            theGFunEvaluator->setExpression(lsfExpression);
-            
-            gFunctionValue = theGFunEvaluator->evaluateExpression();
-            if (!FEconvergence) {
-				gFunctionValue = -1.0;
-			}
+            gFunctionValue = gValues(lsf);
 
 			
 			// ESTIMATION OF FAILURE PROBABILITY
@@ -473,6 +476,7 @@ ImportanceSamplingAnalysis::analyze(void)
 
 	// Step 'k' back a step now that we went out
 	k--;
+	this->stopWorkers();
 	opserr << endln;
 
 
@@ -612,3 +616,222 @@ ImportanceSamplingAnalysis::analyze(void)
 	return 0;
 }
 
+
+
+
+int
+ImportanceSamplingAnalysis::evaluateSample(long int k, const Vector &startPointY, 
+					   Vector &u, Vector &gValues, 
+					   bool isFirstSimulation, int &seed)
+{
+	int result;
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	// u never holds the point of a previous sample, even if this one fails
+	u = startPointY;
+
+	// Create array of standard normal random numbers; a generator with
+	// independent streams uses stream k for sample k
+	if (theRandomNumberGenerator->setStream(k) == 0) {
+		result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+	}
+	else if (isFirstSimulation) {
+		result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+	}
+	else {
+		result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+	}
+	seed = theRandomNumberGenerator->getSeed();
+	if (result < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - could not generate" << endln
+			<< " random numbers for simulation." << endln;
+		return -1;
+	}
+	const Vector &randomArray = theRandomNumberGenerator->getGeneratedNumbers();
+
+	// Compute the point in standard normal space
+	//u = startPointY + chol_covariance * randomArray;
+	u = startPointY;
+	u.addVector(1.0, randomArray, samplingStdv);
+
+	// Transform into original space
+	Vector x(numRV);
+	result = theProbabilityTransformation->transform_u_to_x(u, x);
+	if (result < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - could not transform u to x. " << endln;
+		return -1;
+	}
+        
+	// update domain with new x values
+	for (int j = 0; j < numRV; j++) {
+		int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+		Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+		theParam->update( x(j) );
+	}
+        
+	// set values in the variable namespace
+	if (theGFunEvaluator->setVariables() < 0) {
+		opserr << "ImportanceSamplingAnalysis::analyze() - " << endln
+			<< " could not set variables in namespace. " << endln;
+		return -1;
+	}
+        
+	// Evaluate limit-state function
+	bool FEconvergence = true;
+	if (theGFunEvaluator -> runAnalysis() < 0) {
+		// In this case a failure happened during the analysis
+		// Hence, register this as failure
+		opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
+		FEconvergence = false;
+	}
+
+	for (int lsf = 0; lsf < numLsf; lsf++ ) {
+		LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+
+		// Set tag of "active" limit-state function
+		theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
+
+		// set and evaluate LSF
+		theGFunEvaluator->setExpression(theLimitStateFunction->getExpression());
+		gValues(lsf) = theGFunEvaluator->evaluateExpression();
+		if (!FEconvergence) {
+			gValues(lsf) = -1.0;
+		}
+	}
+
+	return 0;
+}
+
+
+//
+// In a parallel analysis the master evaluates sample k itself and sends
+// samples k+1, k+2, ... to the other processes. The results are held in
+// batchResults and handed back to analyze() in sample order, so the
+// estimates are accumulated exactly as in a sequential analysis. A sample
+// that cannot be evaluated stops the analysis whichever process drew it,
+// as in a sequential analysis; the other results of the batch are still
+// received so the processes stay in step until they are stopped.
+//
+
+int
+ImportanceSamplingAnalysis::getSample(long int k, const Vector &startPointY, 
+				      Vector &u, Vector &gValues, 
+				      bool isFirstSimulation, int &seed)
+{
+	if (numChannels == 0)
+		return this->evaluateSample(k, startPointY, u, gValues, isFirstSimulation, seed);
+
+	int numRV = u.Size();
+	int numLsf = gValues.Size();
+
+	if (k < batchStart || k >= batchStart + batchSize) {
+
+		long int maxSample = (numberOfSimulations > 2) ? numberOfSimulations : 2;
+		batchStart = k;
+		batchSize = 1;
+
+		static ID sampleData(2);
+		for (int i=0; i<numChannels && k+1+i <= maxSample; i++) {
+			sampleData(0) = 1;
+			sampleData(1) = k+1+i;
+			if (theChannels[i]->sendID(0, 0, sampleData) < 0) {
+				opserr << "ImportanceSamplingAnalysis::getSample() - failed to send sample to process " << i+1 << endln;
+				return -1;
+			}
+			batchSize++;
+		}
+
+		int result = this->evaluateSample(k, startPointY, u, gValues, isFirstSimulation, seed);
+
+		Matrix &theResults = *batchResults;
+		for (int j=0; j<numRV; j++)
+			theResults(j,0) = u(j);
+		for (int j=0; j<numLsf; j++)
+			theResults(numRV+j,0) = gValues(j);
+
+		// the last entry is the result of evaluateSample() on the process
+		Vector sampleResult(numRV+numLsf+1);
+		for (int i=1; i<batchSize; i++) {
+			if (theChannels[i-1]->recvVector(0, 0, sampleResult) < 0) {
+				opserr << "ImportanceSamplingAnalysis::getSample() - failed to receive sample from process " << i << endln;
+				return -1;
+			}
+			if (sampleResult(numRV+numLsf) < 0.0) {
+				opserr << "ImportanceSamplingAnalysis::getSample() - process " << i;
+				opserr << " failed to evaluate sample " << k+i << endln;
+				result = -1;
+			}
+			for (int j=0; j<numRV+numLsf; j++)
+				theResults(j,i) = sampleResult(j);
+		}
+
+		return result;
+	}
+
+	int loc = k - batchStart;
+	Matrix &theResults = *batchResults;
+	for (int j=0; j<numRV; j++)
+		u(j) = theResults(j,loc);
+	for (int j=0; j<numLsf; j++)
+		gValues(j) = theResults(numRV+j,loc);
+
+	return 0;
+}
+
+
+int
+ImportanceSamplingAnalysis::runWorker(const Vector &startPointY)
+{
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	Vector u(numRV);
+	Vector gValues(numLsf);
+	Vector sampleResult(numRV+numLsf+1);
+	static ID sampleData(2);
+	int seed = 1;
+
+	Channel *theChannel = theChannels[0];
+	while (true) {
+		if (theChannel->recvID(0, 0, sampleData) < 0) {
+			opserr << "ImportanceSamplingAnalysis::runWorker() - failed to receive sample" << endln;
+			return -1;
+		}
+		if (sampleData(0) == 0)
+			break;
+
+		// a failed evaluation is sent back to the master, which stops the
+		// analysis as a sequential analysis would
+		int result = this->evaluateSample(sampleData(1), startPointY, u, gValues, false, seed);
+
+		for (int j=0; j<numRV; j++)
+			sampleResult(j) = u(j);
+		for (int j=0; j<numLsf; j++)
+			sampleResult(numRV+j) = gValues(j);
+		sampleResult(numRV+numLsf) = result;
+
+		if (theChannel->sendVector(0, 0, sampleResult) < 0) {
+			opserr << "ImportanceSamplingAnalysis::runWorker() - failed to send sample" << endln;
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+
+void
+ImportanceSamplingAnalysis::stopWorkers(void)
+{
+	if (numChannels == 0 || processID != 0)
+		return;
+
+	static ID sampleData(2);
+	sampleData(0) = 0;
+	sampleData(1) = 0;
+	for (int i=0; i<numChannels; i++)
+		theChannels[i]->sendID(0, 0, sampleData);
+
+	batchSize = 0;
+}
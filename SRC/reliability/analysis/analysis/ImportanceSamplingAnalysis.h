@@ -44,6 +44,9 @@
 #include <tcl.h>
 using std::ofstream;
 
+class Channel;
+class Matrix;
+
 class ImportanceSamplingAnalysis : public ReliabilityAnalysis
 {
 
@@ -65,9 +68,21 @@ public:
 	
 	int analyze(void);
 
+	// methods for a parallel analysis; process 0 drives the analysis
+	// and the others evaluate the samples it sends them
+	int setProcessID(int processTag);
+	int setChannels(int numChannels, Channel **theChannels);
+
 protected:
 	
 private:
+	int evaluateSample(long int k, const Vector &startPointY, Vector &u, 
+			   Vector &gValues, bool isFirstSimulation, int &seed);
+	int getSample(long int k, const Vector &startPointY, Vector &u, 
+		      Vector &gValues, bool isFirstSimulation, int &seed);
+	int runWorker(const Vector &startPointY);
+	void stopWorkers(void);
+
 	ReliabilityDomain *theReliabilityDomain;
     Domain *theOpenSeesDomain;
 	ProbabilityTransformation *theProbabilityTransformation;
@@ -80,6 +95,13 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+
+	int processID;
+	int numChannels;
+	Channel **theChannels;
+	Matrix *batchResults;   // u and g values of the samples in a batch
+	long int batchStart;
+	int batchSize;
 };
 
 #endif
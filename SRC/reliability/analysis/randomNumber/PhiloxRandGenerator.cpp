@@ -0,0 +1,223 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/analysis/randomNumber/PhiloxRandGenerator.cpp,v $
+
+//
+// Description: implementation of PhiloxRandGenerator; see Salmon et al., 
+// "Parallel random numbers: as easy as 1, 2, 3", SC11, 2011.
+//
+
+#include <RandomNumberGenerator.h>
+#include <PhiloxRandGenerator.h>
+#include <NormalRV.h>
+#include <Vector.h>
+#include <time.h>
+
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+
+
+PhiloxRandGenerator::PhiloxRandGenerator(int passedSeed)
+:RandomNumberGenerator(), generatedNumbers(0)
+{
+	this->setSeed(passedSeed);
+}
+
+
+PhiloxRandGenerator::~PhiloxRandGenerator()
+{
+	if (generatedNumbers != 0)
+		delete generatedNumbers;
+}
+
+
+void
+PhiloxRandGenerator::setSeed(int passedSeed)
+{
+	if (passedSeed != 0)
+		seed = passedSeed;
+	else
+		seed = time(NULL);
+
+	key[0] = (unsigned int)seed;
+	key[1] = 0;
+
+	this->setStream(0);
+}
+
+
+int
+PhiloxRandGenerator::getSeed()
+{
+	return seed;
+}
+
+
+int
+PhiloxRandGenerator::setStream(long int stream)
+{
+	unsigned long long theStream = (unsigned long long)stream;
+
+	counter[0] = 0;
+	counter[1] = 0;
+	counter[2] = (unsigned int)(theStream & 0xFFFFFFFFU);
+	counter[3] = (unsigned int)(theStream >> 32);
+
+	// force a new block on the next draw
+	blockPos = 4;
+
+	return 0;
+}
+
+
+void
+PhiloxRandGenerator::philox4x32(const unsigned int in[4], const unsigned int theKey[2],
+				unsigned int out[4])
+{
+	unsigned int ctr[4], k0, k1;
+	ctr[0] = in[0]; ctr[1] = in[1]; 
+	ctr[2] = in[2]; ctr[3] = in[3];
+	k0 = theKey[0]; k1 = theKey[1];
+
+	// ten rounds of the Philox4x32 bijection
+	for (int round = 0; round < 10; round++) {
+		if (round != 0) {
+			k0 += PHILOX_W0;
+			k1 += PHILOX_W1;
+		}
+		unsigned long long p0 = (unsigned long long)PHILOX_M0 * ctr[0];
+		unsigned long long p1 = (unsigned long long)PHILOX_M1 * ctr[2];
+		unsigned int hi0 = (unsigned int)(p0 >> 32);
+		unsigned int lo0 = (unsigned int)p0;
+		unsigned int hi1 = (unsigned int)(p1 >> 32);
+		unsigned int lo1 = (unsigned int)p1;
+		ctr[0] = hi1 ^ ctr[1] ^ k0;
+		ctr[1] = lo1;
+		ctr[2] = hi0 ^ ctr[3] ^ k1;
+		ctr[3] = lo0;
+	}
+
+	out[0] = ctr[0]; out[1] = ctr[1]; 
+	out[2] = ctr[2]; out[3] = ctr[3];
+}
+
+
+void
+PhiloxRandGenerator::nextBlock(void)
+{
+	philox4x32(counter, key, block);
+	blockPos = 0;
+
+	// advance the position in the stream
+	if (++counter[0] == 0)
+		counter[1]++;
+}
+
+
+double
+PhiloxRandGenerator::nextUniform(void)
+{
+	if (blockPos > 2)
+		this->nextBlock();
+
+	// 53 random bits from two words, mapped to the open interval (0,1)
+	unsigned int a = block[blockPos++] >> 5;
+	unsigned int b = block[blockPos++] >> 6;
+
+	return (a*67108864.0 + b + 0.5) / 9007199254740992.0;
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+{
+	if (seedIn != 0)
+		this->setSeed(seedIn);
+
+	if (generatedNumbers == 0) {
+		generatedNumbers = new Vector(n);
+	}
+	else if (generatedNumbers->Size() != n) {
+		delete generatedNumbers;
+		generatedNumbers = new Vector(n);
+	}
+	Vector &randomArray = *generatedNumbers;
+
+	for (int j=0; j<n; j++)
+		randomArray(j) = (upper-lower)*this->nextUniform() + lower;
+
+	return 0;
+}
+
+
+int
+PhiloxRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+{
+	if (seedIn != 0)
+		this->setSeed(seedIn);
+
+	if (generatedNumbers == 0) {
+		generatedNumbers = new Vector(n);
+	}
+	else if (generatedNumbers->Size() != n) {
+		delete generatedNumbers;
+		generatedNumbers = new Vector(n);
+	}
+	Vector &randomArray = *generatedNumbers;
+
+	// uniform numbers are never exactly 0 or 1, so the inverse
+	// of the standard normal CDF is always defined
+	static NormalRV uRV(1, 0.0, 1.0);
+	for (int j=0; j<n; j++)
+		randomArray(j) = uRV.getInverseCDFvalue(this->nextUniform());
+
+	return 0;
+}
+
+
+const Vector&
+PhiloxRandGenerator::getGeneratedNumbers()
+{
+	return (*generatedNumbers);
+}
+
+
+double 
+PhiloxRandGenerator::generate_singleUniformNumber(double lower, double upper)
+{
+	return (upper-lower)*this->nextUniform() + lower;
+}
+
+
+double
+PhiloxRandGenerator::generate_singleStdNormalNumber(void)
+{
+	static NormalRV uRV(1, 0.0, 1.0);
+	return uRV.getInverseCDFvalue(this->nextUniform());
+}
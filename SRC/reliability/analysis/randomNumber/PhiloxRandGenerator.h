@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/analysis/randomNumber/PhiloxRandGenerator.h,v $
+
+//
+// Description: PhiloxRandGenerator is a counter-based random number 
+// generator (the Philox4x32-10 bijection). The numbers produced are a 
+// pure function of the seed, the stream and the position in the stream,
+// so a sampling analysis that uses stream k for sample k obtains the same
+// sample regardless of which process evaluates it or in which order.
+//
+
+#ifndef PhiloxRandGenerator_h
+#define PhiloxRandGenerator_h
+
+#include <RandomNumberGenerator.h>
+#include <Vector.h>
+
+class PhiloxRandGenerator : public RandomNumberGenerator
+{
+
+public:
+	PhiloxRandGenerator(int seed = 1);
+	~PhiloxRandGenerator();
+
+	int		generate_nIndependentStdNormalNumbers(int n, int seed=0);
+	int     generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+	const   Vector& getGeneratedNumbers();
+	int     getSeed();
+    
+ 	double  generate_singleStdNormalNumber();		
+ 	double  generate_singleUniformNumber(double lower=0.0, double upper=1.0);		
+ 	void    setSeed(int passedSeed=0);
+
+	int     setStream(long int stream);
+
+	// the Philox4x32-10 bijection of a counter under a key
+	static void philox4x32(const unsigned int ctr[4], const unsigned int key[2],
+			       unsigned int out[4]);
+
+protected:
+
+private:
+	double  nextUniform(void);
+	void    nextBlock(void);
+
+	Vector *generatedNumbers;
+	int seed;
+
+	unsigned int key[2];      // from the seed
+	unsigned int counter[4];  // position in stream (0,1) and the stream (2,3)
+	unsigned int block[4];    // output of the bijection for current counter
+	int blockPos;             // next unused word in block
+};
+
+#endif
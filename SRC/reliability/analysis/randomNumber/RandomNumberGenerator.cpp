@@ -41,4 +41,10 @@ RandomNumberGenerator::~RandomNumberGenerator()
 {
 }
 
+int
+RandomNumberGenerator::setStream(long int stream)
+{
+	return -1;
+}
+
 
@@ -53,6 +53,10 @@ public:
 	virtual double  generate_singleUniformNumber(double lower=0.0, double upper=1.0)=0;		
 	virtual void setSeed(int)=0;
 
+	// select an independent stream of numbers, e.g. one per sample;
+	// returns -1 if the generator has only a single sequence
+	virtual int setStream(long int stream);
+
 
 protected:
 
@@ -0,0 +1,89 @@
+
+// Description: known answer test of PhiloxRandGenerator. The bijection is
+// checked against the Philox4x32-10 vectors published with the Random123
+// library (kat_vectors), and the generator is checked to give the same
+// numbers for a stream regardless of the streams drawn before it.
+//
+// usage: testPhilox, exits with the number of failed checks
+
+#include <StandardStream.h>
+#include <PhiloxRandGenerator.h>
+#include <Vector.h>
+#include <stdlib.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static const unsigned int katCounter[3][4] = {
+  {0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U},
+  {0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU},
+  {0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U}
+};
+
+static const unsigned int katKey[3][2] = {
+  {0x00000000U, 0x00000000U},
+  {0xffffffffU, 0xffffffffU},
+  {0xa4093822U, 0x299f31d0U}
+};
+
+static const unsigned int katResult[3][4] = {
+  {0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U},
+  {0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU},
+  {0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U}
+};
+
+// main routine
+int main(int argc, char **argv)
+{
+  int numFailed = 0;
+
+  // the bijection
+  for (int i=0; i<3; i++) {
+    unsigned int out[4];
+    PhiloxRandGenerator::philox4x32(katCounter[i], katKey[i], out);
+    for (int j=0; j<4; j++)
+      if (out[j] != katResult[i][j]) {
+	opserr << "FAILED - known answer " << i << " word " << j << endln;
+	numFailed++;
+      }
+  }
+
+  // a stream gives the same numbers whatever was drawn before
+  int n = 11;
+  PhiloxRandGenerator theGenerator1(12345);
+  PhiloxRandGenerator theGenerator2(12345);
+
+  theGenerator1.setStream(7);
+  theGenerator1.generate_nIndependentUniformNumbers(n, 0.0, 1.0);
+  Vector stream7 = theGenerator1.getGeneratedNumbers();
+
+  theGenerator2.setStream(3);
+  theGenerator2.generate_nIndependentUniformNumbers(5, 0.0, 1.0);
+  theGenerator2.setStream(7);
+  theGenerator2.generate_nIndependentUniformNumbers(n, 0.0, 1.0);
+  const Vector &again = theGenerator2.getGeneratedNumbers();
+
+  for (int k=0; k<n; k++) {
+    if (stream7(k) != again(k)) {
+      opserr << "FAILED - stream 7 number " << k << " not reproduced\n";
+      numFailed++;
+    }
+    if (stream7(k) <= 0.0 || stream7(k) >= 1.0) {
+      opserr << "FAILED - uniform number " << k << " not in (0,1)\n";
+      numFailed++;
+    }
+  }
+
+  // different streams differ
+  theGenerator2.setStream(8);
+  theGenerator2.generate_nIndependentUniformNumbers(n, 0.0, 1.0);
+  if (theGenerator2.getGeneratedNumbers()(0) == stream7(0)) {
+    opserr << "FAILED - streams 7 and 8 start with the same number\n";
+    numFailed++;
+  }
+
+  if (numFailed == 0)
+    opserr << "PhiloxRandGenerator - all checks passed\n";
+
+  exit(numFailed);
+}
@@ -100,6 +100,7 @@ using std::setiosflags;
 #include <SearchWithStepSizeAndStepDirection.h>
 #include <RandomNumberGenerator.h>
 #include <CStdLibRandGenerator.h>
+#include <PhiloxRandGenerator.h>
 #include <FindCurvatures.h>
 #include <FirstPrincipalCurvature.h>
 #include <CurvaturesBySearchAlgorithm.h>
@@ -198,6 +199,12 @@ extern Integrator* theSensitivityIntegrator;
 /////E Modified by K Fujimura /////////////////////////////
 /////////////////////////////////////////////////////////
 
+#ifdef _PARALLEL_INTERPRETERS
+extern Channel **theChannels;
+extern int numChannels;
+extern int OPS_rank;
+#endif
+
 //
 // SOME STATIC POINTERS USED IN THE FUNCTIONS INVOKED BY THE INTERPRETER
 //
@@ -2169,6 +2176,15 @@ TclReliabilityModelBuilder_addRandomNumberGenerator(ClientData clientData, Tcl_I
   if (strcmp(argv[1],"CStdLib") == 0) {
 	  theRandomNumberGenerator = new CStdLibRandGenerator();
   }
+  else if (strcmp(argv[1],"Philox") == 0) {
+	  // randomNumberGenerator Philox <seed>
+	  int seed = 1;
+	  if (argc > 2 && Tcl_GetInt(interp, argv[2], &seed) != TCL_OK) {
+		  opserr << "ERROR: invalid input: seed \n";
+		  return TCL_ERROR;
+	  }
+	  theRandomNumberGenerator = new PhiloxRandGenerator(seed);
+  }
   else {
 	opserr << "ERROR: unrecognized type of RandomNumberGenerator \n";
 	return TCL_ERROR;
@@ -4120,8 +4136,10 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	//     -print 1   (print to screen)
 	//     -print 2   (print to restart file)
 	//
+	//     -parallel  (share the samples among the processes of OpenSeesMP)
+	//
 
-	if (argc!=2 && argc!=4 && argc!=6 && argc!=8 && argc!=10 && argc!=12) {
+	if (argc < 2) {
 		opserr << "ERROR: Wrong number of arguments to Sampling analysis" << endln;
 		return TCL_ERROR;
 	}
@@ -4133,11 +4151,20 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	double samplingVariance	= 1.0;
 	int printFlag			= 0;
 	int analysisTypeTag		= 1;
+	bool parallel			= false;
 
 
 	for (int i=2; i<argc; i=i+2) {
 
-		if (strcmp(argv[i],"-type") == 0) {
+		if (strcmp(argv[i],"-parallel") == 0) {
+			parallel = true;
+			i--; // no value follows
+		}
+		else if (i+1 >= argc) {
+			opserr << "ERROR: Wrong number of arguments to Sampling analysis" << endln;
+			return TCL_ERROR;
+		}
+		else if (strcmp(argv[i],"-type") == 0) {
 
 			if (strcmp(argv[i+1],"failureProbability") == 0) {
 				analysisTypeTag = 1;
@@ -4232,6 +4259,15 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 		return TCL_ERROR;
 	}
 
+	if (parallel == true) {
+#ifdef _PARALLEL_INTERPRETERS
+		theImportanceSamplingAnalysis->setProcessID(OPS_rank);
+		theImportanceSamplingAnalysis->setChannels(numChannels, theChannels);
+#else
+		opserr << "WARNING: -parallel needs the parallel interpreter (OpenSeesMP); running sequentially \n";
+#endif
+	}
+
 	// Now run analysis
 	theImportanceSamplingAnalysis->analyze();
 
@@ -42,9 +42,9 @@
 
 
 
-ArpackSOE::ArpackSOE(double s)
+ArpackSOE::ArpackSOE(double s, bool warm)
 :EigenSOE(EigenSOE_TAGS_ArpackSOE),
- M(0), Msize(0), mDiagonal(false), shift(s), theModel(0), theSOE(0),
+ M(0), Msize(0), mDiagonal(false), shift(s), warmStart(warm), theModel(0), theSOE(0),
  processID(-1), numChannels(0), theChannels(0), localCol(0), sizeLocal(0)
 {
   ArpackSolver *theSolvr = new ArpackSolver();
@@ -264,6 +264,24 @@ ArpackSOE::getShift(void)
     return shift;
 }
 
+void
+ArpackSOE::setShift(double newShift)
+{
+    shift = newShift;
+}
+
+bool
+ArpackSOE::getWarmStart(void)
+{
+    return warmStart;
+}
+
+void
+ArpackSOE::setWarmStart(bool newWarmStart)
+{
+    warmStart = newWarmStart;
+}
+
 
 int 
 ArpackSOE::sendSelf(int commitTag, Channel &theChannel)
@@ -339,6 +357,15 @@ ArpackSOE::sendSelf(int commitTag, Channel &theChannel)
     return -1;
   }
 
+  // the remote SOE adds -shift*M to its part of A
+  Vector data(1);
+  data(0) = shift;
+  res = theChannel.sendVector(0, commitTag, data);
+  if (res < 0) {
+    opserr <<"WARNING ArpackSOE::sendSelf() - failed to send shift\n";
+    return -1;
+  }
+
   return 0;  
 }
 
@@ -355,6 +382,14 @@ ArpackSOE::recvSelf(int commitTag, Channel &theChannel,
   }	      
   processID = idData(0);
 
+  Vector data(1);
+  res = theChannel.recvVector(0, commitTag, data);
+  if (res < 0) {
+    opserr <<"WARNING ArpackSOE::recvSelf() - failed to recv shift\n";
+    return -1;
+  }	      
+  shift = data(0);
+
   numChannels = 1;
   theChannels = new Channel *[1];
   theChannels[0] = &theChannel;
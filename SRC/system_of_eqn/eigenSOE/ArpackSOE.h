@@ -26,6 +26,10 @@
 // Created: 05/09
 //
 // Description: This file contains the class definition for ArpackSOE
+// The A matrix of the LinearSOE set holds K - shift*M, the ArpackSolver
+// performs a shift and invert Lanczos about the shift. If warmStart is
+// true the previous eigenvectors stored at the nodes are used to form
+// the starting vector.
 
 
 #ifndef ArpackSOE_h
@@ -41,7 +45,7 @@ class LinearSOE;
 class ArpackSOE : public EigenSOE
 {
   public:
-    ArpackSOE(double shift = 0.0);
+    ArpackSOE(double shift = 0.0, bool warmStart = false);
 
     ~ArpackSOE();
 
@@ -58,6 +62,9 @@ class ArpackSOE : public EigenSOE
     void zeroM(void);
 
     double getShift(void);
+    void setShift(double newShift);
+    bool getWarmStart(void);
+    void setWarmStart(bool newWarmStart);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
@@ -73,6 +80,7 @@ class ArpackSOE : public EigenSOE
     int Msize;
     bool mDiagonal;
     double shift;
+    bool warmStart;
     AnalysisModel *theModel;
     LinearSOE *theSOE;
 
@@ -49,6 +49,10 @@
 #include <AnalysisModel.h>
 #include <DOF_GrpIter.h>
 #include <DOF_Group.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Matrix.h>
+#include <ID.h>
 #include <FE_EleIter.h>
 #include <FE_Element.h>
 #include <Integrator.h>
@@ -60,7 +64,7 @@ static int sizeWork = 0;
 
 ArpackSolver::ArpackSolver()
 :EigenSolver(EigenSOLVER_TAGS_ArpackSolver),
- theSOE(0), numModesMax(0), numMode(0), size(0),
+ theSOE(0), numModesMax(0), numEqnMax(0), numMode(0), size(0),
  eigenvalues(0), eigenvectors(0), 
  v(0), workl(0), workd(0), resid(0), select(0)
 {
@@ -135,15 +139,13 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
   }
 
   theSOE = theArpackSOE->theSOE;
+  shift = theArpackSOE->getShift();
 
   if (theSOE == 0) {
     opserr << "ArpackSolver::setSize() - no LinearSOE set\n";
     return -1;
   }
   
-  // set up the space for ARPACK functions.
-  // this is done each time method is called!! .. this needs to be cleaned up
-  
   int n = size;
   int nev = numModes;
   int ncv = getNCV(n, nev);
@@ -152,9 +154,9 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 
   int processID = theArpackSOE->processID;
   
-  // set up the space for ARPACK functions.
-  // this is done each time method is called!! .. this needs to be cleaned up
-  if (numModes > numModesMax) {
+  // set up the space for ARPACK functions, only done if more modes are
+  // requested or the number of equations has changed since the last call
+  if (numModes > numModesMax || n != numEqnMax) {
     
     if (v != 0) delete [] v;
     if (workl != 0) delete [] workl;
@@ -181,6 +183,7 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
       v[i] = 0;
     
     numModesMax = numModes;
+    numEqnMax = n;
   }
 
   static char which[3];
@@ -197,6 +200,10 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
   // some more variables
   double tol = 0.0;
   int info = 0;
+
+  // an info of 1 has ARPACK start from the vector in resid
+  if (theArpackSOE->warmStart == true)
+    info = this->setStartVector(n);
   int maxitr = 1000;
   int mode = 3;
   
@@ -339,8 +346,12 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
       opserr << "unrecognised return value\n";
     }
     
+    delete [] eigenvalues;
+    delete [] eigenvectors;
     eigenvalues = 0;
     eigenvectors = 0;
+    numModesMax = 0;
+    numMode = 0;
     
     return info;
   } else {
@@ -453,6 +464,52 @@ ArpackSolver::getNCV(int n, int nev)
 }
 
 
+int
+ArpackSolver::setStartVector(int n)
+{
+  // the vector is the sum of the eigenvectors stored at the nodes, which 
+  // span the space sought if the model has not changed much since they 
+  // were found; returns 1 if resid is set, 0 if ARPACK is to pick it
+  AnalysisModel *theAnalysisModel = theArpackSOE->theModel;
+  if (theArpackSOE->processID != -1 || theAnalysisModel == 0)
+    return 0;
+
+  Domain *theDomain = theAnalysisModel->getDomainPtr();
+  if (theDomain == 0)
+    return 0;
+
+  for (int i=0; i<n; i++)
+    resid[i] = 0.0;
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theAnalysisModel->getDOFs();
+  while ((dofPtr = theDofs()) != 0) {
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+    if (theNode == 0)
+      continue;
+
+    // nodes with transformed dof are skipped, resid is only a start
+    const ID &theID = dofPtr->getID();
+    int numVectors = theNode->getNumEigenvectors();
+    if (numVectors == 0 || theID.Size() != theNode->getNumberDOF())
+      continue;
+
+    const Matrix &theEigenvectors = theNode->getEigenvectors();
+    for (int i=0; i<theID.Size(); i++) {
+      int loc = theID(i);
+      if (loc >= 0 && loc < n)
+	for (int j=0; j<numVectors; j++)
+	  resid[loc] += theEigenvectors(i,j);
+    }
+  }
+
+  for (int i=0; i<n; i++)
+    if (resid[i] != 0.0)
+      return 1;
+
+  return 0;
+}
+
 void
 ArpackSolver::myMv(int n, double *v, double *result)
 {
@@ -583,11 +640,13 @@ ArpackSolver::setSize()
 {
   size = theArpackSOE->Msize;
 
-  if (sizeWork < size)
+  if (sizeWork < size) {
     if (workArea != 0)
       delete [] workArea;
 
-  workArea = new double[size];
+    workArea = new double[size];
+    sizeWork = size;
+  }
   
   return 0;
 }
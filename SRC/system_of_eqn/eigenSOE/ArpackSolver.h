@@ -34,7 +34,10 @@
 // problems. ARPACK is capable of solving large scale non-Hermitian standard 
 // and generalized eigen problems. When the matrix <B>K</B> is symmetric, 
 // the method is a variant of the Lanczos process called Implicitly Restarted
-// Lanczos Method (IRLM).
+// Lanczos Method (IRLM). It is used in shift and invert mode, the LinearSOE
+// holding K - shift*M which is factored once for each solve(). The work
+// arrays are kept between calls and, if requested by the ArpackSOE, the 
+// starting vector is formed from the eigenvectors stored at the nodes.
 
 //
 // It is based on previous work of Jun Peng(Stanford)
@@ -73,6 +76,7 @@ class ArpackSolver : public EigenSolver
     LinearSOE *theSOE;
     ArpackSOE *theArpackSOE;
     int numModesMax;
+    int numEqnMax;
     int numMode;
     int size;
     double *eigenvalues;
@@ -92,6 +96,7 @@ class ArpackSolver : public EigenSolver
     void myMv(int n, double *v, double *result);
     void myCopy(int n, double *v, double *result);
     int getNCV(int n, int nev);
+    int setStartVector(int n);
 };
 
 #endif
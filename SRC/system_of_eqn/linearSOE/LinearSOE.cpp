@@ -32,6 +32,11 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include<CSR_Graph.h>
+#include<Graph.h>
+#include<Matrix.h>
+#include<ID.h>
+#include <PerformanceMonitor.h>
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
     :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
@@ -55,6 +60,8 @@ LinearSOE::~LinearSOE()
 int 
 LinearSOE::solve(void)
 {
+  PerformanceTimer theTimer(PERF_SOLVE);
+
   if (theSolver != 0)
     return (theSolver->solve());
   else 
@@ -86,6 +93,54 @@ LinearSOE::getSolver(void)
     return theSolver;
 }
 
+int 
+LinearSOE::setSize(CSR_Graph &theGraph)
+{
+  return this->setSize(theGraph.getGraph());
+}
+
+int 
+LinearSOE::addA(const int *rowStart, const int *colIndex, 
+		const double *values, double fact)
+{
+  if (fact == 0.0)
+    return 0;
+
+  // each entry is added on its own; an off-diagonal one as the (0,1)
+  // entry of a 2x2 matrix so that SOEs storing only the upper triangle
+  // pick it up from the row it is above the diagonal in
+  static Matrix diag(1,1);
+  static Matrix offDiag(2,2);
+  static ID diagID(1);
+  static ID offDiagID(2);
+
+  int result = 0;
+  int numEqn = this->getNumEqn();
+  for (int i=0; i<numEqn; i++) {
+    for (int k=rowStart[i]; k<rowStart[i+1]; k++) {
+      double value = values[k];
+      if (value == 0.0)
+	continue;
+
+      int j = colIndex[k];
+      if (j == i) {
+	diag(0,0) = value;
+	diagID(0) = i;
+	if (this->addA(diag, diagID, fact) < 0)
+	  result = -1;
+      } else {
+	offDiag(0,1) = value;
+	offDiagID(0) = i;
+	offDiagID(1) = j;
+	if (this->addA(offDiag, offDiagID, fact) < 0)
+	  result = -1;
+      }
+    }
+  }
+
+  return result;
+}
+
 int 
 LinearSOE::setLinks(AnalysisModel &theModel)
 {
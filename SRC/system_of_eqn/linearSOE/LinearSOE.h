@@ -43,6 +43,7 @@
 
 class LinearSOESolver;
 class Graph;
+class CSR_Graph;
 class Matrix;
 class Vector;
 class ID;
@@ -61,8 +62,15 @@ class LinearSOE : public MovableObject
     // pure virtual functions
     virtual int setSize(Graph &theGraph) =0;    
     virtual int getNumEqn(void) const =0;
+
+    // sizing from the compact adjacency, by default through the Graph
+    virtual int setSize(CSR_Graph &theGraph);
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0) =0;
+    // adds a matrix of order getNumEqn() in compressed sparse row form, 
+    // the columns of each row in ascending order; by default entry by entry
+    virtual int addA(const int *rowStart, const int *colIndex, 
+		     const double *values, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0) =0;    
     virtual int setB(const Vector &, double fact = 1.0) =0;        
 
@@ -18,8 +18,8 @@
 **                                                                    **
 ** ****************************************************************** */
                                                                         
-// $Revision: 1.1.1.1 $
-// $Date: 2000/09/15 08:23:29 $
+// $Revision: 1.2 $
+// $Date: 2026/10/17 $
 // $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h,v $
                                                                         
                                                                         
@@ -27,11 +27,13 @@
 //
 // Written: fmk 
 // Created: Mar 1998
-// Revision: A
+// Revision: B
 //
 // Description: This file contains the class definition for 
 // BandSPDLinThreadSolver. It solves the BandSPDLinSOE in parallel
-// using solaris threads.
+// using threads. The band is treated as a profile and factored in place
+// into LDL^t by a ProfileSPDLinThreadFactor using numThreads threads
+// (0 for one per processor).
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
@@ -39,28 +41,34 @@
 #define BandSPDLinThreadSolver_h
 
 #include <BandSPDLinSolver.h>
+#include <ProfileSPDLinThreadFactor.h>
+class ThreadPool;
 
 class BandSPDLinThreadSolver : public BandSPDLinSolver
 {
   public:
     BandSPDLinThreadSolver();    
-    BandSPDLinThreadSolver(int numProcessors, int blockSize);        
+    BandSPDLinThreadSolver(int numThreads, int blockSize, double tol = 1.0e-12);        
     ~BandSPDLinThreadSolver();
 
     int solve(void);
     int setSize(void);
-    
-    int sendSelf(Channel &theChannel, FEM_ObjectBroker &theBroker);
-    int recvSelf(Channel &theChannel, FEM_ObjectBroker &theBroker);    
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
     
   protected:
 
   private:
     int NP;
-    int running;
     int blockSize;
+    double minDiagTol;
+    int size;
+    int *RowTop;
+    double **topRowPtr;
+    ThreadPool *thePool;
+    ProfileSPDLinThreadFactor theFactor;
 };
 
 #endif
 
-
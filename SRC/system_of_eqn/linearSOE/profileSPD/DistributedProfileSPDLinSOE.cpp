@@ -31,6 +31,7 @@
 #include <ProfileSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -356,6 +357,13 @@ DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
   return result;    
 }
 
+// the processes exchange the Vertex based graph
+int 
+DistributedProfileSPDLinSOE::setSize(CSR_Graph &theGraph)
+{
+  return this->setSize(theGraph.getGraph());
+}
+
 
 int 
 DistributedProfileSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
@@ -53,6 +53,7 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     int setB(const Vector &, double fact = 1.0);            
     void zeroB(void);
     int setSize(Graph &theGraph);
+    int setSize(CSR_Graph &theGraph);
     int solve(void);
     const Vector &getB(void);
 
@@ -42,6 +42,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <PerformanceMonitor.h>
 //#include <Timer.h>
 
 ProfileSPDLinDirectSolver::ProfileSPDLinDirectSolver(double tol)
@@ -155,7 +156,10 @@ ProfileSPDLinDirectSolver::solve(void)
     
     if (theSOE->isAfactored == false)  {
 
-	// FACTOR & SOLVE
+	// FACTOR & SOLVE - the forward reduction is done with the
+	// factorization so the substitutions are timed with it
+	PerformanceTimer theTimer(PERF_FACTOR);
+
 	double *ajiPtr, *akjPtr, *akiPtr, *bjPtr;    
 	
 	// if the matrix has not been factored already factor it into U^t D U
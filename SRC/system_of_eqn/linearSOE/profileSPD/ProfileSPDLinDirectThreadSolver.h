@@ -18,8 +18,8 @@
 **                                                                    **
 ** ****************************************************************** */
                                                                         
-// $Revision: 1.1.1.1 $
-// $Date: 2000/09/15 08:23:30 $
+// $Revision: 1.2 $
+// $Date: 2026/10/17 $
 // $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h,v $
                                                                         
                                                                         
@@ -27,12 +27,14 @@
 //
 // Written: fmk 
 // Created: Febuary 1997
-// Revision: A
+// Revision: B
 //
 // Description: This file contains the class definition for 
 // ProfileSPDLinDirectThreadSolver. ProfileSPDLinDirectThreadSolver is a subclass 
 // of LinearSOESOlver. It solves a ProfileSPDLinSOE object using
-// the LDL^t factorization.
+// the LDL^t factorization, the blocked factorization of the
+// ProfileSPDLinDirectBlockSolver being performed by numThreads threads
+// (0 for one per processor) using a ProfileSPDLinThreadFactor.
 
 // What: "@(#) ProfileSPDLinDirectThreadSolver.h, revA"
 
@@ -40,13 +42,15 @@
 #define ProfileSPDLinDirectThreadSolver_h
 
 #include <ProfileSPDLinSolver.h>
+#include <ProfileSPDLinThreadFactor.h>
 class ProfileSPDLinSOE;
+class ThreadPool;
 
 class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinSolver
 {
   public:
     ProfileSPDLinDirectThreadSolver();      
-    ProfileSPDLinDirectThreadSolver(int numProcessors, int blockSize, double tol);    
+    ProfileSPDLinDirectThreadSolver(int numThreads, int blockSize, double tol);    
     virtual ~ProfileSPDLinDirectThreadSolver();
 
     virtual int solve(void);        
@@ -60,17 +64,16 @@ class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinSolver
 
   protected:
     int NP;
-    int running;
     
     double minDiagTol;
     int blockSize;
-    int maxColHeight;
     int size;
     int *RowTop;
-    double **topRowPtr, *invD;
+    double **topRowPtr;
     
   private:
-
+    ThreadPool *thePool;
+    ProfileSPDLinThreadFactor theFactor;
 };
 
 
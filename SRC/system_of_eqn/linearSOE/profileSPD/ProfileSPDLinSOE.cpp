@@ -33,6 +33,7 @@
 #include <ProfileSPDLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -152,27 +153,7 @@ int
 ProfileSPDLinSOE::setSize(Graph &theGraph)
 {
     int oldSize = size;
-    int result = 0;
-    size = theGraph.getNumVertex();
-
-    // check we have enough space in iDiagLoc and iLastCol
-    // if not delete old and create new
-    if (size > Bsize) { 
-	if (iDiagLoc != 0) delete [] iDiagLoc;
-	iDiagLoc = new (nothrow) int[size];
-
-	if (iDiagLoc == 0) {
-	    opserr << "WARNING ProfileSPDLinSOE::setSize() : ";
-	    opserr << " - ran out of memory for iDiagLoc\n";
-	    size = 0; Asize = 0;
-	    result = -1;
-	}
-    }
-
-    // zero out iDiagLoc 
-    for (int i=0; i<size; i++) {
-	iDiagLoc[i] = 0;
-    }
+    int result = this->setSizeDiagLoc(theGraph.getNumVertex());
 
     // now we go through the vertices to find the height of each col and
     // width of each row from the connectivity information.
@@ -198,7 +179,60 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
 	}
     }
 
+    return this->setSizeProfile(oldSize, result);
+}
 
+int
+ProfileSPDLinSOE::setSize(CSR_Graph &theGraph)
+{
+    int oldSize = size;
+    int result = this->setSizeDiagLoc(theGraph.getNumVertex());
+
+    // the adjacency of each vertex is sorted, so the height of each 
+    // col is given by the first entry
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+    for (int i=0; i<size; i++) 
+	if (start[i] != start[i+1] && adjacency[start[i]] < i)
+	    iDiagLoc[i] = i - adjacency[start[i]];
+
+    return this->setSizeProfile(oldSize, result);
+}
+
+// sets size, making sure iDiagLoc is large enough and zeroed
+int
+ProfileSPDLinSOE::setSizeDiagLoc(int newSize)
+{
+    int result = 0;
+    size = newSize;
+
+    // check we have enough space in iDiagLoc and iLastCol
+    // if not delete old and create new
+    if (size > Bsize) { 
+	if (iDiagLoc != 0) delete [] iDiagLoc;
+	iDiagLoc = new (nothrow) int[size];
+
+	if (iDiagLoc == 0) {
+	    opserr << "WARNING ProfileSPDLinSOE::setSize() : ";
+	    opserr << " - ran out of memory for iDiagLoc\n";
+	    size = 0; Asize = 0;
+	    result = -1;
+	}
+    }
+
+    // zero out iDiagLoc 
+    for (int i=0; i<size; i++) {
+	iDiagLoc[i] = 0;
+    }
+
+    return result;
+}
+
+// given the col heights in iDiagLoc, sets the profile and the storage for
+// A, B and X and then invokes setSize() on the solver
+int
+ProfileSPDLinSOE::setSizeProfile(int oldSize, int result)
+{
     // now go through iDiagLoc, adding 1 for the diagonal element
     // and then adding previous entry to give current location.
     if (iDiagLoc != 0)
@@ -353,6 +387,40 @@ ProfileSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
 }
 
     
+int 
+ProfileSPDLinSOE::addA(const int *rowStart, const int *colIndex, 
+		       const double *values, double fact)
+{
+    // subclasses may not hold the whole profile
+    if (this->getClassTag() != LinSOE_TAGS_ProfileSPDLinSOE)
+	return this->LinearSOE::addA(rowStart, colIndex, values, fact);
+
+    // check for a quick return 
+    if (fact == 0.0)  return 0;
+
+    // the entries of row i above the diagonal are in column i of the profile
+    for (int row=0; row<size; row++) {
+	for (int k=rowStart[row]; k<rowStart[row+1]; k++) {
+	    int col = colIndex[k];
+	    if (col < row || col >= size)
+		continue;
+
+	    int minColRow;
+	    if (col == 0)
+		minColRow = 0;
+	    else
+		minColRow = col - (iDiagLoc[col] - iDiagLoc[col-1]) +1;
+
+	    // we only add inside profile
+	    if (row >= minColRow)
+		A[iDiagLoc[col] -1 + row - col] += values[k] * fact;
+	}
+    }
+
+    return 0;
+}
+
+    
 int 
 ProfileSPDLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
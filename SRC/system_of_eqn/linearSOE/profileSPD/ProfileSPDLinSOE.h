@@ -51,7 +51,10 @@ class ProfileSPDLinSOE : public LinearSOE
 
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(CSR_Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addA(const int *rowStart, const int *colIndex, 
+		     const double *values, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);
     
@@ -88,6 +91,8 @@ class ProfileSPDLinSOE : public LinearSOE
     int numInt;
     
   private:
+    int setSizeDiagLoc(int newSize);
+    int setSizeProfile(int oldSize, int result);
 };
 
 
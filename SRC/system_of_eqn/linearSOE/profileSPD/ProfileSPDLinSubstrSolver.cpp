@@ -242,7 +242,7 @@ opserr << endln;
     theSOE->isAcondensed = true;
     theSOE->numInt = numInt;
 
-    opserr << "ProfileSPDLinSubstrSolver::condenseA  numDOF: " << size << "  numInt: " << numInt << "  numExt: " << size-numInt << endln;
+    //    opserr << "ProfileSPDLinSubstrSolver::condenseA  numDOF: " << size << "  numInt: " << numInt << "  numExt: " << size-numInt << endln;
 
     return 0;
 
@@ -443,18 +443,10 @@ ProfileSPDLinSubstrSolver::getCondensedRHS(void)
 	    opserr << "- ran out of memory for vector Size " << matSize << " \n";
 	    exit(-1);
 	}
-    }
-    
-    // check that current Yext is big enough if not enllarge
-    if (Yext->Size() != matSize) {
-	delete Yext;
-	Yext = new Vector(Y,matSize);
-	
-	if (Yext == 0 || Yext->Size() == 0) {
-	    opserr << "ProfileSPDLinSubstrSolver::getCondensedRHS";
-	    opserr << "- ran out of memory for vect Size " << matSize << " \n";
-	    exit(-1);
-	}
+    } else {
+	// Yext only wraps B, which the SOE reallocates when the subdomain
+	// changes, so it is pointed at the current B each time
+	Yext->setData(Y, matSize);
     }
     
     return *Yext;
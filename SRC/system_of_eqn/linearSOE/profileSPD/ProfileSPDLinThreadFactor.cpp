@@ -0,0 +1,438 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinThreadFactor.cpp,v $
+
+// File: ~/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinThreadFactor.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// ProfileSPDLinThreadFactor.
+//
+// What: "@(#) ProfileSPDLinThreadFactor.cpp, revA"
+
+#include <ProfileSPDLinThreadFactor.h>
+#include <OPS_Globals.h>
+#include <new>
+using std::nothrow;
+
+// states of a column block in the task graph
+#define PROFILE_BLOCK_WAITING 0   // waiting for a diagonal block
+#define PROFILE_BLOCK_QUEUED  1
+#define PROFILE_BLOCK_BUSY    2
+#define PROFILE_BLOCK_DONE    3   // diagonal block factored
+
+ProfileSPDLinThreadFactor::ProfileSPDLinThreadFactor(int blckSize)
+  :size(0), blockSize(blckSize), numBlocks(0), RowTop(0), topRowPtr(0), 
+   invD(0), minDiagTol(0.0),
+   firstStep(0), lastAffected(0), nextStep(0), state(0), theQueue(0),
+   queueStart(0), numQueued(0), numDiagDone(0), info(0), errRow(0), errValue(0.0)
+{
+  if (blockSize < 1)
+    blockSize = 1;
+
+#ifndef _WIN32
+  pthread_mutex_init(&theMutex, 0);
+  pthread_cond_init(&readyCond, 0);
+#endif
+}
+
+ProfileSPDLinThreadFactor::~ProfileSPDLinThreadFactor()
+{
+  if (invD != 0) delete [] invD;
+  if (firstStep != 0) delete [] firstStep;
+  if (lastAffected != 0) delete [] lastAffected;
+  if (nextStep != 0) delete [] nextStep;
+  if (state != 0) delete [] state;
+  if (theQueue != 0) delete [] theQueue;
+
+#ifndef _WIN32
+  pthread_cond_destroy(&readyCond);
+  pthread_mutex_destroy(&theMutex);
+#endif
+}
+
+int
+ProfileSPDLinThreadFactor::setSize(int n, int *theRowTop, double **theTopRowPtr)
+{
+  RowTop = theRowTop;
+  topRowPtr = theTopRowPtr;
+
+  if (n != size) {
+    if (invD != 0) delete [] invD;
+    invD = 0;
+    if (n > 0)
+      invD = new (nothrow) double[n];
+  }
+
+  int nBlck = n/blockSize;
+  if ((n % blockSize) != 0)
+    nBlck++;
+
+  if (nBlck != numBlocks) {
+    if (firstStep != 0) delete [] firstStep;
+    if (lastAffected != 0) delete [] lastAffected;
+    if (nextStep != 0) delete [] nextStep;
+    if (state != 0) delete [] state;
+    if (theQueue != 0) delete [] theQueue;
+    firstStep = 0; lastAffected = 0; nextStep = 0; state = 0; theQueue = 0;
+
+    if (nBlck > 0) {
+      firstStep = new (nothrow) int[nBlck];
+      lastAffected = new (nothrow) int[nBlck];
+      nextStep = new (nothrow) int[nBlck];
+      state = new (nothrow) int[nBlck];
+      theQueue = new (nothrow) int[nBlck];
+    }
+  }
+
+  size = n;
+  numBlocks = nBlck;
+
+  if (n > 0 && (invD == 0 || firstStep == 0 || lastAffected == 0 || 
+		nextStep == 0 || state == 0 || theQueue == 0)) {
+    opserr << "WARNING ProfileSPDLinThreadFactor::setSize() - ran out of memory\n";
+    size = 0;
+    numBlocks = 0;
+    return -1;
+  }
+
+  // determine the first block row reaching into each column block and
+  // the last column block reached by each block row
+  for (int b=0; b<numBlocks; b++) {
+    int first = b;
+    int lastCol = (b+1)*blockSize;
+    if (lastCol > size)
+      lastCol = size;
+    for (int c=b*blockSize; c<lastCol; c++)
+      if (RowTop[c]/blockSize < first)
+	first = RowTop[c]/blockSize;
+    firstStep[b] = first;
+    lastAffected[b] = b;
+  }
+  for (int b=0; b<numBlocks; b++)
+    if (lastAffected[firstStep[b]] < b)
+      lastAffected[firstStep[b]] = b;
+  for (int i=1; i<numBlocks; i++)
+    if (lastAffected[i] < lastAffected[i-1])
+      lastAffected[i] = lastAffected[i-1];
+
+  return 0;
+}
+
+int
+ProfileSPDLinThreadFactor::factor(ThreadPool &thePool, double tol)
+{
+  if (size == 0)
+    return 0;
+
+  minDiagTol = tol;
+
+  // set up the task graph
+  queueStart = 0;
+  numQueued = 0;
+  numDiagDone = 0;
+  info = 0;
+  for (int b=0; b<numBlocks; b++) {
+    nextStep[b] = firstStep[b];
+    if (firstStep[b] == b)
+      this->queueBlock(b);
+    else
+      state[b] = PROFILE_BLOCK_WAITING;
+  }
+
+  // each thread runs tasks until the graph is done
+  thePool.execute(*this, thePool.getNumThreads(), 1);
+
+  if (info != 0) {
+    if (errValue <= 0.0) {
+      opserr << "ProfileSPDLinThreadFactor::factor() - ";
+      opserr << " aii < 0 (i, aii): (" << errRow << ", " << errValue << ")\n"; 
+    } else {
+      opserr << "ProfileSPDLinThreadFactor::factor() - ";
+      opserr << " aii < minDiagTol (i, aii): (" << errRow;
+      opserr << ", " << errValue << ")\n"; 
+    }
+    return info;
+  }
+
+  return 0;
+}
+
+void
+ProfileSPDLinThreadFactor::solve(double *X) const
+{
+  // do forward substitution 
+  for (int i=1; i<size; i++) {
+    
+    int rowitop = RowTop[i];	    
+    double *ajiPtr = topRowPtr[i];
+    double *bjPtr  = &X[rowitop];  
+    double tmp = 0;	    
+    
+    for (int j=rowitop; j<i; j++) 
+      tmp -= *ajiPtr++ * *bjPtr++; 
+    
+    X[i] += tmp;
+  }
+
+  // divide by diag term 
+  for (int j=0; j<size; j++) 
+    X[j] *= invD[j];
+  
+  // now do the back substitution storing result in X
+  for (int k=(size-1); k>0; k--) {
+    
+    int rowktop = RowTop[k];
+    double bk = X[k];
+    double *ajiPtr = topRowPtr[k]; 		
+    
+    for (int j=rowktop; j<k; j++) 
+      X[j] -= *ajiPtr++ * bk;
+  }   	 
+}
+
+int
+ProfileSPDLinThreadFactor::run(int first, int last, int threadID)
+{
+  int b = -1;
+  int step = 0;
+  int ok = 0;
+  int badRow = 0;
+  double badValue = 0.0;
+
+  while (true) {
+
+#ifndef _WIN32
+    pthread_mutex_lock(&theMutex);
+#endif
+
+    // publish the task just done, this may make others ready
+    if (b >= 0)
+      this->finishTask(b, step, ok, badRow, badValue);
+
+    // get the next task
+    b = -1;
+#ifndef _WIN32
+    while (numQueued == 0 && numDiagDone < numBlocks && info == 0)
+      pthread_cond_wait(&readyCond, &theMutex);
+#endif
+    if (numQueued != 0 && info == 0) {
+      b = theQueue[queueStart];
+      queueStart = (queueStart+1) % numBlocks;
+      numQueued--;
+      state[b] = PROFILE_BLOCK_BUSY;
+      step = nextStep[b];
+    }
+
+#ifndef _WIN32
+    pthread_mutex_unlock(&theMutex);
+#endif
+
+    if (b < 0)
+      break;
+
+    if (step == b)
+      ok = this->factorDiagBlock(b, badRow, badValue);
+    else {
+      this->updateBlock(step, b);
+      ok = 0;
+    }
+  }
+
+  return 0;
+}
+
+// invoked holding the mutex
+void
+ProfileSPDLinThreadFactor::finishTask(int b, int step, int ok, 
+				      int badRow, double badValue)
+{
+  if (step == b) {
+
+    state[b] = PROFILE_BLOCK_DONE;
+    numDiagDone++;
+
+    if (ok < 0 && info == 0) {
+      info = ok;
+      errRow = badRow;
+      errValue = badValue;
+    }
+
+    // column blocks waiting for this diagonal block can now be updated
+    for (int c=b+1; c<=lastAffected[b]; c++)
+      if (state[c] == PROFILE_BLOCK_WAITING && nextStep[c] == b)
+	this->queueBlock(c);
+
+#ifndef _WIN32
+    // wake everyone up if there is nothing left to do
+    if (numDiagDone == numBlocks || info != 0)
+      pthread_cond_broadcast(&readyCond);
+#endif
+
+  } else {
+
+    int next = step+1;
+    nextStep[b] = next;
+    if (next == b || state[next] == PROFILE_BLOCK_DONE)
+      this->queueBlock(b);
+    else
+      state[b] = PROFILE_BLOCK_WAITING;
+  }
+}
+
+// invoked holding the mutex
+void
+ProfileSPDLinThreadFactor::queueBlock(int b)
+{
+  state[b] = PROFILE_BLOCK_QUEUED;
+
+  // the diagonal blocks are on the critical path, they go to the front
+  if (nextStep[b] == b) {
+    queueStart = (queueStart + numBlocks - 1) % numBlocks;
+    theQueue[queueStart] = b;
+  } else
+    theQueue[(queueStart + numQueued) % numBlocks] = b;
+  numQueued++;
+
+#ifndef _WIN32
+  pthread_cond_signal(&readyCond);
+#endif
+}
+
+// factor the diagonal block i into Ui,i and Di
+int
+ProfileSPDLinThreadFactor::factorDiagBlock(int i, int &badRow, double &badValue)
+{
+  int startRow = i*blockSize;
+  int lastRow = startRow+blockSize-1;
+  if (lastRow >= size)
+    lastRow = size-1;
+
+  for (int currentRow=startRow; currentRow<=lastRow; currentRow++) {
+
+    int rowjTop = RowTop[currentRow];
+    double *akjPtr = topRowPtr[currentRow];
+    int maxRowijTop;
+    if (rowjTop < startRow) {
+      akjPtr += startRow-rowjTop; // pointer to start of block row
+      maxRowijTop = startRow;
+    } else
+      maxRowijTop = rowjTop;
+
+    int k;
+    for (k=maxRowijTop; k<currentRow; k++) {
+      double tmp = *akjPtr;
+      int rowkTop = RowTop[k];
+      int maxRowkjTop;
+      double *alkPtr, *aljPtr;
+      if (rowkTop < rowjTop) {
+	alkPtr = topRowPtr[k] + (rowjTop - rowkTop);
+	aljPtr = topRowPtr[currentRow];
+	maxRowkjTop = rowjTop;
+      } else {
+	alkPtr = topRowPtr[k];
+	aljPtr = topRowPtr[currentRow] + (rowkTop - rowjTop);
+	maxRowkjTop = rowkTop;
+      }
+
+      for (int l = maxRowkjTop; l<k; l++) 
+	tmp -= *alkPtr++ * *aljPtr++;
+      
+      *akjPtr++ = tmp;
+    }
+
+    double ajj = *akjPtr;
+    akjPtr = topRowPtr[currentRow];
+
+    for (k=rowjTop; k<currentRow; k++){
+      double akj = *akjPtr;
+      double lkj = akj * invD[k];
+      *akjPtr++ = lkj;
+      ajj = ajj -lkj * akj;
+    }
+
+    // check that the diag > the tolerance specified
+    if (ajj <= 0.0 || ajj <= minDiagTol) {
+      badRow = currentRow;
+      badValue = ajj;
+      return -2;
+    }
+
+    invD[currentRow] = 1.0/ajj; 
+  }
+
+  return 0;
+}
+
+// update the rows of block row i in the columns of column block b,
+// forming Ui,b*Di
+void
+ProfileSPDLinThreadFactor::updateBlock(int i, int b)
+{
+  int startRow = i*blockSize;
+  int lastRow = startRow+blockSize-1;
+  if (lastRow >= size)
+    lastRow = size-1;
+
+  int lastCol = (b+1)*blockSize;
+  if (lastCol > size)
+    lastCol = size;
+
+  for (int currentCol=b*blockSize; currentCol<lastCol; currentCol++) {
+
+    int rowkTop = RowTop[currentCol];
+    if (rowkTop > lastRow)
+      continue;
+
+    double *alkPtr = topRowPtr[currentCol];
+    int maxRowikTop;
+    if (rowkTop < startRow) {
+      alkPtr += startRow-rowkTop; // pointer to start of block row
+      maxRowikTop = startRow;
+    } else
+      maxRowikTop = rowkTop;
+
+    for (int l=maxRowikTop; l<=lastRow; l++) {
+      double tmp = *alkPtr;
+      int rowlTop = RowTop[l];
+      int maxRowklTop;
+      double *amlPtr, *amkPtr;
+      if (rowlTop < rowkTop) {
+	amlPtr = topRowPtr[l] + (rowkTop - rowlTop);
+	amkPtr = topRowPtr[currentCol];
+	maxRowklTop = rowkTop;
+      } else {
+	amlPtr = topRowPtr[l];
+	amkPtr = topRowPtr[currentCol] + (rowlTop - rowkTop);
+	maxRowklTop = rowlTop;
+      }
+      
+      for (int m = maxRowklTop; m<l; m++) 
+	tmp -= *amkPtr++ * *amlPtr++;
+      
+      *alkPtr++ = tmp;
+    }
+  }
+}
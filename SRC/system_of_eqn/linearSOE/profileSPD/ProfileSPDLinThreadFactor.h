@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinThreadFactor.h,v $
+
+// File: ~/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinThreadFactor.h
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// ProfileSPDLinThreadFactor. A ProfileSPDLinThreadFactor performs the
+// LDL^t factorization of a symmetric positive definite matrix stored in
+// profile (skyline) form using the threads of a ThreadPool. The columns
+// are grouped in blocks of blockSize columns. As in the
+// ProfileSPDLinDirectBlockSolver the factorization of a block row consists
+// of factoring the diagonal block and then updating the later columns
+// that reach into the block row; here each (block row, column block)
+// update and each diagonal block is a task, a column block being updated
+// by the block rows in order, so that updates of different column blocks
+// and the factorization of independent diagonal blocks proceed in parallel.
+//
+// What: "@(#) ProfileSPDLinThreadFactor.h, revA"
+
+#ifndef ProfileSPDLinThreadFactor_h
+#define ProfileSPDLinThreadFactor_h
+
+#include <ThreadPool.h>
+
+class ProfileSPDLinThreadFactor : public ThreadTask
+{
+  public:
+    ProfileSPDLinThreadFactor(int blockSize);
+    ~ProfileSPDLinThreadFactor();
+
+    // sets the matrix: column j holds rows RowTop[j] through j stored 
+    // contiguously from topRowPtr[j], the diagonal being the last entry
+    int setSize(int n, int *RowTop, double **topRowPtr);
+
+    // factors the matrix in place into L (unit diagonal, stored in the
+    // upper profile) and D, of which the inverse is kept
+    int factor(ThreadPool &thePool, double minDiagTol);
+
+    // forward and back substitution with the factored matrix
+    void solve(double *X) const;
+
+    int run(int first, int last, int threadID);
+
+  private:
+    int factorDiagBlock(int i, int &errRow, double &errValue);
+    void updateBlock(int i, int b);
+    void finishTask(int b, int step, int ok, int errRow, double errValue);
+    void queueBlock(int b);
+
+    int size, blockSize, numBlocks;
+    int *RowTop;                   // not owned
+    double **topRowPtr;            // not owned
+    double *invD;
+    double minDiagTol;
+
+    // task graph data, column block b is next to be updated by block
+    // row nextStep[b], the update by block row b being the factorization
+    // of its diagonal block
+    int *firstStep;                // first block row reaching into b
+    int *lastAffected;             // last column block reached by block row
+    int *nextStep;
+    int *state;
+    int *theQueue;                 // circular queue of ready column blocks
+    int queueStart, numQueued;
+    int numDiagDone;
+    int info, errRow;
+    double errValue;
+
+#ifndef _WIN32
+    pthread_mutex_t theMutex;
+    pthread_cond_t readyCond;
+#endif
+};
+
+#endif
@@ -33,6 +33,7 @@
 #include <SparseGenColLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <f2c.h>
@@ -363,6 +364,13 @@ DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
   return result;    
 }
 
+// the processes exchange the Vertex based graph
+int 
+DistributedSparseGenColLinSOE::setSize(CSR_Graph &theGraph)
+{
+  return this->setSize(theGraph.getGraph());
+}
+
 
 int 
 DistributedSparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
@@ -0,0 +1,93 @@
+# krylovBenchmark.tcl - times system Krylov against the direct sparse
+# solvers on the brick and quad models.
+#
+# usage: OpenSees krylovBenchmark.tcl ?brick|quad? ?numEle? ?numSteps?
+#
+# Each system runs the same Newton analysis of numSteps load steps. The
+# table printed at the end gives, for each system, the wall clock time of
+# the analysis, the Newton iterations of the last step and the relative
+# difference of the compared displacement from the first (SparseGeneral)
+# run. Systems that are not built into the executable are reported as
+# such and skipped.
+
+set modelType brick
+set numEle 16
+set numSteps 5
+if {[info exists argv]} {
+    if {[llength $argv] > 0} {set modelType [lindex $argv 0]}
+    if {[llength $argv] > 1} {set numEle [lindex $argv 1]}
+    if {[llength $argv] > 2} {set numSteps [lindex $argv 2]}
+}
+
+set dir [file dirname [info script]]
+if {$modelType == "brick"} {
+    source [file join $dir krylovBrick.tcl]
+} elseif {$modelType == "quad"} {
+    source [file join $dir krylovQuad.tcl]
+} else {
+    puts "krylovBenchmark.tcl - unknown model $modelType, brick or quad"
+    exit 1
+}
+
+set systems {
+    {SparseGeneral -piv}
+    {UmfPack}
+    {Krylov -solver pcg -precond jacobi -tol 1.0e-10 -maxIter 5000}
+    {Krylov -solver pcg -precond ilu -level 0 -tol 1.0e-10}
+    {Krylov -solver pcg -precond amg -tol 1.0e-10}
+    {Krylov -solver pcg -precond amg -tol 1.0e-10 -numThreads 4}
+    {Krylov -solver gmres -precond ilut -dropTol 1.0e-4 -maxFill 30 -tol 1.0e-10}
+    {Krylov -solver bicgstab -precond ilut -dropTol 1.0e-4 -maxFill 30 -tol 1.0e-10}
+}
+
+set results {}
+set uRef 0.0
+
+foreach system $systems {
+
+    wipe
+    set nodeTag [buildModel $numEle]
+
+    constraints Plain
+    numberer RCM
+    if {[catch {eval system $system} msg]} {
+	lappend results [list $system "not available" "" ""]
+	continue
+    }
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator LoadControl [expr 1.0/$numSteps]
+    analysis Static
+
+    set tStart [clock clicks -milliseconds]
+    set ok [analyze $numSteps]
+    set tEnd [clock clicks -milliseconds]
+
+    if {$ok != 0} {
+	lappend results [list $system "failed" "" ""]
+	continue
+    }
+
+    set u [nodeDisp $nodeTag 1]
+    if {$uRef == 0.0} {
+	set uRef $u
+    }
+    set diff [expr abs($u-$uRef)/abs($uRef)]
+
+    lappend results [list $system [expr ($tEnd-$tStart)/1000.0] [numIter] $diff]
+}
+
+wipe
+
+puts ""
+puts "model $modelType numEle $numEle numSteps $numSteps, node $nodeTag dof 1 u = $uRef"
+puts [format "%-80s %10s %6s %10s" "system" "time (s)" "iter" "rel. diff"]
+foreach result $results {
+    set system [lindex $result 0]
+    set time [lindex $result 1]
+    if {[string is double -strict $time]} {
+	puts [format "%-80s %10.3f %6d %10.2e" $system $time [lindex $result 2] [lindex $result 3]]
+    } else {
+	puts [format "%-80s %10s" $system $time]
+    }
+}
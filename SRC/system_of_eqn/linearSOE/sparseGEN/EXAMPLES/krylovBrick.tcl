@@ -0,0 +1,55 @@
+# krylovBrick.tcl - elastic soil block of n x n x n stdBrick elements,
+# fixed at the base and pushed laterally on the top face. Sourced by
+# krylovBenchmark.tcl, which sets numEle and sets up the system.
+#
+# returns the tag of the node whose displacement is compared
+
+proc buildModel {numEle} {
+
+    model BasicBuilder -ndm 3 -ndf 3
+
+    set h 1.0
+    set n1 [expr $numEle+1]
+
+    for {set k 0} {$k <= $numEle} {incr k} {
+	for {set j 0} {$j <= $numEle} {incr j} {
+	    for {set i 0} {$i <= $numEle} {incr i} {
+		set tag [expr 1 + $i + $j*$n1 + $k*$n1*$n1]
+		node $tag [expr $i*$h] [expr $j*$h] [expr $k*$h]
+		if {$k == 0} {
+		    fix $tag 1 1 1
+		}
+	    }
+	}
+    }
+
+    nDMaterial ElasticIsotropic 1 1.0e5 0.3
+
+    set eleTag 1
+    for {set k 0} {$k < $numEle} {incr k} {
+	for {set j 0} {$j < $numEle} {incr j} {
+	    for {set i 0} {$i < $numEle} {incr i} {
+		set n1i [expr 1 + $i + $j*$n1 + $k*$n1*$n1]
+		set n2i [expr $n1i + 1]
+		set n3i [expr $n2i + $n1]
+		set n4i [expr $n1i + $n1]
+		set n5i [expr $n1i + $n1*$n1]
+		set n6i [expr $n2i + $n1*$n1]
+		set n7i [expr $n3i + $n1*$n1]
+		set n8i [expr $n4i + $n1*$n1]
+		element stdBrick $eleTag $n1i $n2i $n3i $n4i $n5i $n6i $n7i $n8i 1
+		incr eleTag
+	    }
+	}
+    }
+
+    pattern Plain 1 Linear {
+	for {set j 0} {$j <= $numEle} {incr j} {
+	    for {set i 0} {$i <= $numEle} {incr i} {
+		load [expr 1 + $i + $j*$n1 + $numEle*$n1*$n1] 1.0 0.0 -0.5
+	    }
+	}
+    }
+
+    return [expr $n1*$n1*$n1]
+}
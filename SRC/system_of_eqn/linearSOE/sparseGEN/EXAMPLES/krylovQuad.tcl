@@ -0,0 +1,47 @@
+# krylovQuad.tcl - plane strain elastic block of (4n) x n quad elements,
+# fixed at the base and pushed laterally along the top edge. Sourced by
+# krylovBenchmark.tcl, which sets numEle and sets up the system.
+#
+# returns the tag of the node whose displacement is compared
+
+proc buildModel {numEle} {
+
+    model BasicBuilder -ndm 2 -ndf 2
+
+    set h 1.0
+    set nx [expr 4*$numEle]
+    set ny $numEle
+    set n1 [expr $nx+1]
+
+    for {set j 0} {$j <= $ny} {incr j} {
+	for {set i 0} {$i <= $nx} {incr i} {
+	    set tag [expr 1 + $i + $j*$n1]
+	    node $tag [expr $i*$h] [expr $j*$h]
+	    if {$j == 0} {
+		fix $tag 1 1
+	    }
+	}
+    }
+
+    nDMaterial ElasticIsotropic 1 1.0e5 0.3
+
+    set eleTag 1
+    for {set j 0} {$j < $ny} {incr j} {
+	for {set i 0} {$i < $nx} {incr i} {
+	    set n1i [expr 1 + $i + $j*$n1]
+	    set n2i [expr $n1i + 1]
+	    set n3i [expr $n2i + $n1]
+	    set n4i [expr $n1i + $n1]
+	    element quad $eleTag $n1i $n2i $n3i $n4i 1.0 PlaneStrain 1
+	    incr eleTag
+	}
+    }
+
+    pattern Plain 1 Linear {
+	for {set i 0} {$i <= $nx} {incr i} {
+	    load [expr 1 + $i + $ny*$n1] 1.0 -0.5
+	}
+    }
+
+    return [expr $n1*($ny+1)]
+}
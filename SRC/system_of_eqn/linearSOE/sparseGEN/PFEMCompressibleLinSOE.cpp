@@ -39,6 +39,7 @@
 #include <PFEMCompressibleSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -209,7 +210,7 @@ PFEMCompressibleLinSOE::recvSelf(int cTag, Channel &theChannel,
 }
 
 int
-PFEMCompressibleLinSOE::setMatIDs(Graph& theGraph, int Ssize, int Fsize, 
+PFEMCompressibleLinSOE::setMatIDs(CSR_Graph& theGraph, int Ssize, int Fsize, 
                                   int Isize, int Psize, int Pisize)
 {
     int Vsize = Ssize+Fsize+Isize;
@@ -229,16 +230,15 @@ PFEMCompressibleLinSOE::setMatIDs(Graph& theGraph, int Ssize, int Fsize,
     cs* Gt1 = cs_spalloc(Psize, Vsize, 1, 1, 1);
     Mp.resize(Psize); Mp.Zero();
 
-    Vertex* theVertex = 0;
-    for (int a=0; a<size; a++) {    // columns
-        theVertex = theGraph.getVertexPtr(a);
-        if (theVertex == 0) {
-            opserr << "WARNING:PFEMCompressibleLinSOE::setSize :";
-            opserr << " vertex " << a << " not in graph!\n";
-            break;
-        }
+    if (theGraph.getNumVertex() != size) {
+        opserr << "WARNING:PFEMCompressibleLinSOE::setSize :";
+        opserr << " graph has " << theGraph.getNumVertex() << " vertices not " << size << "\n";
+        return -1;
+    }
+    const int* start = theGraph.getStart();
+    const int* adjacency = theGraph.getAdjacency();
 
-        int col = theVertex->getTag();  // column 
+    for (int col=0; col<size; col++) {    // columns
         int coltype = dofType(col);     // column type
         int colid = newDofID(col);         // column id
         if(coltype==4 || coltype<0) continue;      // don't need this column
@@ -249,10 +249,8 @@ PFEMCompressibleLinSOE::setMatIDs(Graph& theGraph, int Ssize, int Fsize,
         }
 
         // off diagnol terms
-        const ID &theAdjacency = theVertex->getAdjacency();
-        int idSize = theAdjacency.Size();
-        for (int i=0; i<idSize; i++) {       // rows
-            int row = theAdjacency(i);       // row 
+        for (int k=start[col]; k<start[col+1]; k++) {       // rows
+            int row = adjacency[k];          // row 
             int rowtype = dofType(row);      // row type
             int rowid = newDofID(row);          // row id
             if(rowtype < 0) continue;
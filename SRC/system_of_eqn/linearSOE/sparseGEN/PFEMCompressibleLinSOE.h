@@ -60,7 +60,7 @@ class PFEMCompressibleLinSOE : public PFEMLinSOE
 
 private:    
 
-    virtual int setMatIDs(Graph& theGraph, int Ssize, int Fsize, int Isize, int Psize, int Pisize);
+    virtual int setMatIDs(CSR_Graph& theGraph, int Ssize, int Fsize, int Isize, int Psize, int Pisize);
 
 private:
 
@@ -39,6 +39,7 @@
 #include <PFEMSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
@@ -47,6 +48,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <iostream>
+#include <algorithm>
 using std::nothrow;
 #include <Pressure_Constraint.h>
 #include <Pressure_ConstraintIter.h>
@@ -60,7 +62,7 @@ PFEMLinSOE::PFEMLinSOE(PFEMSolver &the_Solver)
     :LinearSOE(the_Solver, LinSOE_TAGS_PFEMLinSOE),
      M(0), Gft(0), Git(0), L(0), Qt(0),
      X(), B(), Mhat(), Mf(),
-     dofType(), dofID()
+     dofType(), dofID(), newM(true)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -70,7 +72,7 @@ PFEMLinSOE::PFEMLinSOE()
     :LinearSOE(LinSOE_TAGS_PFEMLinSOE),
      M(0), Gft(0), Git(0), L(0), Qt(0),
      X(), B(), Mhat(), Mf(),
-     dofType(), dofID()
+     dofType(), dofID(), newM(true)
 {
 
 }
@@ -79,7 +81,7 @@ PFEMLinSOE::PFEMLinSOE(int classTag)
     :LinearSOE(classTag),
      M(0), Gft(0), Git(0), L(0), Qt(0),
      X(), B(), Mhat(), Mf(),
-     dofType(), dofID()
+     dofType(), dofID(), newM(true)
 {
 
 }
@@ -89,7 +91,7 @@ PFEMLinSOE::PFEMLinSOE(PFEMSolver &the_Solver, int classTag)
     :LinearSOE(the_Solver, classTag),
      M(0), Gft(0), Git(0), L(0), Qt(0),
      X(), B(), Mhat(), Mf(),
-     dofType(), dofID()
+     dofType(), dofID(), newM(true)
 {
 
 }
@@ -115,6 +117,18 @@ PFEMLinSOE::getNumEqn(void) const
 
 int 
 PFEMLinSOE::setSize(Graph &theGraph)
+{
+    CSR_Graph theCSR_Graph;
+    if (theCSR_Graph.build(theGraph) < 0) {
+	opserr << "WARNING:PFEMLinSOE::setSize :";
+	opserr << " failed to build the CSR_Graph\n";
+	return -1;
+    }
+    return this->setSize(theCSR_Graph);
+}
+
+int 
+PFEMLinSOE::setSize(CSR_Graph &theGraph)
 {
     int result = 0;
     int size = theGraph.getNumVertex();
@@ -130,9 +144,13 @@ PFEMLinSOE::setSize(Graph &theGraph)
     // set Dof IDs
     int Ssize, Fsize, Isize, Psize, Pisize;
     result = this->setDofIDs(size, Ssize, Fsize, Isize, Psize, Pisize);
+    if (result < 0)
+	return result;
 
     // set matrix IDs
     result = this->setMatIDs(theGraph, Ssize, Fsize, Isize, Psize, Pisize);
+    if (result < 0)
+	return result;
     
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
@@ -557,8 +575,26 @@ PFEMLinSOE::setDofIDs(int size,int& Ssize, int&Fsize, int& Isize,int& Psize,int&
         }
     }
     
+    // structure momentum, numbered in the order of the nodes and not
+    // of the equations so that the numbering of the structure is kept 
+    // when the fluid mesh changes
+    ID numbered(size);
+    NodeIter& theNodes = domain->getNodes();
+    Node* theNode = 0;
+    while((theNode = theNodes()) != 0) {
+        DOF_Group* theDOF = theNode->getDOF_GroupPtr();
+        if(theDOF == 0) continue;
+        const ID& id = theDOF->getID();
+        for(int i=0; i<id.Size(); i++) {
+            int col = id(i);
+            if(col>=0 && col<size && dofType(col)==0 && numbered(col)==0) {
+                dofID(col) = Ssize++;
+                numbered(col) = 1;
+            }
+        }
+    }
     for(int col=0; col<size; col++) {         
-        if(dofType(col) == 0) {               // structure momentum 
+        if(dofType(col) == 0 && numbered(col) == 0) {    // not at a node
             dofID(col) = Ssize++;
         }
     }
@@ -571,10 +607,92 @@ PFEMLinSOE::setDofIDs(int size,int& Ssize, int&Fsize, int& Isize,int& Psize,int&
     return 0;
 }
 
+// true if the compressed matrices A and B have the same pattern
+static bool
+PFEMLinSOE_samePattern(const cs* A, const cs* B)
+{
+    if(A == 0 || B == 0) return false;
+    if(A->m != B->m || A->n != B->n) return false;
+    for(int j=0; j<=A->n; j++) {
+        if(A->p[j] != B->p[j]) return false;
+    }
+    for(int k=0; k<A->p[A->n]; k++) {
+        if(A->i[k] != B->i[k]) return false;
+    }
+    return true;
+}
+
 int
-PFEMLinSOE::setMatIDs(Graph& theGraph, int Ssize, int Fsize, int Isize, int Psize, int Pisize)
+PFEMLinSOE::setMatIDs(CSR_Graph& theGraph, int Ssize, int Fsize, int Isize, int Psize, int Pisize)
 {
-    cs* M1 = cs_spalloc(Ssize+Isize, Ssize+Isize, 1, 1, 1);
+    int size = X.Size();
+    if(theGraph.getNumVertex() != size) {
+        opserr << "WARNING:PFEMLinSOE::setSize :";
+        opserr << " graph has "<<theGraph.getNumVertex()<<" vertices not "<<size<<"\n";
+        return -1;
+    }
+    const int* start = theGraph.getStart();
+    const int* adjacency = theGraph.getAdjacency();
+
+    // M is formed a column at a time in its own numbering with the row
+    // indices sorted, its pattern then only changes with the structure
+    // and interface connectivity and the old M is kept if it is the same
+    int Msize = Ssize+Isize;
+    ID Mcol(Msize);                 // equation of each column of M
+    for(int col=0; col<size; col++) {
+        if(dofType(col) == 0) {
+            Mcol(dofID(col)) = col;
+        } else if(dofType(col) == 2) {
+            Mcol(dofID(col)+Ssize) = col;
+        }
+    }
+
+    int Mnnz = 0;
+    for(int a=0; a<Msize; a++) {
+        int col = Mcol(a);
+        Mnnz++;
+        for(int k=start[col]; k<start[col+1]; k++) {
+            int rowtype = dofType(adjacency[k]);
+            if(rowtype==0 || rowtype==2) Mnnz++;
+        }
+    }
+
+    cs* M1 = cs_spalloc(Msize, Msize, Mnnz, 1, 0);
+    if(M1 == 0) {
+        opserr << "WARNING:PFEMLinSOE::setSize :";
+        opserr << " run out of memory for M\n";
+        return -1;
+    }
+    int nnz = 0;
+    for(int a=0; a<Msize; a++) {
+        int col = Mcol(a);
+        M1->p[a] = nnz;
+        M1->i[nnz++] = a;
+        for(int k=start[col]; k<start[col+1]; k++) {
+            int row = adjacency[k];
+            if(dofType(row) == 0) {                     // Ms, Mis
+                M1->i[nnz++] = dofID(row);
+            } else if(dofType(row) == 2) {              // Msi, Mi
+                M1->i[nnz++] = dofID(row)+Ssize;
+            }
+        }
+        std::sort(M1->i+M1->p[a], M1->i+nnz);
+    }
+    M1->p[Msize] = nnz;
+    for(int k=0; k<nnz; k++) {
+        M1->x[k] = 0.0;
+    }
+
+    if(PFEMLinSOE_samePattern(M, M1)) {
+        cs_spfree(M1);
+        newM = false;
+    } else {
+        if(M != 0) cs_spfree(M);
+        M = M1;
+        newM = true;
+    }
+
+    // the fluid blocks
     cs* Gft1 = cs_spalloc(Psize, Fsize, 1, 1, 1);
     cs* Git1 = cs_spalloc(Psize, Isize, 1, 1, 1);
     cs* L1 = cs_spalloc(Psize, Psize, 1, 1, 1);
@@ -582,48 +700,23 @@ PFEMLinSOE::setMatIDs(Graph& theGraph, int Ssize, int Fsize, int Isize, int Psiz
     Mhat.resize(Pisize); Mhat.Zero();
     Mf.resize(Fsize); Mf.Zero();
 
-    Vertex* theVertex = 0;
-    int size = X.Size();
-    for (int a=0; a<size; a++) {    // columns
-        theVertex = theGraph.getVertexPtr(a);
-        if (theVertex == 0) {
-            opserr << "WARNING:PFEMLinSOE::setSize :";
-            opserr << " vertex " << a << " not in graph!\n";
-            break;
-        }
-
-        int col = theVertex->getTag();  // column 
+    for (int col=0; col<size; col++) {    // columns
         int coltype = dofType(col);     // column type
         int colid = dofID(col);         // column id
         if(coltype==4 || coltype<0) continue;      // don't need this column
 
         // diagnol terms
-        if(coltype == 0) {                      // structure momentum
-            cs_entry(M1, colid, colid, 0.0);   
-        } else if(coltype == 2) {               // interface momentum
-            cs_entry(M1, colid+Ssize, colid+Ssize, 0.0);   
-        } else if(coltype == 3) {               // pressure
+        if(coltype == 3) {               // pressure
             cs_entry(L1, colid, colid, 0.0);    
         }
 
         // off diagnol terms
-        const ID &theAdjacency = theVertex->getAdjacency();
-        int idSize = theAdjacency.Size();
-        for (int i=0; i<idSize; i++) {       // rows
-            int row = theAdjacency(i);       // row 
+        for (int k=start[col]; k<start[col+1]; k++) {       // rows
+            int row = adjacency[k];          // row 
             int rowtype = dofType(row);      // row type
             int rowid = dofID(row);          // row id
 
-            
-            if(rowtype==0 && coltype==0) {                // Ms
-                cs_entry(M1, rowid, colid, 0.0);
-            } else if(rowtype==2 && coltype==2) {         // Mi
-                cs_entry(M1, rowid+Ssize, colid+Ssize, 0.0);
-            } else if(rowtype==0 && coltype==2) {         // Msi
-                cs_entry(M1, rowid, colid+Ssize, 0.0);
-            } else if(rowtype==2 && coltype==0) {         // Mis
-                cs_entry(M1, rowid+Ssize, colid, 0.0);
-            } else if(rowtype==3 && coltype==1) {        // Gft
+            if(rowtype==3 && coltype==1) {               // Gft
                 cs_entry(Gft1, rowid, colid, 0.0);
             } else if(rowtype==3 && coltype==2) {        // Git
                 cs_entry(Git1, rowid, colid, 0.0);
@@ -636,10 +729,6 @@ PFEMLinSOE::setMatIDs(Graph& theGraph, int Ssize, int Fsize, int Isize, int Psiz
     }
 
     // convert to compressed format
-    if(M != 0) cs_spfree(M);
-    M = cs_compress(M1);
-    cs_spfree(M1);
-
     if(Gft != 0) cs_spfree(Gft);
     Gft = cs_compress(Gft1);
     cs_spfree(Gft1);
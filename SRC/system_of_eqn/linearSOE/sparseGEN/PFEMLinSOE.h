@@ -43,6 +43,7 @@ extern "C" {
 #include <cs.h>
 }
 class PFEMSolver;
+class CSR_Graph;
 
 class PFEMLinSOE : public LinearSOE
 {
@@ -56,6 +57,7 @@ class PFEMLinSOE : public LinearSOE
 
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph& theGraph);
+    virtual int setSize(CSR_Graph& theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
@@ -82,13 +84,14 @@ class PFEMLinSOE : public LinearSOE
 private:    
 
     virtual int setDofIDs(int size,int& Ssize, int&Fsize, int& Isize,int& Psize,int& Pisize);
-    virtual int setMatIDs(Graph& theGraph, int Ssize, int Fsize, int Isize, int Psize, int Pisize);
+    virtual int setMatIDs(CSR_Graph& theGraph, int Ssize, int Fsize, int Isize, int Psize, int Pisize);
 
 private:
 
     cs* M, *Gft, *Git, *L, *Qt;
     Vector X, B, Mhat, Mf;
     ID dofType, dofID;
+    bool newM;    // true if the pattern of M changed in last setSize()
 };
 
 #endif
@@ -349,8 +349,9 @@ PFEMSolver::solve()
 
 int PFEMSolver::setSize()
 {
+    // the symbolic analysis is kept if the pattern of M is unchanged
     cs* M = theSOE->M;
-    if(M->n > 0) {
+    if(M->n > 0 && (Msym == 0 || theSOE->newM == true)) {
         if(Msym != 0) {
             cs_sfree(Msym);
             Msym = 0;
@@ -36,9 +36,12 @@
 #include <SparseGenColLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
+#include <string.h>
+#include <algorithm>
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -163,11 +166,6 @@ SparseGenColLinSOE::getNumEqn(void) const
 int 
 SparseGenColLinSOE::setSize(Graph &theGraph)
 {
-
-    int result = 0;
-    int oldSize = size;
-    size = theGraph.getNumVertex();
-
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int newNNZ = 0;
@@ -176,6 +174,86 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	const ID &theAdjacency = theVertex->getAdjacency();
 	newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
     }
+
+    int result = this->setSizeStorage(theGraph.getNumVertex(), newNNZ);
+
+    // fill in colStartA and rowA
+    if (size != 0) {
+      colStartA[0] = 0;
+      int startLoc = 0;
+      int lastLoc = 0;
+      for (int a=0; a<size; a++) {
+
+	theVertex = theGraph.getVertexPtr(a);
+	if (theVertex == 0) {
+	  opserr << "WARNING:SparseGenColLinSOE::setSize :";
+	  opserr << " vertex " << a << " not in graph! - size set to 0\n";
+	  size = 0;
+	  return -1;
+	}
+
+	rowA[lastLoc++] = theVertex->getTag(); // place diag in first
+	const ID &theAdjacency = theVertex->getAdjacency();
+	int idSize = theAdjacency.Size();
+	
+	// now add the entries in the ID & place them in order in rowA
+	for (int i=0; i<idSize; i++)
+	  rowA[lastLoc++] = theAdjacency(i);
+	std::sort(&rowA[startLoc], &rowA[lastLoc]);
+
+	colStartA[a+1] = lastLoc;;	    
+	startLoc = lastLoc;
+      }
+    }
+
+    int solverOK = this->setSizeSolver();
+    if (solverOK < 0)
+      return solverOK;
+
+    return result;
+}
+
+int 
+SparseGenColLinSOE::setSize(CSR_Graph &theGraph)
+{
+    int numVertex = theGraph.getNumVertex();
+    const int *start = theGraph.getStart();
+    const int *adjacency = theGraph.getAdjacency();
+
+    // the adjacency of each vertex is sorted, only the diag is merged in
+    int result = this->setSizeStorage(numVertex, theGraph.getNumEdge()*2 + numVertex);
+
+    if (size != 0) {
+      colStartA[0] = 0;
+      int lastLoc = 0;
+      for (int a=0; a<size; a++) {
+	int j = start[a];
+	int endJ = start[a+1];
+	while (j < endJ && adjacency[j] < a)
+	  rowA[lastLoc++] = adjacency[j++];
+	rowA[lastLoc++] = a;
+	while (j < endJ)
+	  rowA[lastLoc++] = adjacency[j++];
+
+	colStartA[a+1] = lastLoc;
+      }
+    }
+
+    int solverOK = this->setSizeSolver();
+    if (solverOK < 0)
+      return solverOK;
+
+    return result;
+}
+
+// sets size and nnz, making sure A, rowA, B, X and colStartA are large
+// enough and zeroed
+int
+SparseGenColLinSOE::setSizeStorage(int newSize, int newNNZ)
+{
+    int result = 0;
+    int oldSize = size;
+    size = newSize;
     nnz = newNNZ;
 
     if (newNNZ > Asize) { // we have to get more space for A and rowA
@@ -245,51 +323,35 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	vectB = new Vector(B,size);	
     }
 
-    // fill in colStartA and rowA
-    if (size != 0) {
-      colStartA[0] = 0;
-      int startLoc = 0;
-      int lastLoc = 0;
-      for (int a=0; a<size; a++) {
-
-	theVertex = theGraph.getVertexPtr(a);
-	if (theVertex == 0) {
-	  opserr << "WARNING:SparseGenColLinSOE::setSize :";
-	  opserr << " vertex " << a << " not in graph! - size set to 0\n";
-	  size = 0;
-	  return -1;
-	}
-
-	rowA[lastLoc++] = theVertex->getTag(); // place diag in first
-	const ID &theAdjacency = theVertex->getAdjacency();
-	int idSize = theAdjacency.Size();
-	
-	// now we have to place the entries in the ID into order in rowA
-	for (int i=0; i<idSize; i++) {
-
-	  int row = theAdjacency(i);
-	  bool foundPlace = false;
-	  // find a place in rowA for current col
-	  for (int j=startLoc; j<lastLoc; j++)
-	    if (rowA[j] > row) { 
-	      // move the entries already there one further on
-	      // and place col in current location
-	      for (int k=lastLoc; k>j; k--)
-		
-		rowA[k] = rowA[k-1];
-	      rowA[j] = row;
-	      foundPlace = true;
-	      j = lastLoc;
-	    }
-	  if (foundPlace == false) // put in at the end
-	    rowA[lastLoc] = row;
+    return result;
+}
 
-	  lastLoc++;
-	}
-	colStartA[a+1] = lastLoc;;	    
-	startLoc = lastLoc;
+// builds the scatter map and transpose map once colStartA and rowA are
+// set and then invokes setSize() on the solver
+int
+SparseGenColLinSOE::setSizeSolver(void)
+{
+    // build the maps addA() uses to locate the entries of the FE_Elements
+    // and DOF_Groups in A
+    if (theModel != 0 && size != 0)
+      theScatterMap.setSize(*theModel, size, colStartA, rowA, true);
+    else
+      theScatterMap.clear();
+
+    // the pattern is symmetric, so a matrix given in compressed rows on
+    // this same pattern is added to A by way of the transpose locations
+    transA.resize(nnz);
+    for (int col=0; col<size; col++)
+      for (int k=colStartA[col]; k<colStartA[col+1]; k++) {
+	int row = rowA[k];
+	int *rowStart = &rowA[colStartA[row]];
+	int *rowEnd = &rowA[colStartA[row+1]];
+	int *loc = std::lower_bound(rowStart, rowEnd, col);
+	if (loc != rowEnd && *loc == col)
+	  transA(k) = colStartA[row] + (loc - rowStart);
+	else
+	  transA(k) = -1;
       }
-    }
 
     
     // invoke setSize() on the Solver    
@@ -301,7 +363,7 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	return solverOK;
     }    
 
-    return result;
+    return 0;
 }
 
 int 
@@ -319,6 +381,27 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	opserr << " - Matrix and ID not of similar sizes\n";
 	return -1;
     }
+
+    // if a scatter map was built for id use it to place the entries
+    const int *theLocs = theScatterMap.getLocations(id);
+    if (theLocs != 0) {
+      if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *theLocs++;
+	    if (loc >= 0)
+	      A[loc] += m(j,i);
+	  }
+      } else {
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *theLocs++;
+	    if (loc >= 0)
+	      A[loc] += fact * m(j,i);
+	  }
+      }
+      return 0;
+    }
     
     if (fact == 1.0) { // do not need to multiply 
       for (int i=0; i<idSize; i++) {
@@ -363,6 +446,42 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 }
 
     
+int
+SparseGenColLinSOE::addA(const int *rowStart, const int *colIndex, 
+			 const double *values, double fact)
+{
+    // check for a quick return 
+    if (fact == 0.0)
+	return 0;
+
+    // on the pattern of A the entries are placed using the transpose map
+    if (transA.Size() == nnz && rowStart[size] == nnz &&
+	memcmp(rowStart, colStartA, (size+1)*sizeof(int)) == 0 &&
+	memcmp(colIndex, rowA, nnz*sizeof(int)) == 0) {
+      for (int k=0; k<nnz; k++) {
+	int loc = transA(k);
+	if (loc >= 0)
+	  A[loc] += fact * values[k];
+      }
+      return 0;
+    }
+
+    // otherwise each entry is found in its column of A
+    for (int row=0; row<size; row++)
+      for (int l=rowStart[row]; l<rowStart[row+1]; l++) {
+	int col = colIndex[l];
+	if (col < 0 || col >= size)
+	  continue;
+	int *colStart = &rowA[colStartA[col]];
+	int *colEnd = &rowA[colStartA[col+1]];
+	int *loc = std::lower_bound(colStart, colEnd, row);
+	if (loc != colEnd && *loc == row)
+	  A[colStartA[col] + (loc - colStart)] += fact * values[l];
+      }
+
+    return 0;
+}
+
 int 
 SparseGenColLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
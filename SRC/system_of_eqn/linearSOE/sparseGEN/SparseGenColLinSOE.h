@@ -38,6 +38,8 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ID.h>
+#include <SparseGenScatterMap.h>
 
 class SparseGenColLinSolver;
 
@@ -55,7 +57,10 @@ class SparseGenColLinSOE : public LinearSOE
 
     virtual int getNumEqn(void) const;
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(CSR_Graph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addA(const int *rowStart, const int *colIndex, 
+		     const double *values, double fact = 1.0);
     virtual int addB(const Vector &, const ID &, double fact = 1.0);    
     virtual int setB(const Vector &, double fact = 1.0);        
     
@@ -98,7 +103,11 @@ class SparseGenColLinSOE : public LinearSOE
     bool factored;
     
   private:
+    int setSizeStorage(int newSize, int newNNZ);
+    int setSizeSolver(void);
 
+    SparseGenScatterMap theScatterMap;  // element entry -> location in A
+    ID transA;           // location in A of the transpose of each entry
 };
 
 
@@ -0,0 +1,507 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMG.cpp,v $
+                                                                        
+                                                                        
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMG.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of SparseGenRowAMG.
+//
+// What: "@(#) SparseGenRowAMG.cpp, revA"
+
+#include <SparseGenRowAMG.h>
+#include <Matrix.h>
+#include <math.h>
+
+// the coarsest level is solved with a dense inverse up to this size
+#define SPARSE_AMG_MAX_DENSE 2000
+
+// a level of the hierarchy; the finest level refers to the matrix of the 
+// SOE, the coarser levels own their matrix. P and R are the prolongator
+// and restrictor to the next coarser level.
+class SparseGenRowAMGLevel
+{
+  public:
+    SparseGenRowAMGLevel() :n(0), rowStart(0), colA(0), A(0), nc(0) {};
+    void setOwned(void) {
+      rowStart = &start[0];
+      colA = col.empty() ? 0 : &col[0];
+      A = val.empty() ? 0 : &val[0];
+    }
+    
+    int n;
+    const int *rowStart;
+    const int *colA;
+    const double *A;
+    std::vector<int> start, col;
+    std::vector<double> val;
+    std::vector<double> Dinv;   // the smoother weight over the diagonal
+
+    int nc;
+    std::vector<int> Pstart, Pcol, Rstart, Rcol;
+    std::vector<double> Pval, Rval;
+
+    std::vector<double> x, b, r;
+};
+
+// the transpose of an nr by nc compressed row matrix
+static void
+transposeCSR(int nr, int nc, const int *start, const int *col, const double *val,
+	     std::vector<int> &tStart, std::vector<int> &tCol, std::vector<double> &tVal)
+{
+  int nnz = start[nr];
+  tStart.assign(nc+1, 0);
+  tCol.resize(nnz);
+  tVal.resize(nnz);
+
+  int i, p;
+  for (p=0; p<nnz; p++)
+    tStart[col[p]+1]++;
+  for (i=0; i<nc; i++)
+    tStart[i+1] += tStart[i];
+
+  std::vector<int> next(tStart.begin(), tStart.end()-1);
+  for (i=0; i<nr; i++)
+    for (p=start[i]; p<start[i+1]; p++) {
+      int loc = next[col[p]]++;
+      tCol[loc] = i;
+      tVal[loc] = val[p];
+    }
+}
+
+// C = A B, A having nr rows and B nc columns
+static void
+multiplyCSR(int nr, int nc, 
+	    const int *aStart, const int *aCol, const double *aVal,
+	    const int *bStart, const int *bCol, const double *bVal,
+	    std::vector<int> &cStart, std::vector<int> &cCol, std::vector<double> &cVal)
+{
+  std::vector<int> marker(nc, -1);
+  cStart.assign(nr+1, 0);
+  cCol.clear();
+  cVal.clear();
+
+  for (int i=0; i<nr; i++) {
+    int rowBegin = cCol.size();
+    for (int p=aStart[i]; p<aStart[i+1]; p++) {
+      int k = aCol[p];
+      double aik = aVal[p];
+      for (int q=bStart[k]; q<bStart[k+1]; q++) {
+	int j = bCol[q];
+	if (marker[j] < rowBegin) {
+	  marker[j] = cCol.size();
+	  cCol.push_back(j);
+	  cVal.push_back(0.0);
+	}
+	cVal[marker[j]] += aik * bVal[q];
+      }
+    }
+    cStart[i+1] = cCol.size();
+  }
+}
+
+
+SparseGenRowAMG::SparseGenRowAMG(double tol, int sweeps, int size, int levels)
+  :SparseGenRowPreconditioner(),
+   strengthTol(tol), numSweeps(sweeps), coarseSize(size), maxLevels(levels),
+   coarseInverse(0)
+{
+  if (numSweeps < 1)
+    numSweeps = 1;
+  if (coarseSize < 1)
+    coarseSize = 1;
+  if (maxLevels < 1)
+    maxLevels = 1;
+}
+
+SparseGenRowAMG::~SparseGenRowAMG()
+{
+  this->clearAll();
+}
+
+void
+SparseGenRowAMG::clearAll(void)
+{
+  for (unsigned int i=0; i<theLevels.size(); i++)
+    delete theLevels[i];
+  theLevels.clear();
+
+  if (coarseInverse != 0)
+    delete coarseInverse;
+  coarseInverse = 0;
+}
+
+int
+SparseGenRowAMG::setup(int n, const int *rowStart, const int *colA, 
+		       const double *A)
+{
+  this->clearAll();
+
+  SparseGenRowAMGLevel *theLevel = new SparseGenRowAMGLevel();
+  theLevel->n = n;
+  theLevel->rowStart = rowStart;
+  theLevel->colA = colA;
+  theLevel->A = A;
+  this->setSmoother(*theLevel);
+  theLevels.push_back(theLevel);
+
+  double eps = strengthTol;
+  while ((int)theLevels.size() < maxLevels && theLevel->n > coarseSize) {
+    SparseGenRowAMGLevel *coarse = new SparseGenRowAMGLevel();
+    if (this->coarsen(*theLevel, eps, *coarse) < 0 || coarse->n >= theLevel->n) {
+      theLevel->nc = 0;
+      delete coarse;
+      break;
+    }
+    this->setSmoother(*coarse);
+    theLevels.push_back(coarse);
+    theLevel = coarse;
+    eps *= 0.5;
+  }
+
+  // work vectors
+  for (unsigned int l=0; l<theLevels.size(); l++) {
+    SparseGenRowAMGLevel &theL = *theLevels[l];
+    theL.x.assign(theL.n, 0.0);
+    theL.b.assign(theL.n, 0.0);
+    theL.r.assign(theL.n, 0.0);
+  }
+
+  // the coarsest level
+  int nc = theLevel->n;
+  if (nc > 0 && nc <= SPARSE_AMG_MAX_DENSE) {
+    Matrix Ac(nc, nc);
+    for (int i=0; i<nc; i++)
+      for (int p=theLevel->rowStart[i]; p<theLevel->rowStart[i+1]; p++)
+	Ac(i, theLevel->colA[p]) += theLevel->A[p];
+    coarseInverse = new Matrix(nc, nc);
+    if (Ac.Invert(*coarseInverse) < 0) {
+      // left to the smoother
+      delete coarseInverse;
+      coarseInverse = 0;
+    }
+  }
+
+  return 0;
+}
+
+// void setSmoother():
+//	damped Jacobi with weight 4/3 over a Gershgorin bound of the spectral
+//	radius of D^-1 A.
+void
+SparseGenRowAMG::setSmoother(SparseGenRowAMGLevel &theLevel)
+{
+  int n = theLevel.n;
+  theLevel.Dinv.assign(n, 0.0);
+
+  double rho = 0.0;
+  for (int i=0; i<n; i++) {
+    double diag = 0.0;
+    double sum = 0.0;
+    for (int p=theLevel.rowStart[i]; p<theLevel.rowStart[i+1]; p++) {
+      if (theLevel.colA[p] == i)
+	diag += theLevel.A[p];
+      sum += fabs(theLevel.A[p]);
+    }
+    if (diag != 0.0) {
+      theLevel.Dinv[i] = 1.0/diag;
+      if (sum/fabs(diag) > rho)
+	rho = sum/fabs(diag);
+    }
+  }
+
+  if (rho > 0.0) {
+    double weight = 4.0/(3.0*rho);
+    for (int j=0; j<n; j++)
+      theLevel.Dinv[j] *= weight;
+  }
+}
+
+// int coarsen():
+//	aggregates the strongly connected unknowns of the fine level, forms
+//	the smoothed prolongator P and R = P^T of the fine level and the 
+//	matrix R A P of the coarse level.
+int
+SparseGenRowAMG::coarsen(SparseGenRowAMGLevel &fine, double eps, 
+			 SparseGenRowAMGLevel &coarse)
+{
+  int n = fine.n;
+  const int *rowStart = fine.rowStart;
+  const int *colA = fine.colA;
+  const double *A = fine.A;
+  int nnz = rowStart[n];
+  int i, p;
+
+  std::vector<double> diag(n, 0.0);
+  for (i=0; i<n; i++)
+    for (p=rowStart[i]; p<rowStart[i+1]; p++)
+      if (colA[p] == i)
+	diag[i] += A[p];
+
+  // the strong connections, |a_ij| >= eps sqrt(|a_ii a_jj|)
+  std::vector<char> strong(nnz, 0);
+  std::vector<int> numStrong(n, 0);
+  for (i=0; i<n; i++)
+    for (p=rowStart[i]; p<rowStart[i+1]; p++) {
+      int j = colA[p];
+      if (j != i && fabs(A[p]) >= eps*sqrt(fabs(diag[i]*diag[j])) && A[p] != 0.0) {
+	strong[p] = 1;
+	numStrong[i]++;
+      }
+    }
+
+  // aggregation, -1 not yet aggregated and -2 isolated
+  std::vector<int> agg(n, -1);
+  int numAgg = 0;
+
+  // 1. an unknown all of whose strong neighbours are free forms an aggregate
+  for (i=0; i<n; i++) {
+    if (agg[i] != -1)
+      continue;
+    if (numStrong[i] == 0) {
+      agg[i] = -2;
+      continue;
+    }
+    bool allFree = true;
+    for (p=rowStart[i]; p<rowStart[i+1] && allFree == true; p++)
+      if (strong[p] != 0 && agg[colA[p]] != -1)
+	allFree = false;
+    if (allFree == true) {
+      agg[i] = numAgg;
+      for (p=rowStart[i]; p<rowStart[i+1]; p++)
+	if (strong[p] != 0)
+	  agg[colA[p]] = numAgg;
+      numAgg++;
+    }
+  }
+
+  // 2. the remaining join the aggregate they are most strongly connected to
+  std::vector<int> agg1(agg);
+  for (i=0; i<n; i++) {
+    if (agg[i] != -1)
+      continue;
+    double maxA = 0.0;
+    for (p=rowStart[i]; p<rowStart[i+1]; p++)
+      if (strong[p] != 0 && agg1[colA[p]] >= 0 && fabs(A[p]) > maxA) {
+	maxA = fabs(A[p]);
+	agg[i] = agg1[colA[p]];
+      }
+  }
+
+  // 3. any left form aggregates with their free strong neighbours
+  for (i=0; i<n; i++) {
+    if (agg[i] != -1)
+      continue;
+    agg[i] = numAgg;
+    for (p=rowStart[i]; p<rowStart[i+1]; p++)
+      if (strong[p] != 0 && agg[colA[p]] == -1)
+	agg[colA[p]] = numAgg;
+    numAgg++;
+  }
+
+  if (numAgg == 0)
+    return -1;
+
+  // the tentative prolongator, normalized piecewise constant
+  std::vector<int> aggSize(numAgg, 0);
+  for (i=0; i<n; i++)
+    if (agg[i] >= 0)
+      aggSize[agg[i]]++;
+  std::vector<double> p0(n, 0.0);
+  for (i=0; i<n; i++)
+    if (agg[i] >= 0)
+      p0[i] = 1.0/sqrt((double)aggSize[agg[i]]);
+
+  // the filtered matrix lumps the weak connections into the diagonal
+  std::vector<double> diagF(diag);
+  for (i=0; i<n; i++)
+    for (p=rowStart[i]; p<rowStart[i+1]; p++)
+      if (colA[p] != i && strong[p] == 0)
+	diagF[i] += A[p];
+
+  double rho = 0.0;
+  for (i=0; i<n; i++) {
+    if (diagF[i] == 0.0)
+      continue;
+    double sum = fabs(diagF[i]);
+    for (p=rowStart[i]; p<rowStart[i+1]; p++)
+      if (strong[p] != 0)
+	sum += fabs(A[p]);
+    if (sum/fabs(diagF[i]) > rho)
+      rho = sum/fabs(diagF[i]);
+  }
+  double omega = (rho > 0.0) ? 4.0/(3.0*rho) : 0.0;
+
+  // P = (I - omega D_F^-1 A_F) P0
+  fine.nc = numAgg;
+  fine.Pstart.assign(n+1, 0);
+  fine.Pcol.clear();
+  fine.Pval.clear();
+  std::vector<int> marker(numAgg, -1);
+  for (i=0; i<n; i++) {
+    int rowBegin = fine.Pcol.size();
+    if (agg[i] >= 0) {
+      marker[agg[i]] = fine.Pcol.size();
+      fine.Pcol.push_back(agg[i]);
+      fine.Pval.push_back(p0[i]);
+    }
+    if (diagF[i] != 0.0) {
+      double s = -omega/diagF[i];
+      for (p=rowStart[i]; p<rowStart[i+1]; p++) {
+	int j = colA[p];
+	double aij;
+	if (j == i)
+	  aij = diagF[i];
+	else if (strong[p] != 0)
+	  aij = A[p];
+	else
+	  continue;
+	if (agg[j] < 0)
+	  continue;
+	int c = agg[j];
+	if (marker[c] < rowBegin) {
+	  marker[c] = fine.Pcol.size();
+	  fine.Pcol.push_back(c);
+	  fine.Pval.push_back(0.0);
+	}
+	fine.Pval[marker[c]] += s * aij * p0[j];
+      }
+    }
+    fine.Pstart[i+1] = fine.Pcol.size();
+  }
+
+  if (fine.Pcol.empty() == true)
+    return -1;
+
+  transposeCSR(n, numAgg, &fine.Pstart[0], &fine.Pcol[0], &fine.Pval[0],
+	       fine.Rstart, fine.Rcol, fine.Rval);
+
+  // the coarse matrix R (A P)
+  std::vector<int> apStart, apCol;
+  std::vector<double> apVal;
+  multiplyCSR(n, numAgg, rowStart, colA, A, 
+	      &fine.Pstart[0], &fine.Pcol[0], &fine.Pval[0],
+	      apStart, apCol, apVal);
+
+  if (apCol.empty() == true)
+    return -1;
+
+  multiplyCSR(numAgg, numAgg, &fine.Rstart[0], &fine.Rcol[0], &fine.Rval[0],
+	      &apStart[0], &apCol[0], &apVal[0],
+	      coarse.start, coarse.col, coarse.val);
+  coarse.n = numAgg;
+  coarse.setOwned();
+
+  return 0;
+}
+
+void
+SparseGenRowAMG::smooth(SparseGenRowAMGLevel &theLevel, const double *b, double *x)
+{
+  double *r = &theLevel.r[0];
+  multiply(thePool, theLevel.n, theLevel.rowStart, theLevel.colA, theLevel.A, x, r);
+  for (int i=0; i<theLevel.n; i++)
+    x[i] += theLevel.Dinv[i] * (b[i] - r[i]);
+}
+
+void
+SparseGenRowAMG::cycle(int level, const double *b, double *x)
+{
+  SparseGenRowAMGLevel &theLevel = *theLevels[level];
+  int n = theLevel.n;
+  int i, s;
+
+  if (level == (int)theLevels.size()-1) {
+    if (coarseInverse != 0) {
+      for (i=0; i<n; i++) {
+	double sum = 0.0;
+	for (int j=0; j<n; j++)
+	  sum += (*coarseInverse)(i,j) * b[j];
+	x[i] = sum;
+      }
+    } else {
+      for (i=0; i<n; i++)
+	x[i] = theLevel.Dinv[i] * b[i];
+      for (s=1; s<4*numSweeps; s++)
+	this->smooth(theLevel, b, x);
+    }
+    return;
+  }
+
+  // pre-smoothing from a zero start
+  for (i=0; i<n; i++)
+    x[i] = theLevel.Dinv[i] * b[i];
+  for (s=1; s<numSweeps; s++)
+    this->smooth(theLevel, b, x);
+
+  // the coarse correction
+  double *r = &theLevel.r[0];
+  multiply(thePool, n, theLevel.rowStart, theLevel.colA, theLevel.A, x, r);
+  for (i=0; i<n; i++)
+    r[i] = b[i] - r[i];
+
+  SparseGenRowAMGLevel &coarse = *theLevels[level+1];
+  multiply(thePool, coarse.n, &theLevel.Rstart[0], &theLevel.Rcol[0], &theLevel.Rval[0],
+	   r, &coarse.b[0]);
+  this->cycle(level+1, &coarse.b[0], &coarse.x[0]);
+  multiply(thePool, n, &theLevel.Pstart[0], &theLevel.Pcol[0], &theLevel.Pval[0],
+	   &coarse.x[0], r);
+  for (i=0; i<n; i++)
+    x[i] += r[i];
+
+  // post-smoothing
+  for (s=0; s<numSweeps; s++)
+    this->smooth(theLevel, b, x);
+}
+
+int
+SparseGenRowAMG::apply(const double *r, double *z)
+{
+  if (theLevels.empty() == true)
+    return -1;
+
+  this->cycle(0, r, z);
+  return 0;
+}
+
+void
+SparseGenRowAMG::Print(OPS_Stream &s, int flag)
+{
+  s << "AMG (smoothed aggregation) levels: " << (int)theLevels.size();
+  double nnzFine = 0.0;
+  double nnzAll = 0.0;
+  for (unsigned int l=0; l<theLevels.size(); l++) {
+    SparseGenRowAMGLevel &theLevel = *theLevels[l];
+    double nnz = theLevel.rowStart[theLevel.n];
+    if (l == 0)
+      nnzFine = nnz;
+    nnzAll += nnz;
+    s << " " << theLevel.n;
+  }
+  if (nnzFine > 0.0)
+    s << " operator complexity: " << nnzAll/nnzFine;
+  s << endln;
+}
@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMG.h,v $
+                                                                        
+                                                                        
+#ifndef SparseGenRowAMG_h
+#define SparseGenRowAMG_h
+
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMG.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseGenRowAMG. SparseGenRowAMG is a smoothed aggregation algebraic 
+// multigrid preconditioner (Vanek, Mandel and Brezina, Computing 56, 
+// 1996). The unknowns strongly connected in the matrix are aggregated, 
+// the piecewise constant prolongator of the aggregates is smoothed by 
+// one damped Jacobi step on the filtered matrix and the coarse matrix is
+// the Galerkin product R A P with R = P^T. apply() performs a V-cycle 
+// with damped Jacobi smoothing, the coarsest level being solved with a
+// dense inverse; the cycle is symmetric so that it can be used with PCG.
+// The finest level uses the matrix given in setup() directly, it must 
+// not be deallocated while the preconditioner is in use.
+//
+// What: "@(#) SparseGenRowAMG.h, revA"
+
+#include <SparseGenRowPreconditioner.h>
+#include <vector>
+
+class Matrix;
+class SparseGenRowAMGLevel;
+
+class SparseGenRowAMG : public SparseGenRowPreconditioner
+{
+  public:
+    SparseGenRowAMG(double strengthTol = 0.08, int numSweeps = 1,
+		    int coarseSize = 500, int maxLevels = 10);
+    ~SparseGenRowAMG();
+
+    int setup(int n, const int *rowStart, const int *colA, const double *A);
+    int apply(const double *r, double *z);
+    void Print(OPS_Stream &s, int flag = 0);
+
+  protected:
+
+  private:
+    void clearAll(void);
+    int coarsen(SparseGenRowAMGLevel &fine, double eps, SparseGenRowAMGLevel &coarse);
+    void setSmoother(SparseGenRowAMGLevel &theLevel);
+    void smooth(SparseGenRowAMGLevel &theLevel, const double *b, double *x);
+    void cycle(int level, const double *b, double *x);
+
+    double strengthTol;
+    int numSweeps;
+    int coarseSize;
+    int maxLevels;
+
+    std::vector<SparseGenRowAMGLevel *> theLevels;
+    Matrix *coarseInverse;
+};
+
+#endif
@@ -0,0 +1,388 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowILU.cpp,v $
+                                                                        
+                                                                        
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowILU.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of SparseGenRowILU.
+// The factorizations follow the row (IKJ) variants of Saad, "Iterative 
+// Methods for Sparse Linear Systems", 2nd ed., SIAM 2003, Ch. 10.
+//
+// What: "@(#) SparseGenRowILU.cpp, revA"
+
+#include <SparseGenRowILU.h>
+#include <math.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+
+// a zero pivot is replaced by this times the norm of the row
+#define SPARSE_ILU_PIVOT_TOL 1.0e-8
+
+// orders the column indices by the magnitude of their entry in w
+class SparseGenRowILU_Greater
+{
+  public:
+    SparseGenRowILU_Greater(const std::vector<double> &w) :w(w) {};
+    bool operator()(int i, int j) const {return fabs(w[i]) > fabs(w[j]);}
+  private:
+    const std::vector<double> &w;
+};
+
+
+SparseGenRowILU::SparseGenRowILU(int lev)
+  :SparseGenRowPreconditioner(),
+   threshold(false), level(lev), dropTol(0.0), maxFill(0),
+   n(0), havePattern(false)
+{
+  if (level < 0)
+    level = 0;
+}
+
+SparseGenRowILU::SparseGenRowILU(double tol, int fill)
+  :SparseGenRowPreconditioner(),
+   threshold(true), level(0), dropTol(tol), maxFill(fill),
+   n(0), havePattern(false)
+{
+  if (dropTol < 0.0)
+    dropTol = 0.0;
+  if (maxFill < 0)
+    maxFill = 0;
+}
+
+SparseGenRowILU::~SparseGenRowILU()
+{
+
+}
+
+void
+SparseGenRowILU::newStructure(void)
+{
+  havePattern = false;
+}
+
+int
+SparseGenRowILU::setup(int size, const int *rowStart, const int *colA, 
+		       const double *A)
+{
+  if (size != n)
+    havePattern = false;
+  n = size;
+
+  w.assign(n, 0.0);
+  marker.assign(n, -1);
+  Dinv.resize(n);
+
+  if (threshold == true)
+    return this->factorThreshold(rowStart, colA, A);
+
+  if (havePattern == false) {
+    if (this->formPattern(rowStart, colA) < 0)
+      return -1;
+    havePattern = true;
+  }
+
+  return this->factorPattern(rowStart, colA, A);
+}
+
+// int formPattern():
+//	the ILU(k) pattern; the columns of row i are kept in a sorted linked 
+//	list with their level of fill, the fill entering from the U row of 
+//	each column k < i in turn.
+int
+SparseGenRowILU::formPattern(const int *rowStart, const int *colA)
+{
+  Lstart.assign(n+1, 0);
+  Ustart.assign(n+1, 0);
+  Lcol.clear();
+  Ucol.clear();
+
+  std::vector<int> Ulev;
+  std::vector<int> next(n+1);
+  std::vector<int> lev(n, -1);
+
+  for (int i=0; i<n; i++) {
+
+    // the list of the columns of A, n ends the list
+    int head = n;
+    int tail = -1;
+    bool haveDiag = false;
+    for (int p=rowStart[i]; p<rowStart[i+1]; p++) {
+      int j = colA[p];
+      if (j == i)
+	haveDiag = true;
+      else if (j > i && haveDiag == false) {
+	// the diagonal is always in the pattern
+	if (tail < 0) head = i; else next[tail] = i;
+	lev[i] = 0; tail = i;
+	haveDiag = true;
+      }
+      if (tail < 0) head = j; else next[tail] = j;
+      lev[j] = 0; tail = j;
+    }
+    if (haveDiag == false) {
+      if (tail < 0) head = i; else next[tail] = i;
+      lev[i] = 0; tail = i;
+    }
+    next[tail] = n;
+
+    // the fill
+    for (int k=head; k<i; k=next[k]) {
+      int levK = lev[k];
+      for (int p=Ustart[k]; p<Ustart[k+1]; p++) {
+	int newLev = levK + Ulev[p] + 1;
+	if (newLev > level)
+	  continue;
+	int j = Ucol[p];
+	if (lev[j] < 0) {
+	  int prev = k;
+	  while (next[prev] < j)
+	    prev = next[prev];
+	  next[j] = next[prev];
+	  next[prev] = j;
+	  lev[j] = newLev;
+	} else if (newLev < lev[j])
+	  lev[j] = newLev;
+      }
+    }
+
+    for (int c=head; c<n; c=next[c]) {
+      if (c < i)
+	Lcol.push_back(c);
+      else if (c > i) {
+	Ucol.push_back(c);
+	Ulev.push_back(lev[c]);
+      }
+      lev[c] = -1;
+    }
+    Lstart[i+1] = Lcol.size();
+    Ustart[i+1] = Ucol.size();
+  }
+
+  Lval.resize(Lcol.size());
+  Uval.resize(Ucol.size());
+
+  return 0;
+}
+
+double
+SparseGenRowILU::pivot(double d, double rowNorm)
+{
+  double tol = SPARSE_ILU_PIVOT_TOL * rowNorm;
+  if (tol == 0.0)
+    tol = SPARSE_ILU_PIVOT_TOL;
+  if (fabs(d) < tol)
+    d = (d < 0.0) ? -tol : tol;
+  return 1.0/d;
+}
+
+int
+SparseGenRowILU::factorPattern(const int *rowStart, const int *colA, 
+			       const double *A)
+{
+  for (int i=0; i<n; i++) {
+
+    // scatter the row of A into the pattern of row i
+    int p;
+    for (p=Lstart[i]; p<Lstart[i+1]; p++) {
+      marker[Lcol[p]] = i;
+      w[Lcol[p]] = 0.0;
+    }
+    for (p=Ustart[i]; p<Ustart[i+1]; p++) {
+      marker[Ucol[p]] = i;
+      w[Ucol[p]] = 0.0;
+    }
+    marker[i] = i;
+    w[i] = 0.0;
+
+    double rowNorm = 0.0;
+    for (p=rowStart[i]; p<rowStart[i+1]; p++) {
+      w[colA[p]] = A[p];
+      rowNorm += fabs(A[p]);
+    }
+
+    // eliminate with the rows above, in increasing order
+    for (p=Lstart[i]; p<Lstart[i+1]; p++) {
+      int k = Lcol[p];
+      double lik = w[k] * Dinv[k];
+      w[k] = lik;
+      if (lik == 0.0)
+	continue;
+      for (int q=Ustart[k]; q<Ustart[k+1]; q++) {
+	int j = Ucol[q];
+	if (marker[j] == i)
+	  w[j] -= lik * Uval[q];
+      }
+    }
+
+    for (p=Lstart[i]; p<Lstart[i+1]; p++)
+      Lval[p] = w[Lcol[p]];
+    for (p=Ustart[i]; p<Ustart[i+1]; p++)
+      Uval[p] = w[Ucol[p]];
+    Dinv[i] = this->pivot(w[i], rowNorm);
+  }
+
+  return 0;
+}
+
+int
+SparseGenRowILU::factorThreshold(const int *rowStart, const int *colA, 
+				 const double *A)
+{
+  Lstart.assign(n+1, 0);
+  Ustart.assign(n+1, 0);
+  Lcol.clear(); Lval.clear();
+  Ucol.clear(); Uval.clear();
+  marker.assign(n, -1);
+  havePattern = false;
+
+  std::vector<int> nonZeros;
+  std::vector<int> lower, upper;
+  std::priority_queue<int, std::vector<int>, std::greater<int> > theQueue;
+
+  for (int i=0; i<n; i++) {
+
+    nonZeros.clear();
+    double rowNorm = 0.0;
+    for (int p=rowStart[i]; p<rowStart[i+1]; p++) {
+      int j = colA[p];
+      w[j] = A[p];
+      marker[j] = i;
+      nonZeros.push_back(j);
+      rowNorm += A[p]*A[p];
+      if (j < i)
+	theQueue.push(j);
+    }
+    if (marker[i] != i) {
+      w[i] = 0.0;
+      marker[i] = i;
+      nonZeros.push_back(i);
+    }
+    int rowLength = rowStart[i+1] - rowStart[i];
+    rowNorm = (rowLength > 0) ? sqrt(rowNorm/rowLength) : 0.0;
+    double tol = dropTol * rowNorm;
+
+    // eliminate with the rows above in increasing order; the fill from
+    // row k only enters columns above k
+    while (theQueue.empty() == false) {
+      int k = theQueue.top();
+      theQueue.pop();
+      double lik = w[k] * Dinv[k];
+      if (fabs(lik) < tol) {
+	w[k] = 0.0;
+	continue;
+      }
+      w[k] = lik;
+      for (int q=Ustart[k]; q<Ustart[k+1]; q++) {
+	int j = Ucol[q];
+	if (marker[j] != i) {
+	  marker[j] = i;
+	  w[j] = 0.0;
+	  nonZeros.push_back(j);
+	  if (j < i)
+	    theQueue.push(j);
+	}
+	w[j] -= lik * Uval[q];
+      }
+    }
+
+    // drop the small entries and keep the largest maxFill of L and U
+    lower.clear();
+    upper.clear();
+    for (unsigned int a=0; a<nonZeros.size(); a++) {
+      int j = nonZeros[a];
+      if (j != i && fabs(w[j]) >= tol && w[j] != 0.0) {
+	if (j < i)
+	  lower.push_back(j);
+	else
+	  upper.push_back(j);
+      }
+    }
+
+    SparseGenRowILU_Greater theOrder(w);
+    if (maxFill > 0 && (int)lower.size() > maxFill) {
+      std::nth_element(lower.begin(), lower.begin()+maxFill, lower.end(), theOrder);
+      lower.resize(maxFill);
+    }
+    if (maxFill > 0 && (int)upper.size() > maxFill) {
+      std::nth_element(upper.begin(), upper.begin()+maxFill, upper.end(), theOrder);
+      upper.resize(maxFill);
+    }
+
+    for (unsigned int b=0; b<lower.size(); b++) {
+      Lcol.push_back(lower[b]);
+      Lval.push_back(w[lower[b]]);
+    }
+    for (unsigned int c=0; c<upper.size(); c++) {
+      Ucol.push_back(upper[c]);
+      Uval.push_back(w[upper[c]]);
+    }
+    Lstart[i+1] = Lcol.size();
+    Ustart[i+1] = Ucol.size();
+
+    Dinv[i] = this->pivot(w[i], rowNorm);
+
+    for (unsigned int d=0; d<nonZeros.size(); d++)
+      w[nonZeros[d]] = 0.0;
+  }
+
+  return 0;
+}
+
+int
+SparseGenRowILU::apply(const double *r, double *z)
+{
+  int i, p;
+
+  // L y = r
+  for (i=0; i<n; i++) {
+    double sum = r[i];
+    for (p=Lstart[i]; p<Lstart[i+1]; p++)
+      sum -= Lval[p] * z[Lcol[p]];
+    z[i] = sum;
+  }
+
+  // U z = y
+  for (i=n-1; i>=0; i--) {
+    double sum = z[i];
+    for (p=Ustart[i]; p<Ustart[i+1]; p++)
+      sum -= Uval[p] * z[Ucol[p]];
+    z[i] = sum * Dinv[i];
+  }
+
+  return 0;
+}
+
+void
+SparseGenRowILU::Print(OPS_Stream &s, int flag)
+{
+  if (threshold == true)
+    s << "ILUT drop tolerance: " << dropTol << " max fill: " << maxFill;
+  else
+    s << "ILU(" << level << ")";
+  s << " nnz L: " << (int)Lcol.size() << " U: " << (int)Ucol.size() << endln;
+}
@@ -0,0 +1,87 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowILU.h,v $
+                                                                        
+                                                                        
+#ifndef SparseGenRowILU_h
+#define SparseGenRowILU_h
+
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowILU.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseGenRowILU. SparseGenRowILU is an incomplete LU factorization 
+// preconditioner, either ILU(k), keeping the fill up to level k in a 
+// pattern that is formed once for each structure of the matrix, or 
+// ILUT(tau, p), dropping the entries smaller than tau times the norm of 
+// the row and keeping at most p entries in each row of L and U.
+//
+// What: "@(#) SparseGenRowILU.h, revA"
+
+#include <SparseGenRowPreconditioner.h>
+#include <vector>
+
+class SparseGenRowILU : public SparseGenRowPreconditioner
+{
+  public:
+    SparseGenRowILU(int level = 0);
+    SparseGenRowILU(double dropTol, int maxFill);
+    ~SparseGenRowILU();
+
+    int setup(int n, const int *rowStart, const int *colA, const double *A);
+    int apply(const double *r, double *z);
+    void Print(OPS_Stream &s, int flag = 0);
+    void newStructure(void);
+
+  protected:
+
+  private:
+    int formPattern(const int *rowStart, const int *colA);
+    int factorPattern(const int *rowStart, const int *colA, const double *A);
+    int factorThreshold(const int *rowStart, const int *colA, const double *A);
+    double pivot(double d, double rowNorm);
+
+    bool threshold;        // true for ILUT
+    int level;             // fill level of ILU(k)
+    double dropTol;        // tau of ILUT
+    int maxFill;           // p of ILUT
+
+    int n;
+    bool havePattern;
+    
+    // strictly lower L with unit diagonal, strictly upper U and the 
+    // inverse of the diagonal of U, each row of L sorted for ILU(k)
+    std::vector<int> Lstart, Lcol;
+    std::vector<double> Lval;
+    std::vector<int> Ustart, Ucol;
+    std::vector<double> Uval;
+    std::vector<double> Dinv;
+
+    // work arrays
+    std::vector<double> w;
+    std::vector<int> marker;
+};
+
+#endif
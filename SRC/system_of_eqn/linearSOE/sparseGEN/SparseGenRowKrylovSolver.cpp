@@ -0,0 +1,541 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowKrylovSolver.cpp,v $
+                                                                        
+                                                                        
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowKrylovSolver.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// SparseGenRowKrylovSolver.
+//
+// What: "@(#) SparseGenRowKrylovSolver.cpp, revA"
+
+#include <SparseGenRowKrylovSolver.h>
+#include <SparseGenRowLinSOE.h>
+#include <SparseGenRowPreconditioner.h>
+#include <ThreadPool.h>
+#include <Channel.h>
+#include <ID.h>
+#include <Vector.h>
+#include <classTags.h>
+#include <math.h>
+
+static double
+dotProduct(int n, const double *x, const double *y)
+{
+  double sum = 0.0;
+  for (int i=0; i<n; i++)
+    sum += x[i]*y[i];
+  return sum;
+}
+
+SparseGenRowKrylovSolver::SparseGenRowKrylovSolver(int meth, 
+						   SparseGenRowPreconditioner *precond,
+						   double tolerance, int maxI, 
+						   int m, int numT, double ratio)
+  :SparseGenRowLinSolver(SOLVER_TAGS_SparseGenRowKrylovSolver),
+   method(meth), thePrecond(precond), tol(tolerance), maxIter(maxI),
+   restart(m), numThreads(numT), reuseRatio(ratio), thePool(0),
+   precondOK(false), rebuild(false), setupIter(0), numIter(0), numSetups(0)
+{
+  if (restart < 1)
+    restart = 1;
+  if (maxIter < 1)
+    maxIter = 1;
+}
+
+SparseGenRowKrylovSolver::~SparseGenRowKrylovSolver()
+{
+  if (thePrecond != 0)
+    delete thePrecond;
+  if (thePool != 0)
+    delete thePool;
+}
+
+int
+SparseGenRowKrylovSolver::setLinearSOE(SparseGenRowLinSOE &theLinearSOE)
+{
+  theSOE = &theLinearSOE;
+  return 0;
+}
+
+int
+SparseGenRowKrylovSolver::setSize(void)
+{
+  if (thePrecond != 0)
+    thePrecond->newStructure();
+  precondOK = false;
+  return 0;
+}
+
+int
+SparseGenRowKrylovSolver::getNumIterations(void) const
+{
+  return numIter;
+}
+
+int
+SparseGenRowKrylovSolver::getNumSetups(void) const
+{
+  return numSetups;
+}
+
+int
+SparseGenRowKrylovSolver::solve(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::solve(void)- ";
+    opserr << " No LinearSOE object has been set\n";
+    return -1;
+  }
+
+  int n = theSOE->size;
+  if (n == 0)
+    return 0;
+
+  if (thePool == 0 && numThreads != 1) {
+    int numT = numThreads;
+    if (numT <= 0)
+      numT = ThreadPool::getNumProcessors();
+    if (numT > 1) {
+      thePool = new ThreadPool(numT);
+      if (thePrecond != 0)
+	thePrecond->setThreadPool(thePool);
+    }
+  }
+
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  double normB = sqrt(dotProduct(n, B, B));
+
+  if (normB == 0.0) {
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+    numIter = 0;
+    return 0;
+  }
+
+  // a new matrix, either from zeroA() or a new structure
+  bool newMatrix = (theSOE->factored == false);
+  bool newPrecond = false;
+
+  if (precondOK == false || 
+      (newMatrix == true && (reuseRatio <= 0.0 || rebuild == true))) {
+    if (this->setupPrecond() < 0)
+      return -2;
+    newPrecond = true;
+  }
+
+  int result = this->iterate(normB);
+
+  // a preconditioner that is no longer good enough is set up again
+  if (result < 0 && newPrecond == false) {
+    if (this->setupPrecond() < 0)
+      return -2;
+    newPrecond = true;
+    result = this->iterate(normB);
+  }
+
+  if (result < 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::solve(void)- ";
+    opserr << " failed to converge in " << maxIter << " iterations\n";
+    return -3;
+  }
+
+  if (newPrecond == true)
+    setupIter = numIter;
+  else if (numIter > reuseRatio*(setupIter > 0 ? setupIter : 1))
+    rebuild = true;
+
+  theSOE->factored = true;
+
+  return 0;
+}
+
+int
+SparseGenRowKrylovSolver::setupPrecond(void)
+{
+  int n = theSOE->size;
+  const int *rowStart = theSOE->rowStartA;
+  const int *colA = theSOE->colA;
+  const double *A = theSOE->A;
+
+  if (thePrecond != 0) {
+    if (thePrecond->setup(n, rowStart, colA, A) < 0) {
+      opserr << "WARNING SparseGenRowKrylovSolver::solve(void)- ";
+      opserr << " the preconditioner setup failed\n";
+      precondOK = false;
+      return -1;
+    }
+  } else {
+    Dinv.assign(n, 1.0);
+    for (int i=0; i<n; i++)
+      for (int k=rowStart[i]; k<rowStart[i+1]; k++)
+	if (colA[k] == i && A[k] != 0.0)
+	  Dinv[i] = 1.0/A[k];
+  }
+
+  precondOK = true;
+  rebuild = false;
+  numSetups++;
+
+  return 0;
+}
+
+void
+SparseGenRowKrylovSolver::applyPrecond(const double *res, double *zz)
+{
+  if (thePrecond != 0) 
+    thePrecond->apply(res, zz);
+  else {
+    int n = theSOE->size;
+    for (int i=0; i<n; i++)
+      zz[i] = Dinv[i]*res[i];
+  }
+}
+
+void
+SparseGenRowKrylovSolver::multiply(const double *x, double *y)
+{
+  SparseGenRowPreconditioner::multiply(thePool, theSOE->size, theSOE->rowStartA, 
+				       theSOE->colA, theSOE->A, x, y);
+}
+
+int
+SparseGenRowKrylovSolver::iterate(double normB)
+{
+  int n = theSOE->size;
+  r.resize(n);
+  z.resize(n);
+  p.resize(n);
+  q.resize(n);
+
+  for (int i=0; i<n; i++)
+    theSOE->X[i] = 0.0;
+
+  switch (method) {
+  case SPARSE_KRYLOV_CG:
+    return this->solveCG(normB);
+  case SPARSE_KRYLOV_BICGSTAB:
+    return this->solveBiCGStab(normB);
+  default:
+    return this->solveGMRES(normB);
+  }
+}
+
+// int solveCG():
+//	preconditioned conjugate gradients, x = 0 on entry.
+int
+SparseGenRowKrylovSolver::solveCG(double normB)
+{
+  int n = theSOE->size;
+  double *X = theSOE->X;
+  double *R = &r[0];
+  double *Z = &z[0];
+  double *P = &p[0];
+  double *Q = &q[0];
+  int i;
+
+  for (i=0; i<n; i++)
+    R[i] = theSOE->B[i];
+  this->applyPrecond(R, Z);
+  for (i=0; i<n; i++)
+    P[i] = Z[i];
+  double rz = dotProduct(n, R, Z);
+
+  for (numIter=1; numIter<=maxIter; numIter++) {
+    this->multiply(P, Q);
+    double pq = dotProduct(n, P, Q);
+    if (pq == 0.0)
+      return -1;
+
+    double alpha = rz/pq;
+    for (i=0; i<n; i++) {
+      X[i] += alpha*P[i];
+      R[i] -= alpha*Q[i];
+    }
+
+    if (sqrt(dotProduct(n, R, R)) <= tol*normB)
+      return 0;
+
+    this->applyPrecond(R, Z);
+    double rzNew = dotProduct(n, R, Z);
+    double beta = rzNew/rz;
+    rz = rzNew;
+    for (i=0; i<n; i++)
+      P[i] = Z[i] + beta*P[i];
+  }
+
+  return -1;
+}
+
+// int solveGMRES():
+//	restarted GMRES(m) preconditioned on the right, with modified 
+//	Gram-Schmidt for the Arnoldi basis and Givens rotations for the
+//	least squares problem, x = 0 on entry.
+int
+SparseGenRowKrylovSolver::solveGMRES(double normB)
+{
+  int n = theSOE->size;
+  int m = restart;
+  double *X = theSOE->X;
+  double *R = &r[0];
+  double *Z = &z[0];
+  int i, j, k;
+
+  V.resize((m+1)*n);
+  H.resize((m+1)*m);
+  cs.resize(m);
+  sn.resize(m);
+  g.resize(m+1);
+
+  numIter = 0;
+  while (numIter < maxIter) {
+
+    // r = b - A x
+    this->multiply(X, R);
+    for (i=0; i<n; i++)
+      R[i] = theSOE->B[i] - R[i];
+    double beta = sqrt(dotProduct(n, R, R));
+    if (beta <= tol*normB)
+      return 0;
+
+    double *V0 = &V[0];
+    for (i=0; i<n; i++)
+      V0[i] = R[i]/beta;
+    g[0] = beta;
+    for (i=1; i<=m; i++)
+      g[i] = 0.0;
+
+    double resid = beta;
+    int numV = 0;
+    for (j=0; j<m && numIter<maxIter; j++) {
+      numIter++;
+      numV = j+1;
+
+      double *Vj = &V[j*n];
+      double *W = &V[(j+1)*n];
+      double *Hj = &H[j*(m+1)];
+      this->applyPrecond(Vj, Z);
+      this->multiply(Z, W);
+
+      for (k=0; k<=j; k++) {
+	double *Vk = &V[k*n];
+	double h = dotProduct(n, W, Vk);
+	Hj[k] = h;
+	for (i=0; i<n; i++)
+	  W[i] -= h*Vk[i];
+      }
+      double hNext = sqrt(dotProduct(n, W, W));
+      Hj[j+1] = hNext;
+      if (hNext != 0.0)
+	for (i=0; i<n; i++)
+	  W[i] /= hNext;
+
+      // apply the previous rotations to the new column, then a new one
+      for (k=0; k<j; k++) {
+	double temp = cs[k]*Hj[k] + sn[k]*Hj[k+1];
+	Hj[k+1] = -sn[k]*Hj[k] + cs[k]*Hj[k+1];
+	Hj[k] = temp;
+      }
+      double denom = sqrt(Hj[j]*Hj[j] + Hj[j+1]*Hj[j+1]);
+      if (denom == 0.0) {
+	cs[j] = 1.0;
+	sn[j] = 0.0;
+      } else {
+	cs[j] = Hj[j]/denom;
+	sn[j] = Hj[j+1]/denom;
+      }
+      Hj[j] = cs[j]*Hj[j] + sn[j]*Hj[j+1];
+      Hj[j+1] = 0.0;
+      g[j+1] = -sn[j]*g[j];
+      g[j] = cs[j]*g[j];
+
+      resid = fabs(g[j+1]);
+      if (resid <= tol*normB || hNext == 0.0)
+	break;
+    }
+
+    // y = H^-1 g, overwriting g
+    for (k=numV-1; k>=0; k--) {
+      double sum = g[k];
+      for (j=k+1; j<numV; j++)
+	sum -= H[j*(m+1)+k]*g[j];
+      double hkk = H[k*(m+1)+k];
+      if (hkk == 0.0)
+	return -1;
+      g[k] = sum/hkk;
+    }
+
+    // x += M^-1 V y
+    for (i=0; i<n; i++)
+      R[i] = 0.0;
+    for (k=0; k<numV; k++) {
+      double *Vk = &V[k*n];
+      double yk = g[k];
+      for (i=0; i<n; i++)
+	R[i] += yk*Vk[i];
+    }
+    this->applyPrecond(R, Z);
+    for (i=0; i<n; i++)
+      X[i] += Z[i];
+
+    if (resid <= tol*normB)
+      return 0;
+  }
+
+  return -1;
+}
+
+// int solveBiCGStab():
+//	BiCGStab preconditioned on the right, x = 0 on entry.
+int
+SparseGenRowKrylovSolver::solveBiCGStab(double normB)
+{
+  int n = theSOE->size;
+  double *X = theSOE->X;
+  int i;
+
+  s.resize(n);
+  t.resize(n);
+  rHat.resize(n);
+
+  double *R = &r[0];
+  double *Phat = &z[0];
+  double *P = &p[0];
+  double *Vv = &q[0];
+  double *S = &s[0];
+  double *T = &t[0];
+  double *Rhat = &rHat[0];
+
+  for (i=0; i<n; i++) {
+    R[i] = theSOE->B[i];
+    Rhat[i] = R[i];
+    P[i] = 0.0;
+    Vv[i] = 0.0;
+  }
+  double rho = 1.0;
+  double alpha = 1.0;
+  double omega = 1.0;
+
+  for (numIter=1; numIter<=maxIter; numIter++) {
+    double rhoNew = dotProduct(n, Rhat, R);
+    if (rhoNew == 0.0)
+      return -1;
+
+    double beta = (rhoNew/rho)*(alpha/omega);
+    for (i=0; i<n; i++)
+      P[i] = R[i] + beta*(P[i] - omega*Vv[i]);
+
+    this->applyPrecond(P, Phat);
+    this->multiply(Phat, Vv);
+    double rv = dotProduct(n, Rhat, Vv);
+    if (rv == 0.0)
+      return -1;
+    alpha = rhoNew/rv;
+
+    for (i=0; i<n; i++)
+      S[i] = R[i] - alpha*Vv[i];
+    if (sqrt(dotProduct(n, S, S)) <= tol*normB) {
+      for (i=0; i<n; i++)
+	X[i] += alpha*Phat[i];
+      return 0;
+    }
+
+    // shat shares the storage of r
+    double *Shat = R;
+    this->applyPrecond(S, Shat);
+    this->multiply(Shat, T);
+    double tt = dotProduct(n, T, T);
+    if (tt == 0.0)
+      return -1;
+    omega = dotProduct(n, T, S)/tt;
+
+    for (i=0; i<n; i++) {
+      X[i] += alpha*Phat[i] + omega*Shat[i];
+      R[i] = S[i] - omega*T[i];
+    }
+
+    if (sqrt(dotProduct(n, R, R)) <= tol*normB)
+      return 0;
+    if (omega == 0.0)
+      return -1;
+
+    rho = rhoNew;
+  }
+
+  return -1;
+}
+
+int
+SparseGenRowKrylovSolver::sendSelf(int cTag, Channel &theChannel)
+{
+  // the preconditioner is not sent
+  static ID idata(4);
+  idata(0) = method;
+  idata(1) = maxIter;
+  idata(2) = restart;
+  idata(3) = numThreads;
+  if (theChannel.sendID(0, cTag, idata) < 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::sendSelf() - failed to send ID\n";
+    return -1;
+  }
+
+  static Vector ddata(2);
+  ddata(0) = tol;
+  ddata(1) = reuseRatio;
+  if (theChannel.sendVector(0, cTag, ddata) < 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::sendSelf() - failed to send Vector\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+SparseGenRowKrylovSolver::recvSelf(int cTag, Channel &theChannel, 
+				   FEM_ObjectBroker &theBroker)
+{
+  static ID idata(4);
+  if (theChannel.recvID(0, cTag, idata) < 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::recvSelf() - failed to recv ID\n";
+    return -1;
+  }
+  method = idata(0);
+  maxIter = idata(1);
+  restart = idata(2);
+  numThreads = idata(3);
+
+  static Vector ddata(2);
+  if (theChannel.recvVector(0, cTag, ddata) < 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::recvSelf() - failed to recv Vector\n";
+    return -1;
+  }
+  tol = ddata(0);
+  reuseRatio = ddata(1);
+
+  return 0;
+}
@@ -0,0 +1,111 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowKrylovSolver.h,v $
+                                                                        
+                                                                        
+#ifndef SparseGenRowKrylovSolver_h
+#define SparseGenRowKrylovSolver_h
+
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowKrylovSolver.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseGenRowKrylovSolver. SparseGenRowKrylovSolver is a 
+// SparseGenRowLinSolver which solves the system with a preconditioned
+// Krylov method: conjugate gradients for symmetric positive definite
+// systems, restarted GMRES or BiCGStab. The preconditioner, Jacobi if none
+// is given, is set up when the matrix changes and is reused for the 
+// following matrices (e.g. the Newton iterations of a step) as long as 
+// the number of iterations stays below reuseRatio times the number needed
+// right after the last setup. A reuseRatio of 0 sets the preconditioner up 
+// for each new matrix.
+//
+// What: "@(#) SparseGenRowKrylovSolver.h, revA"
+
+#include <SparseGenRowLinSolver.h>
+#include <vector>
+
+#define SPARSE_KRYLOV_CG       0
+#define SPARSE_KRYLOV_GMRES    1
+#define SPARSE_KRYLOV_BICGSTAB 2
+
+class SparseGenRowLinSOE;
+class SparseGenRowPreconditioner;
+class ThreadPool;
+
+class SparseGenRowKrylovSolver : public SparseGenRowLinSolver
+{
+  public:
+    SparseGenRowKrylovSolver(int method = SPARSE_KRYLOV_GMRES,
+			     SparseGenRowPreconditioner *thePrecond = 0,
+			     double tol = 1.0e-8, int maxIter = 1000, 
+			     int restart = 50, int numThreads = 1, 
+			     double reuseRatio = 2.0);
+    ~SparseGenRowKrylovSolver();
+
+    int solve(void);
+    int setSize(void);
+    int setLinearSOE(SparseGenRowLinSOE &theSOE);
+
+    int getNumIterations(void) const;
+    int getNumSetups(void) const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+
+  private:
+    int setupPrecond(void);
+    void applyPrecond(const double *r, double *z);
+    void multiply(const double *x, double *y);
+    int iterate(double normB);
+    int solveCG(double normB);
+    int solveGMRES(double normB);
+    int solveBiCGStab(double normB);
+
+    int method;
+    SparseGenRowPreconditioner *thePrecond;
+    double tol;
+    int maxIter;
+    int restart;
+    int numThreads;
+    double reuseRatio;
+
+    ThreadPool *thePool;
+
+    bool precondOK;       // preconditioner set up for the current structure
+    bool rebuild;         // set up again at the next new matrix
+    int setupIter;        // iterations of the first solve after the setup
+    int numIter;          // iterations of the last solve
+    int numSetups;
+
+    std::vector<double> Dinv;    // Jacobi preconditioner
+    std::vector<double> r, z, p, q, s, t, rHat;
+    std::vector<double> V, H, cs, sn, g;
+};
+
+#endif
@@ -31,10 +31,12 @@
 #include <SparseGenRowLinSolver.h>
 #include <Matrix.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
 #include <math.h>
 #include <stdlib.h>
+#include <algorithm>
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -128,10 +130,6 @@ SparseGenRowLinSOE::getNumEqn(void) const
 int
 SparseGenRowLinSOE::setSize(Graph &theGraph)
 {
-  int result = 0;
-  int oldSize = size;
-  size = theGraph.getNumVertex();
-
   // fist iterate through the vertices of the graph to get nnz
   Vertex *theVertex;
   int newNNZ = 0;
@@ -140,6 +138,85 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
     const ID &theAdjacency = theVertex->getAdjacency();
     newNNZ += theAdjacency.Size() + 1; // the +1 is for the diag entry
   }
+
+  int result = this->setSizeStorage(theGraph.getNumVertex(), newNNZ);
+
+  // fill in rowStartA and colA
+  if (size != 0) {
+    rowStartA[0] = 0;
+    int startLoc = 0;
+    int lastLoc = 0;
+    for (int a = 0; a < size; a++) {
+      theVertex = theGraph.getVertexPtr(a);
+      if (theVertex == 0) {
+        opserr << "WARNING:SparseGenRowLinSOE::setSize :";
+        opserr << " vertex " << a << " not in graph! - size set to 0\n";
+        size = 0;
+        return -1;
+      }
+
+      colA[lastLoc++] = theVertex->getTag(); // place diag in first
+      const ID &theAdjacency = theVertex->getAdjacency();
+      int idSize = theAdjacency.Size();
+
+      // now add the entries in the ID & place them in order in colA
+      for (int i = 0; i<idSize; i++)
+        colA[lastLoc++] = theAdjacency(i);
+      std::sort(&colA[startLoc], &colA[lastLoc]);
+
+      rowStartA[a + 1] = lastLoc;;
+      startLoc = lastLoc;
+    }
+  }
+
+  int solverOK = this->setSizeSolver();
+  if (solverOK < 0)
+    return solverOK;
+
+  return result;
+}
+
+int
+SparseGenRowLinSOE::setSize(CSR_Graph &theGraph)
+{
+  int numVertex = theGraph.getNumVertex();
+  const int *start = theGraph.getStart();
+  const int *adjacency = theGraph.getAdjacency();
+
+  // the adjacency of each vertex is sorted, only the diag is merged in
+  int result = this->setSizeStorage(numVertex, theGraph.getNumEdge()*2 + numVertex);
+
+  if (size != 0) {
+    rowStartA[0] = 0;
+    int lastLoc = 0;
+    for (int a = 0; a < size; a++) {
+      int j = start[a];
+      int endJ = start[a + 1];
+      while (j < endJ && adjacency[j] < a)
+        colA[lastLoc++] = adjacency[j++];
+      colA[lastLoc++] = a;
+      while (j < endJ)
+        colA[lastLoc++] = adjacency[j++];
+
+      rowStartA[a + 1] = lastLoc;
+    }
+  }
+
+  int solverOK = this->setSizeSolver();
+  if (solverOK < 0)
+    return solverOK;
+
+  return result;
+}
+
+// sets size and nnz, making sure A, colA, B, X and rowStartA are large
+// enough
+int
+SparseGenRowLinSOE::setSizeStorage(int newSize, int newNNZ)
+{
+  int result = 0;
+  int oldSize = size;
+  size = newSize;
   nnz = newNNZ;
 
   if (newNNZ > Asize) { // we have to get more space for A and colA
@@ -208,48 +285,20 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
     vectB = new Vector(B, size);
   }
 
-  // fill in rowStartA and colA
-  if (size != 0) {
-    rowStartA[0] = 0;
-    int startLoc = 0;
-    int lastLoc = 0;
-    for (int a = 0; a < size; a++) {
-      theVertex = theGraph.getVertexPtr(a);
-      if (theVertex == 0) {
-        opserr << "WARNING:SparseGenRowLinSOE::setSize :";
-        opserr << " vertex " << a << " not in graph! - size set to 0\n";
-        size = 0;
-        return -1;
-      }
-
-      colA[lastLoc++] = theVertex->getTag(); // place diag in first
-      const ID &theAdjacency = theVertex->getAdjacency();
-      int idSize = theAdjacency.Size();
-
-      // now we have to place the entries in the ID into order in colA
-      for (int i = 0; i<idSize; i++) {
-        int row = theAdjacency(i);
-        bool foundPlace = false;
-        // find a place in colA for current col
-        for (int j = startLoc; j<lastLoc; j++)
-        if (colA[j] > row) {
-          // move the entries already there one further on
-          // and place col in current location
-          for (int k = lastLoc; k>j; k--)
-            colA[k] = colA[k - 1];
-          colA[j] = row;
-          foundPlace = true;
-          j = lastLoc;
-        }
-        if (foundPlace == false) // put in at the end
-          colA[lastLoc] = row;
+  return result;
+}
 
-        lastLoc++;
-      }
-      rowStartA[a + 1] = lastLoc;;
-      startLoc = lastLoc;
-    }
-  }
+// builds the scatter map once rowStartA and colA are set and then
+// invokes setSize() on the solver
+int
+SparseGenRowLinSOE::setSizeSolver(void)
+{
+  // build the maps addA() uses to locate the entries of the FE_Elements
+  // and DOF_Groups in A
+  if (theModel != 0 && size != 0)
+    theScatterMap.setSize(*theModel, size, rowStartA, colA, false);
+  else
+    theScatterMap.clear();
 
   // invoke setSize() on the Solver   
   LinearSOESolver *the_Solver = this->getSolver();
@@ -259,7 +308,7 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
     opserr << " solver failed setSize()\n";
     return solverOK;
   }
-  return result;
+  return 0;
 }
 
 int
@@ -278,6 +327,27 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
     return -1;
   }
 
+  // if a scatter map was built for id use it to place the entries
+  const int *theLocs = theScatterMap.getLocations(id);
+  if (theLocs != 0) {
+    if (fact == 1.0) { // do not need to multiply 
+      for (int i = 0; i < idSize; i++)
+        for (int j = 0; j < idSize; j++) {
+          int loc = *theLocs++;
+          if (loc >= 0)
+            A[loc] += m(j, i);
+        }
+    } else {
+      for (int i = 0; i < idSize; i++)
+        for (int j = 0; j < idSize; j++) {
+          int loc = *theLocs++;
+          if (loc >= 0)
+            A[loc] += fact * m(j, i);
+        }
+    }
+    return 0;
+  }
+
   if (fact == 1.0) { // do not need to multiply 
     for (int i = 0; i < idSize; i++) {
       int row = id(i);
@@ -321,6 +391,32 @@ SparseGenRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
   return 0;
 }
 
+int
+SparseGenRowLinSOE::addA(const int *rowStart, const int *colIndex, 
+			 const double *values, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)
+    return 0;
+
+  // the columns of both are sorted, so each row is a single merge
+  for (int row = 0; row < size; row++) {
+    int k = rowStartA[row];
+    int endRowLoc = rowStartA[row + 1];
+    for (int l = rowStart[row]; l < rowStart[row + 1]; l++) {
+      int col = colIndex[l];
+      while (k < endRowLoc && colA[k] < col)
+        k++;
+      if (k == endRowLoc)
+        break;
+      if (colA[k] == col)
+        A[k] += fact * values[l];
+    }
+  }
+
+  return 0;
+}
+
 int
 SparseGenRowLinSOE::addB(const Vector &v, const ID &id, double fact)
 {
@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <SparseGenScatterMap.h>
 
 class SparseGenRowLinSolver;
 
@@ -50,7 +51,10 @@ class SparseGenRowLinSOE : public LinearSOE
 
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
+    int setSize(CSR_Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addA(const int *rowStart, const int *colIndex, 
+	     const double *values, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
     int setB(const Vector &, double fact = 1.0);        
     
@@ -72,10 +76,14 @@ class SparseGenRowLinSOE : public LinearSOE
     friend class CulaSparseSolverS5;    
     friend class CulaSparseSolverS6;
     friend class CuSPSolver;
+    friend class SparseGenRowKrylovSolver;
 
   protected:
     
   private:
+    int setSizeStorage(int newSize, int newNNZ);
+    int setSizeSolver(void);
+
     int size;            // order of A
     int nnz;             // number of non-zeros in A
     double *A, *B, *X;   // 1d arrays containing coefficients of A, B and X
@@ -84,6 +92,7 @@ class SparseGenRowLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    SparseGenScatterMap theScatterMap;  // element entry -> location in A
 };
 
 
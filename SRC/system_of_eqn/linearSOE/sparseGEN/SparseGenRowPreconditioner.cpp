@@ -0,0 +1,98 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowPreconditioner.cpp,v $
+                                                                        
+                                                                        
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowPreconditioner.cpp
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// SparseGenRowPreconditioner.
+//
+// What: "@(#) SparseGenRowPreconditioner.cpp, revA"
+
+#include <SparseGenRowPreconditioner.h>
+#include <ThreadPool.h>
+
+// rows below this are multiplied by the calling thread alone
+#define SPARSE_GEN_ROW_MIN_PARALLEL 2000
+
+// ThreadTask for the rows of y = A x
+class SparseGenRowMultiplyTask: public ThreadTask
+{
+  public:
+    SparseGenRowMultiplyTask(const int *rowStart, const int *colA, 
+			     const double *A, const double *x, double *y)
+      :rowStart(rowStart), colA(colA), A(A), x(x), y(y) {};
+    int run(int first, int last, int threadID) {
+      for (int i=first; i<last; i++) {
+	double sum = 0.0;
+	for (int k=rowStart[i]; k<rowStart[i+1]; k++)
+	  sum += A[k]*x[colA[k]];
+	y[i] = sum;
+      }
+      return 0;
+    }
+  private:
+    const int *rowStart;
+    const int *colA;
+    const double *A;
+    const double *x;
+    double *y;
+};
+
+
+SparseGenRowPreconditioner::SparseGenRowPreconditioner()
+  :thePool(0)
+{
+
+}
+
+SparseGenRowPreconditioner::~SparseGenRowPreconditioner()
+{
+
+}
+
+void
+SparseGenRowPreconditioner::setThreadPool(ThreadPool *pool)
+{
+  thePool = pool;
+}
+
+void
+SparseGenRowPreconditioner::multiply(ThreadPool *pool, int n, 
+				     const int *rowStart, const int *colA, 
+				     const double *A, 
+				     const double *x, double *y)
+{
+  SparseGenRowMultiplyTask theTask(rowStart, colA, A, x, y);
+
+  // each row is formed by one thread, the result does not depend on 
+  // the number of threads
+  if (pool != 0 && pool->getNumThreads() > 1 && n >= SPARSE_GEN_ROW_MIN_PARALLEL)
+    pool->execute(theTask, n, 256);
+  else
+    theTask.run(0, n, 0);
+}
@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowPreconditioner.h,v $
+                                                                        
+                                                                        
+#ifndef SparseGenRowPreconditioner_h
+#define SparseGenRowPreconditioner_h
+
+// File: ~/system_of_eqn/linearSOE/sparseGEN/SparseGenRowPreconditioner.h
+// 
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// SparseGenRowPreconditioner. SparseGenRowPreconditioner is an abstract 
+// base class for the preconditioners used by SparseGenRowKrylovSolver. 
+// setup() is given the matrix in the compressed row storage of 
+// SparseGenRowLinSOE, apply() returns z = M^-1 r. The class also provides
+// the product of a compressed row matrix and a vector, performed by the
+// ThreadPool if one has been set.
+//
+// What: "@(#) SparseGenRowPreconditioner.h, revA"
+
+#include <OPS_Globals.h>
+
+class ThreadPool;
+
+class SparseGenRowPreconditioner
+{
+  public:
+    SparseGenRowPreconditioner();
+    virtual ~SparseGenRowPreconditioner();
+
+    virtual int setup(int n, const int *rowStart, const int *colA, 
+		      const double *A) =0;
+    virtual int apply(const double *r, double *z) =0;
+    virtual void Print(OPS_Stream &s, int flag = 0) =0;
+
+    // invoked when the structure of the matrix has changed
+    virtual void newStructure(void) {};
+
+    void setThreadPool(ThreadPool *thePool);
+
+    // y = A x
+    static void multiply(ThreadPool *thePool, int n, const int *rowStart, 
+			 const int *colA, const double *A, 
+			 const double *x, double *y);
+
+  protected:
+    ThreadPool *thePool;
+
+  private:
+};
+
+#endif
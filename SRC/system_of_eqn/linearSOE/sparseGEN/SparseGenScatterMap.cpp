@@ -0,0 +1,276 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenScatterMap.cpp,v $
+
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation for SparseGenScatterMap.
+//
+// What: "@(#) SparseGenScatterMap.cpp, revA"
+
+#include <SparseGenScatterMap.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <ID.h>
+#include <OPS_Globals.h>
+#include <stddef.h>
+#include <limits.h>
+#include <iostream>
+using std::nothrow;
+
+// the IDs are at least 8 byte aligned, the low bits carry no information
+static inline int
+hashID(const ID *id, int tableSize)
+{
+  size_t key = (size_t)id >> 3;
+  return (int)((key * 2654435761u) & (size_t)(tableSize-1));
+}
+
+SparseGenScatterMap::SparseGenScatterMap()
+  :numMaps(0), theIDs(0), dofStart(0), locStart(0), theDOFs(0), theLocs(0),
+   theTable(0), tableSize(0), sizeMaps(0), sizeDOFs(0), sizeLocs(0)
+{
+
+}
+
+SparseGenScatterMap::~SparseGenScatterMap()
+{
+  if (theIDs != 0) delete [] theIDs;
+  if (dofStart != 0) delete [] dofStart;
+  if (locStart != 0) delete [] locStart;
+  if (theDOFs != 0) delete [] theDOFs;
+  if (theLocs != 0) delete [] theLocs;
+  if (theTable != 0) delete [] theTable;
+}
+
+void
+SparseGenScatterMap::clear(void)
+{
+  numMaps = 0;
+}
+
+int
+SparseGenScatterMap::setSize(AnalysisModel &theModel, int n, const int *start,
+			     const int *index, bool colCompressed)
+{
+  numMaps = 0;
+
+  // determine the space needed for the maps
+  int newNumMaps = 0;
+  int numDOFs = 0;
+  double numLocs = 0.0;
+
+  FE_EleIter &theEles = theModel.getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    int idSize = elePtr->getID().Size();
+    newNumMaps++;
+    numDOFs += idSize;
+    numLocs += (double)idSize*idSize;
+  }
+
+  DOF_GrpIter &theDofs = theModel.getDOFs();
+  DOF_Group *dofPtr;
+  while ((dofPtr = theDofs()) != 0) {
+    int idSize = dofPtr->getID().Size();
+    newNumMaps++;
+    numDOFs += idSize;
+    numLocs += (double)idSize*idSize;
+  }
+
+  if (newNumMaps == 0)
+    return 0;
+
+  if (numLocs > INT_MAX) {
+    opserr << "WARNING SparseGenScatterMap::setSize() - model too large for scatter maps,";
+    opserr << " entries will be located by search\n";
+    return -1;
+  }
+
+  // get more space if needed
+  if (newNumMaps > sizeMaps) {
+    if (theIDs != 0) delete [] theIDs;
+    if (dofStart != 0) delete [] dofStart;
+    if (locStart != 0) delete [] locStart;
+
+    theIDs = new (nothrow) const ID *[newNumMaps];
+    dofStart = new (nothrow) int[newNumMaps+1];
+    locStart = new (nothrow) int[newNumMaps+1];
+    sizeMaps = newNumMaps;
+
+    if (theIDs == 0 || dofStart == 0 || locStart == 0) {
+      opserr << "WARNING SparseGenScatterMap::setSize() - out of memory\n";
+      sizeMaps = 0;
+      return -1;
+    }
+  }
+
+  if (numDOFs > sizeDOFs) {
+    if (theDOFs != 0) delete [] theDOFs;
+    theDOFs = new (nothrow) int[numDOFs];
+    sizeDOFs = numDOFs;
+    if (theDOFs == 0) {
+      opserr << "WARNING SparseGenScatterMap::setSize() - out of memory\n";
+      sizeDOFs = 0;
+      return -1;
+    }
+  }
+
+  if ((int)numLocs > sizeLocs) {
+    if (theLocs != 0) delete [] theLocs;
+    theLocs = new (nothrow) int[(int)numLocs];
+    sizeLocs = (int)numLocs;
+    if (theLocs == 0) {
+      opserr << "WARNING SparseGenScatterMap::setSize() - out of memory for ";
+      opserr << sizeLocs << " locations\n";
+      sizeLocs = 0;
+      return -1;
+    }
+  }
+
+  // hash table kept at most half full
+  int newTableSize = 16;
+  while (newTableSize < 2*newNumMaps)
+    newTableSize *= 2;
+
+  if (newTableSize != tableSize) {
+    if (theTable != 0) delete [] theTable;
+    theTable = new (nothrow) int[newTableSize];
+    tableSize = newTableSize;
+    if (theTable == 0) {
+      opserr << "WARNING SparseGenScatterMap::setSize() - out of memory\n";
+      tableSize = 0;
+      return -1;
+    }
+  }
+
+  for (int i=0; i<tableSize; i++)
+    theTable[i] = -1;
+
+  // now build the maps
+  dofStart[0] = 0;
+  locStart[0] = 0;
+
+  FE_EleIter &theEles2 = theModel.getFEs();
+  while ((elePtr = theEles2()) != 0)
+    this->addMap(elePtr->getID(), n, start, index, colCompressed);
+
+  DOF_GrpIter &theDofs2 = theModel.getDOFs();
+  while ((dofPtr = theDofs2()) != 0)
+    this->addMap(dofPtr->getID(), n, start, index, colCompressed);
+
+  return 0;
+}
+
+const int *
+SparseGenScatterMap::getLocations(const ID &id) const
+{
+  if (numMaps == 0)
+    return 0;
+
+  int loc = hashID(&id, tableSize);
+  int mapNum;
+  while ((mapNum = theTable[loc]) != -1) {
+    if (theIDs[mapNum] == &id) {
+
+      // make sure the ID has not changed since the map was built
+      int idSize = id.Size();
+      const int *dofs = &theDOFs[dofStart[mapNum]];
+      if (dofStart[mapNum+1] - dofStart[mapNum] != idSize)
+	return 0;
+      for (int i=0; i<idSize; i++)
+	if (dofs[i] != id(i))
+	  return 0;
+
+      return &theLocs[locStart[mapNum]];
+    }
+    loc = (loc+1) & (tableSize-1);
+  }
+
+  return 0;
+}
+
+int
+SparseGenScatterMap::addMap(const ID &id, int n, const int *start,
+			    const int *index, bool colCompressed)
+{
+  int idSize = id.Size();
+
+  int *dofs = &theDOFs[dofStart[numMaps]];
+  for (int j=0; j<idSize; j++)
+    dofs[j] = id(j);
+
+  // locate each entry with a binary search of its row/column in index
+  int *locs = &theLocs[locStart[numMaps]];
+  for (int i=0; i<idSize; i++) {
+    int col = id(i);
+    for (int j=0; j<idSize; j++) {
+      int row = id(j);
+      int loc = -1;
+      if (col >= 0 && col < n && row >= 0 && row < n) {
+	int outer = col;
+	int inner = row;
+	if (colCompressed == false) {
+	  outer = row;
+	  inner = col;
+	}
+	int left = start[outer];
+	int right = start[outer+1]-1;
+	while (left <= right) {
+	  int middle = (left + right)/2;
+	  int value = index[middle];
+	  if (value == inner) {
+	    loc = middle;
+	    break;
+	  } else if (value < inner)
+	    left = middle + 1;
+	  else
+	    right = middle - 1;
+	}
+      }
+      *locs++ = loc;
+    }
+  }
+
+  theIDs[numMaps] = &id;
+  dofStart[numMaps+1] = dofStart[numMaps] + idSize;
+  locStart[numMaps+1] = locStart[numMaps] + idSize*idSize;
+
+  // insert into the hash table; if the same ID is there already keep it
+  int loc = hashID(&id, tableSize);
+  while (theTable[loc] != -1) {
+    if (theIDs[theTable[loc]] == &id)
+      break;
+    loc = (loc+1) & (tableSize-1);
+  }
+  if (theTable[loc] == -1)
+    theTable[loc] = numMaps;
+
+  numMaps++;
+
+  return 0;
+}
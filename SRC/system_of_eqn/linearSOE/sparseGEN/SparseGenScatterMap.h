@@ -0,0 +1,79 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenScatterMap.h,v $
+
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for SparseGenScatterMap.
+// A SparseGenScatterMap stores, for each FE_Element and DOF_Group of an
+// AnalysisModel, the location in the compressed storage of a sparse matrix of
+// every entry of the element matrix. The maps are built once when the SOE is
+// sized and allow addA() to assemble without searching the compressed rows
+// (or columns) of the matrix. The maps are looked up by the address of the
+// ID passed to addA(); the contents of the ID are checked against a copy so a
+// stale or unknown ID is detected and the caller can fall back on a search.
+//
+// What: "@(#) SparseGenScatterMap.h, revA"
+
+#ifndef SparseGenScatterMap_h
+#define SparseGenScatterMap_h
+
+class AnalysisModel;
+class ID;
+
+class SparseGenScatterMap
+{
+  public:
+    SparseGenScatterMap();
+    ~SparseGenScatterMap();
+
+    // builds the maps for the compressed storage given by start (size n+1)
+    // and index, the indices of each of the n rows/columns being in
+    // ascending order. if colCompressed is true the outer index is the
+    // column (SparseGenCol storage), otherwise it is the row.
+    int setSize(AnalysisModel &theModel, int n, const int *start,
+		const int *index, bool colCompressed);
+    void clear(void);
+
+    // returns the locations for the entries of the matrix assembled with id,
+    // entry (j,i) of the matrix at [i*id.Size()+j], -1 for entries with a
+    // row or column outside the matrix; 0 if there is no map for id
+    const int *getLocations(const ID &id) const;
+
+  private:
+    int addMap(const ID &id, int n, const int *start, const int *index,
+	       bool colCompressed);
+
+    int numMaps;
+    const ID **theIDs;    // the IDs the maps were built for
+    int *dofStart;        // start of each map's copy of the ID in theDOFs
+    int *locStart;        // start of each map's locations in theLocs
+    int *theDOFs;
+    int *theLocs;
+    int *theTable;        // hash table of map numbers, -1 for empty slots
+    int tableSize;        // a power of 2
+    int sizeMaps, sizeDOFs, sizeLocs;
+};
+
+#endif
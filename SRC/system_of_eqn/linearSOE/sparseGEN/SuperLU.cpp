@@ -38,18 +38,137 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <DataFileStream.h>
+#include <Timer.h>
+#include <PerformanceMonitor.h>
+#include <string.h>
 #include <iostream>
 using std::nothrow;
 
+// a SuperLUPattern holds a copy of a sparsity pattern together with the
+// column permutation and postordered elimination tree computed for it
+class SuperLUPattern
+{
+  public:
+    SuperLUPattern();
+    ~SuperLUPattern();
+
+    int setPattern(unsigned int hash, int n, int nnz, 
+		   const int *colStart, const int *rowIndex);
+    bool matches(unsigned int hash, int n, int nnz, 
+		 const int *colStart, const int *rowIndex) const;
+
+    unsigned int hash;
+    int n, nnz;
+    int *colStart, *rowIndex;
+    int *perm_c, *etree;
+    int stamp;
+};
+
+SuperLUPattern::SuperLUPattern()
+  :hash(0), n(0), nnz(0), colStart(0), rowIndex(0), perm_c(0), etree(0), stamp(0)
+{
+
+}
+
+SuperLUPattern::~SuperLUPattern()
+{
+  if (colStart != 0)
+    delete [] colStart;
+  if (rowIndex != 0)
+    delete [] rowIndex;
+  if (perm_c != 0)
+    delete [] perm_c;
+  if (etree != 0)
+    delete [] etree;
+}
+
+int
+SuperLUPattern::setPattern(unsigned int theHash, int theN, int theNNZ, 
+			   const int *theColStart, const int *theRowIndex)
+{
+  if (theN != n) {
+    if (colStart != 0)
+      delete [] colStart;
+    if (perm_c != 0)
+      delete [] perm_c;
+    if (etree != 0)
+      delete [] etree;
+    colStart = new (nothrow) int[theN+1];
+    perm_c = new (nothrow) int[theN];
+    etree = new (nothrow) int[theN];
+  }
+  if (theNNZ != nnz) {
+    if (rowIndex != 0)
+      delete [] rowIndex;
+    rowIndex = new (nothrow) int[theNNZ];
+  }
+  n = theN;
+  nnz = theNNZ;
+
+  if (colStart == 0 || rowIndex == 0 || perm_c == 0 || etree == 0) {
+    hash = 0;
+    n = -1;
+    nnz = -1;
+    return -1;
+  }
+
+  hash = theHash;
+  memcpy(colStart, theColStart, (n+1)*sizeof(int));
+  memcpy(rowIndex, theRowIndex, nnz*sizeof(int));
+
+  return 0;
+}
+
+bool
+SuperLUPattern::matches(unsigned int theHash, int theN, int theNNZ, 
+			const int *theColStart, const int *theRowIndex) const
+{
+  if (theHash != hash || theN != n || theNNZ != nnz)
+    return false;
+
+  // guard against hash collisions
+  if (memcmp(colStart, theColStart, (n+1)*sizeof(int)) != 0 ||
+      memcmp(rowIndex, theRowIndex, nnz*sizeof(int)) != 0)
+    return false;
+
+  return true;
+}
+
+// FNV-1a hash of the compressed column pattern
+static unsigned int
+hashPattern(int n, int nnz, const int *colStart, const int *rowIndex)
+{
+  unsigned int hash = 2166136261u;
+  hash = (hash ^ (unsigned int)n) * 16777619u;
+  hash = (hash ^ (unsigned int)nnz) * 16777619u;
+  for (int i=0; i<=n; i++)
+    hash = (hash ^ (unsigned int)colStart[i]) * 16777619u;
+  for (int i=0; i<nnz; i++)
+    hash = (hash ^ (unsigned int)rowIndex[i]) * 16777619u;
+
+  return hash;
+}
+
+SuperLU *SuperLU::lastFactored = 0;
+int SuperLU::numSymbolic = 0;
+int SuperLU::numSymbolicReused = 0;
+int SuperLU::numNumeric = 0;
+double SuperLU::symbolicTime = 0.0;
+double SuperLU::numericTime = 0.0;
+
 SuperLU::SuperLU(int perm, 
 		 double drop_tolerance, 
 		 int panel, 
 		 int relx, 
-		 char symm)
+		 char symm,
+		 int numPat,
+		 bool reuseRowP)
 :SparseGenColLinSolver(SOLVER_TAGS_SuperLU),
  perm_r(0),perm_c(0), etree(0), sizePerm(0),
  relax(relx), permSpec(perm), panelSize(panel), 
- drop_tol(drop_tolerance), symmetric(symm)
+ drop_tol(drop_tolerance), symmetric(symm),
+ thePatterns(0), maxPatterns(0), numPatterns(0), patternStamp(0),
+ currentPattern(0), reuseRowPerm(reuseRowP)
 {
   // set_default_options(&options);
   options.Fact = DOFACT;
@@ -71,6 +190,17 @@ SuperLU::SuperLU(int perm,
   A.ncol = 0;
   B.ncol = 0;
   AC.ncol = 0;
+
+  if (numPat > 0) {
+    thePatterns = new (nothrow) SuperLUPattern *[numPat];
+    if (thePatterns == 0) {
+      opserr << "WARNING SuperLU::SuperLU() - ran out of memory for pattern cache\n";
+    } else {
+      for (int i=0; i<numPat; i++)
+	thePatterns[i] = 0;
+      maxPatterns = numPat;
+    }
+  }
 }
 
 
@@ -101,6 +231,15 @@ SuperLU::~SuperLU()
   if (B.ncol != 0) {
     SUPERLU_FREE(B.Store);
   }
+
+  if (thePatterns != 0) {
+    for (int i=0; i<numPatterns; i++)
+      delete thePatterns[i];
+    delete [] thePatterns;
+  }
+
+  if (lastFactored == this)
+    lastFactored = 0;
 }
 
 /*
@@ -187,22 +326,38 @@ SuperLU::solve(void)
 	// factor the matrix
 	int info;
 
-	if (L.ncol != 0 && symmetric == 'N') {
+	// dgstrf() keeps the sizes of L and U in static storage, they can
+	// only be reused if this object performed the last factorization
+	if (options.Fact == SamePattern_SameRowPerm && lastFactored != this)
+	  options.Fact = SamePattern;
+
+	if (L.ncol != 0 && options.Fact != SamePattern_SameRowPerm) {
 	  Destroy_SuperNode_Matrix(&L);
 	  Destroy_CompCol_Matrix(&U);	  
 	}
 
-	dgstrf(&options, &AC, relax, panelSize,
-	       etree, NULL, 0, perm_c, perm_r, &L, &U, &stat, &info);
+	double startTime = Timer::getWallTime();
 
+	{
+	  PerformanceTimer theTimer(PERF_FACTOR);
+	  dgstrf(&options, &AC, relax, panelSize,
+		 etree, NULL, 0, perm_c, perm_r, &L, &U, &stat, &info);
+	}
+
+	numericTime += Timer::getWallTime() - startTime;
+	numNumeric++;
+	lastFactored = this;
 
 	if (info != 0) {	
 	  opserr << "WARNING SuperLU::solve(void)- ";
 	  opserr << " Error " << info << " returned in factorization dgstrf()\n";
+	  // do not try to keep the row permutation next time round
+	  if (options.Fact == SamePattern_SameRowPerm)
+	    options.Fact = SamePattern;
 	  return -info;
 	}
 
-	if (symmetric == 'Y')
+	if (symmetric == 'Y' || reuseRowPerm == true)
 	  options.Fact= SamePattern_SameRowPerm;
 	else
 	  options.Fact = SamePattern;
@@ -233,6 +388,8 @@ SuperLU::setSize()
     int n = theSOE->size;
     if (n > 0) {
 
+      double startTime = Timer::getWallTime();
+
       // create space for the permutation vectors 
       // and the elimination tree
       if (sizePerm < n) {
@@ -261,25 +418,93 @@ SuperLU::setSize()
       // initialisation
       StatInit(&stat);
 
+      // free the structures created for the previous system
+      if (AC.ncol != 0) {
+	NCPformat *ACstore = (NCPformat *)AC.Store;
+	SUPERLU_FREE(ACstore->colbeg);
+	SUPERLU_FREE(ACstore->colend);
+	SUPERLU_FREE(ACstore);
+      }
+      if (A.ncol != 0)
+	SUPERLU_FREE(A.Store);
+      if (B.ncol != 0)
+	SUPERLU_FREE(B.Store);
+
       // create the SuperMatrix A	
       dCreate_CompCol_Matrix(&A, n, n, theSOE->nnz, theSOE->A, 
 			     theSOE->rowA, theSOE->colStartA, 
 			     SLU_NC, SLU_D, SLU_GE);
 
-      // obtain and apply column permutation to give SuperMatrix AC
-      get_perm_c(permSpec, &A, perm_c);
+      if (symmetric == 'Y')
+	options.SymmetricMode=YES;
+
+      // see if the symbolic analysis of the pattern is in the cache
+      SuperLUPattern *thePattern = 0;
+      unsigned int hash = 0;
+      if (maxPatterns > 0) {
+	hash = hashPattern(n, theSOE->nnz, theSOE->colStartA, theSOE->rowA);
+	thePattern = this->findPattern(hash);
+      }
+
+      bool keepFactors = false;
+
+      if (thePattern != 0) {
+
+	// reuse the postordered column permutation and elimination tree,
+	// with Fact != DOFACT sp_preorder() only applies the permutation
+	for (int i=0; i<n; i++) {
+	  perm_c[i] = thePattern->perm_c[i];
+	  etree[i] = thePattern->etree[i];
+	}
+	options.Fact = SamePattern;
+	sp_preorder(&options, &A, perm_c, etree, &AC);
+
+	// if L and U are still those of this pattern keep them & the row perm
+	if (reuseRowPerm == true && thePattern == currentPattern && 
+	    lastFactored == this && L.ncol != 0)
+	  keepFactors = true;
+
+	numSymbolicReused++;
+
+      } else {
 
-      sp_preorder(&options, &A, perm_c, etree, &AC);
+	// obtain and apply column permutation to give SuperMatrix AC
+	get_perm_c(permSpec, &A, perm_c);
+
+	// set the refact variable to 'N' after first factorization with new size 
+	// can set to 'Y'.
+	options.Fact = DOFACT;
+
+	sp_preorder(&options, &A, perm_c, etree, &AC);
+
+	// save the result for when the pattern is seen again
+	if (maxPatterns > 0) {
+	  thePattern = this->addPattern(hash);
+	  if (thePattern != 0) {
+	    for (int i=0; i<n; i++) {
+	      thePattern->perm_c[i] = perm_c[i];
+	      thePattern->etree[i] = etree[i];
+	    }
+	  }
+	}
+
+	numSymbolic++;
+      }
+
+      if (keepFactors == true)
+	options.Fact = SamePattern_SameRowPerm;
+      else if (L.ncol != 0) {
+	Destroy_SuperNode_Matrix(&L);
+	Destroy_CompCol_Matrix(&U);	  
+	L.ncol = 0;
+	U.ncol = 0;
+      }
+      currentPattern = thePattern;
 
       // create the rhs SuperMatrix B 
       dCreate_Dense_Matrix(&B, n, 1, theSOE->X, n, SLU_DN, SLU_D, SLU_GE);
-	
-      // set the refact variable to 'N' after first factorization with new size 
-      // can set to 'Y'.
-      options.Fact = DOFACT;
 
-      if (symmetric == 'Y')
-	options.SymmetricMode=YES;
+      symbolicTime += Timer::getWallTime() - startTime;
 
     } else if (n == 0)
 	return 0;
@@ -292,6 +517,72 @@ SuperLU::setSize()
     return 0;
 }
 
+SuperLUPattern *
+SuperLU::findPattern(unsigned int hash)
+{
+  int n = theSOE->size;
+  int nnz = theSOE->nnz;
+
+  for (int i=0; i<numPatterns; i++) {
+    SuperLUPattern *thePattern = thePatterns[i];
+    if (thePattern->matches(hash, n, nnz, theSOE->colStartA, theSOE->rowA) == true) {
+      thePattern->stamp = ++patternStamp;
+      return thePattern;
+    }
+  }
+
+  return 0;
+}
+
+SuperLUPattern *
+SuperLU::addPattern(unsigned int hash)
+{
+  SuperLUPattern *thePattern = 0;
+
+  // use a free slot or else the least recently used pattern
+  if (numPatterns < maxPatterns) {
+    thePattern = new (nothrow) SuperLUPattern();
+    if (thePattern == 0)
+      return 0;
+    thePatterns[numPatterns++] = thePattern;
+  } else {
+    thePattern = thePatterns[0];
+    for (int i=1; i<numPatterns; i++)
+      if (thePatterns[i]->stamp < thePattern->stamp)
+	thePattern = thePatterns[i];
+  }
+
+  if (thePattern->setPattern(hash, theSOE->size, theSOE->nnz, 
+			     theSOE->colStartA, theSOE->rowA) < 0) {
+    opserr << "WARNING SuperLU::setSize() - ran out of memory for pattern cache\n";
+    return 0;
+  }
+  thePattern->stamp = ++patternStamp;
+
+  return thePattern;
+}
+
+void
+SuperLU::getStatistics(int &numSym, int &numSymReused, double &symTime, 
+		       int &numNum, double &numTime)
+{
+  numSym = numSymbolic;
+  numSymReused = numSymbolicReused;
+  symTime = symbolicTime;
+  numNum = numNumeric;
+  numTime = numericTime;
+}
+
+void
+SuperLU::resetStatistics(void)
+{
+  numSymbolic = 0;
+  numSymbolicReused = 0;
+  numNumeric = 0;
+  symbolicTime = 0.0;
+  numericTime = 0.0;
+}
+
 int
 SuperLU::sendSelf(int cTag, Channel &theChannel)
 {
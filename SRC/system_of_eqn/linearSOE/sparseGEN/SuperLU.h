@@ -42,12 +42,22 @@
 // factorization; the preordering for sparsity is completely separate
 // from the factorization and a number of ordering schemes are provided. 
 //
+// Optionally the symbolic analysis (column permutation and elimination
+// tree) of up to numPatterns sparsity patterns is cached, keyed by a hash
+// of the pattern, so that when setSize() is invoked for a pattern seen
+// before (elements removed and re-added, repeated analyses) only the
+// numeric factorization is performed. If reuseRowPerm is true the row
+// permutation and the storage of L and U are kept for refactorizations of
+// the same pattern as long as the pivots remain acceptable.
+//
 // What: "@(#) SuperLU.h, revA"
 
 #include <SparseGenColLinSolver.h>
 #include <slu_ddefs.h>
 #include <supermatrix.h>
 
+class SuperLUPattern;
+
 class SuperLU : public SparseGenColLinSolver
 {
   public:
@@ -55,7 +65,9 @@ class SuperLU : public SparseGenColLinSolver
 	    double drop_tol = 0.0, 
 	    int panelSize = 6, 
 	    int relax = 6,
-	    char symmetric = 'N');
+	    char symmetric = 'N',
+	    int numPatterns = 0,
+	    bool reuseRowPerm = false);
     ~SuperLU();
 
     int solve(void);
@@ -63,10 +75,21 @@ class SuperLU : public SparseGenColLinSolver
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+
+    // counts and wall clock times of the symbolic analyses (computed and
+    // taken from the pattern cache) and numeric factorizations performed
+    // by all SuperLU objects
+    static void getStatistics(int &numSymbolic, int &numSymbolicReused,
+			      double &symbolicTime, 
+			      int &numNumeric, double &numericTime);
+    static void resetStatistics(void);
     
   protected:
 
   private:
+    SuperLUPattern *findPattern(unsigned int hash);
+    SuperLUPattern *addPattern(unsigned int hash);
+
     SuperMatrix A,L,U,B,AC;
     int *perm_r;
     int *perm_c;
@@ -77,6 +100,20 @@ class SuperLU : public SparseGenColLinSolver
     char symmetric;
     superlu_options_t options;
     SuperLUStat_t stat;
+
+    SuperLUPattern **thePatterns;   // cache of symbolic analyses
+    int maxPatterns, numPatterns;
+    int patternStamp;               // for replacing least recently used
+    SuperLUPattern *currentPattern; // pattern of the current L and U
+    bool reuseRowPerm;
+
+    // the SuperLU object that performed the last factorization; dgstrf()
+    // keeps part of its state in static storage so L and U can only be
+    // refactored with the same row permutation by that object
+    static SuperLU *lastFactored;
+
+    static int numSymbolic, numSymbolicReused, numNumeric;
+    static double symbolicTime, numericTime;
 };
 
 #endif
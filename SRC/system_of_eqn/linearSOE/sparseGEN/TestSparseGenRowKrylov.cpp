@@ -0,0 +1,239 @@
+// Description: checks SparseGenRowKrylovSolver against the direct sparse
+// solvers. The 7 point finite difference Laplacian of an n x n x n grid,
+// with the boundary fixed, is solved with SuperLU and UMFPACK and with each
+// of pcg, gmres and bicgstab preconditioned by jacobi, ilu, ilut and amg.
+// For each solver the wall time of the solve (the setup of the
+// factorization or preconditioner included), the number of iterations and
+// the relative difference of the solution from the SuperLU one are printed.
+// SuperLU must reproduce the known solution to round-off. Every Krylov
+// solve must converge and agree with SuperLU to within the tolerance on
+// the residual times the condition number, which grows as n^2.
+//
+// usage: testSparseGenRowKrylov ?n?, exits with the number of failed checks
+
+#include <StandardStream.h>
+#include <SparseGenRowLinSOE.h>
+#include <SparseGenRowKrylovSolver.h>
+#include <SparseGenRowILU.h>
+#include <SparseGenRowAMG.h>
+#include <SparseGenColLinSOE.h>
+#include <SuperLU.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#include <LinearSOE.h>
+#include <CSR_Graph.h>
+#include <Timer.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+StandardStream sserr;
+OPS_Stream *opserrPtr = &sserr;
+
+static int n = 20;
+static const double tol = 1.0e-10;
+
+static int
+eqnNumber(int i, int j, int k)
+{
+  return i + j*n + k*n*n;
+}
+
+static ID *
+newEdge(int eqn0, int eqn1)
+{
+  ID *theEdge = new ID(2);
+  (*theEdge)(0) = eqn0;
+  (*theEdge)(1) = eqn1;
+  return theEdge;
+}
+
+// the grid edges, each an ID of the 2 equations it connects
+static void
+getEdges(ID **&theEdges, int &numEdge)
+{
+  numEdge = 3*n*n*(n-1);
+  theEdges = new ID *[numEdge];
+  int edge = 0;
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int eqn = eqnNumber(i,j,k);
+	if (i < n-1)
+	  theEdges[edge++] = newEdge(eqn, eqnNumber(i+1,j,k));
+	if (j < n-1)
+	  theEdges[edge++] = newEdge(eqn, eqnNumber(i,j+1,k));
+	if (k < n-1)
+	  theEdges[edge++] = newEdge(eqn, eqnNumber(i,j,k+1));
+      }
+}
+
+// assembles the Laplacian, an edge matrix for each edge of the grid and a
+// diagonal term for each neighbour on the fixed boundary, and the right
+// hand side A x for a known x
+static void
+formSystem(LinearSOE &theSOE, ID **theEdges, int numEdge, Vector &x)
+{
+  theSOE.zeroA();
+  theSOE.zeroB();
+
+  Matrix edgeMatrix(2,2);
+  edgeMatrix(0,0) = edgeMatrix(1,1) = 1.0;
+  edgeMatrix(0,1) = edgeMatrix(1,0) = -1.0;
+  for (int edge=0; edge<numEdge; edge++)
+    theSOE.addA(edgeMatrix, *theEdges[edge]);
+
+  int numEqn = n*n*n;
+  Matrix boundary(1,1);
+  ID eqn(1);
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int numFixed = (i == 0) + (i == n-1) + (j == 0) + (j == n-1) + (k == 0) + (k == n-1);
+	if (numFixed != 0) {
+	  boundary(0,0) = numFixed;
+	  eqn(0) = eqnNumber(i,j,k);
+	  theSOE.addA(boundary, eqn);
+	}
+      }
+
+  // b = A x, x a smooth field plus a checkerboard
+  x.resize(numEqn);
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++)
+	x(eqnNumber(i,j,k)) = sin(0.3*i + 0.2*j + 0.1*k) + (((i+j+k)%2 == 0) ? 0.5 : -0.5);
+  Vector b(numEqn);
+  for (int edge=0; edge<numEdge; edge++) {
+    int e0 = (*theEdges[edge])(0);
+    int e1 = (*theEdges[edge])(1);
+    b(e0) += x(e0) - x(e1);
+    b(e1) += x(e1) - x(e0);
+  }
+  for (int k=0; k<n; k++)
+    for (int j=0; j<n; j++)
+      for (int i=0; i<n; i++) {
+	int numFixed = (i == 0) + (i == n-1) + (j == 0) + (j == n-1) + (k == 0) + (k == n-1);
+	b(eqnNumber(i,j,k)) += numFixed*x(eqnNumber(i,j,k));
+      }
+  theSOE.setB(b);
+}
+
+// solves the system, returning the wall time of the solve or -1.0 if it
+// fails; UmfpackGenLinSolver returns a positive code on failure
+static double
+solveSystem(LinearSOE &theSOE, Vector &x)
+{
+  double tStart = Timer::getWallTime();
+  if (theSOE.solve() != 0)
+    return -1.0;
+  double time = Timer::getWallTime() - tStart;
+  x = theSOE.getX();
+  return time;
+}
+
+// main routine
+int main(int argc, char **argv)
+{
+  if (argc == 2)
+    n = atoi(argv[1]);
+
+  int numFailed = 0;
+  int numEqn = n*n*n;
+
+  ID **theEdges;
+  int numEdge;
+  getEdges(theEdges, numEdge);
+  CSR_Graph theGraph;
+  theGraph.build(numEqn, (const ID **)theEdges, numEdge);
+
+  opserr << "Laplacian " << n << " x " << n << " x " << n << ", " << numEqn << " equations\n";
+  opserr << "solver             time (s)  iterations  rel. difference\n";
+  char buffer[120];
+
+  // the direct solves, SuperLU with the COLAMD column ordering as the 
+  // grid numbering is not a good one for it
+  Vector xSuperLU, xUmfpack, xExact;
+  SparseGenColLinSOE theSuperLU(*(new SuperLU(3)));
+  theSuperLU.setSize(theGraph.getGraph());
+  formSystem(theSuperLU, theEdges, numEdge, xExact);
+  double time = solveSystem(theSuperLU, xSuperLU);
+  if (time < 0.0) {
+    opserr << "FAILED - SuperLU\n";
+    exit(numFailed+1);
+  }
+  double normX = xSuperLU.Norm();
+  if ((xSuperLU - xExact).Norm() > 1.0e-12*normX) {
+    opserr << "FAILED - SuperLU solution\n";
+    numFailed++;
+  }
+  sprintf(buffer, "%-17s %9.3f %11s %16s\n", "SuperLU", time, "-", "-");
+  opserr << buffer;
+
+  // the fill of the factors of a 3D grid, and the workspace UMFPACK needs
+  // for them, grows with n; UMFPACK is only timed, the test does not
+  // depend on it
+  UmfpackGenLinSOE theUmfpack(*(new UmfpackGenLinSolver()), 10 + 8*n);
+  theUmfpack.setSize(theGraph.getGraph());
+  formSystem(theUmfpack, theEdges, numEdge, xExact);
+  time = solveSystem(theUmfpack, xUmfpack);
+  if (time < 0.0)
+    opserr << "UMFPACK           failed\n";
+  else {
+    double diff = (xUmfpack - xSuperLU).Norm()/normX;
+    sprintf(buffer, "%-17s %9.3f %11s %16.2e\n", "UMFPACK", time, "-", diff);
+    opserr << buffer;
+  }
+
+  // the Krylov solves
+  const char *methodNames[3] = {"pcg", "gmres", "bicgstab"};
+  const char *precondNames[4] = {"jacobi", "ilu", "ilut", "amg"};
+  int methods[3] = {SPARSE_KRYLOV_CG, SPARSE_KRYLOV_GMRES, SPARSE_KRYLOV_BICGSTAB};
+
+  for (int m=0; m<3; m++)
+    for (int p=0; p<4; p++) {
+      SparseGenRowPreconditioner *thePrecond = 0;
+      if (p == 1)
+	thePrecond = new SparseGenRowILU(0);
+      else if (p == 2)
+	thePrecond = new SparseGenRowILU(1.0e-4, 30);
+      else if (p == 3)
+	thePrecond = new SparseGenRowAMG();
+      SparseGenRowKrylovSolver *theSolver =
+	new SparseGenRowKrylovSolver(methods[m], thePrecond, tol, 5000, 50, 1, 0.0);
+      SparseGenRowLinSOE theSOE(*theSolver);
+      theSOE.setSize(theGraph);
+      formSystem(theSOE, theEdges, numEdge, xExact);
+
+      Vector x;
+      char name[40];
+      sprintf(name, "%s %s", methodNames[m], precondNames[p]);
+      time = solveSystem(theSOE, x);
+      if (time < 0.0) {
+	opserr << "FAILED - " << name << " did not converge\n";
+	numFailed++;
+	continue;
+      }
+
+      double diff = (x - xSuperLU).Norm()/normX;
+      sprintf(buffer, "%-17s %9.3f %11d %16.2e\n", name, time,
+	      theSolver->getNumIterations(), diff);
+      opserr << buffer;
+      if (diff > tol*n*n) {
+	opserr << "FAILED - " << name << " differs from SuperLU\n";
+	numFailed++;
+      }
+    }
+
+  for (int edge=0; edge<numEdge; edge++)
+    delete theEdges[edge];
+  delete [] theEdges;
+
+  if (numFailed == 0)
+    opserr << "SparseGenRowKrylovSolver - all checks passed\n";
+
+  exit(numFailed);
+}
@@ -0,0 +1,383 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/HashOfTaggedObjects.cpp,v $
+
+// File: ~/tagged/storage/HashOfTaggedObjects.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Purpose: This file contains the implementation of the HashOfTaggedObjects
+// class.
+//
+// What: "@(#) HashOfTaggedObjects.cpp, revA"
+
+#include <TaggedObject.h>
+#include <HashOfTaggedObjects.h>
+
+#include <OPS_Globals.h>
+
+// the home slot of a tag, Fibonacci hashing so that tags following a
+// regular pattern (1010203, 1010204, .., 1020203, ..) are spread evenly
+#define HASH_SLOT(tag, shift) \
+  ((int)(((unsigned int)(tag) * 2654435769u) >> (shift)))
+
+HashOfTaggedObjects::HashOfTaggedObjects(int size)
+:numComponents(0), sizeComponentArray(0), numUsed(0), theComponents(0),
+ tableSize(0), tableShift(0), theTable(0), 
+ myIter(*this)
+{
+  if (size < 2)
+    size = 2;
+
+  theComponents = new TaggedObject *[size];
+  if (theComponents == 0) {
+    opserr << "HashOfTaggedObjects::HashOfTaggedObjects - failed to allocate an array of size " << size << endln;
+    return;
+  } 
+
+  sizeComponentArray = size;
+  for (int i=0; i<sizeComponentArray; i++) 
+    theComponents[i] = 0;
+
+  // keep the table at most half full
+  int newTableSize = 16;
+  while (newTableSize < 2*size)
+    newTableSize *= 2;
+
+  this->rehash(newTableSize);
+}
+
+
+HashOfTaggedObjects::~HashOfTaggedObjects()
+{
+  if (theComponents != 0)
+    delete [] theComponents;
+  if (theTable != 0)
+    delete [] theTable;
+}
+
+
+int
+HashOfTaggedObjects::setSize(int newSize)
+{
+  if (newSize < 0) {
+    opserr << "HashOfTaggedObjects::setSize - invalid size " << newSize << endln;
+    return -1;	
+  } 
+
+  // squeeze out any holes before deciding on a size
+  if (numUsed != numComponents)
+    if (this->compact() < 0)
+      return -2;
+
+  if (newSize < numUsed)
+    newSize = numUsed;
+  if (newSize < 2) 
+    newSize = 2;
+
+  if (newSize != sizeComponentArray) {
+    TaggedObject **newArray = new TaggedObject *[newSize];
+    if (newArray == 0) {
+      opserr << "HashOfTaggedObjects::setSize - failed to allocate an array of size " << newSize << endln;
+      return -2;
+    } 
+
+    for (int i=0; i<numUsed; i++)
+      newArray[i] = theComponents[i];
+    for (int i=numUsed; i<newSize; i++)
+      newArray[i] = 0;
+
+    if (theComponents != 0)
+      delete [] theComponents;
+    theComponents = newArray;
+    sizeComponentArray = newSize;
+  }
+
+  // enlarge the table if it would be more than half full
+  int newTableSize = tableSize;
+  while (newTableSize < 2*newSize)
+    newTableSize *= 2;
+
+  if (newTableSize != tableSize)
+    return this->rehash(newTableSize);
+
+  return 0;
+}
+
+
+bool 
+HashOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+  if (theTable == 0) {
+    opserr << "HashOfTaggedObjects::addComponent() - no memory was allocated\n";
+    return false;
+  }
+
+  int newComponentTag = newComponent->getTag();
+
+  // check to see that no other component already exists; at the same 
+  // time find the empty slot the new component will go in
+  int mask = tableSize-1;
+  int slot = HASH_SLOT(newComponentTag, tableShift);
+  while (theTable[2*slot+1] >= 0) {
+    if (theTable[2*slot] == newComponentTag) {
+      opserr << "WARNING HashOfTaggedObjects::addComponent() - component" <<
+	" with tag already exists, not adding component with tag: " <<
+	newComponentTag << endln;
+      return false;
+    }
+    slot = (slot+1) & mask;
+  }
+
+  // check to see if the array has room at the end. if not make room
+  // by squeezing out the holes or, if few, by doubling its size
+  if (numUsed == sizeComponentArray || 2*(numComponents+1) > tableSize) {
+    int newSize = sizeComponentArray;
+    if (2*numComponents >= numUsed)
+      newSize = 2*sizeComponentArray;
+    if (this->setSize(newSize) < 0) {
+      opserr << "HashOfTaggedObjects::addComponent()- failed to enlarge the array to size " <<
+	newSize << endln;
+      return false;
+    }
+
+    // the table may have been rebuilt, find the slot again
+    mask = tableSize-1;
+    slot = HASH_SLOT(newComponentTag, tableShift);
+    while (theTable[2*slot+1] >= 0)
+      slot = (slot+1) & mask;
+  }
+
+  theComponents[numUsed] = newComponent;
+  theTable[2*slot] = newComponentTag;
+  theTable[2*slot+1] = numUsed;
+  numUsed++;
+  numComponents++;
+
+  return true;  // o.k.
+}
+
+
+TaggedObject *
+HashOfTaggedObjects::removeComponent(int tag)
+{
+  int slot = this->findSlot(tag);
+  if (slot < 0)
+    return 0;
+
+  int loc = theTable[2*slot+1];
+  TaggedObject *removed = theComponents[loc];
+  theComponents[loc] = 0;
+  numComponents--;
+
+  // trailing holes can be given back straight away, the iter 
+  // never goes past numUsed
+  while (numUsed > 0 && theComponents[numUsed-1] == 0)
+    numUsed--;
+
+  // remove from the table, moving back any entry further along the
+  // probe sequence that would otherwise no longer be found
+  int mask = tableSize-1;
+  int hole = slot;
+  int next = slot;
+  while (true) {
+    next = (next+1) & mask;
+    if (theTable[2*next+1] < 0)
+      break;
+
+    int home = HASH_SLOT(theTable[2*next], tableShift);
+
+    // entry stays if its home lies cyclically in (hole, next]
+    bool stays;
+    if (hole <= next)
+      stays = (hole < home && home <= next);
+    else
+      stays = (hole < home || home <= next);
+
+    if (stays == false) {
+      theTable[2*hole] = theTable[2*next];
+      theTable[2*hole+1] = theTable[2*next+1];
+      hole = next;
+    }
+  }
+  theTable[2*hole+1] = -1;
+
+  return removed;
+}
+
+
+int
+HashOfTaggedObjects::getNumComponents(void) const
+{
+  return numComponents;
+}
+
+
+TaggedObject *
+HashOfTaggedObjects::getComponentPtr(int tag)
+{
+  int slot = this->findSlot(tag);
+  if (slot < 0)
+    return 0;
+
+  return theComponents[theTable[2*slot+1]];
+}
+
+
+TaggedObjectIter &
+HashOfTaggedObjects::getComponents()
+{
+  // reset the iter to point to first component and then return 
+  // a reference to the iter
+  myIter.reset();
+  return myIter;
+}
+
+
+HashOfTaggedObjectsIter 
+HashOfTaggedObjects::getIter()
+{
+  // return a new iter to the components, needed if user needs
+  // to have multiple iters running in same code segment!
+  return HashOfTaggedObjectsIter(*this);
+}
+
+
+TaggedObjectStorage *
+HashOfTaggedObjects::getEmptyCopy(void)
+{
+  HashOfTaggedObjects *theCopy = new HashOfTaggedObjects(sizeComponentArray);
+    
+  if (theCopy == 0) {
+    opserr << "HashOfTaggedObjects::getEmptyCopy - out of memory\n";
+  }
+
+  return theCopy;
+}
+
+
+void
+HashOfTaggedObjects::clearAll(bool invokeDestructors)
+{
+  for (int i=0; i<numUsed; i++) {
+    if (theComponents[i] != 0) {
+      if (invokeDestructors == true)
+	delete theComponents[i];
+      theComponents[i] = 0;
+    }
+  }
+
+  for (int i=0; i<tableSize; i++)
+    theTable[2*i+1] = -1;
+
+  numUsed = 0;
+  numComponents = 0;
+}
+
+
+// void Print(OPS_Stream &s, int flag) const
+//	method which invokes Print on all components
+
+void
+HashOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+  for (int i=0; i<numUsed; i++)
+    if (theComponents[i] != 0)
+      theComponents[i]->Print(s, flag);
+}
+
+
+int
+HashOfTaggedObjects::findSlot(int tag) const
+{
+  if (theTable == 0)
+    return -1;
+
+  int mask = tableSize-1;
+  int slot = HASH_SLOT(tag, tableShift);
+  while (theTable[2*slot+1] >= 0) {
+    if (theTable[2*slot] == tag)
+      return slot;
+    slot = (slot+1) & mask;
+  }
+
+  return -1;
+}
+
+
+int
+HashOfTaggedObjects::rehash(int newTableSize)
+{
+  int *newTable = new int[2*newTableSize];
+  if (newTable == 0) {
+    opserr << "HashOfTaggedObjects::rehash() - failed to allocate a table of size " << newTableSize << endln;
+    return -2;
+  }
+
+  if (theTable != 0)
+    delete [] theTable;
+  theTable = newTable;
+  tableSize = newTableSize;
+
+  tableShift = 32;
+  for (int i=1; i<tableSize; i*=2)
+    tableShift--;
+
+  for (int i=0; i<tableSize; i++)
+    theTable[2*i+1] = -1;
+
+  int mask = tableSize-1;
+  for (int i=0; i<numUsed; i++) {
+    TaggedObject *theObject = theComponents[i];
+    if (theObject != 0) {
+      int tag = theObject->getTag();
+      int slot = HASH_SLOT(tag, tableShift);
+      while (theTable[2*slot+1] >= 0)
+	slot = (slot+1) & mask;
+      theTable[2*slot] = tag;
+      theTable[2*slot+1] = i;
+    }
+  }
+
+  return 0;
+}
+
+
+int
+HashOfTaggedObjects::compact(void)
+{
+  // move the components down over the holes keeping their order
+  int numKept = 0;
+  for (int i=0; i<numUsed; i++) 
+    if (theComponents[i] != 0)
+      theComponents[numKept++] = theComponents[i];
+
+  for (int i=numKept; i<numUsed; i++)
+    theComponents[i] = 0;
+
+  numUsed = numKept;
+
+  // the locations have changed, rebuild the table
+  return this->rehash(tableSize);
+}
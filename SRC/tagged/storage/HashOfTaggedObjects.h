@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/HashOfTaggedObjects.h,v $
+
+#ifndef HashOfTaggedObjects_h
+#define HashOfTaggedObjects_h
+
+// File: ~/tagged/storage/HashOfTaggedObjects.h
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definition for 
+// HashOfTaggedObjects. HashOfTaggedObjects is a storage class. The class 
+// is responsible for holding and providing access to objects of type 
+// TaggedObject. The objects are held in a contiguous array in the order
+// they were added and an open addressing hash table (linear probing) maps
+// a tag to its location in that array. Lookup is O(1) whatever the tags,
+// which makes the class a good choice for models using large or encoded
+// tag numbers, and iteration is a sequential sweep of the array in the
+// order the objects were added. Removing an object leaves a hole in the
+// array, the holes are squeezed out when the array next needs to grow.
+//
+// What: "@(#) HashOfTaggedObjects.h, revA"
+
+#include <TaggedObjectStorage.h>
+#include <HashOfTaggedObjectsIter.h>
+
+class HashOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    HashOfTaggedObjects(int size = 32);
+    ~HashOfTaggedObjects();    
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);    
+    int  getNumComponents(void) const;
+    
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    HashOfTaggedObjectsIter  getIter();
+    
+    virtual TaggedObjectStorage *getEmptyCopy(void);
+    virtual void clearAll(bool invokeDestructor = true);
+    
+    void Print(OPS_Stream &s, int flag =0);
+    friend class HashOfTaggedObjectsIter;
+    
+  private:
+    int findSlot(int tag) const;      // slot in table holding tag, -1 if none
+    int rehash(int newTableSize);     // rebuild table for array as it is
+    int compact(void);                // squeeze holes out of the array
+
+    int numComponents;          // num of components added
+    int sizeComponentArray;     // size of the array
+    int numUsed;                // num of array locations used, incl. holes
+    TaggedObject **theComponents; // the array, in order of addition
+
+    int tableSize;              // num of slots in the table, a power of 2
+    int tableShift;             // 32 - log2(tableSize)
+    int *theTable;              // slot i: tag at 2i, array location at 2i+1
+
+    HashOfTaggedObjectsIter  myIter; // an iter for accessing the objects
+};
+
+#endif
@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/HashOfTaggedObjectsIter.cpp,v $
+
+// File: ~/tagged/storage/HashOfTaggedObjectsIter.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the method definitions for class 
+// HashOfTaggedObjectsIter.
+
+#include <HashOfTaggedObjectsIter.h>
+#include <HashOfTaggedObjects.h>
+
+HashOfTaggedObjectsIter::HashOfTaggedObjectsIter(HashOfTaggedObjects &theComponents)
+  :myComponents(theComponents), currIndex(0)
+{
+}
+
+HashOfTaggedObjectsIter::~HashOfTaggedObjectsIter()
+{
+}    
+
+void
+HashOfTaggedObjectsIter::reset(void)
+{
+  currIndex = 0;
+}
+
+TaggedObject *
+HashOfTaggedObjectsIter::operator()(void)
+{
+  // skip over the holes left by removed components; components removed
+  // while iterating are simply not seen as the array is not reordered
+  // by removeComponent()
+  TaggedObject **theComponents = myComponents.theComponents;
+  int numUsed = myComponents.numUsed;
+
+  while (currIndex < numUsed) {
+    TaggedObject *theObject = theComponents[currIndex++];
+    if (theObject != 0)
+      return theObject;
+  }
+
+  return 0;
+}
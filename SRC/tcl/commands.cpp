@@ -76,6 +76,8 @@ OPS_Stream *opserrPtr = &sserr;
 #include <FEM_ObjectBrokerAllClasses.h>
 
 #include <Timer.h>
+#include <PerformanceMonitor.h>
+#include <BinaryTimeSeriesFile.h>
 #include <ModelBuilder.h>
 #include "commands.h"
 
@@ -132,6 +134,7 @@ OPS_Stream *opserrPtr = &sserr;
 #include <KrylovNewton.h>
 #include <PeriodicNewton.h>
 #include <AcceleratedNewton.h>
+#include <AdaptiveNewton.h>
 ///*/
 #include <RitzAlgo.h>
 ///*/
@@ -157,6 +160,7 @@ OPS_Stream *opserrPtr = &sserr;
 //#include <PenaltyHandlerNoHomoSPMultipliers.h>
 #include <LagrangeConstraintHandler.h>
 #include <TransformationConstraintHandler.h>
+#include <SparseTransformationConstraintHandler.h>
 #include <Pressure_Constraint.h>
 
 // numberers
@@ -220,6 +224,7 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #include <DirectIntegrationAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
 #include <PFEMAnalysis.h>
+#include <ExplicitDynamicAnalysis.h>
 ///*/
 #include <RitzAnalysis.h>
 ///*/
@@ -250,9 +255,9 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #include <SProfileSPDLinSOE.h>
 
 // #include <ProfileSPDLinDirectBlockSolver.h>
-// #include <ProfileSPDLinDirectThreadSolver.h>
+#include <ProfileSPDLinDirectThreadSolver.h>
 // #include <ProfileSPDLinDirectSkypackSolver.h>
-// #include <BandSPDLinThreadSolver.h>
+#include <BandSPDLinThreadSolver.h>
 ///*/
 #include <FullGenRitzSOE.h>
 #include <FullGenRitzSOESolver.h>
@@ -307,6 +312,9 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 #endif
 
 #include <SparseGenRowLinSOE.h>
+#include <SparseGenRowKrylovSolver.h>
+#include <SparseGenRowILU.h>
+#include <SparseGenRowAMG.h>
 #include <SymSparseLinSOE.h>
 #include <SymSparseLinSolver.h>
 #include <UmfpackGenLinSOE.h>
@@ -333,6 +341,8 @@ extern TransientIntegrator *OPS_NewGeneralizedAlpha(void);
 // graph
 #include <RCM.h>
 #include <AMDNumberer.h>
+#include <NestedDissection.h>
+#include <AutoNumberer.h>
 
 #include <ErrorHandler.h>
 #include <ConsoleErrorHandler.h>
@@ -398,8 +408,10 @@ ModelBuilder *theBuilder = 0;
 
 #include <DistributedDisplacementControl.h>
 #include <ShadowSubdomain.h>
+#include <ThreadSubdomain.h>
 #include <Metis.h>
 #include <ShedHeaviest.h>
+#include <MeasuredCostBalancer.h>
 #include <DomainPartitioner.h>
 #include <GraphPartitioner.h>
 #include <FEM_ObjectBrokerAllClasses.h>
@@ -519,6 +531,7 @@ static EigenSOE *theEigenSOE = 0;
 static StaticAnalysis *theStaticAnalysis = 0;
 static DirectIntegrationAnalysis *theTransientAnalysis = 0;
 static VariableTimeStepDirectIntegrationAnalysis *theVariableTimeStepTransientAnalysis = 0;
+static ExplicitDynamicAnalysis *theExplicitAnalysis = 0;
 static int numEigen = 0;
 #ifdef _PFEM
 static PFEMAnalysis* thePFEMAnalysis = 0;
@@ -554,6 +567,7 @@ static TclOptimizationBuilder *theOptimizationBuilder = 0;   // Quan March 2010
 static StaticIntegrator *theStaticIntegrator = 0;
 static TransientIntegrator *theTransientIntegrator = 0;
 static ConvergenceTest *theTest = 0;
+static int numAssemblyThreads = 1;
 static bool builtModel = false;
 
 static char *resDataPtr = 0;
@@ -670,6 +684,9 @@ convertBinaryToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
 int
 convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+convertTextToBinaryTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int
 maxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -949,6 +966,10 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "modalDamping", &modalDamping,
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "parallelAssembly", &parallelAssembly,
+    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "superLUStats", &superLUStats,
+    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "setElementRayleighDampingFactors",
     &setElementRayleighDampingFactors,
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
@@ -987,6 +1008,7 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
   Tcl_CreateCommand(interp, "stripXML", &stripOpenSeesXML, (ClientData)NULL, NULL);
   Tcl_CreateCommand(interp, "convertBinaryToText", &convertBinaryToText, (ClientData)NULL, NULL);
   Tcl_CreateCommand(interp, "convertTextToBinary", &convertTextToBinary, (ClientData)NULL, NULL);
+  Tcl_CreateCommand(interp, "convertTextToBinaryTimeSeries", &convertTextToBinaryTimeSeries, (ClientData)NULL, NULL);
 
   Tcl_CreateCommand(interp, "getEleTags", &getEleTags,
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
@@ -1031,6 +1053,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "numIter", &numIter,
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  Tcl_CreateCommand(interp, "perfStats", &perfStats,
+    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
   Tcl_CreateCommand(interp, "version", &version,
     (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
 
@@ -1087,6 +1111,7 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
   theStaticAnalysis = 0;
   theTransientAnalysis = 0;
   theVariableTimeStepTransientAnalysis = 0;
+  theExplicitAnalysis = 0;
   theTest = 0;
 
   // create an error handler
@@ -1443,6 +1468,7 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   theStaticAnalysis = 0;
   theTransientAnalysis = 0;
   theVariableTimeStepTransientAnalysis = 0;
+  theExplicitAnalysis = 0;
 
   theTest = 0;
   theDatabase = 0;
@@ -1487,6 +1513,12 @@ wipeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   // NOTE : DON'T do the above on theVariableTimeStepAnalysis
   // as it and theTansientAnalysis are one in the same
 
+  if (theExplicitAnalysis != 0) {
+    theExplicitAnalysis->clearAll();
+    delete theExplicitAnalysis;
+    theExplicitAnalysis = 0;
+  }
+
   theAlgorithm = 0;
   theHandler = 0;
   theNumberer = 0;
@@ -1540,6 +1572,8 @@ initializeAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
 {
   if (theTransientAnalysis != 0)
     theTransientAnalysis->initialize();
+  else if (theExplicitAnalysis != 0)
+    theExplicitAnalysis->initialize();
   else if (theStaticAnalysis != 0)
     theStaticAnalysis->initialize();
 
@@ -1732,19 +1766,107 @@ partitionModel(int eleTag)
   return result;
 }
 
+//
+// partitions the model into numSub ThreadSubdomains in this process; the
+// subdomains are condensed, updated and committed by numSub threads. if
+// balanceInterval is not 0 the elements are moved between the subdomains
+// every balanceInterval commits if the measured cost of the most expensive
+// exceeds the average by the factor balanceTol, see MeasuredCostBalancer
+//
+int 
+partitionThreadModel(int numSub, int eleTag, double balanceTol, int balanceInterval)
+{
+  if (OPS_NUM_SUBDOMAINS > 1) {
+    opserr << "WARNING partition -threads - can not be used with more than one process\n";
+    return -1;
+  }
+
+  // the subdomain integrators are static, the subdomains being condensed
+  // on their own and the loads applied by the PartitionedDomain
+  if (theStaticAnalysis == 0 || theTransientAnalysis != 0) {
+    opserr << "WARNING partition -threads - a static analysis must be defined first\n";
+    return -1;
+  }
+
+  for (int i=1; i<=numSub; i++) {
+    ThreadSubdomain *theSubdomain = new ThreadSubdomain(i);
+    theDomain.addSubdomain(theSubdomain);
+  }
+
+  if (OPS_DOMAIN_PARTITIONER == 0) {
+    OPS_GRAPH_PARTITIONER  = new Metis;
+    if (balanceInterval != 0) {
+      OPS_BALANCER = new MeasuredCostBalancer(balanceTol, balanceInterval);
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
+    } else
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
+    theDomain.setPartitioner(OPS_DOMAIN_PARTITIONER);
+  } else if (balanceInterval != 0 && OPS_BALANCER == 0)
+    opserr << "WARNING partition -threads -balance - the model has already been partitioned without balancing, -balance ignored\n";
+
+  int result = theDomain.partition(numSub, false, 0, eleTag);
+  if (result < 0) 
+    return result;
+
+  OPS_PARTITIONED = true;
+
+  SubdomainIter &theSubdomains = theDomain.getSubdomains();
+  Subdomain *theSub =0;
+  while ((theSub = theSubdomains()) != 0) {
+    IncrementalIntegrator *theSubIntegrator = new LoadControl(0.0, 1, 0.0, 0.0);
+    if (((ThreadSubdomain *)theSub)->setCondensationAnalysis(*theSubIntegrator) < 0)
+      return -1;
+  }
+
+  theDomain.setNumThreads(numSub);
+  theStaticIntegrator->setNumThreads(numSub);
+
+  return result;
+}
+
 #endif
 
 int
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
 #ifdef _PARALLEL_PROCESSING
-  int eleTag;
-  if (argc == 2) {
-    if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK) {
+  int eleTag = 0;
+  int numThreads = 0;
+  double balanceTol = 0.0;
+  int balanceInterval = 0;
+  int loc = 1;
+  if (argc > 2 && strcmp(argv[1], "-threads") == 0) {
+    if (Tcl_GetInt(interp, argv[2], &numThreads) != TCL_OK || numThreads < 2) {
+      opserr << "WARNING partition -threads numSub? <-balance tol? interval?> eleTag? - invalid numSub " << argv[2] << endln;
+      return TCL_ERROR;
+    }
+    loc = 3;
+    if (argc > loc && strcmp(argv[loc], "-balance") == 0) {
+      if (argc < loc+3 || Tcl_GetDouble(interp, argv[loc+1], &balanceTol) != TCL_OK ||
+	  Tcl_GetInt(interp, argv[loc+2], &balanceInterval) != TCL_OK ||
+	  balanceTol < 1.0 || balanceInterval < 1) {
+	opserr << "WARNING partition -threads numSub? -balance tol? interval? - want tol >= 1.0 and interval >= 1\n";
+	return TCL_ERROR;
+      }
+      loc += 3;
+    }
+  } else if (argc > 1 && strcmp(argv[1], "-balance") == 0) {
+    opserr << "WARNING partition -balance - only available with -threads\n";
+    return TCL_ERROR;
+  }
+  if (argc == loc+1) {
+    if (Tcl_GetInt(interp, argv[loc], &eleTag) != TCL_OK) {
       ;
     }
   }
-  partitionModel(eleTag);
+
+  if (numThreads != 0) {
+    if (partitionThreadModel(numThreads, eleTag, balanceTol, balanceInterval) < 0) {
+      opserr << "WARNING partition -threads failed\n";
+      return TCL_ERROR;
+    }
+  } else
+    partitionModel(eleTag);
 
 #endif
   return TCL_OK;
@@ -1785,6 +1907,23 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
     result = thePFEMAnalysis->analyze();
 #endif
   }
+  else if (theExplicitAnalysis != 0) {
+    if (argc < 3) {
+      opserr << "WARNING explicit analysis: analysis numIncr? deltaT?\n";
+      return TCL_ERROR;
+    }
+    int numIncr;
+    if (Tcl_GetInt(interp, argv[1], &numIncr) != TCL_OK)
+      return TCL_ERROR;
+    double dT;
+    if (Tcl_GetDouble(interp, argv[2], &dT) != TCL_OK)
+      return TCL_ERROR;
+
+    // Set global time step variable
+    ops_Dt = dT;
+
+    result = theExplicitAnalysis->analyze(numIncr, dT);
+  }
   else if (theTransientAnalysis != 0) {
     if (argc < 3) {
       opserr << "WARNING transient analysis: analysis numIncr? deltaT?\n";
@@ -2229,6 +2368,10 @@ TCL_Char **argv)
     theTransientAnalysis = 0;
     theVariableTimeStepTransientAnalysis = 0;
   }
+  if (theExplicitAnalysis != 0) {
+    delete theExplicitAnalysis;
+    theExplicitAnalysis = 0;
+  }
 
   // check argv[1] for type of SOE and create it
   if (strcmp(argv[1], "Static") == 0) {
@@ -2628,6 +2771,61 @@ TCL_Char **argv)
 #endif
 
   }
+  else if (strcmp(argv[1], "ExplicitDynamic") == 0) {
+    // the explicit analysis works directly on the domain with a lumped
+    // mass, no handler, numberer, SOE, algorithm or integrator are used
+    double alphaM = 0.0;
+    double factor = 0.9;
+    double waveSpeed = 0.0;
+    int maxLevel = 0;
+    int numThreads = 1;
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count], "-alphaM") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[count+1], &alphaM) != TCL_OK) {
+          opserr << "WARNING analysis ExplicitDynamic - invalid alphaM\n";
+          return TCL_ERROR;
+        }
+        count += 2;
+      }
+      else if (strcmp(argv[count], "-factor") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[count+1], &factor) != TCL_OK) {
+          opserr << "WARNING analysis ExplicitDynamic - invalid factor\n";
+          return TCL_ERROR;
+        }
+        count += 2;
+      }
+      else if (strcmp(argv[count], "-waveSpeed") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[count+1], &waveSpeed) != TCL_OK) {
+          opserr << "WARNING analysis ExplicitDynamic - invalid waveSpeed\n";
+          return TCL_ERROR;
+        }
+        count += 2;
+      }
+      else if (strcmp(argv[count], "-subcycle") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[count+1], &maxLevel) != TCL_OK) {
+          opserr << "WARNING analysis ExplicitDynamic - invalid subcycle level\n";
+          return TCL_ERROR;
+        }
+        count += 2;
+      }
+      else if (strcmp(argv[count], "-numThreads") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[count+1], &numThreads) != TCL_OK) {
+          opserr << "WARNING analysis ExplicitDynamic - invalid numThreads\n";
+          return TCL_ERROR;
+        }
+        count += 2;
+      }
+      else {
+        opserr << "WARNING analysis ExplicitDynamic <-alphaM $a> <-factor $f> ";
+        opserr << "<-waveSpeed $c> <-subcycle $maxLevel> <-numThreads $n>\n";
+        return TCL_ERROR;
+      }
+    }
+
+    theExplicitAnalysis = new ExplicitDynamicAnalysis(theDomain, alphaM, factor, 
+						      waveSpeed, maxLevel, numThreads);
+  }
   else {
     opserr << "WARNING No Analysis type exists (Static Transient only) \n";
     return TCL_ERROR;
@@ -2678,6 +2876,12 @@ TCL_Char **argv)
     }
   }
 
+  if (numAssemblyThreads != 1) {
+    if (theStaticAnalysis != 0 && theStaticIntegrator != 0)
+      theStaticIntegrator->setNumThreads(numAssemblyThreads);
+    else if (theTransientAnalysis != 0 && theTransientIntegrator != 0)
+      theTransientIntegrator->setNumThreads(numAssemblyThreads);
+  }
 
   return TCL_OK;
 }
@@ -2725,7 +2929,27 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   // BAND SPD SOE & SOLVER
   else if (strcmp(argv[1], "BandSPD") == 0) {
-    BandSPDLinSolver    *theSolver = new BandSPDLinLapackSolver();
+    // system BandSPD <-threads numThreads> <-blockSize size>
+    int numThreads = -1;
+    int blockSize = 32;
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count], "-threads") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &numThreads) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-blockSize") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &blockSize) != TCL_OK)
+          return TCL_ERROR;
+      }
+      count++;
+    }
+
+    BandSPDLinSolver    *theSolver = 0;
+    if (numThreads >= 0)
+      theSolver = new BandSPDLinThreadSolver(numThreads, blockSize);
+    else
+      theSolver = new BandSPDLinLapackSolver();
 #ifdef _PARALLEL_PROCESSING
     theSOE = new DistributedBandSPDLinSOE(*theSolver);        
 #else
@@ -2767,7 +2991,27 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   else if (strcmp(argv[1], "ProfileSPD") == 0) {
     // now must determine the type of solver to create from rest of args
-    ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver();
+    // system ProfileSPD <-threads numThreads> <-blockSize size>
+    int numThreads = -1;
+    int blockSize = 32;
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count], "-threads") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &numThreads) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-blockSize") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &blockSize) != TCL_OK)
+          return TCL_ERROR;
+      }
+      count++;
+    }
+
+    ProfileSPDLinSolver *theSolver = 0;
+    if (numThreads >= 0)
+      theSolver = new ProfileSPDLinDirectThreadSolver(numThreads, blockSize, 1.0e-12);
+    else
+      theSolver = new ProfileSPDLinDirectSolver();
 
     /* *********** Some misc solvers i play with ******************
     else if (strcmp(argv[2],"Normal") == 0) {
@@ -3018,6 +3262,8 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     int npRow = 1;
     int npCol = 1;
     int np = 1;
+    int numPatterns = 0;
+    bool reuseRowPerm = false;
 
     // defaults for threaded SuperLU
 
@@ -3045,6 +3291,15 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
           if (Tcl_GetInt(interp, argv[count], &npCol) != TCL_OK)
             return TCL_ERROR;
       }
+      else if (strcmp(argv[count], "-patternCache") == 0) {
+        count++;
+        if (count < argc)
+          if (Tcl_GetInt(interp, argv[count], &numPatterns) != TCL_OK)
+            return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-reuseRowPerm") == 0) {
+        reuseRowPerm = true;
+      }
       count++;
     }
 
@@ -3080,7 +3335,8 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       count++;
     }
 
-    theSolver = new SuperLU(permSpec, drop_tol, panelSize, relax, symmetric);
+    theSolver = new SuperLU(permSpec, drop_tol, panelSize, relax, symmetric,
+      numPatterns, reuseRowPerm);
 
 #endif
 
@@ -3094,6 +3350,109 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   }
 
 
+  // PRECONDITIONED KRYLOV SOLVERS ON THE SPARSE GENERAL ROW SOE
+  else if ((strcmp(argv[1], "Krylov") == 0) || (strcmp(argv[1], "SparseIterative") == 0)) {
+
+    int method = SPARSE_KRYLOV_GMRES;
+    int precond = 2;   // 0 jacobi, 1 ilu, 2 ilut, 3 amg
+    int level = 0;
+    double dropTol = 1.0e-3;
+    int maxFill = 20;
+    double strengthTol = 0.08;
+    int numSweeps = 1;
+    double tol = 1.0e-8;
+    int maxIter = 1000;
+    int restart = 50;
+    int numThreads = 1;
+    double reuseRatio = 2.0;
+
+    int count = 2;
+    while (count < argc) {
+      if (strcmp(argv[count], "-solver") == 0 && count+1 < argc) {
+        count++;
+        if ((strcmp(argv[count], "pcg") == 0) || (strcmp(argv[count], "cg") == 0))
+          method = SPARSE_KRYLOV_CG;
+        else if (strcmp(argv[count], "gmres") == 0)
+          method = SPARSE_KRYLOV_GMRES;
+        else if (strcmp(argv[count], "bicgstab") == 0)
+          method = SPARSE_KRYLOV_BICGSTAB;
+        else {
+          opserr << "WARNING system Krylov - unknown solver " << argv[count] << " (pcg, gmres, bicgstab)\n";
+          return TCL_ERROR;
+        }
+      }
+      else if (strcmp(argv[count], "-precond") == 0 && count+1 < argc) {
+        count++;
+        if ((strcmp(argv[count], "jacobi") == 0) || (strcmp(argv[count], "none") == 0))
+          precond = 0;
+        else if (strcmp(argv[count], "ilu") == 0)
+          precond = 1;
+        else if (strcmp(argv[count], "ilut") == 0)
+          precond = 2;
+        else if (strcmp(argv[count], "amg") == 0)
+          precond = 3;
+        else {
+          opserr << "WARNING system Krylov - unknown preconditioner " << argv[count] << " (jacobi, ilu, ilut, amg)\n";
+          return TCL_ERROR;
+        }
+      }
+      else if (strcmp(argv[count], "-level") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &level) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-dropTol") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++count], &dropTol) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-maxFill") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &maxFill) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-strength") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++count], &strengthTol) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-sweeps") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &numSweeps) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-tol") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++count], &tol) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-maxIter") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &maxIter) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-restart") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &restart) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-numThreads") == 0 && count+1 < argc) {
+        if (Tcl_GetInt(interp, argv[++count], &numThreads) != TCL_OK)
+          return TCL_ERROR;
+      }
+      else if (strcmp(argv[count], "-reuse") == 0 && count+1 < argc) {
+        if (Tcl_GetDouble(interp, argv[++count], &reuseRatio) != TCL_OK)
+          return TCL_ERROR;
+      }
+      count++;
+    }
+
+    SparseGenRowPreconditioner *thePrecond = 0;
+    if (precond == 1)
+      thePrecond = new SparseGenRowILU(level);
+    else if (precond == 2)
+      thePrecond = new SparseGenRowILU(dropTol, maxFill);
+    else if (precond == 3)
+      thePrecond = new SparseGenRowAMG(strengthTol, numSweeps);
+
+    SparseGenRowKrylovSolver *theSolver = 
+      new SparseGenRowKrylovSolver(method, thePrecond, tol, maxIter, restart, 
+                                   numThreads, reuseRatio);
+    theSOE = new SparseGenRowLinSOE(*theSolver);
+  }
+
   else if ((strcmp(argv[1], "SparseSPD") == 0) || (strcmp(argv[1], "SparseSYM") == 0)) {
     // now must determine the type of solver to create from rest of args
 
@@ -3398,6 +3757,44 @@ specifyNumberer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
     AMD *theAMD = new AMD();
     theNumberer = new DOF_Numberer(*theAMD);
   }
+  else if ((strcmp(argv[1], "ND") == 0) || (strcmp(argv[1], "NestedDissection") == 0)) {
+    int leafSize = 64;
+    if (argc > 2 && Tcl_GetInt(interp, argv[2], &leafSize) != TCL_OK) {
+      opserr << "WARNING numberer ND ?leafSize? - invalid leafSize " << argv[2] << endln;
+      return TCL_ERROR;
+    }
+    NestedDissection *theND = new NestedDissection(leafSize);
+    theNumberer = new DOF_Numberer(*theND);
+  }
+  else if (strcmp(argv[1], "Auto") == 0) {
+    // numberer Auto ?-profile? ?-bandwidth? ?-fill? ?-print?
+    // the default criterion follows the system already specified
+    int criterion = AUTO_NUMBERER_PROFILE;
+    if (theSOE != 0) {
+      int soeTag = theSOE->getClassTag();
+      if (soeTag == LinSOE_TAGS_BandGenLinSOE || soeTag == LinSOE_TAGS_BandSPDLinSOE)
+	criterion = AUTO_NUMBERER_BANDWIDTH;
+      else if (soeTag != LinSOE_TAGS_ProfileSPDLinSOE && soeTag != LinSOE_TAGS_ProfileSPDLinSOEGather)
+	criterion = AUTO_NUMBERER_FILL;
+    }
+    bool printCosts = false;
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i], "-profile") == 0)
+	criterion = AUTO_NUMBERER_PROFILE;
+      else if (strcmp(argv[i], "-bandwidth") == 0)
+	criterion = AUTO_NUMBERER_BANDWIDTH;
+      else if (strcmp(argv[i], "-fill") == 0)
+	criterion = AUTO_NUMBERER_FILL;
+      else if (strcmp(argv[i], "-print") == 0)
+	printCosts = true;
+      else {
+	opserr << "WARNING numberer Auto ?-profile? ?-bandwidth? ?-fill? ?-print? - unknown option " << argv[i] << endln;
+	return TCL_ERROR;
+      }
+    }
+    AutoNumberer *theAuto = new AutoNumberer(criterion, printCosts);
+    theNumberer = new DOF_Numberer(*theAuto);
+  }
 
 #ifdef _PARALLEL_INTERPRETERS
 
@@ -3488,6 +3885,10 @@ TCL_Char **argv)
     theHandler = new TransformationConstraintHandler();
   }
 
+  else if (strcmp(argv[1], "SparseTransformation") == 0) {
+    theHandler = new SparseTransformationConstraintHandler();
+  }
+
   else {
     opserr << "WARNING No ConstraintHandler type exists (Plain, Penalty,\n";
     opserr << " Lagrange, Transformation) only\n";
@@ -3749,6 +4150,30 @@ TCL_Char **argv)
     theNewAlgo = new AcceleratedNewton(*theTest, theAccel, incrementTangent);
   }
 
+  else if (strcmp(argv[1], "AdaptiveNewton") == 0) {
+    int formTangent = CURRENT_TANGENT;
+    int maxDim = 3;
+    double maxRatio = 0.9;
+    double krylovRatio = 0.1;
+    for (int i = 2; i < argc; i++) {
+      if (strcmp(argv[i], "-initial") == 0)
+        formTangent = INITIAL_TANGENT;
+      else if (strcmp(argv[i], "-maxDim") == 0 && i + 1 < argc)
+        maxDim = atoi(argv[++i]);
+      else if (strcmp(argv[i], "-maxRatio") == 0 && i + 1 < argc)
+        maxRatio = atof(argv[++i]);
+      else if (strcmp(argv[i], "-krylovRatio") == 0 && i + 1 < argc)
+        krylovRatio = atof(argv[++i]);
+    }
+
+    if (theTest == 0) {
+      opserr << "ERROR: No ConvergenceTest yet specified\n";
+      return TCL_ERROR;
+    }
+
+    theNewAlgo = new AdaptiveNewton(*theTest, maxDim, maxRatio, krylovRatio, formTangent);
+  }
+
   else if (strcmp(argv[1], "Broyden") == 0) {
     int formTangent = CURRENT_TANGENT;
     int count = -1;
@@ -5882,6 +6307,7 @@ TCL_Char **argv)
   int loc = 1;
   double shift = 0.0;
   bool findSmallest = true;
+  bool warmStart = false;
   //  int factLVALUE = 10; // parameter for UmfPack SOE
 
   // Check type of eigenvalue analysis
@@ -5900,6 +6326,19 @@ TCL_Char **argv)
     else if ((strcmp(argv[loc], "-findLargest") == 0))
       findSmallest = false;
 
+    // eigenvalues nearest the shift are found by the Arpack solver
+    else if ((strcmp(argv[loc], "-shift") == 0) && loc < (argc - 2)) {
+      loc++;
+      if (Tcl_GetDouble(interp, argv[loc], &shift) != TCL_OK) {
+        opserr << "WARNING eigen -shift shift? - invalid shift " << argv[loc] << endln;
+        return TCL_ERROR;
+      }
+    }
+
+    // the previous eigenvectors form the starting vector
+    else if ((strcmp(argv[loc], "-warmStart") == 0))
+      warmStart = true;
+
     else if ((strcmp(argv[loc], "genBandArpack") == 0) ||
       (strcmp(argv[loc], "-genBandArpack") == 0) ||
       (strcmp(argv[loc], "genBandArpackEigen") == 0) ||
@@ -6004,7 +6443,7 @@ TCL_Char **argv)
     }
     else {
 
-      theEigenSOE = new ArpackSOE(shift);
+      theEigenSOE = new ArpackSOE(shift, warmStart);
 
     }
 
@@ -6040,6 +6479,13 @@ TCL_Char **argv)
 
   } // theEigenSOE != 0    
 
+  // an existing ArpackSOE keeps its LinearSOE, only the options change
+  else if (typeSolver == EigenSOE_TAGS_ArpackSOE) {
+    ArpackSOE *theArpackSOE = (ArpackSOE *)theEigenSOE;
+    theArpackSOE->setShift(shift);
+    theArpackSOE->setWarmStart(warmStart);
+  }
+
 
   int requiredDataSize = 20 * numEigen;
   if (requiredDataSize > resDataSize) {
@@ -8526,6 +8972,64 @@ modalDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
   return TCL_OK;
 }
 
+// parallelAssembly ?numThreads?
+//   form the element tangents and residuals with numThreads threads,
+//   with no argument or 0 one thread per processor is used
+int
+parallelAssembly(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  int numThreads = 0;
+  if (argc > 1) {
+    if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK || numThreads < 0) {
+      opserr << "WARNING parallelAssembly ?numThreads? - invalid numThreads " << argv[1] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  numAssemblyThreads = numThreads;
+
+  // apply to the current analysis, a new analysis picks it up when created
+  if (theStaticIntegrator != 0)
+    theStaticIntegrator->setNumThreads(numAssemblyThreads);
+  if (theTransientIntegrator != 0)
+    theTransientIntegrator->setNumThreads(numAssemblyThreads);
+
+  int actualThreads = 1;
+  if (theStaticIntegrator != 0)
+    actualThreads = theStaticIntegrator->getNumThreads();
+  else if (theTransientIntegrator != 0)
+    actualThreads = theTransientIntegrator->getNumThreads();
+
+  char buffer[20];
+  sprintf(buffer, "%d", actualThreads);
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  return TCL_OK;
+}
+
+// superLUStats ?-reset?
+//   returns the number of symbolic factorizations computed and taken from
+//   the pattern cache, the time spent in them, the number of numeric
+//   factorizations and the time spent in them
+int
+superLUStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  int numSymbolic, numSymbolicReused, numNumeric;
+  double symbolicTime, numericTime;
+  SuperLU::getStatistics(numSymbolic, numSymbolicReused, symbolicTime,
+    numNumeric, numericTime);
+
+  char buffer[120];
+  sprintf(buffer, "%d %d %.6e %d %.6e", numSymbolic, numSymbolicReused,
+    symbolicTime, numNumeric, numericTime);
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+
+  if (argc > 1 && strcmp(argv[1], "-reset") == 0)
+    SuperLU::resetStatistics();
+
+  return TCL_OK;
+}
+
 int
 setElementRayleighDampingFactors(ClientData clientData,
 Tcl_Interp *interp,
@@ -9368,6 +9872,47 @@ int convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL
   return textToBinary(inputFile, outputFile);
 }
 
+// convertTextToBinaryTimeSeries inputFile outputFile <-float> <-time> <-dt dt>
+// writes a file that Path and PathTime series and the DRM load pattern map
+// into memory rather than read
+int convertTextToBinaryTimeSeries(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "ERROR incorrect # args - convertTextToBinaryTimeSeries inputFile outputFile <-float> <-time> <-dt dt>\n";
+    return TCL_ERROR;
+  }
+
+  const char *inputFile = argv[1];
+  const char *outputFile = argv[2];
+  bool singlePrecision = false;
+  bool hasTime = false;
+  double dt = 0.0;
+
+  int count = 3;
+  while (count < argc) {
+    if (strcmp(argv[count],"-float") == 0) {
+      singlePrecision = true;
+    } else if (strcmp(argv[count],"-time") == 0) {
+      hasTime = true;
+    } else if (strcmp(argv[count],"-dt") == 0 && count+1 < argc) {
+      count++;
+      if (Tcl_GetDouble(interp, argv[count], &dt) != TCL_OK) {
+	opserr << "WARNING convertTextToBinaryTimeSeries - invalid dt " << argv[count] << endln;
+	return TCL_ERROR;
+      }
+    } else {
+      opserr << "WARNING convertTextToBinaryTimeSeries - unknown option " << argv[count] << endln;
+      return TCL_ERROR;
+    }
+    count++;
+  }
+
+  if (BinaryTimeSeriesFile::convertText(inputFile, outputFile, singlePrecision, hasTime, dt) < 0)
+    return TCL_ERROR;
+
+  return TCL_OK;
+}
+
 int domainChange(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
   theDomain.domainChange();
@@ -9567,6 +10112,87 @@ numIter(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+// perfStats ?-on ?-trace?? ?-off? ?-reset? ?-print? ?-trace fileName? ?-steps? ?-elements?
+// with no option returns {phase numCalls wallTime cpuTime} for each phase
+int
+perfStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  char buffer[256];
+
+  if (argc == 1) {
+    for (int i=0; i<PERF_NUM_PHASES; i++) {
+      sprintf(buffer, "{%s %d %g %g} ", PerformanceMonitor::getPhaseName(i),
+	      PerformanceMonitor::getNumCalls(i), PerformanceMonitor::getWallTime(i),
+	      PerformanceMonitor::getCPUTime(i));
+      Tcl_AppendResult(interp, buffer, NULL);
+
+      // the back substitution is the part of the solve not spent factoring
+      if (i == PERF_FACTOR) {
+	sprintf(buffer, "{backSubstitute %d %g %g} ", PerformanceMonitor::getNumCalls(PERF_SOLVE),
+		PerformanceMonitor::getWallTime(PERF_SOLVE) - PerformanceMonitor::getWallTime(PERF_FACTOR),
+		PerformanceMonitor::getCPUTime(PERF_SOLVE) - PerformanceMonitor::getCPUTime(PERF_FACTOR));
+	Tcl_AppendResult(interp, buffer, NULL);
+      }
+    }
+    return TCL_OK;
+  }
+
+  if (strcmp(argv[1],"-on") == 0) {
+    bool traceFlag = false;
+    if (argc > 2 && strcmp(argv[2],"-trace") == 0)
+      traceFlag = true;
+    PerformanceMonitor::setOn(true, traceFlag);
+  }
+
+  else if (strcmp(argv[1],"-off") == 0) 
+    PerformanceMonitor::setOn(false);
+
+  else if (strcmp(argv[1],"-reset") == 0) 
+    PerformanceMonitor::reset();
+
+  else if (strcmp(argv[1],"-print") == 0) 
+    PerformanceMonitor::Print(opserr);
+
+  else if (strcmp(argv[1],"-trace") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING perfStats -trace fileName\n";
+      return TCL_ERROR;
+    }
+    if (PerformanceMonitor::writeTrace(argv[2]) < 0)
+      return TCL_ERROR;
+  }
+
+  else if (strcmp(argv[1],"-steps") == 0) {
+    int numSteps = PerformanceMonitor::getNumSteps();
+    for (int i=0; i<numSteps; i++) {
+      sprintf(buffer, "{%g %g} ", PerformanceMonitor::getStepWallTime(i), 
+	      PerformanceMonitor::getStepCPUTime(i));
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+  }
+
+  else if (strcmp(argv[1],"-elements") == 0) {
+    int numClasses = PerformanceMonitor::getNumElementClasses();
+    for (int i=0; i<numClasses; i++) {
+      const char *className;
+      int classTag, phase, numCalls;
+      double wallTime;
+      PerformanceMonitor::getElementClassData(i, className, classTag, phase, numCalls, wallTime);
+      sprintf(buffer, "{%.100s %d %s %d %g} ", className, classTag, 
+	      PerformanceMonitor::getPhaseName(phase), numCalls, wallTime);
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+  }
+
+  else {
+    opserr << "WARNING perfStats - unknown option " << argv[1] << endln;
+    opserr << " want: perfStats ?-on ?-trace?? ?-off? ?-reset? ?-print? ?-trace fileName? ?-steps? ?-elements?\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
 int
 version(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
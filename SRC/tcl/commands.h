@@ -233,6 +233,12 @@ rayleighDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
 int
 modalDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+parallelAssembly(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+superLUStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 setElementRayleighDampingFactors(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -285,6 +291,9 @@ numFact(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 numIter(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+perfStats(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 
 
 
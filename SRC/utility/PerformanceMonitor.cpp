@@ -0,0 +1,350 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/PerformanceMonitor.cpp,v $
+
+// File: ~/utility/PerformanceMonitor.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of 
+// PerformanceMonitor and PerformanceTimer.
+//
+// What: "@(#) PerformanceMonitor.cpp, revA"
+
+#include <PerformanceMonitor.h>
+#include <Timer.h>
+#include <Element.h>
+#include <ThreadPool.h>
+#include <stdio.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <map>
+
+#define PERF_MAX_TRACE_EVENTS 2000000
+
+bool PerformanceMonitor::on = false;
+bool PerformanceMonitor::costOn = false;
+
+static const char *phaseNames[PERF_NUM_PHASES] = {
+  "formTangent", "formUnbalance", "solve", "factor", "domainUpdate",
+  "domainCommit", "domainRecord", "test", "step"
+};
+
+static bool traceOn = false;
+static double timeOrigin = 0.0;
+
+static int phaseCalls[PERF_NUM_PHASES];
+static int phaseDepth[PERF_NUM_PHASES];
+static double phaseWall[PERF_NUM_PHASES];
+static double phaseCPU[PERF_NUM_PHASES];
+
+static std::vector<double> stepWall;
+static std::vector<double> stepCPU;
+
+struct PerformanceTraceEvent {
+  int phase;
+  double start;
+  double duration;
+};
+static std::vector<PerformanceTraceEvent> traceEvents;
+
+struct PerformanceElementData {
+  std::string className;
+  int classTag;
+  int phase;
+  int numCalls;
+  double wallTime;
+};
+static std::map<long, PerformanceElementData> elementData;
+
+static double
+getCPU(void)
+{
+  return (double)clock()/(double)CLOCKS_PER_SEC;
+}
+
+void
+PerformanceMonitor::setOn(bool onFlag, bool traceFlag)
+{
+  if (onFlag == true && on == false && timeOrigin == 0.0)
+    timeOrigin = Timer::getWallTime();
+
+  on = onFlag;
+  traceOn = (onFlag == true) ? traceFlag : false;
+}
+
+void
+PerformanceMonitor::setElementCostOn(bool onFlag)
+{
+  costOn = onFlag;
+}
+
+void
+PerformanceMonitor::reset(void)
+{
+  for (int i=0; i<PERF_NUM_PHASES; i++) {
+    phaseCalls[i] = 0;
+    phaseDepth[i] = 0;
+    phaseWall[i] = 0.0;
+    phaseCPU[i] = 0.0;
+  }
+  stepWall.clear();
+  stepCPU.clear();
+  traceEvents.clear();
+  elementData.clear();
+  timeOrigin = Timer::getWallTime();
+}
+
+const char *
+PerformanceMonitor::getPhaseName(int phase)
+{
+  if (phase < 0 || phase >= PERF_NUM_PHASES)
+    return 0;
+  return phaseNames[phase];
+}
+
+int
+PerformanceMonitor::getNumCalls(int phase)
+{
+  if (phase < 0 || phase >= PERF_NUM_PHASES)
+    return 0;
+  return phaseCalls[phase];
+}
+
+double
+PerformanceMonitor::getWallTime(int phase)
+{
+  if (phase < 0 || phase >= PERF_NUM_PHASES)
+    return 0.0;
+  return phaseWall[phase];
+}
+
+double
+PerformanceMonitor::getCPUTime(int phase)
+{
+  if (phase < 0 || phase >= PERF_NUM_PHASES)
+    return 0.0;
+  return phaseCPU[phase];
+}
+
+int
+PerformanceMonitor::getNumSteps(void)
+{
+  return stepWall.size();
+}
+
+double
+PerformanceMonitor::getStepWallTime(int step)
+{
+  if (step < 0 || step >= (int)stepWall.size())
+    return 0.0;
+  return stepWall[step];
+}
+
+double
+PerformanceMonitor::getStepCPUTime(int step)
+{
+  if (step < 0 || step >= (int)stepCPU.size())
+    return 0.0;
+  return stepCPU[step];
+}
+
+int
+PerformanceMonitor::getNumElementClasses(void)
+{
+  return elementData.size();
+}
+
+int
+PerformanceMonitor::getElementClassData(int i, const char *&className, int &classTag, 
+					int &phase, int &numCalls, double &wallTime)
+{
+  if (i < 0 || i >= (int)elementData.size())
+    return -1;
+
+  std::map<long, PerformanceElementData>::iterator theData = elementData.begin();
+  for (int j=0; j<i; j++)
+    theData++;
+
+  className = theData->second.className.c_str();
+  classTag = theData->second.classTag;
+  phase = theData->second.phase;
+  numCalls = theData->second.numCalls;
+  wallTime = theData->second.wallTime;
+
+  return 0;
+}
+
+bool
+PerformanceMonitor::start(int phase, double &wallStart, double &cpuStart)
+{
+  // only the outermost of nested calls is timed
+  if (phaseDepth[phase]++ != 0)
+    return false;
+
+  wallStart = Timer::getWallTime();
+  cpuStart = getCPU();
+  return true;
+}
+
+void
+PerformanceMonitor::stop(int phase, double wallStart, double cpuStart)
+{
+  double wall = Timer::getWallTime() - wallStart;
+  double cpu = getCPU() - cpuStart;
+
+  phaseDepth[phase] = 0;
+  phaseCalls[phase]++;
+  phaseWall[phase] += wall;
+  phaseCPU[phase] += cpu;
+
+  if (phase == PERF_STEP) {
+    stepWall.push_back(wall);
+    stepCPU.push_back(cpu);
+  }
+
+  if (traceOn == true) {
+    if (traceEvents.size() < PERF_MAX_TRACE_EVENTS) {
+      PerformanceTraceEvent theEvent;
+      theEvent.phase = phase;
+      theEvent.start = wallStart - timeOrigin;
+      theEvent.duration = wall;
+      traceEvents.push_back(theEvent);
+    } else if (traceEvents.size() == PERF_MAX_TRACE_EVENTS) {
+      opserr << "WARNING PerformanceMonitor - trace limited to " << PERF_MAX_TRACE_EVENTS << " events\n";
+      traceOn = false;
+    }
+  }
+}
+
+void
+PerformanceMonitor::addElement(int phase, Element *theEle, double wallTime)
+{
+  int classTag = theEle->getClassTag();
+  long key = (long)classTag * PERF_NUM_PHASES + phase;
+
+  std::map<long, PerformanceElementData>::iterator theData = elementData.find(key);
+  if (theData == elementData.end()) {
+    PerformanceElementData newData;
+    newData.className = theEle->getClassType();
+    newData.classTag = classTag;
+    newData.phase = phase;
+    newData.numCalls = 0;
+    newData.wallTime = 0.0;
+    theData = elementData.insert(std::make_pair(key, newData)).first;
+  }
+
+  theData->second.numCalls++;
+  theData->second.wallTime += wallTime;
+}
+
+int
+PerformanceMonitor::writeTrace(const char *fileName)
+{
+  FILE *theFile = fopen(fileName, "w");
+  if (theFile == 0) {
+    opserr << "WARNING PerformanceMonitor::writeTrace() - could not open file " << fileName << endln;
+    return -1;
+  }
+
+  // complete events, times in micro seconds
+  fprintf(theFile, "{\"traceEvents\":[\n");
+  int numEvents = traceEvents.size();
+  for (int i=0; i<numEvents; i++) {
+    PerformanceTraceEvent &theEvent = traceEvents[i];
+    fprintf(theFile, "{\"name\":\"%s\",\"cat\":\"analysis\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":0}%s\n",
+	    phaseNames[theEvent.phase], 1.0e6*theEvent.start, 1.0e6*theEvent.duration,
+	    (i < numEvents-1) ? "," : "");
+  }
+  fprintf(theFile, "],\"displayTimeUnit\":\"ms\"}\n");
+  fclose(theFile);
+
+  return 0;
+}
+
+void
+PerformanceMonitor::Print(OPS_Stream &s)
+{
+  s << "PerformanceMonitor: phase calls wall cpu\n";
+  for (int i=0; i<PERF_NUM_PHASES; i++) {
+    s << "  " << phaseNames[i] << " " << phaseCalls[i] << " " << phaseWall[i] << " " << phaseCPU[i] << endln;
+    if (i == PERF_FACTOR)
+      s << "  backSubstitute " << phaseCalls[PERF_SOLVE] << " " 
+	<< phaseWall[PERF_SOLVE] - phaseWall[PERF_FACTOR] << " " 
+	<< phaseCPU[PERF_SOLVE] - phaseCPU[PERF_FACTOR] << endln;
+  }
+
+  int numSteps = stepWall.size();
+  if (numSteps != 0) {
+    double maxWall = 0.0;
+    for (int i=0; i<numSteps; i++)
+      if (stepWall[i] > maxWall)
+	maxWall = stepWall[i];
+    s << "  steps: " << numSteps << " average wall " << phaseWall[PERF_STEP]/numSteps 
+      << " max wall " << maxWall << endln;
+  }
+
+  if (elementData.empty() == false) {
+    s << "PerformanceMonitor: element class, phase, calls, wall\n";
+    std::map<long, PerformanceElementData>::iterator theData;
+    for (theData = elementData.begin(); theData != elementData.end(); theData++)
+      s << "  " << theData->second.className.c_str() << " (" << theData->second.classTag << ") "
+	<< phaseNames[theData->second.phase] << " " << theData->second.numCalls << " " 
+	<< theData->second.wallTime << endln;
+  }
+}
+
+
+void
+PerformanceTimer::start(int phase)
+{
+  // the counters are not thread safe, work done by the worker threads
+  // of a ThreadPool is accounted for in the phase of the calling thread;
+  // the cost of an element is only ever updated by one thread
+  bool worker = ThreadPool::isWorkerThread();
+  if (theElement != 0) {
+    if (worker == false || PerformanceMonitor::isElementCostOn() == true) {
+      thePhase = phase;
+      wallStart = Timer::getWallTime();
+    } else
+      thePhase = -1;
+  } else if (worker == false && PerformanceMonitor::start(phase, wallStart, cpuStart) == true)
+    thePhase = phase;
+  else
+    thePhase = -1;
+}
+
+void
+PerformanceTimer::stop(void)
+{
+  if (theElement != 0) {
+    double wallTime = Timer::getWallTime() - wallStart;
+    if (PerformanceMonitor::isElementCostOn() == true)
+      theElement->addMeasuredCost(wallTime);
+    if (PerformanceMonitor::isOn() == true && ThreadPool::isWorkerThread() == false)
+      PerformanceMonitor::addElement(thePhase, theElement, wallTime);
+  } else
+    PerformanceMonitor::stop(thePhase, wallStart, cpuStart);
+}
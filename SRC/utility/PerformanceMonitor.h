@@ -0,0 +1,130 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/PerformanceMonitor.h,v $
+
+// File: ~/utility/PerformanceMonitor.h
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definitions for 
+// PerformanceMonitor and PerformanceTimer. The PerformanceMonitor 
+// accumulates the number of calls, wall and cpu time of the phases of 
+// an analysis (forming the tangent and unbalance, solving the equations,
+// updating, committing and recording the domain, testing for convergence
+// and the analysis steps) and the time spent in each class of element.
+// A PerformanceTimer times a phase over its scope; when the monitor is
+// off its only cost is the test of a static flag. Nested timers of the
+// same phase are counted once. If tracing is on the phases are also 
+// stored as events and can be written in the Chrome trace JSON format.
+// Independently of the monitor, the element timers can add the time
+// they measure to the cost of the element, see Element::getMeasuredCost().
+//
+// What: "@(#) PerformanceMonitor.h, revA"
+
+#ifndef PerformanceMonitor_h
+#define PerformanceMonitor_h
+
+#include <OPS_Globals.h>
+
+class Element;
+
+#define PERF_FORM_TANGENT     0
+#define PERF_FORM_UNBALANCE   1
+#define PERF_SOLVE            2
+#define PERF_FACTOR           3
+#define PERF_DOMAIN_UPDATE    4
+#define PERF_DOMAIN_COMMIT    5
+#define PERF_DOMAIN_RECORD    6
+#define PERF_TEST             7
+#define PERF_STEP             8
+#define PERF_NUM_PHASES       9
+
+class PerformanceMonitor
+{
+  public:
+    static inline bool isOn(void) {return on;}
+    static void setOn(bool onFlag, bool traceFlag = false);
+
+    // if on the element timers add to the measured cost of the elements
+    static inline bool isElementCostOn(void) {return costOn;}
+    static void setElementCostOn(bool onFlag);
+    static void reset(void);
+
+    // accumulated values of a phase, the back substitution is taken as
+    // the time of solve less that of factor
+    static const char *getPhaseName(int phase);
+    static int getNumCalls(int phase);
+    static double getWallTime(int phase);
+    static double getCPUTime(int phase);
+
+    // wall and cpu time of each analysis step
+    static int getNumSteps(void);
+    static double getStepWallTime(int step);
+    static double getStepCPUTime(int step);
+
+    // time spent in the elements of each class
+    static int getNumElementClasses(void);
+    static int getElementClassData(int i, const char *&className, int &classTag, 
+				   int &phase, int &numCalls, double &wallTime);
+
+    static int writeTrace(const char *fileName);
+    static void Print(OPS_Stream &s);
+
+  protected:
+    friend class PerformanceTimer;
+    static bool start(int phase, double &wallStart, double &cpuStart);
+    static void stop(int phase, double wallStart, double cpuStart);
+    static void addElement(int phase, Element *theEle, double wallTime);
+
+  private:
+    static bool on;
+    static bool costOn;
+};
+
+class PerformanceTimer
+{
+  public:
+    // times the phase
+    inline PerformanceTimer(int phase)
+      :thePhase(-1), theElement(0) 
+      {if (PerformanceMonitor::isOn() == true) this->start(phase);}
+    // times theEle in the phase, nothing is timed if theEle is 0
+    inline PerformanceTimer(int phase, Element *theEle)
+      :thePhase(-1), theElement(theEle) 
+      {if ((PerformanceMonitor::isOn() == true || PerformanceMonitor::isElementCostOn() == true) 
+	   && theEle != 0) this->start(phase);}
+    inline ~PerformanceTimer()
+      {if (thePhase >= 0) this->stop();}
+
+  private:
+    void start(int phase);
+    void stop(void);
+
+    int thePhase;
+    Element *theElement;
+    double wallStart;
+    double cpuStart;
+};
+
+#endif
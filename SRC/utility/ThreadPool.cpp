@@ -0,0 +1,271 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadPool.cpp,v $
+
+// File: ~/utility/ThreadPool.cpp
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the implementation of ThreadPool.
+//
+// What: "@(#) ThreadPool.cpp, revA"
+
+#include <ThreadPool.h>
+#include <OPS_Globals.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifndef _WIN32
+#ifdef OPS_HAVE_THREAD_LOCAL
+static OPS_THREAD_LOCAL bool workerThread = false;
+#else
+static pthread_key_t workerKey;
+static pthread_once_t workerKeyOnce = PTHREAD_ONCE_INIT;
+static void createWorkerKey(void)
+{
+  pthread_key_create(&workerKey, 0);
+}
+#endif
+#endif
+
+ThreadPool::ThreadPool(int numThr)
+  :numThreads(numThr)
+{
+  if (numThreads < 1)
+    numThreads = 1;
+
+#ifdef _WIN32
+  // no worker threads, execute() runs the task in the calling thread
+  numThreads = 1;
+#else
+  theThreads = 0;
+  theTask = 0;
+  numItems = 0;
+  chunkSize = 1;
+  nextItem = 0;
+  numBusy = 0;
+  generation = 0;
+  result = 0;
+  numStarted = 0;
+  shutdown = false;
+
+  pthread_mutex_init(&theMutex, 0);
+  pthread_cond_init(&startCond, 0);
+  pthread_cond_init(&doneCond, 0);
+
+  if (numThreads > 1) {
+    theThreads = new pthread_t[numThreads-1];
+    int numCreated = 0;
+    for (int i=0; i<numThreads-1; i++) {
+      if (pthread_create(&theThreads[i], 0, ThreadPool::workerMain, this) != 0) {
+	opserr << "WARNING ThreadPool::ThreadPool() - could only create ";
+	opserr << numCreated << " of " << numThreads-1 << " threads\n";
+	break;
+      }
+      numCreated++;
+    }
+    numThreads = numCreated + 1;
+  }
+#endif
+}
+
+ThreadPool::~ThreadPool()
+{
+#ifndef _WIN32
+  if (theThreads != 0) {
+    pthread_mutex_lock(&theMutex);
+    shutdown = true;
+    pthread_cond_broadcast(&startCond);
+    pthread_mutex_unlock(&theMutex);
+
+    for (int i=0; i<numThreads-1; i++)
+      pthread_join(theThreads[i], 0);
+
+    delete [] theThreads;
+  }
+
+  pthread_cond_destroy(&doneCond);
+  pthread_cond_destroy(&startCond);
+  pthread_mutex_destroy(&theMutex);
+#endif
+}
+
+int
+ThreadPool::getNumThreads(void) const
+{
+  return numThreads;
+}
+
+int
+ThreadPool::execute(ThreadTask &task, int num, int chunk)
+{
+  if (num <= 0)
+    return 0;
+
+  // quick return if there is nothing to share
+  if (numThreads == 1 || num == 1)
+    return task.run(0, num, 0);
+
+#ifdef _WIN32
+  return task.run(0, num, 0);
+#else
+  // by default hand out ~8 chunks per thread, enough to even out
+  // items of differing cost without contention on the mutex
+  if (chunk <= 0) {
+    chunk = num/(8*numThreads);
+    if (chunk < 1)
+      chunk = 1;
+  }
+
+  pthread_mutex_lock(&theMutex);
+  theTask = &task;
+  numItems = num;
+  chunkSize = chunk;
+  nextItem = 0;
+  result = 0;
+  numBusy = numThreads-1;
+  generation++;
+  pthread_cond_broadcast(&startCond);
+  pthread_mutex_unlock(&theMutex);
+
+  // the calling thread does its share
+  this->work(0);
+
+  pthread_mutex_lock(&theMutex);
+  while (numBusy > 0)
+    pthread_cond_wait(&doneCond, &theMutex);
+  theTask = 0;
+  int res = result;
+  pthread_mutex_unlock(&theMutex);
+
+  return res;
+#endif
+}
+
+int
+ThreadPool::getNumProcessors(void)
+{
+#ifdef _WIN32
+  SYSTEM_INFO sysInfo;
+  GetSystemInfo(&sysInfo);
+  return sysInfo.dwNumberOfProcessors;
+#else
+  int num = sysconf(_SC_NPROCESSORS_ONLN);
+  if (num < 1)
+    num = 1;
+  return num;
+#endif
+}
+
+bool
+ThreadPool::isWorkerThread(void)
+{
+#ifdef _WIN32
+  return false;
+#elif defined(OPS_HAVE_THREAD_LOCAL)
+  return workerThread;
+#else
+  pthread_once(&workerKeyOnce, createWorkerKey);
+  return pthread_getspecific(workerKey) != 0;
+#endif
+}
+
+#ifndef _WIN32
+int
+ThreadPool::work(int threadID)
+{
+  int res = 0;
+
+  while (true) {
+    pthread_mutex_lock(&theMutex);
+    int first = nextItem;
+    nextItem += chunkSize;
+    pthread_mutex_unlock(&theMutex);
+
+    if (first >= numItems)
+      break;
+
+    int last = first + chunkSize;
+    if (last > numItems)
+      last = numItems;
+
+    int ok = theTask->run(first, last, threadID);
+    if (ok < 0)
+      res = ok;
+  }
+
+  if (res < 0) {
+    pthread_mutex_lock(&theMutex);
+    if (result == 0)
+      result = res;
+    pthread_mutex_unlock(&theMutex);
+  }
+
+  return res;
+}
+
+void *
+ThreadPool::workerMain(void *arg)
+{
+  ThreadPool *thePool = (ThreadPool *)arg;
+
+  int lastGeneration = 0;
+
+#ifdef OPS_HAVE_THREAD_LOCAL
+  workerThread = true;
+#else
+  pthread_once(&workerKeyOnce, createWorkerKey);
+  pthread_setspecific(workerKey, thePool);
+#endif
+
+  // worker ids are 1 through numThreads-1, the calling thread is 0
+  pthread_mutex_lock(&thePool->theMutex);
+  int threadID = ++thePool->numStarted;
+
+  while (true) {
+    while (thePool->shutdown == false && thePool->generation == lastGeneration)
+      pthread_cond_wait(&thePool->startCond, &thePool->theMutex);
+
+    if (thePool->shutdown == true)
+      break;
+
+    lastGeneration = thePool->generation;
+    pthread_mutex_unlock(&thePool->theMutex);
+
+    thePool->work(threadID);
+
+    pthread_mutex_lock(&thePool->theMutex);
+    thePool->numBusy--;
+    if (thePool->numBusy == 0)
+      pthread_cond_signal(&thePool->doneCond);
+  }
+  pthread_mutex_unlock(&thePool->theMutex);
+
+  return 0;
+}
+#endif
@@ -0,0 +1,99 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026/10/17 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadPool.h,v $
+
+// File: ~/utility/ThreadPool.h
+//
+// Created: 10/2026
+// Revision: A
+//
+// Description: This file contains the class definitions for ThreadTask
+// and ThreadPool. A ThreadPool is a fixed set of worker threads that is
+// created once and then reused to execute ThreadTasks, a ThreadTask
+// being a loop over numItems independent items. The items are handed
+// out to the threads in chunks; the calling thread takes part in the
+// work and execute() returns only when all items have been processed.
+// On platforms without pthreads the task is executed by the calling
+// thread alone.
+//
+// What: "@(#) ThreadPool.h, revA"
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class ThreadTask
+{
+  public:
+    ThreadTask() {};
+    virtual ~ThreadTask() {};
+
+    // process items first <= i < last; threadID is in [0, numThreads)
+    // and can be used to index per thread storage. a negative return
+    // value is reported back as the result of ThreadPool::execute()
+    virtual int run(int first, int last, int threadID) =0;
+};
+
+class ThreadPool
+{
+  public:
+    ThreadPool(int numThreads);
+    ~ThreadPool();
+
+    int getNumThreads(void) const;
+    int execute(ThreadTask &theTask, int numItems, int chunkSize = 0);
+
+    static int getNumProcessors(void);
+
+    // true if called from one of the worker threads of any ThreadPool;
+    // used by code that is not thread safe to skip work (e.g. timing)
+    static bool isWorkerThread(void);
+
+  private:
+#ifndef _WIN32
+    static void *workerMain(void *thePool);
+    int work(int threadID);
+
+    pthread_t *theThreads;
+    pthread_mutex_t theMutex;
+    pthread_cond_t startCond;
+    pthread_cond_t doneCond;
+
+    ThreadTask *theTask;
+    int numItems;
+    int chunkSize;
+    int nextItem;      // next item to be handed out
+    int numBusy;       // number of workers still in the current task
+    int generation;    // incremented each time a new task is posted
+    int result;
+    int numStarted;    // used to hand out the worker ids
+    bool shutdown;
+#endif
+
+    int numThreads;   // including the calling thread
+};
+
+#endif
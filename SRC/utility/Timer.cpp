@@ -43,6 +43,8 @@ extern "C" int getrusage(int who, struct rusage *rusage);
 
 #ifdef _WIN32
 #include <Windows.h>
+#else
+#include <sys/time.h>
 #endif
 
 #ifndef CLK_TCK
@@ -131,6 +133,21 @@ Timer::getNumPageFaults(void) const
 #endif
 }    
 
+double
+Timer::getWallTime(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart/(double)freq.QuadPart;
+#else
+    struct timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + 1.0e-6*tv.tv_usec;
+#endif
+}
+
 
 
 void 
@@ -65,6 +65,9 @@ class Timer
     double getReal(void) const;
     double getCPU(void) const;
     int getNumPageFaults(void) const;
+
+    // wall clock time in seconds from an arbitrary origin
+    static double getWallTime(void);
     
     virtual void Print(OPS_Stream &s) const;   
     friend OPS_Stream &operator<<(OPS_Stream &s, const Timer &E);    